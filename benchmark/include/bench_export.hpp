@@ -0,0 +1,202 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Machine-readable export of the benchmark results
+ *
+ * When the ETL_BENCH_EXPORT environment variable is set, the time of each
+ * call of the benchmark sections is sampled and, at the end of the
+ * benchmark, the results are written in JSON to the file it names. The
+ * results of each section and size are summarized by their median and
+ * median absolute deviation (MAD), which are robust to the noise of the
+ * machine.
+ *
+ * The file contains the fingerprint of the machine and of the
+ * configuration, the comparison tool (bench_compare) only compares results
+ * with the same fingerprint. If the name of the file contains %f, it is
+ * replaced by the hash of the fingerprint.
+ */
+
+#pragma once
+
+#include "bench_stats.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace etl_bench {
+
+constexpr size_t bench_max_samples = 2048; ///< The maximum number of samples kept per section and size
+
+/*!
+ * \brief The sampled times of a section for a given size.
+ *
+ * The samples are kept with reservoir sampling, the median of the samples
+ * is therefore not biased towards the first or last calls.
+ */
+struct bench_samples {
+    size_t seen = 0;               ///< The number of calls
+    std::vector<uint64_t> samples; ///< The sampled times, in nanoseconds
+
+    /*!
+     * \brief Add the time of one call
+     * \param ns The time of the call, in nanoseconds
+     * \param generator The generator for the reservoir sampling
+     */
+    void add(uint64_t ns, std::minstd_rand& generator) {
+        ++seen;
+
+        if (samples.size() < bench_max_samples) {
+            samples.push_back(ns);
+        } else {
+            const size_t i = std::uniform_int_distribution<size_t>(0, seen - 1)(generator);
+
+            if (i < bench_max_samples) {
+                samples[i] = ns;
+            }
+        }
+    }
+};
+
+/*!
+ * \brief Returns the fingerprint of the machine and of the configuration
+ */
+inline std::string bench_fingerprint() {
+    std::string cpu = "unknown";
+
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+
+    while (std::getline(cpuinfo, line)) {
+        if (line.compare(0, 10, "model name") == 0) {
+            cpu = line.substr(line.find(':') + 2);
+            break;
+        }
+    }
+
+    std::ostringstream os;
+
+    os << "cpu=" << cpu
+       << ";hw_threads=" << std::thread::hardware_concurrency()
+       << ";compiler=" << __VERSION__
+       << ";vec=" << etl::vec_enabled << etl::vectorize_impl
+       << ";parallel=" << etl::is_parallel << etl::threads
+       << ";blas=" << etl::cblas_enabled << etl::cublas_enabled << etl::cudnn_enabled << etl::mkl_enabled;
+
+    return os.str();
+}
+
+/*!
+ * \brief Returns the hash of a fingerprint (FNV-1a, hexadecimal)
+ */
+inline std::string bench_fingerprint_hash(const std::string& fingerprint) {
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (unsigned char c : fingerprint) {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+
+    std::ostringstream os;
+    os << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return os.str();
+}
+
+/*!
+ * \brief The samples of all the sections, exported at the end of the benchmark
+ */
+struct bench_export {
+    const char* path = std::getenv("ETL_BENCH_EXPORT"); ///< The file to export to, nullptr to not export
+
+    std::map<std::pair<std::string, size_t>, bench_samples> results; ///< The samples by section and elements
+    std::minstd_rand generator;                                      ///< The generator of the reservoir sampling
+
+    /*!
+     * \brief Indicates if the results are exported
+     */
+    bool enabled() const {
+        return path && *path;
+    }
+
+    /*!
+     * \brief Returns the samples of the given section and size
+     */
+    bench_samples& get(const std::string& name, size_t elements) {
+        return results[std::make_pair(name, elements)];
+    }
+
+    ~bench_export() {
+        if (!enabled()) {
+            return;
+        }
+
+        const auto fingerprint = bench_fingerprint();
+        const auto hash        = bench_fingerprint_hash(fingerprint);
+
+        std::string file(path);
+
+        auto pos = file.find("%f");
+        if (pos != std::string::npos) {
+            file.replace(pos, 2, hash);
+        }
+
+        std::ofstream os(file);
+
+        if (!os) {
+            std::cerr << "Cannot export the benchmark results to " << file << std::endl;
+            return;
+        }
+
+        const char* revision = std::getenv("ETL_BENCH_REVISION");
+
+        os << "{\n\"fingerprint\": ";
+        etl::write_json_string(os, fingerprint);
+        os << ",\n\"hash\": \"" << hash << "\",\n\"revision\": ";
+        etl::write_json_string(os, revision ? revision : "");
+        os << ",\n\"results\": [";
+
+        bool first = true;
+
+        for (auto& entry : results) {
+            std::vector<double> values(entry.second.samples.begin(), entry.second.samples.end());
+
+            os << (first ? "\n" : ",\n") << "{\"name\": ";
+            etl::write_json_string(os, entry.first.first);
+            os << ", \"elements\": " << entry.first.second
+               << ", \"calls\": " << entry.second.seen
+               << ", \"samples\": " << values.size()
+               << ", \"median_ns\": " << bench_median(values)
+               << ", \"mad_ns\": " << bench_mad(values)
+               << ", \"min_ns\": " << (values.empty() ? 0.0 : *std::min_element(values.begin(), values.end())) << "}";
+
+            first = false;
+        }
+
+        os << "\n]\n}\n";
+
+        std::cout << "Benchmark results exported to " << file << std::endl;
+    }
+};
+
+/*!
+ * \brief Returns the export of the results
+ */
+inline bench_export& get_bench_export() {
+    static bench_export e;
+    return e;
+}
+
+} //end of namespace etl_bench
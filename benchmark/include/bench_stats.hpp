@@ -0,0 +1,63 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Robust statistics of the benchmark results, shared by the
+ * benchmark and the comparison tool
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "etl/util/json.hpp"
+
+namespace etl_bench {
+
+/*!
+ * \brief Returns the median of the given values
+ */
+inline double bench_median(std::vector<double> values) {
+    if (values.empty()) {
+        return 0.0;
+    }
+
+    const size_t n = values.size();
+
+    std::nth_element(values.begin(), values.begin() + n / 2, values.end());
+
+    const double upper = values[n / 2];
+
+    if (n % 2) {
+        return upper;
+    }
+
+    return 0.5 * (upper + *std::max_element(values.begin(), values.begin() + n / 2));
+}
+
+/*!
+ * \brief Returns the median absolute deviation of the given values around their median
+ */
+inline double bench_mad(const std::vector<double>& values) {
+    const double median = bench_median(values);
+
+    std::vector<double> deviations;
+    deviations.reserve(values.size());
+
+    for (auto value : values) {
+        deviations.push_back(std::abs(value - median));
+    }
+
+    return bench_median(deviations);
+}
+
+} //end of namespace etl_bench
@@ -20,6 +20,8 @@
 
 #include "cpm/cpm.hpp"
 
+#include "perf_counters.hpp"
+
 // Check if VEC can be benchmarked
 #ifdef ETL_VECTORIZE_IMPL
 #ifdef __AVX__
@@ -168,55 +170,55 @@ using small_kernel_policy_2d = NARY_POLICY(
     VALUES_POLICY(10, 15, 20, 25, 30, 35, 40));
 
 #ifdef TEST_STDFIX
-#define STDFIX_SECTION_FUNCTOR(name, ...) , CPM_SECTION_FUNCTOR(name, __VA_ARGS__)
+#define STDFIX_SECTION_FUNCTOR(name, ...) , PERF_SECTION_FUNCTOR(name, __VA_ARGS__)
 #else
 #define STDFIX_SECTION_FUNCTOR(name, ...)
 #endif
 
 #ifdef TEST_VEC
-#define VEC_SECTION_FUNCTOR(name, ...) , CPM_SECTION_FUNCTOR(name, __VA_ARGS__)
+#define VEC_SECTION_FUNCTOR(name, ...) , PERF_SECTION_FUNCTOR(name, __VA_ARGS__)
 #else
 #define VEC_SECTION_FUNCTOR(name, ...)
 #endif
 
 #ifdef TEST_SSE
-#define SSE_SECTION_FUNCTOR(name, ...) , CPM_SECTION_FUNCTOR(name, __VA_ARGS__)
+#define SSE_SECTION_FUNCTOR(name, ...) , PERF_SECTION_FUNCTOR(name, __VA_ARGS__)
 #else
 #define SSE_SECTION_FUNCTOR(name, ...)
 #endif
 
 #ifdef TEST_AVX
-#define AVX_SECTION_FUNCTOR(name, ...) , CPM_SECTION_FUNCTOR(name, __VA_ARGS__)
+#define AVX_SECTION_FUNCTOR(name, ...) , PERF_SECTION_FUNCTOR(name, __VA_ARGS__)
 #else
 #define AVX_SECTION_FUNCTOR(name, ...)
 #endif
 
 #ifdef TEST_MKL
-#define MKL_SECTION_FUNCTOR(name, ...) , CPM_SECTION_FUNCTOR(name, __VA_ARGS__)
+#define MKL_SECTION_FUNCTOR(name, ...) , PERF_SECTION_FUNCTOR(name, __VA_ARGS__)
 #else
 #define MKL_SECTION_FUNCTOR(name, ...)
 #endif
 
 #ifdef TEST_BLAS
-#define BLAS_SECTION_FUNCTOR(name, ...) , CPM_SECTION_FUNCTOR(name, __VA_ARGS__)
+#define BLAS_SECTION_FUNCTOR(name, ...) , PERF_SECTION_FUNCTOR(name, __VA_ARGS__)
 #else
 #define BLAS_SECTION_FUNCTOR(name, ...)
 #endif
 
 #ifdef TEST_CUBLAS
-#define CUBLAS_SECTION_FUNCTOR(name, ...) , CPM_SECTION_FUNCTOR(name, __VA_ARGS__)
+#define CUBLAS_SECTION_FUNCTOR(name, ...) , PERF_SECTION_FUNCTOR(name, __VA_ARGS__)
 #else
 #define CUBLAS_SECTION_FUNCTOR(name, ...)
 #endif
 
 #ifdef TEST_CUFFT
-#define CUFFT_SECTION_FUNCTOR(name, ...) , CPM_SECTION_FUNCTOR(name, __VA_ARGS__)
+#define CUFFT_SECTION_FUNCTOR(name, ...) , PERF_SECTION_FUNCTOR(name, __VA_ARGS__)
 #else
 #define CUFFT_SECTION_FUNCTOR(name, ...)
 #endif
 
 #ifdef TEST_CUDNN
-#define CUDNN_SECTION_FUNCTOR(name, ...) , CPM_SECTION_FUNCTOR(name, __VA_ARGS__)
+#define CUDNN_SECTION_FUNCTOR(name, ...) , PERF_SECTION_FUNCTOR(name, __VA_ARGS__)
 #else
 #define CUDNN_SECTION_FUNCTOR(name, ...)
 #endif
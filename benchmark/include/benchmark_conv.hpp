@@ -268,11 +268,11 @@ using imagenet_gradients_policy = NARY_POLICY(
     );
 
 #define CONV4_BENCH(Name, Policy, Function) \
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF(Name, Policy, \
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF(Name, Policy, \
     FLOPS([](size_t n, size_t k, size_t c, size_t i, size_t w){ return 2 * n * k * c * i * i * w * w; }), \
     CPM_SECTION_INIT([](size_t n, size_t k, size_t c, size_t i, size_t w){ \
         return std::make_tuple(smat4(n, c, i, i), smat4(k, c, w, w), smat4(n, k, i - w + 1, i - w + 1)); }), \
-    CPM_SECTION_FUNCTOR("default", [](smat4& a, smat4& b, smat4& r){ r = Function(a, b); }) \
+    PERF_SECTION_FUNCTOR("default", [](smat4& a, smat4& b, smat4& r){ r = Function(a, b); }) \
     STDFIX_SECTION_FUNCTOR("std", [](smat4& a, smat4& b, smat4& r){ r = selected_helper(etl::conv4_impl::STD, Function(a, b)); }) \
     VEC_SECTION_FUNCTOR("vec", [](smat4& a, smat4& b, smat4& r){ r = selected_helper(etl::conv4_impl::VEC, Function(a, b)); }) \
     VEC_SECTION_FUNCTOR("blas_vec", [](smat4& a, smat4& b, smat4& r){ r = selected_helper(etl::conv4_impl::BLAS_VEC, Function(a, b)); }) \
@@ -0,0 +1,434 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Hardware performance counters of the benchmark sections
+ *
+ * When ETL_BENCH_PERF is defined (Linux only), each benchmark section
+ * declared with PERF_SECTION_FUNCTOR is measured with perf_event_open:
+ * cycles, instructions, L1 data cache misses and last level cache misses.
+ * At the end of the benchmark, a report is printed with the IPC, the L1
+ * and LLC misses per element and the memory bandwidth achieved (LLC misses
+ * times the cache line size, per second).
+ *
+ * The counters only measure the benchmark thread, the parallel sections
+ * should be measured with ETL_PARALLEL disabled.
+ *
+ * If the counters cannot be opened (perf_event_paranoid, containers,
+ * virtual machines), the sections are run without counters and the reason
+ * is printed in the report.
+ *
+ * The same wrapper also samples the time of the calls of the sections for
+ * the export of the results (see bench_export.hpp).
+ *
+ * The sections are identified by the name of their benchmark and their own
+ * name, so that the results can be compared between revisions even when
+ * the benchmarks are moved. The benchmarks with measured sections must be
+ * declared with the PERF_DIRECT_SECTION_* macros, which record the name of
+ * the benchmark when its data is initialized.
+ */
+
+#pragma once
+
+#include "bench_export.hpp"
+
+#ifdef ETL_BENCH_PERF
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+namespace etl_bench {
+
+constexpr size_t perf_cache_line = 64; ///< The size of a cache line, for the bandwidth
+
+#ifdef ETL_BENCH_PERF
+
+/*!
+ * \brief The hardware counters of the benchmark thread.
+ *
+ * The counters are opened as one group, read at once, and left running.
+ */
+struct perf_counters {
+    static constexpr size_t N = 4; ///< The number of counters
+
+    std::array<int, N> fds;      ///< The file descriptors of the counters (-1 if not available)
+    std::string error;           ///< The reason why the counters are not available
+
+    perf_counters() {
+        fds.fill(-1);
+
+        const std::array<std::pair<uint32_t, uint64_t>, N> events{{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}
+        }};
+
+        for (size_t i = 0; i < N; ++i) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+
+            attr.size           = sizeof(attr);
+            attr.type           = events[i].first;
+            attr.config         = events[i].second;
+            attr.disabled       = i == 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_GROUP;
+
+            fds[i] = syscall(SYS_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fds[0], 0);
+
+            if (fds[i] < 0 && i == 0) {
+                error = std::string("perf_event_open: ") + std::strerror(errno);
+                return;
+            }
+        }
+
+        ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    perf_counters(const perf_counters& rhs) = delete;
+    perf_counters& operator=(const perf_counters& rhs) = delete;
+
+    ~perf_counters() {
+        for (auto fd : fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    /*!
+     * \brief Indicates if the counters are available
+     */
+    bool available() const {
+        return fds[0] >= 0;
+    }
+
+    /*!
+     * \brief Indicates if the given counter is available
+     */
+    bool available(size_t i) const {
+        return fds[i] >= 0;
+    }
+
+    /*!
+     * \brief Read the current values of the counters
+     */
+    std::array<uint64_t, N> read() const {
+        // Layout of a group read: nr followed by the values in the order of the group
+        std::array<uint64_t, N + 1> buffer{};
+        std::array<uint64_t, N> values{};
+
+        if (::read(fds[0], buffer.data(), sizeof(buffer)) > 0) {
+            for (size_t i = 0, j = 1; i < N && j <= buffer[0]; ++i) {
+                if (fds[i] >= 0) {
+                    values[i] = buffer[j++];
+                }
+            }
+        }
+
+        return values;
+    }
+};
+
+#else
+
+/*!
+ * \brief The hardware counters (disabled)
+ */
+struct perf_counters {
+    static constexpr size_t N = 4; ///< The number of counters
+
+    std::string error; ///< The reason why the counters are not available (none, not enabled)
+
+    /*!
+     * \brief Indicates if the counters are available
+     */
+    bool available() const {
+        return false;
+    }
+
+    /*!
+     * \brief Indicates if the given counter is available
+     */
+    bool available(size_t /*i*/) const {
+        return false;
+    }
+
+    /*!
+     * \brief Read the current values of the counters
+     */
+    std::array<uint64_t, N> read() const {
+        return {};
+    }
+};
+
+#endif
+
+/*!
+ * \brief The counters of the benchmark thread
+ */
+inline perf_counters& get_perf_counters() {
+    static perf_counters counters;
+    return counters;
+}
+
+/*!
+ * \brief The accumulated counters of a section for a given size
+ */
+struct perf_record {
+    size_t calls    = 0;         ///< The number of calls
+    size_t elements = 0;         ///< The number of elements of the arguments
+    size_t ns       = 0;         ///< The total time, in nanoseconds
+    std::array<uint64_t, perf_counters::N> counts{}; ///< The total of the counters
+};
+
+/*!
+ * \brief The report of all the sections, printed at the end of the benchmark
+ */
+struct perf_report {
+    std::map<std::pair<std::string, size_t>, perf_record> records; ///< The records by section and elements
+
+    ~perf_report() {
+        auto& counters = get_perf_counters();
+
+        if (!counters.available()) {
+            if (!counters.error.empty()) {
+                std::cout << "\nHardware counters: not available (" << counters.error << ")" << std::endl;
+            }
+
+            return;
+        }
+
+        std::cout << "\nHardware counters\n" << std::left << std::setw(48) << "section" << std::right << std::setw(12) << "elements" << std::setw(10) << "calls"
+                  << std::setw(8) << "IPC" << std::setw(14) << "L1 miss/elem" << std::setw(14) << "LLC miss/elem" << std::setw(10) << "GB/s" << "\n";
+
+        auto per_element = [&counters](const perf_record& record, size_t i) {
+            std::ostringstream os;
+
+            if (!counters.available(i) || !record.elements) {
+                os << "-";
+            } else {
+                os << std::fixed << std::setprecision(3) << double(record.counts[i]) / (record.calls * record.elements);
+            }
+
+            return os.str();
+        };
+
+        for (auto& entry : records) {
+            auto& record = entry.second;
+
+            const double ipc = record.counts[0] ? double(record.counts[1]) / record.counts[0] : 0.0;
+            const double gbs = record.ns ? double(record.counts[3] * perf_cache_line) / record.ns : 0.0;
+
+            std::cout << std::left << std::setw(48) << entry.first.first << std::right << std::setw(12) << record.elements << std::setw(10)
+                      << record.calls << std::setw(8) << std::fixed << std::setprecision(2) << ipc << std::setw(14) << per_element(record, 2)
+                      << std::setw(14) << per_element(record, 3) << std::setw(10) << gbs << "\n";
+        }
+
+        std::cout << std::flush;
+    }
+};
+
+/*!
+ * \brief Returns the report of the sections
+ */
+inline perf_report& get_perf_report() {
+    static perf_report report;
+    return report;
+}
+
+/*!
+ * \brief Returns the number of elements of an argument of a section
+ */
+template <typename T, std::enable_if_t<etl::is_etl_expr<std::decay_t<T>>::value, int> = 0>
+size_t perf_elements(const T& value) {
+    return etl::size(value);
+}
+
+/*!
+ * \brief Returns the number of elements of an argument of a section (not an ETL expression)
+ */
+template <typename T, std::enable_if_t<!etl::is_etl_expr<std::decay_t<T>>::value, int> = 0>
+size_t perf_elements(const T& /*value*/) {
+    return 0;
+}
+
+/*!
+ * \brief Returns the name of the benchmark being run
+ */
+inline const char*& perf_current_benchmark() {
+    static const char* name = "";
+    return name;
+}
+
+/*!
+ * \brief The init functor of a benchmark with measured sections, recording
+ * the name of the benchmark before its data is initialized
+ */
+template <typename Init>
+struct perf_init_functor {
+    const char* name; ///< The name of the benchmark
+    Init init;        ///< The init functor
+
+    /*!
+     * \brief Record the name of the benchmark and initialize its data
+     */
+    template <typename... Args>
+    auto operator()(Args&&... args) -> decltype(init(std::forward<Args>(args)...)) {
+        perf_current_benchmark() = name;
+        return init(std::forward<Args>(args)...);
+    }
+};
+
+/*!
+ * \brief Wrap the init functor of a benchmark to record its name
+ * \param name The name of the benchmark
+ * \param init The init functor
+ */
+template <typename Init>
+perf_init_functor<std::decay_t<Init>> perf_benchmark_init(const char* name, Init&& init) {
+    return {name, std::forward<Init>(init)};
+}
+
+/*!
+ * \brief A section functor measured with the hardware counters and
+ * sampled for the export of the results
+ */
+template <typename Functor>
+struct perf_section_functor {
+    const char* section; ///< The name of the section
+    Functor fun;         ///< The section functor
+
+    std::string name;                     ///< The name of the benchmark and of the section
+    const char* last_benchmark = nullptr; ///< The benchmark of the previous call
+    size_t last_elements       = size_t(-1); ///< The number of elements of the previous call
+    perf_record* record        = nullptr;    ///< The record of the previous number of elements
+    bench_samples* samples     = nullptr;    ///< The samples of the previous number of elements
+
+    /*!
+     * \brief Call the functor and accumulate the counters and the samples
+     */
+    template <typename... Args>
+    auto operator()(Args&&... args) -> decltype(fun(std::forward<Args>(args)...)) {
+        auto& counters = get_perf_counters();
+        auto& results  = get_bench_export();
+
+        if (!counters.available() && !results.enabled()) {
+            return fun(std::forward<Args>(args)...);
+        }
+
+        size_t elements = 0;
+
+        for (size_t n : {size_t(0), perf_elements(args)...}) {
+            elements += n;
+        }
+
+        // The sizes only change between the benchmarks, not between the calls
+        if (elements != last_elements || perf_current_benchmark() != last_benchmark) {
+            if (perf_current_benchmark() != last_benchmark) {
+                last_benchmark = perf_current_benchmark();
+                name           = std::string(last_benchmark) + " / " + section;
+            }
+
+            last_elements = elements;
+            record        = counters.available() ? &get_perf_report().records[std::make_pair(name, elements)] : nullptr;
+            samples       = results.enabled() ? &results.get(name, elements) : nullptr;
+        }
+        // The result, if any, is discarded by the CPM sections
+        struct guard {
+            perf_counters& counters;
+            perf_record* record;
+            bench_samples* samples;
+            std::minstd_rand& generator;
+            size_t elements;
+            std::array<uint64_t, perf_counters::N> before;
+            std::chrono::steady_clock::time_point start;
+
+            ~guard() {
+                auto end   = std::chrono::steady_clock::now();
+                auto after = record ? counters.read() : before;
+                auto ns    = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+                if (samples) {
+                    samples->add(ns, generator);
+                }
+
+                if (record) {
+                    ++record->calls;
+                    record->elements = elements;
+                    record->ns += ns;
+
+                    for (size_t i = 0; i < perf_counters::N; ++i) {
+                        record->counts[i] += after[i] - before[i];
+                    }
+                }
+            }
+        } g{counters, record, samples, results.generator, elements, record ? counters.read() : std::array<uint64_t, perf_counters::N>{}, std::chrono::steady_clock::now()};
+
+        return fun(std::forward<Args>(args)...);
+    }
+};
+
+/*!
+ * \brief Wrap a section functor to measure it with the hardware counters
+ * and to sample it for the export of the results
+ * \param name The name of the section
+ * \param fun The section functor
+ */
+template <typename Functor>
+perf_section_functor<std::decay_t<Functor>> perf_section(const char* name, Functor&& fun) {
+    // The report must be destroyed (printed) before the counters
+    get_perf_counters();
+    get_perf_report();
+    get_bench_export();
+
+    return {name, std::forward<Functor>(fun)};
+}
+
+} //end of namespace etl_bench
+
+/*!
+ * \brief Declare a CPM section functor measured with the hardware counters
+ * and sampled for the export of the results
+ */
+#define PERF_SECTION_FUNCTOR(name, ...) CPM_SECTION_FUNCTOR(name, etl_bench::perf_section(name, __VA_ARGS__))
+
+/*!
+ * \brief Declare a CPM direct section benchmark (policy and flops) whose
+ * sections are measured with PERF_SECTION_FUNCTOR
+ */
+#define PERF_DIRECT_SECTION_TWO_PASS_NS_PF(name, policy, flops, init, ...) \
+    CPM_DIRECT_SECTION_TWO_PASS_NS_PF(name, policy, flops, etl_bench::perf_benchmark_init(name, init), __VA_ARGS__)
+
+/*!
+ * \brief Declare a CPM direct section benchmark (policy) whose sections are
+ * measured with PERF_SECTION_FUNCTOR
+ */
+#define PERF_DIRECT_SECTION_TWO_PASS_NS_P(name, policy, init, ...) \
+    CPM_DIRECT_SECTION_TWO_PASS_NS_P(name, policy, etl_bench::perf_benchmark_init(name, init), __VA_ARGS__)
+
+/*!
+ * \brief Declare a CPM direct section benchmark (flops) whose sections are
+ * measured with PERF_SECTION_FUNCTOR
+ */
+#define PERF_DIRECT_SECTION_TWO_PASS_NS_F(name, flops, init, ...) \
+    CPM_DIRECT_SECTION_TWO_PASS_NS_F(name, flops, etl_bench::perf_benchmark_init(name, init), __VA_ARGS__)
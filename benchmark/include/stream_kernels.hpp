@@ -0,0 +1,273 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Hand-written STREAM kernels (copy, scale, add and triad), used as
+ * the reference of the elementwise expressions.
+ *
+ * The kernels use the widest intrinsics enabled at compile-time (AVX, SSE2
+ * or plain loops) with unaligned loads and regular stores, like the
+ * vectorized evaluator of ETL. The bytes are counted as in STREAM: one read
+ * or write per array element, without the write-allocate traffic.
+ */
+
+#pragma once
+
+#include <cstring>
+
+#include <immintrin.h>
+
+namespace etl_bench {
+
+/*!
+ * \brief The STREAM kernels
+ */
+enum class stream_kernel {
+    COPY,  ///< a = b
+    SCALE, ///< a = s * b
+    ADD,   ///< a = b + c
+    TRIAD  ///< a = b + s * c
+};
+
+/*!
+ * \brief Returns the name of the given STREAM kernel
+ */
+inline const char* stream_name(stream_kernel kernel) {
+    switch (kernel) {
+        case stream_kernel::COPY:
+            return "copy";
+        case stream_kernel::SCALE:
+            return "scale";
+        case stream_kernel::ADD:
+            return "add";
+        case stream_kernel::TRIAD:
+            return "triad";
+    }
+
+    return "unknown";
+}
+
+/*!
+ * \brief Returns the number of bytes moved by a STREAM kernel on n doubles
+ */
+inline size_t stream_bytes(stream_kernel kernel, size_t n) {
+    return (kernel == stream_kernel::COPY || kernel == stream_kernel::SCALE ? 2 : 3) * n * sizeof(double);
+}
+
+/*!
+ * \brief Returns the name of the intrinsics used by the hand-written kernels
+ */
+inline const char* stream_intrinsics() {
+#if defined(__AVX__)
+    return "avx";
+#elif defined(__SSE2__)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+#if defined(__AVX__)
+
+using stream_vec = __m256d; ///< The vector type of the kernels
+
+constexpr size_t stream_width = 4; ///< The number of doubles per vector
+
+/*!
+ * \brief Load a vector from memory
+ */
+inline stream_vec stream_load(const double* in) {
+    return _mm256_loadu_pd(in);
+}
+
+/*!
+ * \brief Store a vector to memory
+ */
+inline void stream_store(double* out, stream_vec v) {
+    _mm256_storeu_pd(out, v);
+}
+
+/*!
+ * \brief Broadcast a scalar to a vector
+ */
+inline stream_vec stream_set(double s) {
+    return _mm256_set1_pd(s);
+}
+
+/*!
+ * \brief Add two vectors
+ */
+inline stream_vec stream_add(stream_vec lhs, stream_vec rhs) {
+    return _mm256_add_pd(lhs, rhs);
+}
+
+/*!
+ * \brief Multiply two vectors
+ */
+inline stream_vec stream_mul(stream_vec lhs, stream_vec rhs) {
+    return _mm256_mul_pd(lhs, rhs);
+}
+
+#elif defined(__SSE2__)
+
+using stream_vec = __m128d; ///< The vector type of the kernels
+
+constexpr size_t stream_width = 2; ///< The number of doubles per vector
+
+/*!
+ * \brief Load a vector from memory
+ */
+inline stream_vec stream_load(const double* in) {
+    return _mm_loadu_pd(in);
+}
+
+/*!
+ * \brief Store a vector to memory
+ */
+inline void stream_store(double* out, stream_vec v) {
+    _mm_storeu_pd(out, v);
+}
+
+/*!
+ * \brief Broadcast a scalar to a vector
+ */
+inline stream_vec stream_set(double s) {
+    return _mm_set1_pd(s);
+}
+
+/*!
+ * \brief Add two vectors
+ */
+inline stream_vec stream_add(stream_vec lhs, stream_vec rhs) {
+    return _mm_add_pd(lhs, rhs);
+}
+
+/*!
+ * \brief Multiply two vectors
+ */
+inline stream_vec stream_mul(stream_vec lhs, stream_vec rhs) {
+    return _mm_mul_pd(lhs, rhs);
+}
+
+#else
+
+using stream_vec = double; ///< The vector type of the kernels
+
+constexpr size_t stream_width = 1; ///< The number of doubles per vector
+
+/*!
+ * \brief Load a vector from memory
+ */
+inline stream_vec stream_load(const double* in) {
+    return *in;
+}
+
+/*!
+ * \brief Store a vector to memory
+ */
+inline void stream_store(double* out, stream_vec v) {
+    *out = v;
+}
+
+/*!
+ * \brief Broadcast a scalar to a vector
+ */
+inline stream_vec stream_set(double s) {
+    return s;
+}
+
+/*!
+ * \brief Add two vectors
+ */
+inline stream_vec stream_add(stream_vec lhs, stream_vec rhs) {
+    return lhs + rhs;
+}
+
+/*!
+ * \brief Multiply two vectors
+ */
+inline stream_vec stream_mul(stream_vec lhs, stream_vec rhs) {
+    return lhs * rhs;
+}
+
+#endif
+
+/*!
+ * \brief Run a STREAM kernel with the hand-written intrinsics on [first, last)
+ * \param kernel The kernel to run
+ * \param a The output array
+ * \param b The first input array
+ * \param c The second input array (add and triad)
+ * \param s The scalar (scale and triad)
+ */
+inline void stream_run(stream_kernel kernel, double* a, const double* b, const double* c, double s, size_t first, size_t last) {
+    constexpr size_t W = stream_width;
+
+    const auto vs = stream_set(s);
+
+    size_t i = first;
+
+    switch (kernel) {
+        case stream_kernel::COPY:
+            for (; i + 2 * W - 1 < last; i += 2 * W) {
+                stream_store(a + i, stream_load(b + i));
+                stream_store(a + i + W, stream_load(b + i + W));
+            }
+
+            for (; i < last; ++i) {
+                a[i] = b[i];
+            }
+
+            break;
+
+        case stream_kernel::SCALE:
+            for (; i + 2 * W - 1 < last; i += 2 * W) {
+                stream_store(a + i, stream_mul(vs, stream_load(b + i)));
+                stream_store(a + i + W, stream_mul(vs, stream_load(b + i + W)));
+            }
+
+            for (; i < last; ++i) {
+                a[i] = s * b[i];
+            }
+
+            break;
+
+        case stream_kernel::ADD:
+            for (; i + 2 * W - 1 < last; i += 2 * W) {
+                stream_store(a + i, stream_add(stream_load(b + i), stream_load(c + i)));
+                stream_store(a + i + W, stream_add(stream_load(b + i + W), stream_load(c + i + W)));
+            }
+
+            for (; i < last; ++i) {
+                a[i] = b[i] + c[i];
+            }
+
+            break;
+
+        case stream_kernel::TRIAD:
+            for (; i + 2 * W - 1 < last; i += 2 * W) {
+                stream_store(a + i, stream_add(stream_load(b + i), stream_mul(vs, stream_load(c + i))));
+                stream_store(a + i + W, stream_add(stream_load(b + i + W), stream_mul(vs, stream_load(c + i + W))));
+            }
+
+            for (; i < last; ++i) {
+                a[i] = b[i] + s * c[i];
+            }
+
+            break;
+    }
+}
+
+/*!
+ * \brief Copy [first, last) with memcpy, the reference of the copy kernel
+ */
+inline void stream_memcpy(double* a, const double* b, size_t first, size_t last) {
+    std::memcpy(a + first, b + first, (last - first) * sizeof(double));
+}
+
+} //end of namespace etl_bench
@@ -0,0 +1,349 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Training steps of small neural networks (MLP, CNN and LSTM),
+ * written with the public expression API.
+ *
+ * Each network holds its weights, its gradients and the buffers of one
+ * mini-batch. A training step runs the forward pass, the backward pass and
+ * the SGD update on a mini-batch of inputs. Each operation of the step is run through a timer functor,
+ * called with the name of the operation and a functor running it, so that
+ * the share of time per operation can be measured. The null_timer simply
+ * runs the operation.
+ */
+
+#pragma once
+
+#include "etl/etl.hpp"
+
+namespace etl_bench {
+
+/*!
+ * \brief A timer running the operations without measuring them
+ */
+struct null_timer {
+    /*!
+     * \brief Run the given operation
+     * \param name The name of the operation
+     * \param op The operation
+     */
+    template <typename Op>
+    void operator()(const char* name, Op&& op) {
+        (void)name;
+        op();
+    }
+};
+
+/*!
+ * \brief Multi-Layer Perceptron: dense-sigmoid-dense-softmax, trained with
+ * the cross-entropy loss
+ */
+template <typename T>
+struct mlp {
+    using mat = etl::dyn_matrix<T>; ///< The type of the matrices
+    using vec = etl::dyn_vector<T>; ///< The type of the vectors
+
+    const size_t B; ///< The size of the mini-batch
+
+    mat y;  ///< The one-hot labels
+    mat w1; ///< The weights of the hidden layer
+    vec b1; ///< The biases of the hidden layer
+    mat w2; ///< The weights of the output layer
+    vec b2; ///< The biases of the output layer
+
+    mat h;  ///< The activations of the hidden layer
+    mat o;  ///< The activations of the output layer
+    mat d1; ///< The errors of the hidden layer
+    mat d2; ///< The errors of the output layer
+
+    mat gw1; ///< The gradients of w1
+    vec gb1; ///< The gradients of b1
+    mat gw2; ///< The gradients of w2
+    vec gb2; ///< The gradients of b2
+
+    T lr = 0.1; ///< The learning rate
+
+    /*!
+     * \brief Create a MLP with the given sizes, with random weights
+     * \param B The size of the mini-batch
+     * \param I The number of inputs
+     * \param H The number of hidden units
+     * \param O The number of outputs
+     */
+    mlp(size_t B, size_t I, size_t H, size_t O)
+            : B(B), y(B, O, T(0)), w1(I, H), b1(H, T(0)), w2(H, O), b2(O, T(0)), h(B, H), o(B, O), d1(B, H), d2(B, O), gw1(I, H), gb1(H), gw2(H, O), gb2(O) {
+        w1 = etl::normal_generator<T>(0.0, 0.01);
+        w2 = etl::normal_generator<T>(0.0, 0.01);
+
+        for (size_t i = 0; i < B; ++i) {
+            y(i, i % O) = T(1);
+        }
+    }
+
+    /*!
+     * \brief Run one training step on the given mini-batch
+     * \param x The inputs of the mini-batch
+     * \param timer The timer of the operations
+     */
+    template <typename X, typename Timer>
+    void step(const X& x, Timer&& timer) {
+        // Forward
+
+        timer("dense", [&] { h = etl::sigmoid(x * w1 + etl::rep_l(b1, B)); });
+        timer("dense", [&] { o = h * w2 + etl::rep_l(b2, B); });
+        timer("softmax", [&] {
+            for (size_t i = 0; i < B; ++i) {
+                o(i) = etl::stable_softmax(o(i));
+            }
+        });
+
+        // Backward
+
+        timer("loss", [&] { d2 = o - y; });
+        timer("dense backward", [&] { d1 = (d2 * etl::transpose(w2)) >> etl::sigmoid_derivative(h); });
+        timer("gradients", [&] {
+            gw2 = etl::transpose(h) * d2;
+            gb2 = etl::sum_l(d2);
+            gw1 = etl::transpose(x) * d1;
+            gb1 = etl::sum_l(d1);
+        });
+
+        // Update (the gradients are summed over the mini-batch)
+
+        timer("sgd", [&] {
+            w1 -= (lr / B) * gw1;
+            b1 -= (lr / B) * gb1;
+            w2 -= (lr / B) * gw2;
+            b2 -= (lr / B) * gb2;
+        });
+    }
+};
+
+/*!
+ * \brief Convolutional network: conv-relu-pool-dense-softmax, trained with
+ * the cross-entropy loss
+ */
+template <typename T>
+struct cnn {
+    using mat  = etl::dyn_matrix<T>;    ///< The type of the matrices
+    using mat4 = etl::dyn_matrix<T, 4>; ///< The type of the 4D matrices
+    using vec  = etl::dyn_vector<T>;    ///< The type of the vectors
+
+    const size_t B;  ///< The size of the mini-batch
+    const size_t K;  ///< The number of filters
+    const size_t NP; ///< The size of the pooled feature maps
+
+    mat y;   ///< The one-hot labels
+    mat4 wc; ///< The filters of the convolutional layer
+    vec bc;  ///< The biases of the convolutional layer
+    mat wd;  ///< The weights of the dense layer
+    vec bd;  ///< The biases of the dense layer
+
+    mat4 c; ///< The activations of the convolutional layer
+    mat4 p; ///< The activations of the pooling layer
+    mat o;  ///< The activations of the dense layer
+    mat dd; ///< The errors of the dense layer
+    mat dp; ///< The errors of the pooling layer (flat)
+    mat4 dc; ///< The errors of the convolutional layer
+
+    mat4 gwc; ///< The gradients of wc
+    vec gbc;  ///< The gradients of bc (mean over the mini-batch)
+    mat gwd;  ///< The gradients of wd
+    vec gbd;  ///< The gradients of bd
+
+    T lr = 0.1; ///< The learning rate
+
+    /*!
+     * \brief Create a CNN with the given sizes, with random weights
+     * \param B The size of the mini-batch
+     * \param C The number of channels of the images
+     * \param N The size of the (square) images
+     * \param K The number of filters
+     * \param NF The size of the (square) filters
+     * \param O The number of outputs
+     */
+    cnn(size_t B, size_t C, size_t N, size_t K, size_t NF, size_t O)
+            : B(B), K(K), NP((N - NF + 1) / 2),
+              y(B, O, T(0)), wc(K, C, NF, NF), bc(K, T(0)), wd(K * NP * NP, O), bd(O, T(0)),
+              c(B, K, N - NF + 1, N - NF + 1), p(B, K, NP, NP), o(B, O), dd(B, O), dp(B, K * NP * NP), dc(B, K, N - NF + 1, N - NF + 1),
+              gwc(K, C, NF, NF), gbc(K), gwd(K * NP * NP, O), gbd(O) {
+        wc = etl::normal_generator<T>(0.0, 0.01);
+        wd = etl::normal_generator<T>(0.0, 0.01);
+
+        for (size_t i = 0; i < B; ++i) {
+            y(i, i % O) = T(1);
+        }
+    }
+
+    /*!
+     * \brief Run one training step on the given mini-batch
+     * \param x The inputs of the mini-batch
+     * \param timer The timer of the operations
+     */
+    template <typename X, typename Timer>
+    void step(const X& x, Timer&& timer) {
+        // Forward
+
+        timer("conv", [&] { c = etl::conv_4d_valid_flipped(x, wc); });
+        timer("bias relu", [&] {
+            auto b_rep = etl::force_temporary(etl::rep(bc, etl::dim<2>(c), etl::dim<3>(c)));
+
+            for (size_t i = 0; i < B; ++i) {
+                c(i) = etl::relu(c(i) + b_rep);
+            }
+        });
+        timer("pool", [&] { p = etl::max_pool_2d<2, 2>(c); });
+        timer("dense", [&] { o = etl::reshape(p, B, K * NP * NP) * wd + etl::rep_l(bd, B); });
+        timer("softmax", [&] {
+            for (size_t i = 0; i < B; ++i) {
+                o(i) = etl::stable_softmax(o(i));
+            }
+        });
+
+        // Backward
+
+        timer("loss", [&] { dd = o - y; });
+        timer("dense backward", [&] { dp = dd * etl::transpose(wd); });
+        timer("pool backward", [&] {
+            dc = etl::max_pool_upsample_2d<2, 2>(c, p, etl::reshape(dp, B, K, NP, NP)) >> etl::relu_derivative(c);
+        });
+        timer("gradients", [&] {
+            gwd = etl::transpose(etl::reshape(p, B, K * NP * NP)) * dd;
+            gbd = etl::sum_l(dd);
+            gwc = etl::conv_4d_valid_filter_flipped(x, dc);
+            gbc = etl::bias_batch_mean(dc);
+        });
+
+        // Update (the gradients are summed over the mini-batch, except gbc)
+
+        timer("sgd", [&] {
+            wc -= (lr / B) * gwc;
+            bc -= lr * gbc;
+            wd -= (lr / B) * gwd;
+            bd -= (lr / B) * gbd;
+        });
+    }
+};
+
+/*!
+ * \brief One step of a LSTM layer, trained with the squared error of the
+ * new hidden state against a target
+ */
+template <typename T>
+struct lstm {
+    using mat = etl::dyn_matrix<T>; ///< The type of the matrices
+    using vec = etl::dyn_vector<T>; ///< The type of the vectors
+
+    /*!
+     * \brief A gate of the LSTM: its parameters, its activations and its gradients
+     */
+    struct gate {
+        mat wx; ///< The input weights
+        mat wh; ///< The recurrent weights
+        vec b;  ///< The biases
+
+        mat a;  ///< The activations
+        mat d;  ///< The errors (before the activation function)
+
+        mat gwx; ///< The gradients of wx
+        mat gwh; ///< The gradients of wh
+        vec gb;  ///< The gradients of b
+
+        /*!
+         * \brief Create a gate with random weights
+         */
+        gate(size_t B, size_t I, size_t H)
+                : wx(I, H), wh(H, H), b(H, T(0)), a(B, H), d(B, H), gwx(I, H), gwh(H, H), gb(H) {
+            wx = etl::normal_generator<T>(0.0, 0.01);
+            wh = etl::normal_generator<T>(0.0, 0.01);
+        }
+    };
+
+    const size_t B; ///< The size of the mini-batch
+
+    mat h;      ///< The previous hidden state
+    mat s;      ///< The previous cell state
+    mat target; ///< The target of the new hidden state
+
+    gate gi; ///< The input gate
+    gate gf; ///< The forget gate
+    gate go; ///< The output gate
+    gate gg; ///< The candidate cell state
+
+    mat s_next; ///< The new cell state
+    mat h_next; ///< The new hidden state
+    mat ds;     ///< The errors of the new cell state
+    mat dh;     ///< The errors of the new hidden state
+
+    T lr = 0.1; ///< The learning rate
+
+    /*!
+     * \brief Create a LSTM step with the given sizes, with random weights and states
+     * \param B The size of the mini-batch
+     * \param I The number of inputs
+     * \param H The number of hidden units
+     */
+    lstm(size_t B, size_t I, size_t H)
+            : B(B), h(B, H), s(B, H), target(B, H), gi(B, I, H), gf(B, I, H), go(B, I, H), gg(B, I, H), s_next(B, H), h_next(B, H), ds(B, H), dh(B, H) {
+        h      = etl::uniform_generator<T>(-1.0, 1.0);
+        s      = etl::uniform_generator<T>(-1.0, 1.0);
+        target = etl::uniform_generator<T>(-1.0, 1.0);
+    }
+
+    /*!
+     * \brief Run one training step on the given mini-batch
+     * \param x The inputs of the mini-batch
+     * \param timer The timer of the operations
+     */
+    template <typename X, typename Timer>
+    void step(const X& x, Timer&& timer) {
+        // Forward
+
+        timer("gates", [&] {
+            gi.a = etl::sigmoid(x * gi.wx + h * gi.wh + etl::rep_l(gi.b, B));
+            gf.a = etl::sigmoid(x * gf.wx + h * gf.wh + etl::rep_l(gf.b, B));
+            go.a = etl::sigmoid(x * go.wx + h * go.wh + etl::rep_l(go.b, B));
+            gg.a = etl::tanh(x * gg.wx + h * gg.wh + etl::rep_l(gg.b, B));
+        });
+        timer("state", [&] {
+            s_next = (gf.a >> s) + (gi.a >> gg.a);
+            h_next = go.a >> etl::tanh(s_next);
+        });
+
+        // Backward
+
+        timer("loss", [&] { dh = h_next - target; });
+        timer("state backward", [&] {
+            ds   = dh >> go.a >> etl::tanh_derivative(etl::tanh(s_next));
+            go.d = dh >> etl::tanh(s_next) >> etl::sigmoid_derivative(go.a);
+            gi.d = ds >> gg.a >> etl::sigmoid_derivative(gi.a);
+            gf.d = ds >> s >> etl::sigmoid_derivative(gf.a);
+            gg.d = ds >> gi.a >> etl::tanh_derivative(gg.a);
+        });
+        timer("gradients", [&] {
+            for (auto* g : {&gi, &gf, &go, &gg}) {
+                g->gwx = etl::transpose(x) * g->d;
+                g->gwh = etl::transpose(h) * g->d;
+                g->gb  = etl::sum_l(g->d);
+            }
+        });
+
+        // Update (the gradients are summed over the mini-batch)
+
+        timer("sgd", [&] {
+            for (auto* g : {&gi, &gf, &go, &gg}) {
+                g->wx -= (lr / B) * g->gwx;
+                g->wh -= (lr / B) * g->gwh;
+                g->b -= (lr / B) * g->gb;
+            }
+        });
+    }
+};
+
+} //end of namespace etl_bench
@@ -0,0 +1,384 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+// Compare exported benchmark results (ETL_BENCH_EXPORT) against a baseline.
+//
+// Usage: bench_compare [options] current.json...
+//   --baseline FILE       A baseline result file (can be repeated)
+//   --baseline-dir DIR    Use the result files of DIR with the same fingerprint as baseline
+//   --revision REV        Only use the result files of DIR of the revision REV (prefix)
+//                         (default: the revision of the most recent file)
+//   --threshold T         Minimum relative slowdown to report a regression (default 0.05)
+//   --mad-factor K        Minimum slowdown in number of (scaled) MAD (default 3)
+//   --force               Compare even if the fingerprints are different
+//
+// Several files of the same side are repeats of the benchmark, a section is
+// summarized by the median of its medians. The noise of a section is the
+// largest of the MAD of the medians between the repeats and of the MAD of
+// the samples within the runs, scaled to be comparable to a standard
+// deviation. A section is a regression if it is slower by more than the
+// threshold and by more than K times the noise of both sides.
+//
+// The exit code is 0 if there is no regression, 1 if there are regressions
+// and 2 in case of error, including when a section is only in one side or
+// when no section is compared.
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "bench_stats.hpp"
+
+namespace {
+
+// The scale factor of the MAD to estimate the standard deviation of normal data
+constexpr double mad_scale = 1.4826;
+
+// The results of one section at one size, in one run
+struct result {
+    double median_ns = 0.0;
+    double mad_ns    = 0.0;
+};
+
+// The results of a file
+struct result_file {
+    std::string path;
+    std::string fingerprint;
+    std::string hash;
+    std::string revision;
+    std::map<std::pair<std::string, size_t>, result> results;
+};
+
+// Extract the value of a string field of a JSON line
+bool json_string(const std::string& line, const std::string& key, std::string& value) {
+    auto pos = line.find("\"" + key + "\": \"");
+
+    if (pos == std::string::npos) {
+        return false;
+    }
+
+    value.clear();
+
+    for (size_t i = pos + key.size() + 5; i < line.size() && line[i] != '"'; ++i) {
+        if (line[i] == '\\' && i + 1 < line.size()) {
+            ++i;
+        }
+
+        value += line[i];
+    }
+
+    return true;
+}
+
+// Extract the value of a number field of a JSON line
+bool json_number(const std::string& line, const std::string& key, double& value) {
+    auto pos = line.find("\"" + key + "\": ");
+
+    if (pos == std::string::npos) {
+        return false;
+    }
+
+    value = std::strtod(line.c_str() + pos + key.size() + 4, nullptr);
+
+    return true;
+}
+
+// Read a file exported by the benchmark (one result per line)
+bool read_results(const std::string& path, result_file& file) {
+    std::ifstream is(path);
+
+    if (!is) {
+        std::cerr << "Cannot read " << path << std::endl;
+        return false;
+    }
+
+    file.path = path;
+
+    std::string line;
+
+    while (std::getline(is, line)) {
+        std::string name;
+        double elements;
+        result r;
+
+        if (json_string(line, "name", name) && json_number(line, "elements", elements) && json_number(line, "median_ns", r.median_ns)
+            && json_number(line, "mad_ns", r.mad_ns)) {
+            file.results[std::make_pair(name, size_t(elements))] = r;
+        } else if (line.find("\"fingerprint\"") == 0) {
+            json_string(line, "fingerprint", file.fingerprint);
+        } else if (line.find("\"hash\"") == 0) {
+            json_string(line, "hash", file.hash);
+        } else if (line.find("\"revision\"") == 0) {
+            json_string(line, "revision", file.revision);
+        }
+    }
+
+    if (file.fingerprint.empty()) {
+        std::cerr << path << " is not an exported benchmark result" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+// The summary of a section over the repeats of one side
+struct summary {
+    double median_ns = 0.0;
+    double noise_ns  = 0.0;
+    size_t runs      = 0;
+};
+
+// Summarize a section over the files of one side
+bool summarize(const std::vector<result_file>& files, const std::pair<std::string, size_t>& key, summary& s) {
+    std::vector<double> medians;
+    std::vector<double> mads;
+
+    for (auto& file : files) {
+        auto it = file.results.find(key);
+
+        if (it != file.results.end()) {
+            medians.push_back(it->second.median_ns);
+            mads.push_back(it->second.mad_ns);
+        }
+    }
+
+    if (medians.empty()) {
+        return false;
+    }
+
+    s.runs      = medians.size();
+    s.median_ns = etl_bench::bench_median(medians);
+    s.noise_ns  = mad_scale * std::max(etl_bench::bench_mad(medians), etl_bench::bench_median(mads));
+
+    return true;
+}
+
+void usage() {
+    std::cerr << "Usage: bench_compare [--baseline FILE]... [--baseline-dir DIR [--revision REV]] [--threshold T] [--mad-factor K] [--force] current.json..." << std::endl;
+}
+
+} //end of anonymous namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> baseline_paths;
+    std::vector<std::string> current_paths;
+    std::string baseline_dir;
+    std::string revision;
+
+    double threshold  = 0.05;
+    double mad_factor = 3.0;
+    bool force        = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg(argv[i]);
+
+        if ((arg == "--baseline" || arg == "--baseline-dir" || arg == "--revision" || arg == "--threshold" || arg == "--mad-factor") && i + 1 >= argc) {
+            usage();
+            return 2;
+        }
+
+        if (arg == "--baseline") {
+            baseline_paths.push_back(argv[++i]);
+        } else if (arg == "--baseline-dir") {
+            baseline_dir = argv[++i];
+        } else if (arg == "--revision") {
+            revision = argv[++i];
+        } else if (arg == "--threshold") {
+            threshold = std::atof(argv[++i]);
+        } else if (arg == "--mad-factor") {
+            mad_factor = std::atof(argv[++i]);
+        } else if (arg == "--force") {
+            force = true;
+        } else if (arg.size() > 1 && arg[0] == '-') {
+            usage();
+            return 2;
+        } else {
+            current_paths.push_back(arg);
+        }
+    }
+
+    if (current_paths.empty() || (baseline_paths.empty() && baseline_dir.empty())) {
+        usage();
+        return 2;
+    }
+
+    std::vector<result_file> current(current_paths.size());
+
+    for (size_t i = 0; i < current_paths.size(); ++i) {
+        if (!read_results(current_paths[i], current[i])) {
+            return 2;
+        }
+
+        if (current[i].fingerprint != current[0].fingerprint) {
+            std::cerr << "The current results have different fingerprints" << std::endl;
+            return 2;
+        }
+    }
+
+    std::vector<result_file> baseline;
+
+    for (auto& path : baseline_paths) {
+        baseline.emplace_back();
+
+        if (!read_results(path, baseline.back())) {
+            return 2;
+        }
+    }
+
+    if (!baseline_dir.empty()) {
+        std::vector<result_file> candidates;
+
+        // The most recent file selects the revision if none is given
+        time_t latest = 0;
+        std::string latest_revision;
+
+        if (auto* dir = opendir(baseline_dir.c_str())) {
+            while (auto* entry = readdir(dir)) {
+                std::string name(entry->d_name);
+
+                if (name.size() > 5 && name.compare(name.size() - 5, 5, ".json") == 0) {
+                    result_file file;
+                    struct stat st;
+
+                    if (read_results(baseline_dir + "/" + name, file) && file.fingerprint == current[0].fingerprint) {
+                        if (stat(file.path.c_str(), &st) == 0 && (latest_revision.empty() || st.st_mtime > latest)) {
+                            latest          = st.st_mtime;
+                            latest_revision = file.revision;
+                        }
+
+                        candidates.push_back(std::move(file));
+                    }
+                }
+            }
+
+            closedir(dir);
+        }
+
+        if (revision.empty()) {
+            revision = latest_revision;
+        }
+
+        // Only the repeats of one revision are summarized together
+        for (auto& file : candidates) {
+            if (revision.empty() ? file.revision.empty() : file.revision.compare(0, revision.size(), revision) == 0) {
+                baseline.push_back(std::move(file));
+            }
+        }
+
+        if (!candidates.empty()) {
+            std::cout << "Baseline revision: " << (revision.empty() ? "unknown" : revision) << "\n";
+        }
+    }
+
+    if (baseline.empty()) {
+        std::cerr << "No baseline for the fingerprint " << current[0].hash << " (" << current[0].fingerprint << ")" << std::endl;
+        return 2;
+    }
+
+    for (auto& file : baseline) {
+        if (file.fingerprint != current[0].fingerprint) {
+            std::cerr << "The fingerprint of " << file.path << " is different from the current results:\n  " << file.fingerprint << "\n  "
+                      << current[0].fingerprint << std::endl;
+
+            if (!force) {
+                return 2;
+            }
+        }
+    }
+
+    size_t regressions  = 0;
+    size_t improvements = 0;
+    size_t compared     = 0;
+    size_t missing      = 0;
+    size_t removed      = 0;
+
+    std::cout << "Baseline: " << baseline.size() << " run(s), current: " << current.size() << " run(s), threshold: " << 100.0 * threshold
+              << "%, noise factor: " << mad_factor << "\n\n";
+
+    for (auto& entry : current[0].results) {
+        auto& key = entry.first;
+
+        summary base;
+        summary cur;
+
+        summarize(current, key, cur);
+
+        if (!summarize(baseline, key, base)) {
+            std::cout << std::left << std::setw(12) << "MISSING" << std::setw(48) << key.first << std::right << std::setw(12) << key.second
+                      << "  not in the baseline\n";
+            ++missing;
+            continue;
+        }
+
+        ++compared;
+
+        const double ratio = base.median_ns > 0.0 ? cur.median_ns / base.median_ns : 1.0;
+        const double delta = cur.median_ns - base.median_ns;
+        const double noise = mad_factor * std::max(base.noise_ns, cur.noise_ns);
+
+        const char* status = nullptr;
+
+        if (ratio > 1.0 + threshold && delta > noise) {
+            status = "REGRESSION";
+            ++regressions;
+        } else if (ratio < 1.0 - threshold && -delta > noise) {
+            status = "improvement";
+            ++improvements;
+        }
+
+        if (status) {
+            std::cout << std::left << std::setw(12) << status << std::setw(48) << key.first << std::right << std::setw(12) << key.second
+                      << std::fixed << std::setprecision(0) << std::setw(14) << base.median_ns << std::setw(14) << cur.median_ns
+                      << std::setprecision(1) << std::setw(9) << 100.0 * (ratio - 1.0) << "%\n";
+        }
+    }
+
+    std::set<std::pair<std::string, size_t>> baseline_keys;
+
+    for (auto& file : baseline) {
+        for (auto& entry : file.results) {
+            baseline_keys.insert(entry.first);
+        }
+    }
+
+    for (auto& key : baseline_keys) {
+        if (!current[0].results.count(key)) {
+            std::cout << std::left << std::setw(12) << "MISSING" << std::setw(48) << key.first << std::right << std::setw(12) << key.second
+                      << "  not in the current results\n";
+            ++removed;
+        }
+    }
+
+    std::cout << "\n" << compared << " sections compared, " << regressions << " regression(s), " << improvements << " improvement(s)";
+
+    if (missing) {
+        std::cout << ", " << missing << " not in the baseline";
+    }
+
+    if (removed) {
+        std::cout << ", " << removed << " not in the current results";
+    }
+
+    std::cout << std::endl;
+
+    // The sections that cannot be compared must not pass the gate
+    if (!compared || missing || removed) {
+        std::cerr << (compared ? "Some sections are not in both sides" : "No section compared") << std::endl;
+        return 2;
+    }
+
+    return regressions ? 1 : 0;
+}
@@ -258,19 +258,19 @@ CPM_BENCH() {
         );
 }
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_P("ssum [std][sum][s]", dot_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("ssum [std][sum][s]", dot_policy,
     CPM_SECTION_INIT([](size_t d1){ return std::make_tuple(svec(d1)); }),
-    CPM_SECTION_FUNCTOR("default", [](svec& a){ float_ref += etl::sum(a); }),
-    CPM_SECTION_FUNCTOR("std", [](svec& a){ SELECTED_SECTION(etl::sum_impl::STD){ float_ref += etl::sum(a); } })
+    PERF_SECTION_FUNCTOR("default", [](svec& a){ float_ref += etl::sum(a); }),
+    PERF_SECTION_FUNCTOR("std", [](svec& a){ SELECTED_SECTION(etl::sum_impl::STD){ float_ref += etl::sum(a); } })
     VEC_SECTION_FUNCTOR("vec", [](svec& a){ SELECTED_SECTION(etl::sum_impl::VEC){ float_ref += etl::sum(a); } })
     BLAS_SECTION_FUNCTOR("blas", [](svec& a){ SELECTED_SECTION(etl::sum_impl::BLAS){ float_ref += etl::sum(a); } })
     CUBLAS_SECTION_FUNCTOR("cublas", [](svec& a){ SELECTED_SECTION(etl::sum_impl::CUBLAS){ float_ref += etl::sum(a); } })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_P("dsum [std][sum][d]", dot_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("dsum [std][sum][d]", dot_policy,
     CPM_SECTION_INIT([](size_t d1){ return std::make_tuple(dvec(d1)); }),
-    CPM_SECTION_FUNCTOR("default", [](dvec& a){ double_ref += etl::sum(a); }),
-    CPM_SECTION_FUNCTOR("std", [](dvec& a){ SELECTED_SECTION(etl::sum_impl::STD){ double_ref += etl::sum(a); } })
+    PERF_SECTION_FUNCTOR("default", [](dvec& a){ double_ref += etl::sum(a); }),
+    PERF_SECTION_FUNCTOR("std", [](dvec& a){ SELECTED_SECTION(etl::sum_impl::STD){ double_ref += etl::sum(a); } })
     VEC_SECTION_FUNCTOR("vec", [](dvec& a){ SELECTED_SECTION(etl::sum_impl::VEC){ double_ref += etl::sum(a); } })
     BLAS_SECTION_FUNCTOR("blas", [](dvec& a){ SELECTED_SECTION(etl::sum_impl::BLAS){ float_ref += etl::sum(a); } })
     CUBLAS_SECTION_FUNCTOR("cublas", [](dvec& a){ SELECTED_SECTION(etl::sum_impl::CUBLAS){ float_ref += etl::sum(a); } })
@@ -295,37 +295,59 @@ CPM_BENCH() {
 #endif
 }
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_P("strans [transpose][s]", trans_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("strans [transpose][s]", trans_policy,
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1,d2), smat(d2,d1)); }),
-    CPM_SECTION_FUNCTOR("default", [](smat& a, smat& r){ r = transpose(a); }),
-    CPM_SECTION_FUNCTOR("std", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::STD, transpose(a)); })
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& r){ r = transpose(a); }),
+    PERF_SECTION_FUNCTOR("std", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::STD, transpose(a)); })
     BLAS_SECTION_FUNCTOR("blas", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::MKL, transpose(a)); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::CUBLAS, transpose(a)); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_P("inplace_strans [transpose][s]", trans_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("inplace_strans [transpose][s]", trans_policy,
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1,d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](smat& r){ r.transpose_inplace(); }),
-    CPM_SECTION_FUNCTOR("std", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::STD){ r.transpose_inplace(); } })
+    PERF_SECTION_FUNCTOR("default", [](smat& r){ r.transpose_inplace(); }),
+    PERF_SECTION_FUNCTOR("std", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::STD){ r.transpose_inplace(); } })
     BLAS_SECTION_FUNCTOR("blas", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::MKL){ r.transpose_inplace(); } })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::CUBLAS){ r.transpose_inplace(); } })
 )
 
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("dtrans [transpose][d]", trans_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(dmat(d1,d2), dmat(d2,d1)); }),
+    PERF_SECTION_FUNCTOR("default", [](dmat& a, dmat& r){ r = transpose(a); }),
+    PERF_SECTION_FUNCTOR("std", [](dmat& a, dmat& r){ r = selected_helper(etl::transpose_impl::STD, transpose(a)); })
+    BLAS_SECTION_FUNCTOR("blas", [](dmat& a, dmat& r){ r = selected_helper(etl::transpose_impl::MKL, transpose(a)); })
+    CUBLAS_SECTION_FUNCTOR("cublas", [](dmat& a, dmat& r){ r = selected_helper(etl::transpose_impl::CUBLAS, transpose(a)); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("inplace_dtrans [transpose][d]", trans_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(dmat(d1,d2)); }),
+    PERF_SECTION_FUNCTOR("default", [](dmat& r){ r.transpose_inplace(); }),
+    PERF_SECTION_FUNCTOR("std", [](dmat& r){ SELECTED_SECTION(etl::transpose_impl::STD){ r.transpose_inplace(); } })
+    BLAS_SECTION_FUNCTOR("blas", [](dmat& r){ SELECTED_SECTION(etl::transpose_impl::MKL){ r.transpose_inplace(); } })
+    CUBLAS_SECTION_FUNCTOR("cublas", [](dmat& r){ SELECTED_SECTION(etl::transpose_impl::CUBLAS){ r.transpose_inplace(); } })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("strans_expr [transpose][s]", trans_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1,d2), smat(d2,d1), smat(d2,d1)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& b, smat& r){ r = transpose(a) + b; }),
+    PERF_SECTION_FUNCTOR("temporary", [](smat& a, smat& b, smat& r){ r = etl::force_temporary(transpose(a)) + b; })
+)
+
 //Sigmoid benchmark
-CPM_DIRECT_SECTION_TWO_PASS_NS_F("a = sigmoid(b) (s) [std][sigmoid][d]",
+PERF_DIRECT_SECTION_TWO_PASS_NS_F("a = sigmoid(b) (s) [std][sigmoid][d]",
     FLOPS([](size_t d){ return 22 * d; }),
     CPM_SECTION_INIT([](size_t d){ return std::make_tuple(svec(d), svec(d)); }),
-    CPM_SECTION_FUNCTOR("default", [](svec& a, svec& b){ a = etl::sigmoid(b); }),
-    CPM_SECTION_FUNCTOR("fast", [](svec& a, svec& b){ a = etl::fast_sigmoid(b); }),
-    CPM_SECTION_FUNCTOR("hard", [](svec& a, svec& b){ a = etl::hard_sigmoid(b); })
+    PERF_SECTION_FUNCTOR("default", [](svec& a, svec& b){ a = etl::sigmoid(b); }),
+    PERF_SECTION_FUNCTOR("fast", [](svec& a, svec& b){ a = etl::fast_sigmoid(b); }),
+    PERF_SECTION_FUNCTOR("hard", [](svec& a, svec& b){ a = etl::hard_sigmoid(b); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_F("a = sigmoid(b) (d) [std][sigmoid][d]",
+PERF_DIRECT_SECTION_TWO_PASS_NS_F("a = sigmoid(b) (d) [std][sigmoid][d]",
     FLOPS([](size_t d){ return 22 * d; }),
     CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dvec(d), dvec(d)); }),
-    CPM_SECTION_FUNCTOR("default", [](dvec& a, dvec& b){ a = etl::sigmoid(b); }),
-    CPM_SECTION_FUNCTOR("fast", [](dvec& a, dvec& b){ a = etl::fast_sigmoid(b); }),
-    CPM_SECTION_FUNCTOR("hard", [](dvec& a, dvec& b){ a = etl::hard_sigmoid(b); })
+    PERF_SECTION_FUNCTOR("default", [](dvec& a, dvec& b){ a = etl::sigmoid(b); }),
+    PERF_SECTION_FUNCTOR("fast", [](dvec& a, dvec& b){ a = etl::fast_sigmoid(b); }),
+    PERF_SECTION_FUNCTOR("hard", [](dvec& a, dvec& b){ a = etl::hard_sigmoid(b); })
 )
 
 #ifdef ETL_EXTENDED_BENCH
@@ -378,35 +400,35 @@ CPM_BENCH() {
 
 // Bench scalar compound operations
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("r += 1.25 (s) [std][scalar][s]", large_vector_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("r += 1.25 (s) [std][scalar][s]", large_vector_policy,
     FLOPS([](size_t d){ return d; }),
     CPM_SECTION_INIT([](size_t d){ return std::make_tuple(svec(d)); }),
-    CPM_SECTION_FUNCTOR("default", [](svec& a){ a += 1.25f; }),
-    CPM_SECTION_FUNCTOR("std", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::STD) { a += 1.25f; } })
+    PERF_SECTION_FUNCTOR("default", [](svec& a){ a += 1.25f; }),
+    PERF_SECTION_FUNCTOR("std", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::STD) { a += 1.25f; } })
     BLAS_SECTION_FUNCTOR("blas", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::BLAS) { a += 1.25f; } })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("r -= 1.25 (s) [std][scalar][s]", large_vector_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("r -= 1.25 (s) [std][scalar][s]", large_vector_policy,
     FLOPS([](size_t d){ return d; }),
     CPM_SECTION_INIT([](size_t d){ return std::make_tuple(svec(d)); }),
-    CPM_SECTION_FUNCTOR("default", [](svec& a){ a -= 1.25f; }),
-    CPM_SECTION_FUNCTOR("std", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::STD) { a -= 1.25f; } })
+    PERF_SECTION_FUNCTOR("default", [](svec& a){ a -= 1.25f; }),
+    PERF_SECTION_FUNCTOR("std", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::STD) { a -= 1.25f; } })
     BLAS_SECTION_FUNCTOR("blas", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::BLAS) { a -= 1.25f; } })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("r *= 1.25 (s) [std][scalar][s]", large_vector_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("r *= 1.25 (s) [std][scalar][s]", large_vector_policy,
     FLOPS([](size_t d){ return d; }),
     CPM_SECTION_INIT([](size_t d){ return std::make_tuple(svec(d)); }),
-    CPM_SECTION_FUNCTOR("default", [](svec& a){ a *= 1.25f; }),
-    CPM_SECTION_FUNCTOR("std", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::STD) { a *= 1.25f; } })
+    PERF_SECTION_FUNCTOR("default", [](svec& a){ a *= 1.25f; }),
+    PERF_SECTION_FUNCTOR("std", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::STD) { a *= 1.25f; } })
     BLAS_SECTION_FUNCTOR("blas", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::BLAS) { a *= 1.25f; } })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("r /= 1.25 (s) [std][scalar][s]", large_vector_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("r /= 1.25 (s) [std][scalar][s]", large_vector_policy,
     FLOPS([](size_t d){ return d; }),
     CPM_SECTION_INIT([](size_t d){ return std::make_tuple(svec(d)); }),
-    CPM_SECTION_FUNCTOR("default", [](svec& a){ a /= 1.25f; }),
-    CPM_SECTION_FUNCTOR("std", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::STD) { a /= 1.25f; } })
+    PERF_SECTION_FUNCTOR("default", [](svec& a){ a /= 1.25f; }),
+    PERF_SECTION_FUNCTOR("std", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::STD) { a /= 1.25f; } })
     BLAS_SECTION_FUNCTOR("blas", [](svec& a){ SELECTED_SECTION(etl::scalar_impl::BLAS) { a /= 1.25f; } })
 )
 
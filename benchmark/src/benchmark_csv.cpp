@@ -0,0 +1,65 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+#include <fstream>
+
+// The CSV file is written once per size, with 100 columns. The "FLOPS" of
+// these benchmarks are the number of values of the file.
+
+namespace {
+
+const char* csv_path = "benchmark.tmp.csv";
+
+// Write a CSV file with the values of the given matrix
+template <typename M>
+void write_csv(const M& matrix) {
+    std::ofstream os(csv_path);
+
+    os.precision(9);
+
+    for (size_t i = 0; i < etl::dim<0>(matrix); ++i) {
+        for (size_t j = 0; j < etl::dim<1>(matrix); ++j) {
+            os << matrix(i, j) << (j == etl::dim<1>(matrix) - 1 ? '\n' : ',');
+        }
+    }
+}
+
+// Read a CSV file with iostreams
+template <typename M>
+void iostream_csv(M& matrix) {
+    std::ifstream is(csv_path);
+
+    for (size_t i = 0; i < etl::dim<0>(matrix); ++i) {
+        for (size_t j = 0; j < etl::dim<1>(matrix); ++j) {
+            char delimiter;
+            is >> matrix(i, j);
+
+            if (j < etl::dim<1>(matrix) - 1) {
+                is >> delimiter;
+            }
+        }
+    }
+}
+
+} //end of anonymous namespace
+
+using csv_policy = VALUES_POLICY(1000, 10000, 100000, 1000000, 10000000);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("load_csv [csv][s]", csv_policy,
+    FLOPS([](size_t d){ return d; }),
+    CPM_SECTION_INIT([](size_t d){
+        smat a(d / 100 + 1, 100);
+        a = etl::uniform_generator(-1000.0, 1000.0);
+        write_csv(a);
+        return std::make_tuple(smat(d / 100 + 1, 100)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a){ etl::load_csv(csv_path, a); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat& a){ SERIAL_SECTION { etl::load_csv(csv_path, a); } }),
+    PERF_SECTION_FUNCTOR("iostream", [](smat& a){ iostream_csv(a); })
+)
@@ -0,0 +1,74 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+namespace {
+
+double determinant_ref = 0.0; ///< Keep the determinants alive
+
+} //end of anonymous namespace
+
+// From L1 (16x16 doubles) to the main memory (1024x1024 doubles)
+using decomposition_policy = VALUES_POLICY(16, 32, 64, 128, 256, 512, 1024);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("lu [decomposition][d]", decomposition_policy,
+    FLOPS([](size_t d){ return 2 * d * d * d / 3; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dmat(d, d), dmat(d, d), dmat(d, d), dmat(d, d)); }),
+    PERF_SECTION_FUNCTOR("default", [](dmat& A, dmat& L, dmat& U, dmat& P){ etl::lu(A, L, U, P); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("qr [decomposition][d]", decomposition_policy,
+    FLOPS([](size_t d){ return 4 * d * d * d / 3; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dmat(d, d), dmat(d, d), dmat(d, d)); }),
+    PERF_SECTION_FUNCTOR("default", [](dmat& A, dmat& Q, dmat& R){ etl::qr(A, Q, R); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("inv [decomposition][d]", decomposition_policy,
+    FLOPS([](size_t d){ return 2 * d * d * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dmat(d, d), dmat(d, d)); }),
+    PERF_SECTION_FUNCTOR("default", [](dmat& A, dmat& C){ C = etl::inv(A); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("determinant [decomposition][d]", decomposition_policy,
+    FLOPS([](size_t d){ return 2 * d * d * d / 3; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dmat(d, d)); }),
+    PERF_SECTION_FUNCTOR("default", [](dmat& A){ determinant_ref += etl::determinant(A); })
+)
+
+// Batches of small matrices, from L1 to the main memory
+using batch_policy = VALUES_POLICY(1024, 4096, 16384, 65536, 262144);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("batch_inv (3x3) [decomposition][batch][s]", batch_policy,
+    FLOPS([](size_t d){ return 45 * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(smat3(d, 3, 3), smat3(d, 3, 3)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat3& A, smat3& C){ etl::batch_inv(A, C); }),
+    PERF_SECTION_FUNCTOR("slices", [](smat3& A, smat3& C){
+        for (size_t b = 0; b < etl::dim<0>(A); ++b) {
+            C(b) = etl::inv(A(b));
+        }
+    })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("batch_inv (4x4) [decomposition][batch][s]", batch_policy,
+    FLOPS([](size_t d){ return 140 * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(smat3(d, 4, 4), smat3(d, 4, 4)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat3& A, smat3& C){ etl::batch_inv(A, C); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("batch_inv (6x6) [decomposition][batch][d]", batch_policy,
+    FLOPS([](size_t d){ return 2 * 6 * 6 * 6 * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dmat3(d, 6, 6), dmat3(d, 6, 6)); }),
+    PERF_SECTION_FUNCTOR("default", [](dmat3& A, dmat3& C){ etl::batch_inv(A, C); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("batch_det (4x4) [decomposition][batch][s]", batch_policy,
+    FLOPS([](size_t d){ return 40 * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(smat3(d, 4, 4), svec(d)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat3& A, svec& D){ etl::batch_det(A, D); })
+)
@@ -0,0 +1,52 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+namespace {
+
+constexpr size_t embedding_rows    = 1000000; ///< The number of rows of the embedding table
+constexpr size_t embedding_columns = 256;     ///< The number of columns of the embedding table
+
+// The indices are kept outside of the CPM tuple so that they are not randomized
+etl::dyn_vector<size_t> embedding_indices;
+
+void init_embedding_indices(size_t n) {
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<size_t> distribution(0, embedding_rows - 1);
+
+    embedding_indices = etl::dyn_vector<size_t>(n);
+
+    for (auto& index : embedding_indices) {
+        index = distribution(generator);
+    }
+}
+
+} //end of anonymous namespace
+
+using embedding_policy = VALUES_POLICY(1024, 4096, 16384, 65536, 262144);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("gather_rows [embedding][s]", embedding_policy,
+    CPM_SECTION_INIT([](size_t d){ init_embedding_indices(d); return std::make_tuple(smat(embedding_rows, embedding_columns), smat(d, embedding_columns)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& E, smat& r){ r = etl::gather_rows(E, embedding_indices); }),
+    PERF_SECTION_FUNCTOR("rows", [](smat& E, smat& r){
+        for (size_t i = 0; i < etl::size(embedding_indices); ++i) {
+            r(i) = E(embedding_indices[i]);
+        }
+    })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("scatter_add_rows [embedding][s]", embedding_policy,
+    CPM_SECTION_INIT([](size_t d){ init_embedding_indices(d); return std::make_tuple(smat(embedding_rows, embedding_columns), smat(d, embedding_columns)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& E, smat& g){ etl::scatter_add_rows(E, embedding_indices, g); }),
+    PERF_SECTION_FUNCTOR("rows", [](smat& E, smat& g){
+        for (size_t i = 0; i < etl::size(embedding_indices); ++i) {
+            E(embedding_indices[i]) += g(i);
+        }
+    })
+)
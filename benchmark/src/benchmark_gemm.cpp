@@ -18,164 +18,217 @@ double double_ref = 0.0;
 
 } //end of anonymous namespace
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("A * B (s) [gemm]", gemm_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * B (s) [gemm]", gemm_policy,
     FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d2 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1,d2), smat(d1,d2), smat(d1, d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](smat& a, smat& b, smat& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& b, smat& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("A * B (d) [gemm]", gemm_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * B (d) [gemm]", gemm_policy,
     FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d2 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(dmat(d1,d2), dmat(d1,d2), dmat(d1, d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](dmat& a, dmat& b, dmat& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](dmat& a, dmat& b, dmat& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](dmat& a, dmat& b, dmat& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](dmat& a, dmat& b, dmat& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](dmat& a, dmat& b, dmat& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](dmat& a, dmat& b, dmat& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](dmat& a, dmat& b, dmat& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("A * B (c) [gemm]", small_square_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * B (c) [gemm]", small_square_policy,
     FLOPS([](size_t d1, size_t d2){ return 6 * 2 * d1 * d2 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(cmat(d1,d2), cmat(d1,d2), cmat(d1, d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](cmat& a, cmat& b, cmat& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](cmat& a, cmat& b, cmat& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](cmat& a, cmat& b, cmat& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](cmat& a, cmat& b, cmat& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](cmat& a, cmat& b, cmat& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](cmat& a, cmat& b, cmat& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](cmat& a, cmat& b, cmat& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
 #ifdef ETL_EXTENDED_BENCH
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("A * B (z) [gemm]", small_square_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * B (z) [gemm]", small_square_policy,
     FLOPS([](size_t d1, size_t d2){ return 6 * 2 * d1 * d2 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(zmat(d1,d2), zmat(d1,d2), zmat(d1, d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](zmat& a, zmat& b, zmat& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](zmat& a, zmat& b, zmat& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](zmat& a, zmat& b, zmat& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](zmat& a, zmat& b, zmat& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](zmat& a, zmat& b, zmat& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](zmat& a, zmat& b, zmat& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](zmat& a, zmat& b, zmat& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("A * trans(B) (s) [gemm]", gemm_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * trans(B) (s) [gemm]", gemm_policy,
     FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d2 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1,d2), smat(d1,d2), smat(d1, d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](smat& a, smat& b, smat& c){ c = a * transpose(b); }),
-    CPM_SECTION_FUNCTOR("std", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::gemm_impl::STD, a * transpose(b)); })
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& b, smat& c){ c = a * transpose(b); }),
+    PERF_SECTION_FUNCTOR("std", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::gemm_impl::STD, a * transpose(b)); })
     VEC_SECTION_FUNCTOR("vec", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::gemm_impl::VEC, a * transpose(b)); })
     BLAS_SECTION_FUNCTOR("blas", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::gemm_impl::BLAS, a * transpose(b)); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * transpose(b)); })
 )
 #endif
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("A * B (cm/s) [gemm]", square_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * B (cm/s) [gemm]", square_policy,
     FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d2 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat_cm(d1,d2), smat_cm(d1,d2), smat_cm(d1, d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](smat_cm& a, smat_cm& b, smat_cm& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](smat_cm& a, smat_cm& b, smat_cm& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](smat_cm& a, smat_cm& b, smat_cm& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](smat_cm& a, smat_cm& b, smat_cm& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](smat_cm& a, smat_cm& b, smat_cm& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](smat_cm& a, smat_cm& b, smat_cm& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat_cm& a, smat_cm& b, smat_cm& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("A * x (s) [gemm]", gemv_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * x (s) [gemm]", gemv_policy,
     FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1,d2), svec(d2), svec(d1)); }),
-    CPM_SECTION_FUNCTOR("default", [](smat& a, svec& b, svec& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](smat& a, svec& b, svec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](smat& a, svec& b, svec& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](smat& a, svec& b, svec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](smat& a, svec& b, svec& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](smat& a, svec& b, svec& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat& a, svec& b, svec& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("A * x (d) [gemm]", gemv_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * x (d) [gemm]", gemv_policy,
     FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(dmat(d1,d2), dvec(d2), dvec(d1)); }),
-    CPM_SECTION_FUNCTOR("default", [](dmat& a, dvec& b, dvec& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](dmat& a, dvec& b, dvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](dmat& a, dvec& b, dvec& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](dmat& a, dvec& b, dvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](dmat& a, dvec& b, dvec& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](dmat& a, dvec& b, dvec& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](dmat& a, dvec& b, dvec& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("A * x (cm/s) [gemm]", gemv_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * x (cm/s) [gemm]", gemv_policy,
     FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat_cm(d1,d2), svec_cm(d2), svec_cm(d1)); }),
-    CPM_SECTION_FUNCTOR("default", [](smat_cm& a, svec_cm& b, svec_cm& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](smat_cm& a, svec_cm& b, svec_cm& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](smat_cm& a, svec_cm& b, svec_cm& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](smat_cm& a, svec_cm& b, svec_cm& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](smat_cm& a, svec_cm& b, svec_cm& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](smat_cm& a, svec_cm& b, svec_cm& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat_cm& a, svec_cm& b, svec_cm& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
 #ifdef ETL_EXTENDED_BENCH
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("A * x (c) [gemm]", gemv_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * x (c) [gemm]", gemv_policy,
     FLOPS([](size_t d1, size_t d2){ return 6 * 2 * d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(cmat(d1,d2), cvec(d2), cvec(d1)); }),
-    CPM_SECTION_FUNCTOR("default", [](cmat& a, cvec& b, cvec& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](cmat& a, cvec& b, cvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](cmat& a, cvec& b, cvec& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](cmat& a, cvec& b, cvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](cmat& a, cvec& b, cvec& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](cmat& a, cvec& b, cvec& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("A * x (z) [gemm]", gemv_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * x (z) [gemm]", gemv_policy,
     FLOPS([](size_t d1, size_t d2){ return 6 * 2 * d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(zmat(d1,d2), zvec(d2), zvec(d1)); }),
-    CPM_SECTION_FUNCTOR("default", [](zmat& a, zvec& b, zvec& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](zmat& a, zvec& b, zvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](zmat& a, zvec& b, zvec& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](zmat& a, zvec& b, zvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](zmat& a, zvec& b, zvec& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](zmat& a, zvec& b, zvec& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 #endif
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("x * A (s) [gemm]", gemv_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * x (sym/s) [gemm][packed]", square_policy,
+    FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d2; }),
+    CPM_SECTION_INIT([](size_t d1, size_t /*d2*/){
+        smat a(d1, d1);
+        a = etl::uniform_generator(-1.0, 1.0);
+        a = a + etl::transpose(a);
+        return std::make_tuple(a, etl::packed_symmetric_matrix<float>(a), svec(d1), svec(d1));
+    }),
+    PERF_SECTION_FUNCTOR("dense", [](smat& a, etl::packed_symmetric_matrix<float>& /*p*/, svec& b, svec& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("packed", [](smat& /*a*/, etl::packed_symmetric_matrix<float>& p, svec& b, svec& c){ etl::symv(p, b, c); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("A * A^T (sym/s) [gemm][packed]", square_policy,
+    FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d1 * d2; }),
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), smat(d1, d1), etl::packed_symmetric_matrix<float>(d1)); }),
+    PERF_SECTION_FUNCTOR("dense", [](smat& a, smat& c, etl::packed_symmetric_matrix<float>& /*p*/){ c = a * etl::transpose(a); }),
+    PERF_SECTION_FUNCTOR("packed", [](smat& a, smat& /*c*/, etl::packed_symmetric_matrix<float>& p){ etl::syrk(a, p); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("D * B (s) [gemm][structured]", square_policy,
+    FLOPS([](size_t d1, size_t d2){ return d1 * d2; }),
+    CPM_SECTION_INIT([](size_t d1, size_t d2){
+        smat a(d1, d1);
+        a = 0;
+        for (size_t i = 0; i < d1; ++i) {
+            a(i, i) = 1.0f + i;
+        }
+        etl::diagonal_matrix<smat> d(d1);
+        d = a;
+        return std::make_tuple(a, d, smat(d1, d2), smat(d1, d2));
+    }),
+    PERF_SECTION_FUNCTOR("dense", [](smat& a, etl::diagonal_matrix<smat>& /*d*/, smat& b, smat& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("structured", [](smat& /*a*/, etl::diagonal_matrix<smat>& d, smat& b, smat& c){ c = d * b; })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("L * B (s) [gemm][structured]", square_policy,
+    FLOPS([](size_t d1, size_t d2){ return d1 * d1 * d2; }),
+    CPM_SECTION_INIT([](size_t d1, size_t d2){
+        smat a(d1, d1);
+        a = etl::uniform_generator(-1.0, 1.0);
+        for (size_t i = 0; i < d1; ++i) {
+            for (size_t j = i + 1; j < d1; ++j) {
+                a(i, j) = 0;
+            }
+        }
+        etl::lower_matrix<smat> l(d1);
+        l = a;
+        return std::make_tuple(a, l, smat(d1, d2), smat(d1, d2));
+    }),
+    PERF_SECTION_FUNCTOR("dense", [](smat& a, etl::lower_matrix<smat>& /*l*/, smat& b, smat& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("structured", [](smat& /*a*/, etl::lower_matrix<smat>& l, smat& b, smat& c){ c = l * b; })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("x * A (s) [gemm]", gemv_policy,
     FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(svec(d1), smat(d1,d2), svec(d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](svec& a, smat& b, svec& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](svec& a, smat& b, svec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](svec& a, smat& b, svec& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](svec& a, smat& b, svec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](svec& a, smat& b, svec& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](svec& a, smat& b, svec& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](svec& a, smat& b, svec& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("x * A (d) [gemm]", gemv_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("x * A (d) [gemm]", gemv_policy,
     FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(dvec(d1), dmat(d1,d2), dvec(d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](dvec& a, dmat& b, dvec& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](dvec& a, dmat& b, dvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](dvec& a, dmat& b, dvec& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](dvec& a, dmat& b, dvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](dvec& a, dmat& b, dvec& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](dvec& a, dmat& b, dvec& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](dvec& a, dmat& b, dvec& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("x * A (cm/s) [gemm]", gemv_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("x * A (cm/s) [gemm]", gemv_policy,
     FLOPS([](size_t d1, size_t d2){ return 2 * d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(svec_cm(d1), smat_cm(d1,d2), svec_cm(d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](svec_cm& a, smat_cm& b, svec_cm& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](svec_cm& a, smat_cm& b, svec_cm& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](svec_cm& a, smat_cm& b, svec_cm& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](svec_cm& a, smat_cm& b, svec_cm& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](svec_cm& a, smat_cm& b, svec_cm& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](svec_cm& a, smat_cm& b, svec_cm& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](svec_cm& a, smat_cm& b, svec_cm& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
 #ifdef ETL_EXTENDED_BENCH
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("x * A (c) [gemm]", gemv_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("x * A (c) [gemm]", gemv_policy,
     FLOPS([](size_t d1, size_t d2){ return 6 * 2 * d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(cvec(d1), cmat(d1,d2), cvec(d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](cvec& a, cmat& b, cvec& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](cvec& a, cmat& b, cvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](cvec& a, cmat& b, cvec& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](cvec& a, cmat& b, cvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](cvec& a, cmat& b, cvec& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](cvec& a, cmat& b, cvec& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](cvec& a, cmat& b, cvec& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("x * A (z) [gemm]", gemv_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("x * A (z) [gemm]", gemv_policy,
     FLOPS([](size_t d1, size_t d2){ return 6 * 2 * d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(zvec(d1), zmat(d1,d2), zvec(d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](zvec& a, zmat& b, zvec& c){ c = a * b; }),
-    CPM_SECTION_FUNCTOR("std", [](zvec& a, zmat& b, zvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
+    PERF_SECTION_FUNCTOR("default", [](zvec& a, zmat& b, zvec& c){ c = a * b; }),
+    PERF_SECTION_FUNCTOR("std", [](zvec& a, zmat& b, zvec& c){ c = selected_helper(etl::gemm_impl::STD, a * b); })
     VEC_SECTION_FUNCTOR("vec", [](zvec& a, zmat& b, zvec& c){ c = selected_helper(etl::gemm_impl::VEC, a * b); })
     BLAS_SECTION_FUNCTOR("blas", [](zvec& a, zmat& b, zvec& c){ c = selected_helper(etl::gemm_impl::BLAS, a * b); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](zvec& a, zmat& b, zvec& c){ c = selected_helper(etl::gemm_impl::CUBLAS, a * b); })
@@ -262,40 +315,40 @@ CPM_BENCH(){
         );
 }
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("r = a *o b (s)", outer_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("r = a *o b (s)", outer_policy,
     FLOPS([](size_t d1, size_t d2){ return d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(svec(d1), svec(d2), smat(d1, d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](svec& a, svec& b, smat& c){ c = etl::outer(a, b); }),
-    CPM_SECTION_FUNCTOR("std", [](svec& a, svec& b, smat& c){ c = selected_helper(etl::outer_impl::STD, etl::outer(a, b)); })
+    PERF_SECTION_FUNCTOR("default", [](svec& a, svec& b, smat& c){ c = etl::outer(a, b); }),
+    PERF_SECTION_FUNCTOR("std", [](svec& a, svec& b, smat& c){ c = selected_helper(etl::outer_impl::STD, etl::outer(a, b)); })
     BLAS_SECTION_FUNCTOR("blas", [](svec& a, svec& b, smat& c){ c = selected_helper(etl::outer_impl::BLAS, etl::outer(a, b)); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("r = batch_outer(a,b) (s)", outer_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("r = batch_outer(a,b) (s)", outer_policy,
     FLOPS([](size_t d1, size_t d2){ return 128UL * d1 * d2; }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(128UL, d1), smat(128UL, d2), smat(d1, d2)); }),
-    CPM_SECTION_FUNCTOR("default", [](smat& a, smat& b, smat& c){ c = etl::batch_outer(a, b); }),
-    CPM_SECTION_FUNCTOR("std", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::outer_impl::STD, etl::batch_outer(a, b)); })
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& b, smat& c){ c = etl::batch_outer(a, b); }),
+    PERF_SECTION_FUNCTOR("std", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::outer_impl::STD, etl::batch_outer(a, b)); })
     VEC_SECTION_FUNCTOR("vec", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::outer_impl::VEC, etl::batch_outer(a, b)); })
     BLAS_SECTION_FUNCTOR("blas", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::outer_impl::BLAS, etl::batch_outer(a, b)); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat& a, smat& b, smat& c){ c = selected_helper(etl::outer_impl::CUBLAS, etl::batch_outer(a, b)); })
 )
 
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("r = a dot b (s)", dot_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("r = a dot b (s)", dot_policy,
     FLOPS([](size_t d1){ return 2 * d1; }),
     CPM_SECTION_INIT([](size_t d1){ return std::make_tuple(svec(d1), svec(d1)); }),
-    CPM_SECTION_FUNCTOR("default", [](svec& a, svec& b){ float_ref += etl::dot(a, b); }),
-    CPM_SECTION_FUNCTOR("std", [](svec& a, svec& b){ SELECTED_SECTION(etl::dot_impl::STD) { float_ref += etl::dot(a, b); } })
+    PERF_SECTION_FUNCTOR("default", [](svec& a, svec& b){ float_ref += etl::dot(a, b); }),
+    PERF_SECTION_FUNCTOR("std", [](svec& a, svec& b){ SELECTED_SECTION(etl::dot_impl::STD) { float_ref += etl::dot(a, b); } })
     VEC_SECTION_FUNCTOR("vec", [](svec& a, svec& b){ SELECTED_SECTION(etl::dot_impl::VEC) { float_ref += etl::dot(a, b); } })
     BLAS_SECTION_FUNCTOR("blas", [](svec& a, svec& b){ SELECTED_SECTION(etl::dot_impl::BLAS) { float_ref += etl::dot(a, b); } })
     CUBLAS_SECTION_FUNCTOR("cublas", [](svec& a, svec& b){ SELECTED_SECTION(etl::dot_impl::CUBLAS) { float_ref += etl::dot(a, b); } })
 )
 
 #ifdef ETL_EXTENDED_BENCH
-CPM_DIRECT_SECTION_TWO_PASS_NS_PF("r = a dot b (d)", dot_policy,
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("r = a dot b (d)", dot_policy,
     FLOPS([](size_t d1){ return 2 * d1; }),
     CPM_SECTION_INIT([](size_t d1){ return std::make_tuple(dvec(d1), dvec(d1)); }),
-    CPM_SECTION_FUNCTOR("default", [](dvec& a, dvec& b){ double_ref += etl::dot(a, b); }),
-    CPM_SECTION_FUNCTOR("std", [](dvec& a, dvec& b){ SELECTED_SECTION(etl::dot_impl::STD) { double_ref += etl::dot(a, b); } })
+    PERF_SECTION_FUNCTOR("default", [](dvec& a, dvec& b){ double_ref += etl::dot(a, b); }),
+    PERF_SECTION_FUNCTOR("std", [](dvec& a, dvec& b){ SELECTED_SECTION(etl::dot_impl::STD) { double_ref += etl::dot(a, b); } })
     VEC_SECTION_FUNCTOR("vec", [](dvec& a, dvec& b){ SELECTED_SECTION(etl::dot_impl::VEC) { double_ref += etl::dot(a, b); } })
     BLAS_SECTION_FUNCTOR("blas", [](dvec& a, dvec& b){ SELECTED_SECTION(etl::dot_impl::BLAS) { double_ref += etl::dot(a, b); } })
 )
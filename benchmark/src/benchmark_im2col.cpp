@@ -0,0 +1,71 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+namespace {
+
+// The kernel size is kept outside of the CPM tuple since it is not a matrix
+size_t im2col_k = 0;
+
+// Reference scalar version of im2col_direct_tr
+template <typename A, typename M>
+void im2col_scalar(M& m, const A& sub, size_t k1, size_t k2, size_t s1, size_t s2) {
+    const size_t i1 = etl::dim<0>(sub);
+    const size_t i2 = etl::dim<1>(sub);
+
+    const size_t c1 = (i1 - k1) / s1 + 1;
+    const size_t c2 = (i2 - k2) / s2 + 1;
+
+    for (size_t b_i = 0; b_i < k1; ++b_i) {
+        for (size_t b_j = 0; b_j < k2; ++b_j) {
+            for (size_t i = 0; i < c1; ++i) {
+                for (size_t j = 0; j < c2; ++j) {
+                    m(b_i * k2 + b_j, i * c2 + j) = sub(i * s1 + b_i, j * s2 + b_j);
+                }
+            }
+        }
+    }
+}
+
+} //end of anonymous namespace
+
+using im2col_policy = NARY_POLICY(
+    VALUES_POLICY(28, 32, 64, 128, 256, 512),
+    VALUES_POLICY(3, 5, 5, 3, 3, 3));
+
+using im2col_multi_policy = NARY_POLICY(
+    VALUES_POLICY(16, 32, 64, 128, 256),
+    VALUES_POLICY(28, 28, 32, 32, 32),
+    VALUES_POLICY(3, 5, 5, 3, 3));
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("im2col_direct_tr [conv][im2col][s]", im2col_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ im2col_k = d2; return std::make_tuple(smat(d1, d1), smat(d2 * d2, (d1 - d2 + 1) * (d1 - d2 + 1))); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& b){ etl::im2col_direct_tr(b, a, im2col_k, im2col_k); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat& a, smat& b){ SERIAL_SECTION { etl::im2col_direct_tr(b, a, im2col_k, im2col_k); } }),
+    PERF_SECTION_FUNCTOR("scalar", [](smat& a, smat& b){ im2col_scalar(b, a, im2col_k, im2col_k, 1, 1); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("im2col_direct_tr_stride [conv][im2col][s]", im2col_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ im2col_k = d2; return std::make_tuple(smat(d1, d1), smat(d2 * d2, ((d1 - d2) / 2 + 1) * ((d1 - d2) / 2 + 1))); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& b){ etl::im2col_direct_tr(b, a, im2col_k, im2col_k, 2, 2); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat& a, smat& b){ SERIAL_SECTION { etl::im2col_direct_tr(b, a, im2col_k, im2col_k, 2, 2); } }),
+    PERF_SECTION_FUNCTOR("scalar", [](smat& a, smat& b){ im2col_scalar(b, a, im2col_k, im2col_k, 2, 2); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("im2col_direct_tr_multi [conv][im2col][s]", im2col_multi_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2, size_t d3){ im2col_k = d3; return std::make_tuple(smat3(d1, d2, d2), smat(d3 * d3, d1 * (d2 - d3 + 1) * (d2 - d3 + 1))); }),
+    PERF_SECTION_FUNCTOR("default", [](smat3& a, smat& b){ etl::im2col_direct_tr_multi(b, a, im2col_k, im2col_k); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat3& a, smat& b){ SERIAL_SECTION { etl::im2col_direct_tr_multi(b, a, im2col_k, im2col_k); } })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("im2col_direct [conv][im2col][s]", im2col_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ im2col_k = d2; return std::make_tuple(smat(d1, d1), smat(d2 * d2, (d1 - d2 + 1) * (d1 - d2 + 1))); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& b){ etl::im2col_direct(b, a, im2col_k, im2col_k); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat& a, smat& b){ SERIAL_SECTION { etl::im2col_direct(b, a, im2col_k, im2col_k); } })
+)
@@ -98,3 +98,42 @@ CPM_TWO_PASS_NS_P(
         [](size_t d){ return 2 * d * d * 4 * 4; }
         );
 }
+
+namespace {
+
+// Scalar reference of the 2D nearest upsampling
+void upsample_2d_scalar(const smat4& a, smat4& r, size_t c1, size_t c2) {
+    for (size_t n = 0; n < etl::dim<0>(r); ++n) {
+        for (size_t k = 0; k < etl::dim<1>(r); ++k) {
+            for (size_t i = 0; i < etl::dim<2>(r); ++i) {
+                for (size_t j = 0; j < etl::dim<3>(r); ++j) {
+                    r(n, k, i, j) = a(n, k, i / c1, j / c2);
+                }
+            }
+        }
+    }
+}
+
+} //end of anonymous namespace
+
+using upsample_policy = VALUES_POLICY(8, 16, 32, 64, 128);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("upsample_2d(c=2) [upsample][s]", upsample_policy,
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(smat4(16UL, 32UL, d, d), smat4(16UL, 32UL, 2 * d, 2 * d)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat4& a, smat4& r){ r = etl::upsample_2d<2, 2>(a); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat4& a, smat4& r){ SERIAL_SECTION { r = etl::upsample_2d<2, 2>(a); } }),
+    PERF_SECTION_FUNCTOR("scalar", [](smat4& a, smat4& r){ upsample_2d_scalar(a, r, 2, 2); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("upsample_2d(c=8) [upsample][s]", upsample_policy,
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(smat4(16UL, 8UL, d, d), smat4(16UL, 8UL, 8 * d, 8 * d)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat4& a, smat4& r){ r = etl::upsample_2d<8, 8>(a); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat4& a, smat4& r){ SERIAL_SECTION { r = etl::upsample_2d<8, 8>(a); } }),
+    PERF_SECTION_FUNCTOR("scalar", [](smat4& a, smat4& r){ upsample_2d_scalar(a, r, 8, 8); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("upsample_2d_bilinear(c=2) [upsample][s]", upsample_policy,
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(smat4(16UL, 32UL, d, d), smat4(16UL, 32UL, 2 * d, 2 * d)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat4& a, smat4& r){ r = etl::upsample_2d_bilinear<2, 2>(a); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat4& a, smat4& r){ SERIAL_SECTION { r = etl::upsample_2d_bilinear<2, 2>(a); } })
+)
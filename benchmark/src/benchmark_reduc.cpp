@@ -0,0 +1,60 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+namespace {
+
+size_t index_ref = 0; ///< Keep the indices alive
+
+} //end of anonymous namespace
+
+// From L1 (16x16 floats) to the main memory (4096x4096 floats), with wide and tall matrices
+using reduc_policy = NARY_POLICY(
+    VALUES_POLICY(16, 64, 256, 1024, 4096, 16, 4096, 65536),
+    VALUES_POLICY(16, 64, 256, 1024, 4096, 4096, 16, 16));
+
+// From L1 (1K floats) to the main memory (16M floats)
+using reduc_vector_policy = VALUES_POLICY(256, 4096, 65536, 1048576, 16777216);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("argmax [reduc][s]", reduc_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), svec(d1)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, svec& r){ r = etl::argmax(a); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("max_index [reduc][s]", reduc_vector_policy,
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(svec(d)); }),
+    PERF_SECTION_FUNCTOR("default", [](svec& a){ index_ref += etl::max_index(a); }),
+    PERF_SECTION_FUNCTOR("min_index", [](svec& a){ index_ref += etl::min_index(a); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("sum_r [reduc][s]", reduc_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), svec(d1)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, svec& r){ r = etl::sum_r(a); }),
+    PERF_SECTION_FUNCTOR("mean_r", [](smat& a, svec& r){ r = etl::mean_r(a); }),
+    PERF_SECTION_FUNCTOR("rows", [](smat& a, svec& r){
+        for (size_t i = 0; i < etl::dim<0>(a); ++i) {
+            r[i] = etl::sum(a(i));
+        }
+    })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("mean_l [reduc][s]", reduc_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), svec(d2)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, svec& r){ r = etl::mean_l(a); }),
+    PERF_SECTION_FUNCTOR("sum_l", [](smat& a, svec& r){ r = etl::sum_l(a); }),
+    PERF_SECTION_FUNCTOR("rows", [](smat& a, svec& r){
+        r = 0;
+
+        for (size_t i = 0; i < etl::dim<0>(a); ++i) {
+            r += a(i);
+        }
+
+        r /= etl::dim<0>(a);
+    })
+)
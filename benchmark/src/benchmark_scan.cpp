@@ -0,0 +1,38 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+#include <numeric>
+
+using scan_policy = VALUES_POLICY(1000, 10000, 100000, 1000000, 10000000);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("cumsum [scan][s]", scan_policy,
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(svec(d), svec(d)); }),
+    PERF_SECTION_FUNCTOR("default", [](svec& a, svec& b){ b = etl::cumsum(a); }),
+    PERF_SECTION_FUNCTOR("serial", [](svec& a, svec& b){ SERIAL_SECTION { b = etl::cumsum(a); } }),
+    PERF_SECTION_FUNCTOR("std", [](svec& a, svec& b){ std::partial_sum(a.begin(), a.end(), b.begin()); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("cumsum_r [scan][s]", square_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), smat(d1, d2)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& b){ b = etl::cumsum_r(a); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat& a, smat& b){ SERIAL_SECTION { b = etl::cumsum_r(a); } })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("cumsum_l [scan][s]", square_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), smat(d1, d2)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& b){ b = etl::cumsum_l(a); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat& a, smat& b){ SERIAL_SECTION { b = etl::cumsum_l(a); } })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("integral_image [scan][s]", square_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), smat(d1, d2)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& b){ b = etl::integral_image(a); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat& a, smat& b){ SERIAL_SECTION { b = etl::integral_image(a); } })
+)
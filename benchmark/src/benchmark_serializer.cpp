@@ -0,0 +1,96 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+#include <iostream>
+#include <sstream>
+
+// The serialization benchmarks are done in memory to not measure the disk.
+// The "FLOPS" of these benchmarks are the number of bytes of the matrix,
+// the reported throughput is therefore in bytes per second.
+//
+// The compressed sections are using activations-like data (ReLU of a
+// smooth signal, quantized) and the compression ratio is printed once per
+// size when the load benchmark is initialized.
+
+namespace {
+
+// The serialized matrices, kept outside of the CPM tuple since they are not matrices
+std::string serialized;
+std::string serialized_legacy;
+std::string serialized_compressed;
+
+// Fill a matrix with compressible values
+template <typename M>
+M& compressible(M& matrix) {
+    for (size_t i = 0; i < etl::size(matrix); ++i) {
+        matrix[i] = std::max(0.0f, std::round(std::sin(float(i) * 0.01f) * 256.0f) / 256.0f);
+    }
+
+    return matrix;
+}
+
+// Serialize a matrix in the old format, one value at a time
+template <typename M>
+void legacy_serialize(etl::serializer<std::ostringstream>& os, const M& matrix) {
+    for (size_t i = 0; i < etl::dimensions(matrix); ++i) {
+        os << etl::dim(matrix, i);
+    }
+
+    for (const auto& value : matrix) {
+        os << value;
+    }
+}
+
+// Deserialize a matrix in the old format, one value at a time
+template <typename M>
+void legacy_deserialize(etl::deserializer<std::istringstream>& is, M& matrix) {
+    size_t d1;
+    size_t d2;
+
+    is >> d1 >> d2;
+
+    for (auto& value : matrix) {
+        is >> value;
+    }
+}
+
+} //end of anonymous namespace
+
+using serializer_policy = VALUES_POLICY(1000, 10000, 100000, 1000000, 10000000, 50000000);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("save [serializer][s]", serializer_policy,
+    FLOPS([](size_t d){ return d * sizeof(float); }),
+    CPM_SECTION_INIT([](size_t d){ smat a(d / 100 + 1, 100); return std::make_tuple(compressible(a)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a){ etl::serializer<std::ostringstream> os; os << a; }),
+    PERF_SECTION_FUNCTOR("compressed", [](smat& a){ etl::serializer<std::ostringstream> os; os.compress(); os << a; }),
+    PERF_SECTION_FUNCTOR("legacy", [](smat& a){ etl::serializer<std::ostringstream> os; legacy_serialize(os, a); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("load [serializer][s]", serializer_policy,
+    FLOPS([](size_t d){ return d * sizeof(float); }),
+    CPM_SECTION_INIT([](size_t d){
+        smat a(d / 100 + 1, 100);
+        compressible(a);
+        etl::serializer<std::ostringstream> os;
+        os << a;
+        serialized = os.stream.str();
+        etl::serializer<std::ostringstream> compressed_os;
+        compressed_os.compress();
+        compressed_os << a;
+        serialized_compressed = compressed_os.stream.str();
+        std::cout << "compression ratio (" << etl::size(a) << " floats): " << double(serialized.size()) / serialized_compressed.size() << std::endl;
+        etl::serializer<std::ostringstream> legacy_os;
+        legacy_serialize(legacy_os, a);
+        serialized_legacy = legacy_os.stream.str();
+        return std::make_tuple(smat(d / 100 + 1, 100)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a){ etl::deserializer<std::istringstream> is(serialized); is >> a; }),
+    PERF_SECTION_FUNCTOR("compressed", [](smat& a){ etl::deserializer<std::istringstream> is(serialized_compressed); is >> a; }),
+    PERF_SECTION_FUNCTOR("legacy", [](smat& a){ etl::deserializer<std::istringstream> is(serialized_legacy); legacy_deserialize(is, a); })
+)
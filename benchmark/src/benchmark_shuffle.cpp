@@ -0,0 +1,29 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+// From L1 (1K floats) to the main memory (16M floats)
+using shuffle_vector_policy = VALUES_POLICY(256, 4096, 65536, 1048576, 16777216);
+
+// Data sets of samples (with their labels) of various sizes (from L1 to the main memory)
+using shuffle_matrix_policy = NARY_POLICY(
+    VALUES_POLICY(64, 1024, 16384, 65536, 1024, 60000),
+    VALUES_POLICY(16, 16, 16, 16, 784, 784));
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("shuffle (vector) [shuffle][s]", shuffle_vector_policy,
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(svec(d), svec(d)); }),
+    PERF_SECTION_FUNCTOR("shuffle", [](svec& a, svec& /*b*/){ etl::shuffle(a); }),
+    PERF_SECTION_FUNCTOR("parallel_shuffle", [](svec& a, svec& b){ etl::parallel_shuffle(a, b); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("shuffle (matrix) [shuffle][s]", shuffle_matrix_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), smat(d1, 10)); }),
+    PERF_SECTION_FUNCTOR("shuffle", [](smat& a, smat& /*b*/){ etl::shuffle(a); }),
+    PERF_SECTION_FUNCTOR("parallel_shuffle", [](smat& a, smat& b){ etl::parallel_shuffle(a, b); })
+)
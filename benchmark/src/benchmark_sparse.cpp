@@ -0,0 +1,90 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+namespace {
+
+constexpr double sparse_density = 0.01; ///< The ratio of non-zeros of the sparse matrices
+
+// The sparse matrices are kept outside of the CPM tuple so that their
+// density is not modified by the randomization
+std::unique_ptr<etl::sparse_matrix<float>> sparse_a;
+std::unique_ptr<etl::sparse_matrix<float>> sparse_b;
+std::unique_ptr<etl::sparse_matrix<float>> sparse_c;
+
+// The dense version of the sparse matrices
+smat dense_a;
+smat dense_b;
+
+void init_sparse(size_t d) {
+    std::mt19937_64 generator(42);
+    std::uniform_real_distribution<float> value_distribution(-1.0f, 1.0f);
+    std::uniform_int_distribution<size_t> index_distribution(0, d - 1);
+
+    dense_a = smat(d, d, 0.0f);
+    dense_b = smat(d, d, 0.0f);
+
+    for (size_t n = 0; n < sparse_density * d * d; ++n) {
+        dense_a(index_distribution(generator), index_distribution(generator)) = value_distribution(generator);
+        dense_b(index_distribution(generator), index_distribution(generator)) = value_distribution(generator);
+    }
+
+    sparse_a = std::make_unique<etl::sparse_matrix<float>>(d, d);
+    sparse_b = std::make_unique<etl::sparse_matrix<float>>(d, d);
+    sparse_c = std::make_unique<etl::sparse_matrix<float>>(d, d);
+
+    *sparse_a = dense_a;
+    *sparse_b = dense_b;
+}
+
+} //end of anonymous namespace
+
+// The accesses to the sparse matrices are linear in the number of non-zeros
+using sparse_policy = VALUES_POLICY(32, 64, 128, 256);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("sparse_build [sparse][s]", sparse_policy,
+    CPM_SECTION_INIT([](size_t d){ init_sparse(d); return std::make_tuple(smat(d, d)); }),
+    PERF_SECTION_FUNCTOR("assign", [](smat& /*r*/){ *sparse_c = dense_a; }),
+    PERF_SECTION_FUNCTOR("set", [](smat& /*r*/){
+        sparse_c = std::make_unique<etl::sparse_matrix<float>>(etl::dim<0>(dense_a), etl::dim<1>(dense_a));
+
+        for (size_t i = 0; i < etl::dim<0>(dense_a); ++i) {
+            for (size_t j = 0; j < etl::dim<1>(dense_a); ++j) {
+                if (dense_a(i, j) != 0.0f) {
+                    sparse_c->set(i, j, dense_a(i, j));
+                }
+            }
+        }
+    })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("sparse_get [sparse][s]", sparse_policy,
+    CPM_SECTION_INIT([](size_t d){ init_sparse(d); return std::make_tuple(smat(d, d)); }),
+    PERF_SECTION_FUNCTOR("get", [](smat& r){
+        for (size_t i = 0; i < etl::dim<0>(r); ++i) {
+            for (size_t j = 0; j < etl::dim<1>(r); ++j) {
+                r(i, j) = sparse_a->get(i, j);
+            }
+        }
+    }),
+    PERF_SECTION_FUNCTOR("dense", [](smat& r){ r = dense_a; })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("sparse_add [sparse][s]", sparse_policy,
+    CPM_SECTION_INIT([](size_t d){ init_sparse(d); return std::make_tuple(smat(d, d)); }),
+    PERF_SECTION_FUNCTOR("sparse", [](smat& /*r*/){ *sparse_c = *sparse_a + *sparse_b; }),
+    PERF_SECTION_FUNCTOR("dense", [](smat& r){ r = dense_a + dense_b; })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("sparse_mul [sparse][s]", sparse_policy,
+    CPM_SECTION_INIT([](size_t d){ init_sparse(d); return std::make_tuple(smat(d, d)); }),
+    PERF_SECTION_FUNCTOR("sparse", [](smat& /*r*/){ *sparse_c = *sparse_a >> *sparse_b; }),
+    PERF_SECTION_FUNCTOR("mixed", [](smat& /*r*/){ *sparse_c = *sparse_a >> dense_b; }),
+    PERF_SECTION_FUNCTOR("dense", [](smat& r){ r = dense_a >> dense_b; })
+)
@@ -0,0 +1,61 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+#include "stream_kernels.hpp"
+
+// STREAM-style benchmarks of the elementwise expressions against memcpy and
+// hand-written intrinsics. The "FLOPS" of these benchmarks are the bytes
+// moved by the kernels (STREAM counting), the throughput is the bandwidth.
+// The roofline program reports the same kernels in percent of the peak.
+
+namespace {
+
+constexpr double stream_scalar = 3.0;
+
+} //end of anonymous namespace
+
+using stream_policy = VALUES_POLICY(512, 4096, 32768, 262144, 2097152, 8388608);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("stream copy [stream][d]", stream_policy,
+    FLOPS([](size_t d){ return etl_bench::stream_bytes(etl_bench::stream_kernel::COPY, d); }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dvec(d), dvec(d)); }),
+    PERF_SECTION_FUNCTOR("default", [](dvec& a, dvec& b){ a = b; }),
+    PERF_SECTION_FUNCTOR("serial", [](dvec& a, dvec& b){ SERIAL_SECTION { a = b; } }),
+    PERF_SECTION_FUNCTOR("memcpy", [](dvec& a, dvec& b){ etl_bench::stream_memcpy(a.memory_start(), b.memory_start(), 0, etl::size(a)); }),
+    PERF_SECTION_FUNCTOR("intrinsics", [](dvec& a, dvec& b){
+        etl_bench::stream_run(etl_bench::stream_kernel::COPY, a.memory_start(), b.memory_start(), nullptr, stream_scalar, 0, etl::size(a)); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("stream scale [stream][d]", stream_policy,
+    FLOPS([](size_t d){ return etl_bench::stream_bytes(etl_bench::stream_kernel::SCALE, d); }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dvec(d), dvec(d)); }),
+    PERF_SECTION_FUNCTOR("default", [](dvec& a, dvec& b){ a = stream_scalar * b; }),
+    PERF_SECTION_FUNCTOR("serial", [](dvec& a, dvec& b){ SERIAL_SECTION { a = stream_scalar * b; } }),
+    PERF_SECTION_FUNCTOR("intrinsics", [](dvec& a, dvec& b){
+        etl_bench::stream_run(etl_bench::stream_kernel::SCALE, a.memory_start(), b.memory_start(), nullptr, stream_scalar, 0, etl::size(a)); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("stream add [stream][d]", stream_policy,
+    FLOPS([](size_t d){ return etl_bench::stream_bytes(etl_bench::stream_kernel::ADD, d); }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dvec(d), dvec(d), dvec(d)); }),
+    PERF_SECTION_FUNCTOR("default", [](dvec& a, dvec& b, dvec& c){ a = b + c; }),
+    PERF_SECTION_FUNCTOR("serial", [](dvec& a, dvec& b, dvec& c){ SERIAL_SECTION { a = b + c; } }),
+    PERF_SECTION_FUNCTOR("intrinsics", [](dvec& a, dvec& b, dvec& c){
+        etl_bench::stream_run(etl_bench::stream_kernel::ADD, a.memory_start(), b.memory_start(), c.memory_start(), stream_scalar, 0, etl::size(a)); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("stream triad [stream][d]", stream_policy,
+    FLOPS([](size_t d){ return etl_bench::stream_bytes(etl_bench::stream_kernel::TRIAD, d); }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dvec(d), dvec(d), dvec(d)); }),
+    PERF_SECTION_FUNCTOR("default", [](dvec& a, dvec& b, dvec& c){ a = b + stream_scalar * c; }),
+    PERF_SECTION_FUNCTOR("serial", [](dvec& a, dvec& b, dvec& c){ SERIAL_SECTION { a = b + stream_scalar * c; } }),
+    PERF_SECTION_FUNCTOR("intrinsics", [](dvec& a, dvec& b, dvec& c){
+        etl_bench::stream_run(etl_bench::stream_kernel::TRIAD, a.memory_start(), b.memory_start(), c.memory_start(), stream_scalar, 0, etl::size(a)); })
+)
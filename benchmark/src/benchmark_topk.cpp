@@ -0,0 +1,51 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+namespace {
+
+constexpr size_t topk_columns = 1000000; ///< The number of scores per row
+constexpr size_t topk_k       = 100;     ///< The number of selected scores per row
+
+/*!
+ * \brief Top-k of each row with a copy and std::nth_element
+ */
+void topk_nth_element(smat& a, smat& values, etl::dyn_matrix<size_t>& indices) {
+    std::vector<std::pair<float, size_t>> row(topk_columns);
+
+    auto greater = [](const std::pair<float, size_t>& lhs, const std::pair<float, size_t>& rhs) { return lhs.first > rhs.first; };
+
+    for (size_t i = 0; i < etl::dim<0>(a); ++i) {
+        for (size_t j = 0; j < topk_columns; ++j) {
+            row[j] = std::make_pair(a(i, j), j);
+        }
+
+        std::nth_element(row.begin(), row.begin() + topk_k, row.end(), greater);
+        std::sort(row.begin(), row.begin() + topk_k, greater);
+
+        for (size_t j = 0; j < topk_k; ++j) {
+            values(i, j)  = row[j].first;
+            indices(i, j) = row[j].second;
+        }
+    }
+}
+
+// The indices are kept outside of the CPM tuple since they are not floating points
+etl::dyn_matrix<size_t> topk_indices;
+
+} //end of anonymous namespace
+
+using topk_policy = VALUES_POLICY(1, 4, 16, 64);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("topk [topk][s]", topk_policy,
+    CPM_SECTION_INIT([](size_t d){ topk_indices = etl::dyn_matrix<size_t>(d, topk_k); return std::make_tuple(smat(d, topk_columns), smat(d, topk_k)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& v){ etl::topk(a, topk_k, v, topk_indices); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat& a, smat& v){ SERIAL_SECTION { etl::topk(a, topk_k, v, topk_indices); } }),
+    PERF_SECTION_FUNCTOR("nth_element", [](smat& a, smat& v){ topk_nth_element(a, v, topk_indices); })
+)
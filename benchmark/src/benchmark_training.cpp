@@ -0,0 +1,54 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+#include "training.hpp"
+
+// End-to-end training steps (forward, backward and SGD update) of small
+// networks. The "FLOPS" of these benchmarks are the samples of the
+// mini-batch, the throughput is in samples per second. The training program
+// reports the share of time of each operation of the steps.
+
+namespace {
+
+// The networks are kept outside of the CPM tuple, only the inputs are randomized
+std::unique_ptr<etl_bench::mlp<float>> mlp_net;
+std::unique_ptr<etl_bench::cnn<float>> cnn_net;
+std::unique_ptr<etl_bench::lstm<float>> lstm_net;
+
+} //end of anonymous namespace
+
+using training_policy = VALUES_POLICY(16, 32, 64, 128, 256);
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("mlp_step [training][s]", training_policy,
+    FLOPS([](size_t d){ return d; }),
+    CPM_SECTION_INIT([](size_t d){
+        mlp_net = std::make_unique<etl_bench::mlp<float>>(d, 784, 500, 10);
+        return std::make_tuple(smat(d, 784)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& x){ mlp_net->step(x, etl_bench::null_timer()); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat& x){ SERIAL_SECTION { mlp_net->step(x, etl_bench::null_timer()); } })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("cnn_step [training][s]", training_policy,
+    FLOPS([](size_t d){ return d; }),
+    CPM_SECTION_INIT([](size_t d){
+        cnn_net = std::make_unique<etl_bench::cnn<float>>(d, 1, 28, 8, 5, 10);
+        return std::make_tuple(smat4(d, 1, 28, 28)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat4& x){ cnn_net->step(x, etl_bench::null_timer()); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat4& x){ SERIAL_SECTION { cnn_net->step(x, etl_bench::null_timer()); } })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_PF("lstm_step [training][s]", training_policy,
+    FLOPS([](size_t d){ return d; }),
+    CPM_SECTION_INIT([](size_t d){
+        lstm_net = std::make_unique<etl_bench::lstm<float>>(d, 128, 256);
+        return std::make_tuple(smat(d, 128)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& x){ lstm_net->step(x, etl_bench::null_timer()); }),
+    PERF_SECTION_FUNCTOR("serial", [](smat& x){ SERIAL_SECTION { lstm_net->step(x, etl_bench::null_timer()); } })
+)
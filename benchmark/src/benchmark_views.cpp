@@ -0,0 +1,107 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#define CPM_LIB
+#include "benchmark.hpp"
+
+// Benchmarks of the views and of the transformers used as views (rep and
+// flips). The "direct" sections are the plain copy of the same number of
+// elements, the reference of the views.
+
+// From L1 (16x16 floats) to the main memory (4096x4096 floats)
+using view_policy = NARY_POLICY(
+    VALUES_POLICY(16, 64, 256, 1024, 4096),
+    VALUES_POLICY(16, 64, 256, 1024, 4096));
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("rep_r [views][s]", view_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(svec(d1), smat(d1, d2)); }),
+    PERF_SECTION_FUNCTOR("default", [](svec& a, smat& r){ r = etl::rep(a, etl::dim<1>(r)); }),
+    PERF_SECTION_FUNCTOR("rows", [](svec& a, smat& r){
+        for (size_t i = 0; i < etl::dim<0>(r); ++i) {
+            r(i) = a[i];
+        }
+    })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("rep_l [views][s]", view_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(svec(d2), smat(d1, d2)); }),
+    PERF_SECTION_FUNCTOR("default", [](svec& a, smat& r){ r = etl::rep_l(a, etl::dim<0>(r)); }),
+    PERF_SECTION_FUNCTOR("rows", [](svec& a, smat& r){
+        for (size_t i = 0; i < etl::dim<0>(r); ++i) {
+            r(i) = a;
+        }
+    })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("flip [views][s]", view_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), smat(d1, d2)); }),
+    PERF_SECTION_FUNCTOR("hflip", [](smat& a, smat& r){ r = etl::hflip(a); }),
+    PERF_SECTION_FUNCTOR("vflip", [](smat& a, smat& r){ r = etl::vflip(a); }),
+    PERF_SECTION_FUNCTOR("fflip", [](smat& a, smat& r){ r = etl::fflip(a); }),
+    PERF_SECTION_FUNCTOR("direct", [](smat& a, smat& r){ r = a; })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("sub_view [views][s]", view_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), smat(d1, d2)); }),
+    PERF_SECTION_FUNCTOR("rows", [](smat& a, smat& r){
+        for (size_t i = 0; i < etl::dim<0>(a); ++i) {
+            r(i) = a(i);
+        }
+    }),
+    PERF_SECTION_FUNCTOR("rows_expr", [](smat& a, smat& r){
+        for (size_t i = 0; i < etl::dim<0>(a); ++i) {
+            r(i) = a(i) + a(i);
+        }
+    }),
+    PERF_SECTION_FUNCTOR("direct", [](smat& a, smat& r){ r = a; })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("slice [views][s]", view_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), smat(d1 / 2, d2)); }),
+    PERF_SECTION_FUNCTOR("default", [](smat& a, smat& r){ r = etl::slice(a, etl::dim<0>(r) / 2, etl::dim<0>(r) / 2 + etl::dim<0>(r)); }),
+    PERF_SECTION_FUNCTOR("expr", [](smat& a, smat& r){ r = 2.0f * etl::slice(a, etl::dim<0>(r) / 2, etl::dim<0>(r) / 2 + etl::dim<0>(r)); })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("sub_matrix_2d [views][s]", view_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), smat(d1 / 2, d2 / 2)); }),
+    PERF_SECTION_FUNCTOR("read", [](smat& a, smat& r){ r = etl::sub(a, etl::dim<0>(r) / 2, etl::dim<1>(r) / 2, etl::dim<0>(r), etl::dim<1>(r)); }),
+    PERF_SECTION_FUNCTOR("write", [](smat& a, smat& r){ etl::sub(a, etl::dim<0>(r) / 2, etl::dim<1>(r) / 2, etl::dim<0>(r), etl::dim<1>(r)) = r; }),
+    PERF_SECTION_FUNCTOR("element", [](smat& a, smat& r){
+        auto s = etl::sub(a, etl::dim<0>(r) / 2, etl::dim<1>(r) / 2, etl::dim<0>(r), etl::dim<1>(r));
+
+        for (size_t i = 0; i < etl::dim<0>(r); ++i) {
+            for (size_t j = 0; j < etl::dim<1>(r); ++j) {
+                r(i, j) = s(i, j);
+            }
+        }
+    })
+)
+
+PERF_DIRECT_SECTION_TWO_PASS_NS_P("strided [views][s]", view_policy,
+    CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1, d2), smat(d1 / 2, d2 / 2)); }),
+    PERF_SECTION_FUNCTOR("downsample", [](smat& a, smat& r){ r = etl::strided<1>(etl::strided(a, 0, etl::dim<0>(a), 2), 0, etl::dim<1>(a), 2); }),
+    PERF_SECTION_FUNCTOR("loop", [](smat& a, smat& r){
+        for (size_t i = 0; i < etl::dim<0>(r); ++i) {
+            for (size_t j = 0; j < etl::dim<1>(r); ++j) {
+                r(i, j) = a(2 * i, 2 * j);
+            }
+        }
+    }),
+    PERF_SECTION_FUNCTOR("raw", [](smat& a, smat& r){
+        const size_t n = etl::dim<1>(a);
+        const size_t m = etl::dim<1>(r);
+
+        const float* src = a.memory_start();
+        float* dst       = r.memory_start();
+
+        for (size_t i = 0; i < etl::dim<0>(r); ++i) {
+            for (size_t j = 0; j < m; ++j) {
+                dst[i * m + j] = src[2 * i * n + 2 * j];
+            }
+        }
+    })
+)
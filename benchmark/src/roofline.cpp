@@ -0,0 +1,297 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+// Roofline of the elementwise expressions.
+//
+// Usage: roofline [max_elements]
+//
+// For each size, from the L1 cache to the main memory, the peak bandwidth is
+// measured with memcpy and the hand-written STREAM kernels on 1 to N threads
+// (powers of two up to the number of hardware threads). The STREAM kernels
+// written with ETL expressions are then measured in serial and default
+// modes and in parallel mode on 2 to etl::threads threads (powers of two and
+// etl::threads, with THREADS_SECTION), and reported in percent of this peak.
+//
+// The vectorization mode is fixed at compile-time, the program must be
+// compiled once per mode (e.g. with and without ETL_VECTORIZE_FULL, with
+// -mavx or -msse3) to compare them.
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "etl/etl.hpp"
+
+#include "stream_kernels.hpp"
+
+namespace {
+
+using timer_clock = std::chrono::steady_clock;
+
+constexpr double scalar = 3.0;
+
+constexpr size_t trials = 5; // The best of the trials is kept (as STREAM)
+
+const etl_bench::stream_kernel kernels[] = {
+    etl_bench::stream_kernel::COPY,
+    etl_bench::stream_kernel::SCALE,
+    etl_bench::stream_kernel::ADD,
+    etl_bench::stream_kernel::TRIAD};
+
+const char* vector_mode_name() {
+    if (!etl::vec_enabled) {
+        return "none";
+    }
+
+    switch (etl::vector_mode) {
+        case etl::vector_mode_t::NONE:
+            return "none";
+        case etl::vector_mode_t::SSE3:
+            return "sse3";
+        case etl::vector_mode_t::AVX:
+            return "avx";
+        case etl::vector_mode_t::AVX512:
+            return "avx512";
+    }
+
+    return "unknown";
+}
+
+// Returns the level of the memory hierarchy holding the given number of bytes
+std::string memory_level(size_t bytes) {
+    const long caches[] = {sysconf(_SC_LEVEL1_DCACHE_SIZE), sysconf(_SC_LEVEL2_CACHE_SIZE), sysconf(_SC_LEVEL3_CACHE_SIZE)};
+
+    for (size_t i = 0; i < 3; ++i) {
+        if (caches[i] > 0 && bytes <= size_t(caches[i])) {
+            return "L" + std::to_string(i + 1);
+        }
+    }
+
+    return "DRAM";
+}
+
+// Returns the best bandwidth (GB/s) of the given function, run reps times
+// per trial, the number of repetitions is calibrated to run at least 2ms
+template <typename Functor>
+double measure(size_t bytes, Functor&& functor) {
+    size_t reps = 1;
+
+    while (true) {
+        auto start = timer_clock::now();
+        functor(reps);
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_clock::now() - start).count();
+
+        if (ns > 2000000 || reps > (size_t(1) << 30)) {
+            break;
+        }
+
+        reps *= 2;
+    }
+
+    double best = 0.0;
+
+    for (size_t t = 0; t < trials; ++t) {
+        auto start = timer_clock::now();
+        functor(reps);
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_clock::now() - start).count();
+
+        best = std::max(best, double(bytes) * reps / ns);
+    }
+
+    return best;
+}
+
+// Run a function on the given number of threads, each with its (cache line
+// aligned) part of [0, n)
+template <typename Functor>
+void run_threads(size_t threads, size_t n, Functor&& functor) {
+    if (threads == 1) {
+        functor(0, n);
+        return;
+    }
+
+    const size_t block = (n / threads + 7) & ~size_t(7);
+
+    std::vector<std::thread> pool;
+
+    for (size_t t = 0; t < threads; ++t) {
+        const size_t first = std::min(n, t * block);
+        const size_t last  = t == threads - 1 ? n : std::min(n, first + block);
+
+        pool.emplace_back([&functor, first, last] { functor(first, last); });
+    }
+
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+void print_row(const std::string& level, size_t n, const std::string& kernel, const std::string& impl, const std::string& threads, double gbs, double peak) {
+    std::cout << std::left << std::setw(10) << n << std::setw(6) << level << std::setw(8) << kernel << std::setw(14) << impl << std::right
+              << std::setw(8) << threads << std::setw(10) << std::fixed << std::setprecision(2) << gbs << std::setw(9) << std::setprecision(1)
+              << 100.0 * gbs / peak << "%\n";
+}
+
+void roofline(size_t n, const std::vector<size_t>& thread_counts, const std::vector<size_t>& etl_thread_counts) {
+    etl::dyn_vector<double> a(n);
+    etl::dyn_vector<double> b(n);
+    etl::dyn_vector<double> c(n);
+
+    a = 1.0;
+    b = 2.0;
+    c = 0.5;
+
+    double* pa = a.memory_start();
+    double* pb = b.memory_start();
+    double* pc = c.memory_start();
+
+    const auto level = memory_level(3 * n * sizeof(double));
+
+    // 1. Measure the peak with the hand-written kernels
+
+    struct raw_result {
+        std::string kernel;
+        std::string impl;
+        size_t threads;
+        double gbs;
+    };
+
+    std::vector<raw_result> raw;
+
+    for (auto threads : thread_counts) {
+        raw.push_back({"copy", "memcpy", threads, measure(etl_bench::stream_bytes(etl_bench::stream_kernel::COPY, n), [&](size_t reps) {
+            run_threads(threads, n, [&](size_t first, size_t last) {
+                for (size_t r = 0; r < reps; ++r) {
+                    etl_bench::stream_memcpy(pa, pb, first, last);
+                }
+            });
+        })});
+
+        for (auto kernel : kernels) {
+            raw.push_back({etl_bench::stream_name(kernel), etl_bench::stream_intrinsics(), threads, measure(etl_bench::stream_bytes(kernel, n), [&](size_t reps) {
+                run_threads(threads, n, [&](size_t first, size_t last) {
+                    for (size_t r = 0; r < reps; ++r) {
+                        etl_bench::stream_run(kernel, pa, pb, pc, scalar, first, last);
+                    }
+                });
+            })});
+        }
+    }
+
+    double peak = 0.0;
+
+    for (auto& result : raw) {
+        peak = std::max(peak, result.gbs);
+    }
+
+    for (auto& result : raw) {
+        print_row(level, n, result.kernel, result.impl, std::to_string(result.threads), result.gbs, peak);
+    }
+
+    // 2. Measure the ETL expressions
+
+    auto etl_kernel = [&](etl_bench::stream_kernel kernel) {
+        switch (kernel) {
+            case etl_bench::stream_kernel::COPY:
+                a = b;
+                break;
+            case etl_bench::stream_kernel::SCALE:
+                a = scalar * b;
+                break;
+            case etl_bench::stream_kernel::ADD:
+                a = b + c;
+                break;
+            case etl_bench::stream_kernel::TRIAD:
+                a = b + scalar * c;
+                break;
+        }
+    };
+
+    for (auto kernel : kernels) {
+        const auto bytes = etl_bench::stream_bytes(kernel, n);
+
+        auto serial = measure(bytes, [&](size_t reps) {
+            SERIAL_SECTION {
+                for (size_t r = 0; r < reps; ++r) {
+                    etl_kernel(kernel);
+                }
+            }
+        });
+
+        auto def = measure(bytes, [&](size_t reps) {
+            for (size_t r = 0; r < reps; ++r) {
+                etl_kernel(kernel);
+            }
+        });
+
+        print_row(level, n, etl_bench::stream_name(kernel), "etl serial", "1", serial, peak);
+        print_row(level, n, etl_bench::stream_name(kernel), "etl default", etl::select_parallel(n) ? std::to_string(etl::parallel_threads()) : "1", def, peak);
+
+        for (auto threads : etl_thread_counts) {
+            auto parallel = measure(bytes, [&](size_t reps) {
+                THREADS_SECTION(threads) {
+                    PARALLEL_SECTION {
+                        for (size_t r = 0; r < reps; ++r) {
+                            etl_kernel(kernel);
+                        }
+                    }
+                }
+            });
+
+            print_row(level, n, etl_bench::stream_name(kernel), "etl parallel", std::to_string(threads), parallel, peak);
+        }
+    }
+
+    std::cout << std::left << std::setw(10) << n << std::setw(6) << level << "peak: " << std::fixed << std::setprecision(2) << peak << " GB/s\n\n";
+}
+
+} //end of anonymous namespace
+
+int main(int argc, char* argv[]) {
+    const size_t max_n = argc > 1 ? std::stoul(argv[1]) : size_t(1) << 23;
+
+    std::vector<size_t> thread_counts;
+
+    const size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+
+    for (size_t t = 1; t < hardware; t *= 2) {
+        thread_counts.push_back(t);
+    }
+
+    thread_counts.push_back(hardware);
+
+    // The thread counts of the parallel ETL expressions, limited at runtime
+    std::vector<size_t> etl_thread_counts;
+
+    if (etl::parallel_support && etl::threads > 1) {
+        for (size_t t = 2; t < etl::threads; t *= 2) {
+            etl_thread_counts.push_back(t);
+        }
+
+        etl_thread_counts.push_back(etl::threads);
+    }
+
+    std::cout << "Roofline of the elementwise expressions (double)\n"
+              << "  ETL vectorization: " << vector_mode_name() << ", intrinsics: " << etl_bench::stream_intrinsics() << ", ETL threads: " << etl::threads
+              << ", hardware threads: " << hardware << "\n"
+              << "  The peak of each size is the best bandwidth of memcpy and of the intrinsics, on any number of threads\n\n";
+
+    std::cout << std::left << std::setw(10) << "elements" << std::setw(6) << "level" << std::setw(8) << "kernel" << std::setw(14) << "impl" << std::right
+              << std::setw(8) << "threads" << std::setw(10) << "GB/s" << std::setw(10) << "% peak" << "\n";
+
+    for (size_t n = 512; n <= max_n; n *= 4) {
+        roofline(n, thread_counts, etl_thread_counts);
+    }
+
+    return 0;
+}
@@ -0,0 +1,246 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+// Parallel scaling of the parallel kernels.
+//
+// Usage: scaling [kernel]...
+//
+// Each parallel kernel is run at several sizes in serial and in parallel
+// with 1 to etl::threads threads (powers of two and etl::threads), using
+// THREADS_SECTION. For each size, the speedup and the efficiency (speedup
+// divided by the number of threads) over the serial version are reported.
+// The smallest size from which the parallel version with all the threads is
+// always at least 10% faster than the serial version is reported as the
+// suggested parallel threshold of the kernel, in the unit of its current
+// threshold: a number of elements or one of the dimensions of the kernel
+// (for instance the batch size N of max_pool_2d).
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "etl/etl.hpp"
+
+namespace {
+
+using timer_clock = std::chrono::steady_clock;
+
+constexpr size_t trials = 5; // The best of the trials is kept
+
+float sink = 0.0f; // Keep the results of the reductions alive
+
+constexpr double margin = 0.9; // The parallel version must be at least 10% faster to be considered better
+
+// A parallel kernel prepared at a given size
+struct prepared {
+    size_t elements;            // The number of elements of the operation
+    std::function<void()> run;  // Run the operation once
+};
+
+// A parallel kernel
+struct kernel {
+    std::string name;                        // The name of the kernel
+    std::string threshold;                   // The current parallel threshold of the kernel
+    std::string unit;                        // The unit of the threshold, the size swept
+    std::vector<size_t> sizes;               // The sizes to run the kernel at
+    std::function<prepared(size_t)> prepare; // Prepare the kernel at the given size
+};
+
+// Returns the best time (ns) of one call of the given function, the number
+// of calls per trial is calibrated to run at least 1ms
+template <typename Functor>
+double measure(Functor&& functor) {
+    size_t reps = 1;
+
+    while (true) {
+        auto start = timer_clock::now();
+
+        for (size_t r = 0; r < reps; ++r) {
+            functor();
+        }
+
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_clock::now() - start).count();
+
+        if (ns > 1000000 || reps > (size_t(1) << 24)) {
+            break;
+        }
+
+        reps *= 2;
+    }
+
+    double best = 0.0;
+
+    for (size_t t = 0; t < trials; ++t) {
+        auto start = timer_clock::now();
+
+        for (size_t r = 0; r < reps; ++r) {
+            functor();
+        }
+
+        double ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_clock::now() - start).count() / double(reps);
+
+        best = t == 0 ? ns : std::min(best, ns);
+    }
+
+    return best;
+}
+
+std::vector<size_t> geometric(size_t first, size_t last, size_t factor) {
+    std::vector<size_t> sizes;
+
+    for (size_t d = first; d <= last; d *= factor) {
+        sizes.push_back(d);
+    }
+
+    return sizes;
+}
+
+std::vector<kernel> kernels() {
+    std::vector<kernel> k;
+
+    k.push_back({"assign", "parallel_threshold = " + std::to_string(etl::parallel_threshold), "elements", geometric(1024, 4 * 1024 * 1024, 4), [](size_t n) {
+        etl::dyn_vector<float> a(n, 1.0f);
+        etl::dyn_vector<float> b(n, 2.0f);
+        etl::dyn_vector<float> c(n);
+
+        return prepared{n, [a, b, c]() mutable { c = a + b; }};
+    }});
+
+    k.push_back({"sum", "sum_parallel_threshold = " + std::to_string(etl::sum_parallel_threshold), "elements", geometric(1024, 4 * 1024 * 1024, 4), [](size_t n) {
+        etl::dyn_vector<float> a(n, 1.0f);
+
+        return prepared{n, [a]() mutable { sink += etl::sum(a); }};
+    }});
+
+    k.push_back({"outer", "M >= 2 && N > 25", "N", geometric(16, 1024, 2), [](size_t n) {
+        etl::dyn_vector<float> a(n, 1.0f);
+        etl::dyn_vector<float> b(n, 2.0f);
+        etl::dyn_matrix<float> c(n, n);
+
+        return prepared{n * n, [a, b, c]() mutable { c = etl::outer(a, b); }};
+    }});
+
+    k.push_back({"max_pool_2d", "N >= 2", "N", geometric(1, 256, 2), [](size_t n) {
+        etl::dyn_matrix<float, 3> a(n, 32, 32, 1.0f);
+        etl::dyn_matrix<float, 3> c(n, 16, 16);
+
+        return prepared{n * 32 * 32, [a, c]() mutable { c = etl::max_pool_2d<2, 2>(a); }};
+    }});
+
+    k.push_back({"bias_batch_mean", "K >= 2", "K", geometric(2, 256, 2), [](size_t n) {
+        etl::dyn_matrix<float, 4> a(64, n, 8, 8, 1.0f);
+        etl::dyn_vector<float> c(n);
+
+        return prepared{64 * n * 8 * 8, [a, c]() mutable { c = etl::bias_batch_mean(a); }};
+    }});
+
+    k.push_back({"conv_4d_valid", "N >= 2 or K >= 2", "N", geometric(1, 32, 2), [](size_t n) {
+        etl::dyn_matrix<float, 4> i(n, 3, 28, 28, 1.0f);
+        etl::dyn_matrix<float, 4> w(8, 3, 5, 5, 0.5f);
+        etl::dyn_matrix<float, 4> c(n, 8, 24, 24);
+
+        return prepared{n * 3 * 28 * 28, [i, w, c]() mutable { c = etl::conv_4d_valid(i, w); }};
+    }});
+
+    return k;
+}
+
+void sweep(const kernel& k, const std::vector<size_t>& thread_counts) {
+    std::cout << k.name << " (current threshold: " << k.threshold << ", swept: " << k.unit << ")\n";
+
+    std::cout << std::setw(12) << k.unit << std::setw(12) << "elements" << std::setw(12) << "serial(us)";
+
+    for (auto t : thread_counts) {
+        std::cout << std::setw(16) << ("t=" + std::to_string(t));
+    }
+
+    std::cout << "\n";
+
+    // The smallest size from which the parallel version with all the threads is always better
+    size_t crossover          = 0;
+    size_t crossover_elements = 0;
+
+    for (auto size : k.sizes) {
+        auto p = k.prepare(size);
+
+        double serial = 0.0;
+
+        SERIAL_SECTION {
+            serial = measure(p.run);
+        }
+
+        std::cout << std::setw(12) << size << std::setw(12) << p.elements << std::setw(12) << std::fixed << std::setprecision(1) << serial / 1000.0;
+
+        double parallel = serial;
+
+        for (auto t : thread_counts) {
+            THREADS_SECTION(t) {
+                PARALLEL_SECTION {
+                    parallel = measure(p.run);
+                }
+            }
+
+            const double speedup = serial / parallel;
+
+            std::ostringstream cell;
+            cell << std::fixed << std::setprecision(2) << "x" << speedup << " " << std::setprecision(0) << 100.0 * speedup / t << "%";
+
+            std::cout << std::setw(16) << cell.str();
+        }
+
+        std::cout << "\n";
+
+        // parallel holds the time with all the threads
+        if (parallel < margin * serial) {
+            if (!crossover) {
+                crossover          = size;
+                crossover_elements = p.elements;
+            }
+        } else {
+            crossover = 0;
+        }
+    }
+
+    if (thread_counts.back() < 2) {
+        std::cout << "  no suggested threshold: only one thread\n\n";
+    } else if (crossover) {
+        std::cout << "  parallel beats serial from " << k.unit << " = " << crossover << " (" << crossover_elements << " elements), suggested threshold: "
+                  << k.unit << " >= " << crossover << "\n\n";
+    } else {
+        std::cout << "  parallel never beats serial at the largest size, suggested: serial\n\n";
+    }
+}
+
+} //end of anonymous namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<size_t> thread_counts;
+
+    for (size_t t = 1; t < etl::threads; t *= 2) {
+        thread_counts.push_back(t);
+    }
+
+    thread_counts.push_back(etl::threads);
+
+    std::cout << "Parallel scaling (ETL threads: " << etl::threads << ", parallel: " << etl::is_parallel << ")\n"
+              << "  Each cell is the speedup over serial and the efficiency (speedup / threads)\n\n";
+
+    for (auto& k : kernels()) {
+        if (argc > 1 && std::find(argv + 1, argv + argc, k.name) == argv + argc) {
+            continue;
+        }
+
+        sweep(k, thread_counts);
+    }
+
+    return 0;
+}
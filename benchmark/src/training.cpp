@@ -0,0 +1,202 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+// End-to-end training steps of small networks.
+//
+// Usage: training [network]...
+//
+// The training step (forward, backward and SGD update) of a MLP, a CNN and a
+// LSTM layer is run at several mini-batch sizes, in serial and in the default
+// mode. For each size, the throughput in samples per second is reported, as
+// well as the share of time of each operation of the step in the default
+// mode.
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "etl/etl.hpp"
+
+#include "training.hpp"
+
+namespace {
+
+using timer_clock = std::chrono::steady_clock;
+
+constexpr size_t trials = 5; // The best of the trials is kept
+
+// A timer accumulating the time of each operation
+struct op_timer {
+    std::vector<std::pair<std::string, double>> ops; // The accumulated time (ns) per operation, in order of first use
+
+    template <typename Op>
+    void operator()(const char* name, Op&& op) {
+        auto start = timer_clock::now();
+        op();
+        double ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_clock::now() - start).count();
+
+        auto it = std::find_if(ops.begin(), ops.end(), [name](auto& entry) { return entry.first == name; });
+
+        if (it == ops.end()) {
+            ops.emplace_back(name, ns);
+        } else {
+            it->second += ns;
+        }
+    }
+};
+
+// A network prepared at a given mini-batch size
+struct prepared {
+    std::function<void()> step;          // Run one training step
+    std::function<void(op_timer&)> timed; // Run one training step with the timer of the operations
+};
+
+// A network
+struct network {
+    std::string name;                        // The name of the network
+    std::string shape;                       // The description of the layers
+    std::function<prepared(size_t)> prepare; // Prepare the network at the given mini-batch size
+};
+
+// Returns the best time (ns) of one call of the given function, the number
+// of calls per trial is calibrated to run at least 10ms
+template <typename Functor>
+double measure(Functor&& functor) {
+    size_t reps = 1;
+
+    while (true) {
+        auto start = timer_clock::now();
+
+        for (size_t r = 0; r < reps; ++r) {
+            functor();
+        }
+
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_clock::now() - start).count();
+
+        if (ns > 10000000 || reps > (size_t(1) << 20)) {
+            break;
+        }
+
+        reps *= 2;
+    }
+
+    double best = 0.0;
+
+    for (size_t t = 0; t < trials; ++t) {
+        auto start = timer_clock::now();
+
+        for (size_t r = 0; r < reps; ++r) {
+            functor();
+        }
+
+        double ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_clock::now() - start).count() / double(reps);
+
+        best = t == 0 ? ns : std::min(best, ns);
+    }
+
+    return best;
+}
+
+// Prepare a network and its (random) mini-batch of inputs
+template <typename Net, typename X>
+prepared make_prepared(std::shared_ptr<Net> net, X x) {
+    x = etl::uniform_generator<float>(0.0, 1.0);
+
+    auto input = std::make_shared<X>(std::move(x));
+
+    return prepared{
+        [net, input]() { net->step(*input, etl_bench::null_timer()); },
+        [net, input](op_timer& timer) { net->step(*input, timer); }};
+}
+
+std::vector<network> networks() {
+    std::vector<network> n;
+
+    n.push_back({"mlp", "784-500-10, sigmoid, softmax", [](size_t b) {
+        return make_prepared(std::make_shared<etl_bench::mlp<float>>(b, 784, 500, 10), etl::dyn_matrix<float>(b, 784));
+    }});
+
+    n.push_back({"cnn", "1x28x28, 8x5x5 conv, relu, 2x2 max pool, 10 dense, softmax", [](size_t b) {
+        return make_prepared(std::make_shared<etl_bench::cnn<float>>(b, 1, 28, 8, 5, 10), etl::dyn_matrix<float, 4>(b, 1, 28, 28));
+    }});
+
+    n.push_back({"lstm", "128 inputs, 256 hidden units, one step", [](size_t b) {
+        return make_prepared(std::make_shared<etl_bench::lstm<float>>(b, 128, 256), etl::dyn_matrix<float>(b, 128));
+    }});
+
+    return n;
+}
+
+void report(const network& net, const std::vector<size_t>& batches) {
+    std::cout << net.name << " (" << net.shape << ")\n";
+
+    for (auto b : batches) {
+        auto p = net.prepare(b);
+
+        double serial = 0.0;
+
+        SERIAL_SECTION {
+            serial = measure(p.step);
+        }
+
+        double def = measure(p.step);
+
+        // Measure the share of each operation over the same number of steps
+
+        op_timer timer;
+
+        const size_t steps = std::max(size_t(1), size_t(1e8 / def));
+
+        for (size_t s = 0; s < steps; ++s) {
+            p.timed(timer);
+        }
+
+        double total = 0.0;
+
+        for (auto& op : timer.ops) {
+            total += op.second;
+        }
+
+        std::cout << "  batch " << std::setw(4) << b << std::fixed << std::setprecision(0)
+                  << "  serial: " << std::setw(9) << 1e9 * b / serial << " samples/s"
+                  << "  default: " << std::setw(9) << 1e9 * b / def << " samples/s\n";
+
+        std::ostringstream shares;
+
+        for (auto& op : timer.ops) {
+            shares << "  " << op.first << " " << std::fixed << std::setprecision(1) << 100.0 * op.second / total << "%";
+        }
+
+        std::cout << "            " << shares.str() << "\n";
+    }
+
+    std::cout << "\n";
+}
+
+} //end of anonymous namespace
+
+int main(int argc, char* argv[]) {
+    const std::vector<size_t> batches{16, 64, 256};
+
+    std::cout << "End-to-end training steps (float, ETL threads: " << etl::threads << ", parallel: " << etl::is_parallel << ")\n"
+              << "  Throughput of the forward, backward and SGD update, and share of time per operation (default mode)\n\n";
+
+    for (auto& net : networks()) {
+        if (argc > 1 && std::find(argv + 1, argv + argc, net.name) == argv + argc) {
+            continue;
+        }
+
+        report(net, batches);
+    }
+
+    return 0;
+}
@@ -35,6 +35,33 @@ struct adapter {
 protected:
     matrix_t value; ///< The adapted matrix
 
+    /*!
+     * \brief Assign the given expression to the adapted matrix if it
+     * verifies the given predicate, otherwise throw an Exception.
+     *
+     * The expression is evaluated only once: an expression without direct
+     * memory access is evaluated into a temporary which is then validated
+     * and copied.
+     *
+     * \param e The expression to assign
+     * \param predicate The predicate the expression must verify
+     * \tparam Exception The type of exception to throw
+     */
+    template <typename Exception, typename E, typename P>
+    void checked_assign(E&& e, P&& predicate) {
+        standard_evaluator::pre_assign_rhs(e);
+
+        decltype(auto) m = make_temporary(e);
+
+        safe_ensure_cpu_up_to_date(m);
+
+        if (!predicate(m)) {
+            throw Exception();
+        }
+
+        m.assign_to(value);
+    }
+
 public:
     /*!
      * \brief Construct a new matrix and fill it with zeros
@@ -24,7 +24,7 @@ namespace etl {
  * This is only a prototype.
  */
 template <typename Matrix>
-struct diagonal_matrix final : adapter<Matrix>, iterable<const diagonal_matrix<Matrix>> {
+struct diagonal_matrix final : adapter<Matrix>, iterable<const diagonal_matrix<Matrix>, true> {
     using matrix_t = Matrix;   ///< The adapted matrix type
     using expr_t   = matrix_t; ///< The wrapped expression type
 
@@ -115,15 +115,10 @@ public:
      */
     template <typename E, cpp_enable_if(std::is_convertible<value_t<E>, value_type>::value, is_etl_expr<E>::value)>
     diagonal_matrix& operator=(E&& e) noexcept(false) {
-        // Make sure the other matrix is diagonal
-        if(!is_diagonal(e)){
-            throw diagonal_exception();
-        }
-
-        // Perform the real assign
-
         validate_assign(*this, e);
-        e.assign_to(*this);
+
+        // Evaluate the expression once and make sure it is diagonal
+        this->template checked_assign<diagonal_exception>(e, [](auto&& m) { return is_diagonal(m); });
 
         return *this;
     }
@@ -38,7 +38,7 @@ struct hermitian_exception : std::exception {
  * This is only a prototype.
  */
 template <typename Matrix>
-struct hermitian_matrix final : adapter<Matrix>, iterable<const hermitian_matrix<Matrix>> {
+struct hermitian_matrix final : adapter<Matrix>, iterable<const hermitian_matrix<Matrix>, true> {
     using matrix_t = Matrix;   ///< The adapted matrix type
     using expr_t   = matrix_t; ///< The wrapped expression type
 
@@ -139,15 +139,10 @@ public:
      */
     template <typename E, cpp_enable_if(std::is_convertible<value_t<E>, value_type>::value, is_etl_expr<E>::value)>
     hermitian_matrix& operator=(E&& e) noexcept(false) {
-        // Make sure the other matrix is hermitian
-        if(!is_hermitian(e)){
-            throw hermitian_exception();
-        }
-
-        // Perform the real assign
-
         validate_assign(*this, e);
-        e.assign_to(*this);
+
+        // Evaluate the expression once and make sure it is hermitian
+        this->template checked_assign<hermitian_exception>(e, [](auto&& m) { return is_hermitian(m); });
 
         return *this;
     }
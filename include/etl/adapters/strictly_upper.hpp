@@ -24,7 +24,7 @@ namespace etl {
  * This is only a prototype.
  */
 template <typename Matrix>
-struct strictly_upper_matrix final : adapter<Matrix>, iterable<const strictly_upper_matrix<Matrix>> {
+struct strictly_upper_matrix final : adapter<Matrix>, iterable<const strictly_upper_matrix<Matrix>, true> {
     using matrix_t = Matrix;   ///< The adapted matrix type
     using expr_t   = matrix_t; ///< The wrapped expression type
 
@@ -115,15 +115,10 @@ public:
      */
     template <typename E, cpp_enable_if(std::is_convertible<value_t<E>, value_type>::value, is_etl_expr<E>::value)>
     strictly_upper_matrix& operator=(E&& e) noexcept(false) {
-        // Make sure the other matrix is strictly upper triangular
-        if(!is_strictly_upper_triangular(e)){
-            throw strictly_upper_exception();
-        }
-
-        // Perform the real assign
-
         validate_assign(*this, e);
-        e.assign_to(*this);
+
+        // Evaluate the expression once and make sure it is strictly upper triangular
+        this->template checked_assign<strictly_upper_exception>(e, [](auto&& m) { return is_strictly_upper_triangular(m); });
 
         return *this;
     }
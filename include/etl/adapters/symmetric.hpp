@@ -38,7 +38,7 @@ struct symmetric_exception : std::exception {
  * This is only a prototype.
  */
 template <typename Matrix>
-struct symmetric_matrix final : adapter<Matrix>, iterable<const symmetric_matrix<Matrix>> {
+struct symmetric_matrix final : adapter<Matrix>, iterable<const symmetric_matrix<Matrix>, true> {
     using matrix_t = Matrix;   ///< The adapted matrix type
     using expr_t   = matrix_t; ///< The wrapped expression type
 
@@ -139,15 +139,10 @@ public:
      */
     template <typename E, cpp_enable_if(std::is_convertible<value_t<E>, value_type>::value, is_etl_expr<E>::value)>
     symmetric_matrix& operator=(E&& e) noexcept(false) {
-        // Make sure the other matrix is symmetric
-        if(!is_symmetric(e)){
-            throw symmetric_exception();
-        }
-
-        // Perform the real assign
-
         validate_assign(*this, e);
-        e.assign_to(*this);
+
+        // Evaluate the expression once and make sure it is symmetric
+        this->template checked_assign<symmetric_exception>(e, [](auto&& m) { return is_symmetric(m); });
 
         return *this;
     }
@@ -24,7 +24,7 @@ namespace etl {
  * This is only a prototype.
  */
 template <typename Matrix>
-struct uni_lower_matrix final : adapter<Matrix>, iterable<const uni_lower_matrix<Matrix>> {
+struct uni_lower_matrix final : adapter<Matrix>, iterable<const uni_lower_matrix<Matrix>, true> {
     using matrix_t = Matrix;   ///< The adapted matrix type
     using expr_t   = matrix_t; ///< The wrapped expression type
 
@@ -110,15 +110,10 @@ public:
      */
     template <typename E, cpp_enable_if(std::is_convertible<value_t<E>, value_type>::value, is_etl_expr<E>::value)>
     uni_lower_matrix& operator=(E&& e) noexcept(false) {
-        // Make sure the other matrix is uni lower triangular
-        if(!is_uni_lower_triangular(e)){
-            throw uni_lower_exception();
-        }
-
-        // Perform the real assign
-
         validate_assign(*this, e);
-        e.assign_to(*this);
+
+        // Evaluate the expression once and make sure it is uni lower triangular
+        this->template checked_assign<uni_lower_exception>(e, [](auto&& m) { return is_uni_lower_triangular(m); });
 
         return *this;
     }
@@ -752,6 +752,130 @@ struct avx_vec {
         return _mm256_round_pd(x.value, (_MM_FROUND_TO_POS_INF |_MM_FROUND_NO_EXC));
     }
 
+    /*!
+     * \brief Reverse the order of the elements of the vector
+     */
+    ETL_STATIC_INLINE(avx_simd_float) reverse(avx_simd_float x) {
+#ifdef __AVX2__
+        return _mm256_permutevar8x32_ps(x.value, _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+#else
+        __m256 lanes = _mm256_permute_ps(x.value, _MM_SHUFFLE(0, 1, 2, 3));
+        return _mm256_permute2f128_ps(lanes, lanes, 1);
+#endif
+    }
+
+    /*!
+     * \brief Reverse the order of the elements of the vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) reverse(avx_simd_double x) {
+#ifdef __AVX2__
+        return _mm256_permute4x64_pd(x.value, _MM_SHUFFLE(0, 1, 2, 3));
+#else
+        __m256d lanes = _mm256_permute_pd(x.value, 5);
+        return _mm256_permute2f128_pd(lanes, lanes, 1);
+#endif
+    }
+
+    /*!
+     * \brief Return the even elements of the concatenation of lo and hi
+     * \param lo The first elements
+     * \param hi The next elements
+     */
+    ETL_STATIC_INLINE(avx_simd_float) deinterleave(avx_simd_float lo, avx_simd_float hi) {
+        __m256 first  = _mm256_permute2f128_ps(lo.value, hi.value, 0x20);
+        __m256 second = _mm256_permute2f128_ps(lo.value, hi.value, 0x31);
+        return _mm256_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    /*!
+     * \copydoc deinterleave(avx_simd_float, avx_simd_float)
+     */
+    ETL_STATIC_INLINE(avx_simd_double) deinterleave(avx_simd_double lo, avx_simd_double hi) {
+        __m256d first  = _mm256_permute2f128_pd(lo.value, hi.value, 0x20);
+        __m256d second = _mm256_permute2f128_pd(lo.value, hi.value, 0x31);
+        return _mm256_unpacklo_pd(first, second);
+    }
+
+    /*!
+     * \brief Return the first half of the interleaving of a and b,
+     * a[0], b[0], a[1], b[1], ...
+     * \param a The even elements
+     * \param b The odd elements
+     */
+    ETL_STATIC_INLINE(avx_simd_float) interleave_lo(avx_simd_float a, avx_simd_float b) {
+        __m256 lo = _mm256_unpacklo_ps(a.value, b.value);
+        __m256 hi = _mm256_unpackhi_ps(a.value, b.value);
+        return _mm256_permute2f128_ps(lo, hi, 0x20);
+    }
+
+    /*!
+     * \copydoc interleave_lo(avx_simd_float, avx_simd_float)
+     */
+    ETL_STATIC_INLINE(avx_simd_double) interleave_lo(avx_simd_double a, avx_simd_double b) {
+        __m256d lo = _mm256_unpacklo_pd(a.value, b.value);
+        __m256d hi = _mm256_unpackhi_pd(a.value, b.value);
+        return _mm256_permute2f128_pd(lo, hi, 0x20);
+    }
+
+    /*!
+     * \brief Return the second half of the interleaving of a and b,
+     * a[n / 2], b[n / 2], a[n / 2 + 1], b[n / 2 + 1], ...
+     * \param a The even elements
+     * \param b The odd elements
+     */
+    ETL_STATIC_INLINE(avx_simd_float) interleave_hi(avx_simd_float a, avx_simd_float b) {
+        __m256 lo = _mm256_unpacklo_ps(a.value, b.value);
+        __m256 hi = _mm256_unpackhi_ps(a.value, b.value);
+        return _mm256_permute2f128_ps(lo, hi, 0x31);
+    }
+
+    /*!
+     * \copydoc interleave_hi(avx_simd_float, avx_simd_float)
+     */
+    ETL_STATIC_INLINE(avx_simd_double) interleave_hi(avx_simd_double a, avx_simd_double b) {
+        __m256d lo = _mm256_unpacklo_pd(a.value, b.value);
+        __m256d hi = _mm256_unpackhi_pd(a.value, b.value);
+        return _mm256_permute2f128_pd(lo, hi, 0x31);
+    }
+
+#ifdef __AVX2__
+    /*!
+     * \brief Load the elements memory[offsets[l]] with a hardware gather
+     *
+     * The index vector is built from the offsets in registers, loading it
+     * from the array just written would stall on the store forwarding.
+     *
+     * \param memory The base memory
+     * \param offsets The offsets of the elements from memory
+     */
+    ETL_STATIC_INLINE(avx_simd_float) gather(const float* memory, const int32_t* offsets) {
+        return _mm256_i32gather_ps(memory, _mm256_setr_epi32(offsets[0], offsets[1], offsets[2], offsets[3], offsets[4], offsets[5], offsets[6], offsets[7]), 4);
+    }
+
+    /*!
+     * \copydoc gather(const float*, const int32_t*)
+     */
+    ETL_STATIC_INLINE(avx_simd_double) gather(const double* memory, const int32_t* offsets) {
+        return _mm256_i32gather_pd(memory, _mm_setr_epi32(offsets[0], offsets[1], offsets[2], offsets[3]), 8);
+    }
+
+    /*!
+     * \brief Load the elements memory[l * stride] with a hardware gather
+     * \param memory The base memory
+     * \param stride The distance between two elements
+     */
+    ETL_STATIC_INLINE(avx_simd_float) strided_gather(const float* memory, int32_t stride) {
+        return _mm256_i32gather_ps(memory, _mm256_mullo_epi32(_mm256_set1_epi32(stride), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)), 4);
+    }
+
+    /*!
+     * \copydoc strided_gather(const float*, int32_t)
+     */
+    ETL_STATIC_INLINE(avx_simd_double) strided_gather(const double* memory, int32_t stride) {
+        return _mm256_i32gather_pd(memory, _mm_mullo_epi32(_mm_set1_epi32(stride), _mm_setr_epi32(0, 1, 2, 3)), 8);
+    }
+#endif
+
     // Addition
 
 #ifdef __AVX2__
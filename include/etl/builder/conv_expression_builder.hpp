@@ -1400,11 +1400,11 @@ auto convmtx(A&& a, size_t h) -> detail::stable_transform_helper<A, dyn_convmtx_
  * \return a matrix expression for convolution
  */
 template <typename A>
-auto convmtx2(A&& a, size_t k1, size_t k2) -> detail::stable_transform_helper<A, dyn_convmtx2_transformer> {
+dyn_convmtx_2d_expr<A> convmtx2(A&& a, size_t k1, size_t k2) {
     static_assert(is_etl_expr<A>::value, "Convolution matrices only supported for ETL expressions");
     static_assert(decay_traits<A>::dimensions() == 2, "Convolutional matrix only works in 2D");
 
-    return detail::stable_transform_helper<A, dyn_convmtx2_transformer>{dyn_convmtx2_transformer<detail::build_type<A>>(a, k1, k2)};
+    return dyn_convmtx_2d_expr<A>{a, k1, k2};
 }
 
 /*!
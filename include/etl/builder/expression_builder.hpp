@@ -1045,6 +1045,40 @@ auto slice(E&& value, size_t first, size_t last) -> slice_view<detail::build_ide
     return {value, first, last};
 }
 
+/*!
+ * \brief Returns view representing every step-th index of the range [first,
+ * last) of the Dth dimension of the given expression.
+ * \param value The ETL expression
+ * \param first The first index
+ * \param last The last index (exclusive)
+ * \param step The step between two indices
+ * \tparam D The strided dimension
+ * \return a view expression representing a strided view of the given expression
+ */
+template <size_t D = 0, typename E, cpp_enable_if(!is_strided_view<E>::value)>
+auto strided(E&& value, size_t first, size_t last, size_t step) -> strided_view<detail::build_identity_type<E>> {
+    static_assert(is_etl_expr<E>::value, "etl::strided can only be used on ETL expressions");
+    static_assert(D < etl_traits<std::decay_t<E>>::dimensions(), "Invalid dimension for etl::strided");
+    return {value, D, first, last, step};
+}
+
+/*!
+ * \brief Returns view representing every step-th index of the range [first,
+ * last) of the Dth dimension of the given strided view. The result is a
+ * single view over the expression of the strided view.
+ * \param value The strided view
+ * \param first The first index
+ * \param last The last index (exclusive)
+ * \param step The step between two indices
+ * \tparam D The strided dimension
+ * \return a view expression representing a strided view of the given expression
+ */
+template <size_t D = 0, typename E, cpp_enable_if(is_strided_view<E>::value)>
+std::decay_t<E> strided(E&& value, size_t first, size_t last, size_t step) {
+    static_assert(D < etl_traits<std::decay_t<E>>::dimensions(), "Invalid dimension for etl::strided");
+    return {value, D, first, last, step};
+}
+
 /*!
  * \brief Returns view representing the reshape of another expression
  * \param value The ETL expression
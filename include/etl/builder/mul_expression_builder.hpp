@@ -16,6 +16,20 @@
 
 namespace etl {
 
+namespace detail {
+
+/*!
+ * \brief Traits indicating if the matrix-matrix multiplication of A and B
+ * can use the structure of a diagonal or triangular operand
+ */
+template <typename A, typename B>
+using is_structured_mm = cpp::bool_constant<
+    (is_structured_matrix<A>::value || is_structured_matrix<B>::value)
+    && decay_traits<A>::storage_order == order::RowMajor
+    && decay_traits<B>::storage_order == order::RowMajor>;
+
+} //end of namespace detail
+
 #ifndef ETL_ELEMENT_WISE_MULTIPLICATION
 
 /*!
@@ -24,7 +38,7 @@ namespace etl {
  * \param b The right hand side matrix
  * \return An expression representing the matrix-matrix multiplication of a and b
  */
-template <typename A, typename B, cpp_enable_if(is_2d<A>::value, is_2d<B>::value)>
+template <typename A, typename B, cpp_enable_if(is_2d<A>::value, is_2d<B>::value, !detail::is_structured_mm<A, B>::value)>
 gemm_expr<A, B, detail::mm_mul_impl> operator*(A&& a, B&& b) {
     static_assert(is_etl_expr<A>::value && is_etl_expr<B>::value, "Matrix multiplication only supported for ETL expressions");
     static_assert(decay_traits<A>::dimensions() == 2 && decay_traits<B>::dimensions() == 2, "Matrix multiplication only works in 2D");
@@ -32,6 +46,21 @@ gemm_expr<A, B, detail::mm_mul_impl> operator*(A&& a, B&& b) {
     return gemm_expr<A, B, detail::mm_mul_impl>{a, b};
 }
 
+/*!
+ * \brief Multiply two matrices together, one of them being a diagonal or
+ * triangular matrix
+ * \param a The left hand side matrix
+ * \param b The right hand side matrix
+ * \return An expression representing the matrix-matrix multiplication of a and b
+ */
+template <typename A, typename B, cpp_enable_if(is_2d<A>::value, is_2d<B>::value, detail::is_structured_mm<A, B>::value)>
+gemm_expr<A, B, detail::structured_mm_mul_impl> operator*(A&& a, B&& b) {
+    static_assert(is_etl_expr<A>::value && is_etl_expr<B>::value, "Matrix multiplication only supported for ETL expressions");
+    static_assert(decay_traits<A>::dimensions() == 2 && decay_traits<B>::dimensions() == 2, "Matrix multiplication only works in 2D");
+
+    return gemm_expr<A, B, detail::structured_mm_mul_impl>{a, b};
+}
+
 /*!
  * \brief Multiply a vector and a matrix together
  * \param a The left hand side vector
@@ -62,7 +91,7 @@ gemv_expr<A, B, detail::mv_mul_impl> operator*(A&& a, B&& b) {
  * \param b The right hand side matrix
  * \return An expression representing the matrix-matrix multiplication of a and b
  */
-template <typename A, typename B, cpp_enable_if(is_2d<A>::value, is_2d<B>::value)>
+template <typename A, typename B, cpp_enable_if(is_2d<A>::value, is_2d<B>::value, !detail::is_structured_mm<A, B>::value)>
 gemm_expr<A, B, detail::mm_mul_impl> mul(A&& a, B&& b) {
     static_assert(is_etl_expr<A>::value && is_etl_expr<B>::value, "Matrix multiplication only supported for ETL expressions");
     static_assert(decay_traits<A>::dimensions() == 2 && decay_traits<B>::dimensions() == 2, "Matrix multiplication only works in 2D");
@@ -70,6 +99,21 @@ gemm_expr<A, B, detail::mm_mul_impl> mul(A&& a, B&& b) {
     return gemm_expr<A, B, detail::mm_mul_impl>{a, b};
 }
 
+/*!
+ * \brief Multiply two matrices together, one of them being a diagonal or
+ * triangular matrix
+ * \param a The left hand side matrix
+ * \param b The right hand side matrix
+ * \return An expression representing the matrix-matrix multiplication of a and b
+ */
+template <typename A, typename B, cpp_enable_if(is_2d<A>::value, is_2d<B>::value, detail::is_structured_mm<A, B>::value)>
+gemm_expr<A, B, detail::structured_mm_mul_impl> mul(A&& a, B&& b) {
+    static_assert(is_etl_expr<A>::value && is_etl_expr<B>::value, "Matrix multiplication only supported for ETL expressions");
+    static_assert(decay_traits<A>::dimensions() == 2 && decay_traits<B>::dimensions() == 2, "Matrix multiplication only works in 2D");
+
+    return gemm_expr<A, B, detail::structured_mm_mul_impl>{a, b};
+}
+
 /*!
  * \brief Multiply two matrices together and store the result in c
  * \param a The left hand side matrix
@@ -386,6 +386,32 @@ dyn_upsample_2d_expr<E, impl::upsample_2d> upsample_2d(E&& value, size_t c1, siz
     return dyn_upsample_2d_expr<E, impl::upsample_2d>{value, c1, c2};
 }
 
+/*!
+ * \brief Upsample the given 2D matrix expression with bilinear
+ * interpolation
+ * \param value The input expression
+ * \tparam C1 The first upsampling ratio
+ * \tparam C2 The second upsampling ratio
+ * \return A expression representing the Upsampling of the given expression
+ */
+template <size_t C1, size_t C2, typename E>
+upsample_2d_expr<E, C1, C2, impl::bilinear_upsample_2d> upsample_2d_bilinear(E&& value) {
+    return upsample_2d_expr<E, C1, C2, impl::bilinear_upsample_2d>{value};
+}
+
+/*!
+ * \brief Upsample the given 2D matrix expression with bilinear
+ * interpolation
+ * \param value The input expression
+ * \param c1 The first upsampling ratio
+ * \param c2 The second upsampling ratio
+ * \return A expression representing the Upsampling of the given expression
+ */
+template <typename E>
+dyn_upsample_2d_expr<E, impl::bilinear_upsample_2d> upsample_2d_bilinear(E&& value, size_t c1, size_t c2) {
+    return dyn_upsample_2d_expr<E, impl::bilinear_upsample_2d>{value, c1, c2};
+}
+
 /* Upsample 3D */
 
 /*!
@@ -24,6 +24,7 @@ struct forced_impl {
 struct context {
     bool serial   = false; ///< Force serial execution
     bool parallel = false; ///< Force parallel execution
+    size_t threads = 0;    ///< Limit the number of threads of the parallel evaluations (0 for etl::threads)
 
     forced_impl<scalar_impl> scalar_selector;         ///< Force selector for scalar operations
     forced_impl<sum_impl> sum_selector;               ///< Forced selector for sum
@@ -46,6 +47,20 @@ inline context& local_context() {
     return local_context;
 }
 
+/*!
+ * \brief Return the number of threads the parallel evaluations of the
+ * current thread can use.
+ *
+ * This is etl::threads, unless it is limited by the local context (see
+ * THREADS_SECTION).
+ *
+ * \return the number of threads to use in the parallel evaluations
+ */
+inline size_t parallel_threads() {
+    const size_t limit = local_context().threads;
+    return limit && limit < threads ? limit : threads;
+}
+
 namespace detail {
 
 /*!
@@ -202,6 +217,42 @@ struct parallel_context {
     }
 };
 
+/*!
+ * \brief RAII helper for limiting the number of threads of the parallel
+ * evaluations
+ */
+struct threads_context {
+    size_t old_threads; ///< The previous limit of threads
+
+    /*!
+     * \brief Construct a threads context
+     *
+     * This saves the previous limit and sets the new limit
+     *
+     * \param threads The maximum number of threads (0 for etl::threads)
+     */
+    explicit threads_context(size_t threads) {
+        old_threads = etl::local_context().threads;
+        etl::local_context().threads = threads;
+    }
+
+    /*!
+     * \brief Destruct a threads context
+     *
+     * This restores the previous limit
+     */
+    ~threads_context() {
+        etl::local_context().threads = old_threads;
+    }
+
+    /*!
+     * \brief Does nothing, simple trick for section to be nice
+     */
+    operator bool() {
+        return true;
+    }
+};
+
 /*!
  * \brief RAII helper for setting the context to a selected
  * implementation
@@ -254,6 +305,12 @@ struct selected_context {
  */
 #define PARALLEL_SECTION if (auto etl_parallel_context__ = etl::detail::parallel_context())
 
+/*!
+ * \brief Define the start of an ETL section using at most n threads in
+ * the parallel evaluations
+ */
+#define THREADS_SECTION(n) if (auto etl_threads_context__ = etl::detail::threads_context(n))
+
 /*!
  * \brief Define the start of an ETL selected section
  */
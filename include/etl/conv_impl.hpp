@@ -55,4 +55,86 @@ enum class conv_multi_impl {
     CUDNN          ///< GPU with CUDNN
 };
 
+/*!
+ * \brief Returns the name of the given convolution implementation
+ * \param impl The implementation
+ * \return a string literal naming the implementation
+ */
+inline const char* impl_name(conv_impl impl) {
+    switch (impl) {
+        case conv_impl::STD:
+            return "STD";
+        case conv_impl::VEC:
+            return "VEC";
+        case conv_impl::CUDNN:
+            return "CUDNN";
+        case conv_impl::FFT_STD:
+            return "FFT_STD";
+        case conv_impl::FFT_MKL:
+            return "FFT_MKL";
+        case conv_impl::FFT_CUFFT:
+            return "FFT_CUFFT";
+    }
+
+    return "UNKNOWN";
+}
+
+/*!
+ * \brief Returns the name of the given convolution implementation
+ * \param impl The implementation
+ * \return a string literal naming the implementation
+ */
+inline const char* impl_name(conv4_impl impl) {
+    switch (impl) {
+        case conv4_impl::STD:
+            return "STD";
+        case conv4_impl::VEC:
+            return "VEC";
+        case conv4_impl::CUDNN:
+            return "CUDNN";
+        case conv4_impl::FFT_STD:
+            return "FFT_STD";
+        case conv4_impl::FFT_MKL:
+            return "FFT_MKL";
+        case conv4_impl::FFT_CUFFT:
+            return "FFT_CUFFT";
+        case conv4_impl::BLAS_VEC:
+            return "BLAS_VEC";
+        case conv4_impl::BLAS_MKL:
+            return "BLAS_MKL";
+    }
+
+    return "UNKNOWN";
+}
+
+/*!
+ * \brief Returns the name of the given multiple convolution implementation
+ * \param impl The implementation
+ * \return a string literal naming the implementation
+ */
+inline const char* impl_name(conv_multi_impl impl) {
+    switch (impl) {
+        case conv_multi_impl::STD:
+            return "STD";
+        case conv_multi_impl::VEC:
+            return "VEC";
+        case conv_multi_impl::VALID_FFT_MKL:
+            return "VALID_FFT_MKL";
+        case conv_multi_impl::FFT_STD:
+            return "FFT_STD";
+        case conv_multi_impl::FFT_MKL:
+            return "FFT_MKL";
+        case conv_multi_impl::FFT_CUFFT:
+            return "FFT_CUFFT";
+        case conv_multi_impl::BLAS_VEC:
+            return "BLAS_VEC";
+        case conv_multi_impl::BLAS_MKL:
+            return "BLAS_MKL";
+        case conv_multi_impl::CUDNN:
+            return "CUDNN";
+    }
+
+    return "UNKNOWN";
+}
+
 } //end of namespace etl
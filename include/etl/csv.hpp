@@ -0,0 +1,541 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Parallel loader of CSV (and other delimited text) files
+ *
+ * The file is mapped in memory and split in line-aligned chunks. The rows
+ * of each chunk are counted in parallel, the matrix is prepared once and
+ * then the chunks are parsed in parallel directly into the matrix.
+ *
+ * Only numeric fields are supported (no quoting). Empty fields are loaded
+ * as NaN for floating point matrices and 0 otherwise. Empty lines are
+ * ignored.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdlib> //For strtod
+#include <cstring> //For memchr
+#include <fstream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ETL_CSV_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace etl {
+
+/*!
+ * \brief The options of load_csv
+ */
+struct csv_options {
+    char delimiter = ',';        ///< The delimiter between the fields
+    size_t skip_rows = 0;        ///< The number of lines to skip at the beginning of the file (header)
+    std::vector<size_t> columns; ///< The indices of the columns to load, all the columns if empty
+};
+
+namespace detail {
+
+/*!
+ * \brief The content of a text file, mapped in memory when possible
+ */
+struct csv_file {
+    /*!
+     * \brief Map (or read) the given file
+     * \param path The path to the file
+     */
+    explicit csv_file(const std::string& path) {
+#ifdef ETL_CSV_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+
+        if (fd < 0) {
+            return;
+        }
+
+        struct stat st;
+
+        if (::fstat(fd, &st) == 0) {
+            length = size_t(st.st_size);
+
+            if (!length) {
+                valid = true;
+            } else {
+                void* base = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if (base != MAP_FAILED) {
+                    mapped = static_cast<const char*>(base);
+                    valid  = true;
+                }
+            }
+        }
+
+        ::close(fd);
+
+        if (valid) {
+            return;
+        }
+#endif
+
+        std::ifstream is(path, std::ios::binary);
+
+        if (!is) {
+            return;
+        }
+
+        content.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+
+        length = content.size();
+        valid  = true;
+    }
+
+    csv_file(const csv_file& rhs) = delete;
+    csv_file& operator=(const csv_file& rhs) = delete;
+
+    /*!
+     * \brief Unmap the file
+     */
+    ~csv_file() {
+#ifdef ETL_CSV_MMAP
+        if (mapped) {
+            ::munmap(const_cast<char*>(mapped), length);
+        }
+#endif
+    }
+
+    /*!
+     * \brief Returns a pointer to the first character of the file
+     */
+    const char* data() const {
+        return mapped ? mapped : content.data();
+    }
+
+    /*!
+     * \brief Returns the number of characters of the file
+     */
+    size_t size() const {
+        return length;
+    }
+
+    bool valid = false;         ///< Indicates if the file has been opened
+    const char* mapped = nullptr; ///< The mapped memory
+    size_t length = 0;            ///< The size of the file
+    std::vector<char> content;    ///< The content of the file, when not mapped
+};
+
+/*!
+ * \brief Parse a number with the standard library (slow path)
+ * \param first The first character of the number
+ * \param last The character after the number
+ * \param value The parsed value
+ * \return true if the complete token is a number, false otherwise
+ */
+inline bool csv_parse_slow(const char* first, const char* last, double& value) {
+    std::string token(first, last);
+
+    char* end = nullptr;
+    value     = std::strtod(token.c_str(), &end);
+
+    return end == token.c_str() + token.size() && !token.empty();
+}
+
+/*!
+ * \brief Parse a number.
+ *
+ * The decimal mantissa and exponent are accumulated and, when the mantissa
+ * fits in 53 bits and the exponent is small, the value is computed exactly
+ * with a single multiplication or division (Clinger's fast path). The
+ * other numbers are parsed with strtod.
+ *
+ * \param first The first character of the number
+ * \param last The character after the number
+ * \param value The parsed value
+ * \return true if the complete token is a number, false otherwise
+ */
+inline bool csv_parse_number(const char* first, const char* last, double& value) {
+    static constexpr double powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const char* it = first;
+
+    bool negative = false;
+
+    if (it != last && (*it == '-' || *it == '+')) {
+        negative = *it == '-';
+        ++it;
+    }
+
+    uint64_t mantissa = 0;
+    int64_t exponent  = 0;
+    size_t digits     = 0; // The number of significant digits in the mantissa
+    bool any          = false;
+    bool truncated    = false;
+
+    for (; it != last && *it >= '0' && *it <= '9'; ++it) {
+        any = true;
+
+        if (digits < 19) {
+            mantissa = mantissa * 10 + uint64_t(*it - '0');
+            digits += mantissa > 0;
+        } else {
+            ++exponent;
+            truncated |= *it != '0';
+        }
+    }
+
+    if (it != last && *it == '.') {
+        ++it;
+
+        for (; it != last && *it >= '0' && *it <= '9'; ++it) {
+            any = true;
+
+            if (digits < 19) {
+                mantissa = mantissa * 10 + uint64_t(*it - '0');
+                digits += mantissa > 0;
+                --exponent;
+            } else {
+                truncated |= *it != '0';
+            }
+        }
+    }
+
+    if (!any) {
+        // nan, inf, ...
+        return csv_parse_slow(first, last, value);
+    }
+
+    if (it != last && (*it == 'e' || *it == 'E')) {
+        ++it;
+
+        bool negative_exponent = false;
+
+        if (it != last && (*it == '-' || *it == '+')) {
+            negative_exponent = *it == '-';
+            ++it;
+        }
+
+        if (it == last || *it < '0' || *it > '9') {
+            return false;
+        }
+
+        int64_t e = 0;
+
+        for (; it != last && *it >= '0' && *it <= '9'; ++it) {
+            if (e < 100000) {
+                e = e * 10 + (*it - '0');
+            }
+        }
+
+        exponent += negative_exponent ? -e : e;
+    }
+
+    if (it != last) {
+        return false;
+    }
+
+    if (truncated || mantissa > (uint64_t(1) << 53) || exponent < -22 || exponent > 22) {
+        return csv_parse_slow(first, last, value);
+    }
+
+    value = exponent < 0 ? double(mantissa) / powers[-exponent] : double(mantissa) * powers[exponent];
+
+    if (negative) {
+        value = -value;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Returns the value of an empty field for the type T
+ */
+template <typename T>
+T csv_missing() {
+    return std::is_floating_point<T>::value ? T(std::numeric_limits<T>::quiet_NaN()) : T(0);
+}
+
+/*!
+ * \brief Returns the end of the line starting at the given position, without
+ * the carriage return
+ * \param it The beginning of the line
+ * \param last The end of the text
+ * \param next Set to the beginning of the next line
+ */
+inline const char* csv_line_end(const char* it, const char* last, const char*& next) {
+    auto eol = static_cast<const char*>(std::memchr(it, '\n', size_t(last - it)));
+
+    if (!eol) {
+        eol  = last;
+        next = last;
+    } else {
+        next = eol + 1;
+    }
+
+    if (eol != it && *(eol - 1) == '\r') {
+        --eol;
+    }
+
+    return eol;
+}
+
+/*!
+ * \brief Count the non-empty lines between two positions
+ */
+inline size_t csv_count_rows(const char* it, const char* last) {
+    size_t rows = 0;
+
+    while (it != last) {
+        const char* next;
+        const char* eol = csv_line_end(it, last, next);
+
+        rows += eol != it;
+        it = next;
+    }
+
+    return rows;
+}
+
+/*!
+ * \brief Prepare a dyn matrix for the given dimensions, only reallocating
+ * if its dimensions are changing
+ * \return true if the matrix has been prepared
+ */
+template <typename T, order SO>
+bool csv_prepare(dyn_matrix_impl<T, SO, 2>& matrix, size_t rows, size_t columns) {
+    if (etl::dim<0>(matrix) != rows || etl::dim<1>(matrix) != columns) {
+        matrix = dyn_matrix_impl<T, SO, 2>(rows, columns);
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Prepare a matrix for the given dimensions, it must already have
+ * these dimensions.
+ * \return true if the matrix has the dimensions, false otherwise
+ */
+template <typename M>
+bool csv_prepare(M& matrix, size_t rows, size_t columns) {
+    return etl::dim<0>(matrix) == rows && etl::dim<1>(matrix) == columns;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Load a matrix from a CSV file.
+ *
+ * Each non-empty line of the file, after the skipped lines, is a row of
+ * the matrix. The number of columns is given by the first row (or by the
+ * selected columns, which must be distinct). The missing fields at the end
+ * of a shorter row are empty fields, a row with more fields than the first
+ * row is an error. A dyn matrix is resized if necessary, a fast or
+ * custom matrix must already have the dimensions of the file.
+ *
+ * \param path The path to the file
+ * \param matrix The matrix to fill
+ * \param options The options of the parser
+ * \return true if the matrix has been loaded, false otherwise
+ */
+template <typename M>
+bool load_csv(const std::string& path, M& matrix, const csv_options& options = csv_options()) {
+    static_assert(all_dma<M>::value, "load_csv is only implemented for direct memory access");
+    static_assert(decay_traits<M>::dimensions() == 2, "load_csv can only load matrices");
+
+    using T = value_t<M>;
+
+    detail::csv_file file(path);
+
+    if (!file.valid) {
+        return false;
+    }
+
+    const char* it   = file.data();
+    const char* last = file.data() + file.size();
+
+    for (size_t i = 0; i < options.skip_rows && it != last; ++i) {
+        const char* next;
+        detail::csv_line_end(it, last, next);
+        it = next;
+    }
+
+    // Find the number of fields from the first row
+
+    size_t fields = 0;
+
+    for (const char* line = it; line != last;) {
+        const char* next;
+        const char* eol = detail::csv_line_end(line, last, next);
+
+        if (eol != line) {
+            fields = 1 + std::count(line, eol, options.delimiter);
+            break;
+        }
+
+        line = next;
+    }
+
+    // Map each field to its column (-1 if not loaded)
+
+    std::vector<int64_t> targets(fields, -1);
+
+    if (options.columns.empty()) {
+        for (size_t f = 0; f < fields; ++f) {
+            targets[f] = int64_t(f);
+        }
+    } else {
+        for (size_t c = 0; c < options.columns.size(); ++c) {
+            // Each column can only be loaded once
+            if (options.columns[c] >= fields || targets[options.columns[c]] >= 0) {
+                return false;
+            }
+
+            targets[options.columns[c]] = int64_t(c);
+        }
+    }
+
+    const size_t columns = options.columns.empty() ? fields : options.columns.size();
+
+    // Split the text in line-aligned chunks
+
+    const size_t chunks = std::max(etl::parallel_threads(), size_t(1));
+
+    std::vector<const char*> bounds(chunks + 1);
+
+    bounds[0]      = it;
+    bounds[chunks] = last;
+
+    for (size_t c = 1; c < chunks; ++c) {
+        const char* b = std::max(bounds[c - 1], it + (last - it) * c / chunks);
+
+        // Move the boundary to the beginning of the next line
+        if (b != it && b != last && *(b - 1) != '\n') {
+            auto eol = static_cast<const char*>(std::memchr(b, '\n', size_t(last - b)));
+            b        = eol ? eol + 1 : last;
+        }
+
+        bounds[c] = b;
+    }
+
+    const bool parallel = etl::select_parallel(size_t(last - it)) && chunks > 1;
+
+    // Count the rows of each chunk
+
+    std::vector<size_t> offsets(chunks + 1, 0);
+
+    engine_dispatch_1d([&](size_t first, size_t end) {
+        for (size_t c = first; c < end; ++c) {
+            offsets[c + 1] = detail::csv_count_rows(bounds[c], bounds[c + 1]);
+        }
+    }, 0, chunks, parallel);
+
+    for (size_t c = 0; c < chunks; ++c) {
+        offsets[c + 1] += offsets[c];
+    }
+
+    if (!detail::csv_prepare(matrix, offsets[chunks], columns)) {
+        return false;
+    }
+
+    // Parse each chunk directly into the matrix
+
+    const size_t rows = offsets[chunks];
+    T* memory         = matrix.memory_start();
+
+    std::vector<char> status(chunks, 1);
+
+    engine_dispatch_1d([&](size_t first, size_t end) {
+        for (size_t c = first; c < end; ++c) {
+            const char* line = bounds[c];
+            size_t row       = offsets[c];
+
+            while (line != bounds[c + 1]) {
+                const char* next;
+                const char* eol = detail::csv_line_end(line, bounds[c + 1], next);
+
+                if (eol == line) {
+                    line = next;
+                    continue;
+                }
+
+                const char* field = line;
+                size_t f          = 0;
+
+                while (true) {
+                    auto delimiter  = static_cast<const char*>(std::memchr(field, options.delimiter, size_t(eol - field)));
+                    const char* end = delimiter ? delimiter : eol;
+
+                    // A row cannot have more fields than the first row
+                    if (f == fields) {
+                        status[c] = 0;
+                        return;
+                    }
+
+                    if (targets[f] >= 0) {
+                        const size_t column = size_t(targets[f]);
+
+                        T& value = memory[decay_traits<M>::storage_order == order::RowMajor ? row * columns + column : row + column * rows];
+
+                        // Trim the spaces around the value
+                        const char* a = field;
+                        const char* b = end;
+
+                        while (a != b && (*a == ' ' || *a == '\t')) {
+                            ++a;
+                        }
+
+                        while (b != a && (*(b - 1) == ' ' || *(b - 1) == '\t')) {
+                            --b;
+                        }
+
+                        double v;
+
+                        if (a == b) {
+                            value = detail::csv_missing<T>();
+                        } else if (detail::csv_parse_number(a, b, v)) {
+                            value = T(v);
+                        } else {
+                            status[c] = 0;
+                            return;
+                        }
+                    }
+
+                    ++f;
+
+                    if (!delimiter) {
+                        break;
+                    }
+
+                    field = delimiter + 1;
+                }
+
+                // Missing fields at the end of the line
+                for (; f < fields; ++f) {
+                    if (targets[f] >= 0) {
+                        const size_t column = size_t(targets[f]);
+
+                        memory[decay_traits<M>::storage_order == order::RowMajor ? row * columns + column : row + column * rows] = detail::csv_missing<T>();
+                    }
+                }
+
+                ++row;
+                line = next;
+            }
+        }
+    }, 0, chunks, parallel);
+
+    matrix.invalidate_gpu();
+
+    return std::all_of(status.begin(), status.end(), [](char s) { return s != 0; });
+}
+
+} //end of namespace etl
@@ -0,0 +1,287 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Chunked reader of serialized datasets
+ */
+
+#pragma once
+
+#include <fstream>
+#include <future>
+
+namespace etl {
+
+/*!
+ * \brief A chunked reader of a dataset written by the serializer.
+ *
+ * The dataset is a row-major tensor whose first dimension is the number
+ * of samples (rows). The rows are read by chunks directly into the memory
+ * of an existing matrix or sub view, without any allocation.
+ *
+ * When prefetching is enabled, the next chunk is read on a background
+ * thread, in one of two internal buffers, while the current chunk is used.
+ * The reading of the data therefore overlaps with the computations.
+ *
+ * \tparam T The type of the values of the dataset
+ * \tparam Stream The type of stream to read from
+ */
+template <typename T, typename Stream = std::ifstream>
+struct dataset_reader {
+    using value_type = T;      ///< The type of value of the dataset
+    using stream_t   = Stream; ///< The type of stream to use
+
+private:
+    tensor_reader<stream_t> reader; ///< The reader of the tensor
+    bool valid_      = false;       ///< Indicates if the dataset is valid
+    bool prefetching = true;        ///< Indicates if the next chunk is prefetched
+    size_t row_size_ = 0;           ///< The number of values of one row
+    size_t position_ = 0;           ///< The index of the next row to read
+
+    std::array<std::vector<T>, 2> buffers; ///< The prefetch buffers
+    size_t buffer = 0;                     ///< The index of the buffer being prefetched
+
+    std::future<bool> prefetch_task; ///< The prefetch of the next chunk
+    size_t prefetch_first = 0;       ///< The first row of the prefetched chunk
+    size_t prefetch_rows  = 0;       ///< The number of rows of the prefetched chunk
+
+public:
+    /*!
+     * \brief Construct the reader by forwarding the arguments
+     * to the stream and read the header of the dataset
+     * \param args The arguments to forward to the stream constructor
+     */
+    template <typename... Args>
+    explicit dataset_reader(Args&&... args)
+            : reader(std::forward<Args>(args)...) {
+        const auto& header = reader.header();
+
+        valid_ = reader.valid()
+              && header.dtype == detail::tensor_dtype_of<T>()
+              && header.value_size == sizeof(T)
+              && header.storage == 0
+              && header.dimensions > 0;
+
+        if (valid_) {
+            row_size_ = 1;
+
+            for (size_t d = 1; d < reader.dimensions(); ++d) {
+                row_size_ *= reader.dim(d);
+            }
+        }
+    }
+
+    dataset_reader(const dataset_reader& rhs) = delete;
+    dataset_reader& operator=(const dataset_reader& rhs) = delete;
+
+    /*!
+     * \brief Wait for the prefetch task before destroying the reader
+     */
+    ~dataset_reader() {
+        cancel_prefetch();
+    }
+
+    /*!
+     * \brief Indicates if a valid dataset has been found in the stream
+     */
+    bool valid() const {
+        return valid_;
+    }
+
+    /*!
+     * \brief Returns the number of rows of the dataset
+     */
+    size_t rows() const {
+        return valid_ ? reader.dim(0) : 0;
+    }
+
+    /*!
+     * \brief Returns the number of values of one row of the dataset
+     */
+    size_t row_size() const {
+        return row_size_;
+    }
+
+    /*!
+     * \brief Returns the index of the next row that will be read
+     */
+    size_t position() const {
+        return position_;
+    }
+
+    /*!
+     * \brief Returns the number of rows that have not been read yet
+     */
+    size_t remaining() const {
+        return rows() - position_;
+    }
+
+    /*!
+     * \brief Enable or disable the prefetching of the next chunk
+     * \param enabled true to prefetch the next chunk, false otherwise
+     */
+    void prefetch(bool enabled) {
+        if (!enabled) {
+            cancel_prefetch();
+        }
+
+        prefetching = enabled;
+    }
+
+    /*!
+     * \brief Move to the given row
+     * \param row The index of the next row to read
+     */
+    void seek(size_t row) {
+        position_ = std::min(row, rows());
+    }
+
+    /*!
+     * \brief Read rows of the dataset into the given matrix, without
+     * changing the position of the reader.
+     *
+     * As many rows as the first dimension of the matrix are read, or less
+     * at the end of the dataset.
+     *
+     * \param first The index of the first row to read
+     * \param batch The matrix (or sub view) to fill
+     * \return The number of rows that have been read, 0 in case of error
+     */
+    template <typename M>
+    size_t read(size_t first, M&& batch) {
+        static_assert(is_dma<M>::value, "dataset_reader can only read into direct memory expressions");
+        static_assert(decay_traits<M>::storage_order == order::RowMajor, "dataset_reader can only read into row-major expressions");
+        static_assert(std::is_same<value_t<M>, T>::value, "dataset_reader can only read into expressions of the same type");
+
+        const size_t n = chunk_rows(first, batch);
+
+        if (!n) {
+            return 0;
+        }
+
+        cancel_prefetch();
+
+        if (!reader.read(first * row_size_, n * row_size_, batch.memory_start())) {
+            return 0;
+        }
+
+        batch.invalidate_gpu();
+
+        return n;
+    }
+
+    /*!
+     * \brief Read the next rows of the dataset into the given matrix.
+     *
+     * As many rows as the first dimension of the matrix are read, or less
+     * at the end of the dataset. If prefetching is enabled, the following
+     * chunk, of the same size, is then read in the background.
+     *
+     * \param batch The matrix (or sub view) to fill
+     * \return The number of rows that have been read, 0 at the end of the dataset or in case of error
+     */
+    template <typename M>
+    size_t next(M&& batch) {
+        static_assert(is_dma<M>::value, "dataset_reader can only read into direct memory expressions");
+        static_assert(decay_traits<M>::storage_order == order::RowMajor, "dataset_reader can only read into row-major expressions");
+        static_assert(std::is_same<value_t<M>, T>::value, "dataset_reader can only read into expressions of the same type");
+
+        const size_t n = chunk_rows(position_, batch);
+
+        if (!n) {
+            return 0;
+        }
+
+        if (prefetch_task.valid() && prefetch_first == position_ && prefetch_rows == n) {
+            const size_t ready = buffer;
+
+            if (!prefetch_task.get()) {
+                return 0;
+            }
+
+            position_ += n;
+
+            // The next chunk is read into the other buffer during the copy
+            start_prefetch(n);
+
+            direct_copy_n(buffers[ready].data(), batch.memory_start(), n * row_size_);
+
+            batch.invalidate_gpu();
+
+            return n;
+        }
+
+        if (!read(position_, batch)) {
+            return 0;
+        }
+
+        position_ += n;
+
+        start_prefetch(n);
+
+        return n;
+    }
+
+private:
+    /*!
+     * \brief Returns the number of rows of a chunk starting at the given row
+     * and read into the given matrix
+     */
+    template <typename M>
+    size_t chunk_rows(size_t first, const M& batch) const {
+        if (!valid_ || first >= rows()) {
+            return 0;
+        }
+
+        cpp_assert(etl::size(batch) == etl::dim(batch, 0) * row_size_, "Invalid row size of the batch");
+
+        return std::min(etl::dim(batch, 0), rows() - first);
+    }
+
+    /*!
+     * \brief Start reading the chunk of the given number of rows at the
+     * current position into the next buffer
+     */
+    void start_prefetch(size_t n) {
+        n = std::min(n, remaining());
+
+        if (!prefetching || !n) {
+            return;
+        }
+
+        buffer ^= 1;
+
+        auto& memory = buffers[buffer];
+
+        if (memory.size() < n * row_size_) {
+            memory.resize(n * row_size_);
+        }
+
+        prefetch_first = position_;
+        prefetch_rows  = n;
+
+        prefetch_task = std::async(std::launch::async, [this, &memory]() {
+            // The prefetch must not compete with the computations for the thread engine
+            local_context().serial = true;
+
+            return reader.read(prefetch_first * row_size_, prefetch_rows * row_size_, memory.data());
+        });
+    }
+
+    /*!
+     * \brief Wait for the prefetch task, if any, and discard its result
+     */
+    void cancel_prefetch() {
+        if (prefetch_task.valid()) {
+            prefetch_task.wait();
+            prefetch_task = std::future<bool>();
+        }
+    }
+};
+
+} //end of namespace etl
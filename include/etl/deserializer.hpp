@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "etl/util/tensor_format.hpp" //For stream_remaining
+
 namespace etl {
 
 /*!
@@ -19,6 +21,12 @@ struct deserializer {
 
     stream_t stream; ///< The stream
 
+private:
+    std::array<char, 16> lookahead; ///< The bytes that have been read in advance from the stream
+    size_t lookahead_first = 0;     ///< The index of the first available byte of lookahead
+    size_t lookahead_last  = 0;     ///< The index after the last available byte of lookahead
+
+public:
     /*!
      * \brief Construct the deserializer by forwarding the arguments
      * to the stream
@@ -28,6 +36,75 @@ struct deserializer {
     explicit deserializer(Args&&... args)
             : stream(std::forward<Args>(args)...) {}
 
+    /*!
+     * \brief Reads a block of raw bytes from the stream
+     * \param data The memory where to write the bytes
+     * \param n The number of bytes to read
+     */
+    void read(char* data, size_t n) {
+        while (n && lookahead_first < lookahead_last) {
+            *data++ = lookahead[lookahead_first++];
+            --n;
+        }
+
+        if (n) {
+            stream.read(reinterpret_cast<char_t*>(data), n);
+        }
+    }
+
+    /*!
+     * \brief Skip the given number of bytes from the stream
+     * \param n The number of bytes to skip
+     */
+    void skip(size_t n) {
+        char buffer[64];
+
+        while (n && stream) {
+            const size_t c = std::min(n, sizeof(buffer));
+            read(buffer, c);
+            n -= c;
+        }
+    }
+
+    /*!
+     * \brief Returns the number of bytes that can still be read, or the
+     * maximum size_t if the stream cannot be seeked
+     */
+    size_t remaining() {
+        const size_t n = detail::stream_remaining(stream);
+
+        return n == std::numeric_limits<size_t>::max() ? n : n + (lookahead_last - lookahead_first);
+    }
+
+    /*!
+     * \brief Test if the next bytes of the stream are equal to the given
+     * bytes, without consuming them.
+     *
+     * \param expected The expected bytes
+     * \param n The number of bytes to compare
+     * \return true if the next n bytes of the stream are equal to expected, false otherwise
+     */
+    bool peek_equals(const char* expected, size_t n) {
+        cpp_assert(n <= lookahead.size(), "Too many bytes to look ahead");
+
+        // Move the remaining bytes to the beginning of the buffer
+        std::copy(lookahead.begin() + lookahead_first, lookahead.begin() + lookahead_last, lookahead.begin());
+        lookahead_last -= lookahead_first;
+        lookahead_first = 0;
+
+        if (lookahead_last < n && stream) {
+            stream.read(reinterpret_cast<char_t*>(lookahead.data() + lookahead_last), n - lookahead_last);
+            lookahead_last += size_t(stream.gcount());
+
+            // A short stream is not an error yet, the bytes may still be consumed
+            if (lookahead_last > 0 && lookahead_last < n) {
+                stream.clear();
+            }
+        }
+
+        return lookahead_last >= n && std::equal(expected, expected + n, lookahead.begin());
+    }
+
     /*!
      * \brief Reads a value of the given type from the stream
      * \param value Reference to the value where to write
@@ -35,7 +112,7 @@ struct deserializer {
      */
     template <typename T, cpp_enable_if(std::is_arithmetic<T>::value)>
     deserializer& operator>>(T& value) {
-        stream.read(reinterpret_cast<char_t*>(&value), sizeof(T));
+        read(reinterpret_cast<char*>(&value), sizeof(T));
         return *this;
     }
 
@@ -13,6 +13,7 @@
 #pragma once
 
 #include "etl/dyn_base.hpp"    //The base class and utilities
+#include "etl/util/tensor_format.hpp" //The serialization format
 
 namespace etl {
 
@@ -677,22 +678,48 @@ void swap(dyn_matrix_impl<T, SO, D>& lhs, dyn_matrix_impl<T, SO, D>& rhs) {
 
 /*!
  * \brief Serialize the given matrix using the given serializer
+ *
+ * The matrix is written with a tensor header (see tensor_format.hpp)
+ * followed by its memory in a single block.
+ *
  * \param os The serializer
  * \param matrix The matrix to serialize
  */
 template <typename Stream, typename T, order SO, size_t D>
 void serialize(serializer<Stream>& os, const dyn_matrix_impl<T, SO, D>& matrix){
-    for(size_t i = 0; i < etl::dimensions(matrix); ++i){
-        os << matrix.dim(i);
-    }
+    detail::serialize_tensor(os, matrix);
+}
 
-    for(const auto& value : matrix){
-        os << value;
+namespace detail {
+
+/*!
+ * \brief Indicates if the matrix has the given dimensions
+ * \param matrix The matrix to test
+ * \param dimensions The dimensions to compare to
+ * \return true if the matrix has exactly the given dimensions, false otherwise
+ */
+template <typename T, order SO, size_t D>
+bool same_dimensions(const dyn_matrix_impl<T, SO, D>& matrix, const std::array<size_t, D>& dimensions) {
+    for (size_t d = 0; d < D; ++d) {
+        if (matrix.dim(d) != dimensions[d]) {
+            return false;
+        }
     }
+
+    return true;
 }
 
+} //end of namespace detail
+
 /*!
  * \brief Deserialize the given matrix using the given serializer
+ *
+ * Both the tensor format and the old format (the dimensions followed by
+ * the values) can be read. If the tensor cannot be read into the matrix,
+ * or if its size does not fit in memory or in the rest of the stream, the
+ * failbit of the stream is set. The memory of the matrix is only
+ * reallocated if its dimensions are changing.
+ *
  * \param is The deserializer
  * \param matrix The matrix to deserialize
  */
@@ -700,15 +727,45 @@ template <typename Stream, typename T, order SO, size_t D>
 void deserialize(deserializer<Stream>& is, dyn_matrix_impl<T, SO, D>& matrix){
     typename std::decay_t<decltype(matrix)>::dimension_storage_impl new_dimensions;
 
+    detail::tensor_header header;
+
+    if (detail::read_tensor_header(is, header)) {
+        if (!is.stream || !detail::check_tensor_header<dyn_matrix_impl<T, SO, D>>(header) || !detail::check_tensor_data_size(header, is.remaining())) {
+            is.stream.setstate(std::ios_base::failbit);
+            return;
+        }
+
+        std::copy_n(header.dims.begin(), D, new_dimensions.begin());
+
+        // The memory of the matrix is reused when the dimensions are not changing
+        if (!detail::same_dimensions(matrix, new_dimensions)) {
+            matrix.resize_arr(new_dimensions);
+        }
+
+        detail::deserialize_tensor_data(is, header, matrix);
+
+        return;
+    }
+
     for(auto& value : new_dimensions){
         is >> value;
     }
 
-    matrix.resize_arr(new_dimensions);
+    // The dimensions are validated before allocating the memory
+    size_t bytes;
 
-    for(auto& value : matrix){
-        is >> value;
+    if (!is.stream || !detail::checked_data_size(new_dimensions.begin(), new_dimensions.end(), sizeof(T), bytes) || bytes > is.remaining()) {
+        is.stream.setstate(std::ios_base::failbit);
+        return;
+    }
+
+    if (!detail::same_dimensions(matrix, new_dimensions)) {
+        matrix.resize_arr(new_dimensions);
     }
+
+    is.read(reinterpret_cast<char*>(matrix.memory_start()), matrix.size() * sizeof(T));
+
+    matrix.invalidate_gpu();
 }
 
 } //end of namespace etl
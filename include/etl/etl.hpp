@@ -30,12 +30,15 @@
 #include "etl/random.hpp"
 #include "etl/duration.hpp"
 #include "etl/threshold.hpp"
+#include "etl/util/trace.hpp"
 #include "etl/thread_engine.hpp"
 #include "etl/parallel.hpp"
 #include "etl/memory.hpp"
 #include "etl/allocator.hpp"
 #include "etl/iterator.hpp"
 #include "etl/util/counters.hpp"
+#include "etl/util/profile.hpp"
+#include "etl/util/selection_log.hpp"
 
 //Forward declarations
 #include "etl/value_fwd.hpp"
@@ -72,6 +75,12 @@
 // The parallel utilies
 #include "etl/parallel_support.hpp"
 
+// The im2col transformations
+#include "etl/impl/im2col.hpp"
+
+// The top-k selection
+#include "etl/impl/topk.hpp"
+
 // CRTP classes
 #include "etl/crtp/assignable.hpp"
 #include "etl/crtp/inplace_assignable.hpp"
@@ -97,12 +106,15 @@
 #include "etl/expr/prob_pool_2d_expr.hpp"
 #include "etl/expr/dyn_prob_pool_2d_expr.hpp"
 #include "etl/expr/convmtx_2d_expr.hpp"
+#include "etl/expr/dyn_convmtx_2d_expr.hpp"
 #include "etl/expr/fft_expr.hpp"
 #include "etl/expr/gemm_expr.hpp"
 #include "etl/expr/gemv_expr.hpp"
 #include "etl/expr/gevm_expr.hpp"
 #include "etl/expr/outer_product_expr.hpp"
 #include "etl/expr/batch_outer_product_expr.hpp"
+#include "etl/expr/gather_rows_expr.hpp"
+#include "etl/expr/scan_expr.hpp"
 #include "etl/expr/inv_expr.hpp"
 #include "etl/expr/conv_1d_valid_expr.hpp"
 #include "etl/expr/conv_expr.hpp"
@@ -115,6 +127,7 @@
 #include "etl/op/slice_view.hpp"
 #include "etl/op/sub_view.hpp"
 #include "etl/op/sub_matrix_2d.hpp"
+#include "etl/op/strided_view.hpp"
 #include "etl/op/dyn_matrix_view.hpp"
 #include "etl/op/fast_matrix_view.hpp"
 #include "etl/expr/binary_expr.hpp"
@@ -159,9 +172,20 @@
 #include "etl/adapters/strictly_upper.hpp"
 #include "etl/adapters/uni_upper.hpp"
 
+// The packed matrices
+#include "etl/packed.hpp"
+#include "etl/impl/packed.hpp"
+
+// The batched inverse and determinant of small matrices
+#include "etl/impl/batch_inv.hpp"
+
 // Serialization support
 #include "etl/serializer.hpp"
 #include "etl/deserializer.hpp"
+#include "etl/tensor_reader.hpp"
+#include "etl/dataset_reader.hpp"
+#include "etl/npy.hpp"
+#include "etl/csv.hpp"
 
 // to_string support
 #include "etl/print.hpp"
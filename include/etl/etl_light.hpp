@@ -30,12 +30,15 @@
 #include "etl/random.hpp"
 #include "etl/duration.hpp"
 #include "etl/threshold.hpp"
+#include "etl/util/trace.hpp"
 #include "etl/thread_engine.hpp"
 #include "etl/parallel.hpp"
 #include "etl/memory.hpp"
 #include "etl/allocator.hpp"
 #include "etl/iterator.hpp"
 #include "etl/util/counters.hpp"
+#include "etl/util/profile.hpp"
+#include "etl/util/selection_log.hpp"
 
 //Forward declarations
 #include "etl/value_fwd.hpp"
@@ -91,6 +94,7 @@
 #include "etl/op/slice_view.hpp"
 #include "etl/op/sub_view.hpp"
 #include "etl/op/sub_matrix_2d.hpp"
+#include "etl/op/strided_view.hpp"
 #include "etl/op/dyn_matrix_view.hpp"
 #include "etl/op/fast_matrix_view.hpp"
 #include "etl/expr/binary_expr.hpp"
@@ -128,9 +132,20 @@
 #include "etl/adapters/strictly_upper.hpp"
 #include "etl/adapters/uni_upper.hpp"
 
+// The packed matrices
+#include "etl/packed.hpp"
+#include "etl/impl/packed.hpp"
+
+// The batched inverse and determinant of small matrices
+#include "etl/impl/batch_inv.hpp"
+
 // Serialization support
 #include "etl/serializer.hpp"
 #include "etl/deserializer.hpp"
+#include "etl/tensor_reader.hpp"
+#include "etl/dataset_reader.hpp"
+#include "etl/npy.hpp"
+#include "etl/csv.hpp"
 
 // to_string support
 #include "etl/print.hpp"
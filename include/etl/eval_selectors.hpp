@@ -28,6 +28,7 @@ namespace detail {
 template <vector_mode_t V, typename E, typename R>
 using are_vectorizable_select = cpp::and_u<
                                vectorize_expr, // ETL must be allowed to vectorize expressions
+                               has_direct_access<R>::value, // The LHS expression must have direct memory access
                                decay_traits<R>::template vectorizable<V>::value, // The LHS expression must be vectorizable
                                decay_traits<E>::template vectorizable<V>::value, // The RHS expression must be vectorizable
                                decay_traits<E>::storage_order == decay_traits<R>::storage_order, // Both expressions must have the same order
@@ -76,6 +76,8 @@ namespace standard_evaluator {
      */
     template <typename E, typename R, cpp_enable_if(detail::standard_assign<E, R>::value)>
     void assign_evaluate_impl(E&& expr, R&& result) {
+        detail::profile_scope profile("assign", "STD", 2 * etl::size(result) * sizeof(value_t<R>), etl::size(result));
+
         for (size_t i = 0; i < etl::size(result); ++i) {
             result[i] = expr.read_flat(i);
         }
@@ -88,6 +90,8 @@ namespace standard_evaluator {
      */
     template <typename E, typename R, cpp_enable_if(std::is_same<value_t<E>, value_t<R>>::value, detail::fast_assign<E, R>::value)>
     void assign_evaluate_impl(E&& expr, R&& result) {
+        detail::profile_scope profile("assign", "COPY", 2 * etl::size(result) * sizeof(value_t<R>), 0);
+
 //TODO(CPP17) if constexpr
 #ifdef ETL_CUDA
         if(expr.is_cpu_up_to_date()){
@@ -123,6 +127,8 @@ namespace standard_evaluator {
      */
     template <typename E, typename R, cpp_enable_if(!std::is_same<value_t<E>, value_t<R>>::value, detail::fast_assign<E, R>::value)>
     void assign_evaluate_impl(E&& expr, R&& result) {
+        detail::profile_scope profile("assign", "COPY", 2 * etl::size(result) * sizeof(value_t<R>), 0);
+
         expr.ensure_cpu_up_to_date();
 
         direct_copy(expr.memory_start(), expr.memory_end(), result.memory_start());
@@ -151,6 +157,8 @@ namespace standard_evaluator {
 
             //Distribute evenly the batches
 
+            const size_t threads = parallel_threads();
+
             auto batch = n / threads;
 
             for (size_t t = 0; t < threads - 1; ++t) {
@@ -193,6 +201,8 @@ namespace standard_evaluator {
 
             //Distribute evenly the batches
 
+            const size_t threads = parallel_threads();
+
             auto batch = n / threads;
 
             for (size_t t = 0; t < threads - 1; ++t) {
@@ -224,7 +234,10 @@ namespace standard_evaluator {
         safe_ensure_cpu_up_to_date(expr);
         safe_ensure_cpu_up_to_date(result);
 
+        detail::profile_scope profile("assign", "STD", 2 * etl::size(result) * sizeof(value_t<R>), etl::size(result));
+
         if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
+            detail::profile_set_impl("PAR_STD");
             par_linear<detail::Assign>(expr, result);
         } else {
             detail::Assign<R&,E&>(result, expr)();
@@ -243,7 +256,10 @@ namespace standard_evaluator {
 
         constexpr auto V = detail::select_vector_mode<E, R>();
 
+        detail::profile_scope profile("assign", "VEC", 2 * etl::size(result) * sizeof(value_t<R>), etl::size(result));
+
         if(all_thread_safe<E>::value && select_parallel(etl::size(result))){
+            detail::profile_set_impl("PAR_VEC");
             par_vec<detail::VectorizedAssign, V>(expr, result);
         } else {
             detail::VectorizedAssign<V, R&, E&>(result, expr)();
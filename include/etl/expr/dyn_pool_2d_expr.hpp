@@ -9,6 +9,9 @@
 
 #include "etl/expr/base_temporary_expr.hpp"
 
+//Get the implementations
+#include "etl/impl/pooling.hpp"
+
 namespace etl {
 
 /*!
@@ -55,6 +58,8 @@ struct dyn_pool_2d_expr : base_temporary_expr_un<dyn_pool_2d_expr<A, Impl>, A, f
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_lhs(c);
 
+        detail::profile_scope profile(Impl::desc(), detail::pool_impl_name<Impl, 2>(c), (etl::size(a) + etl::size(c)) * sizeof(value_t<A>), etl::size(c) * c1 * c2);
+
         Impl::template apply<>(
             make_temporary(a),
             std::forward<C>(c),
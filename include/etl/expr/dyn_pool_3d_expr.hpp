@@ -9,6 +9,9 @@
 
 #include "etl/expr/base_temporary_expr.hpp"
 
+//Get the implementations
+#include "etl/impl/pooling.hpp"
+
 namespace etl {
 
 /*!
@@ -58,6 +61,8 @@ struct dyn_pool_3d_expr : base_temporary_expr_un<dyn_pool_3d_expr<A, Impl>, A> {
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_lhs(lhs);
 
+        detail::profile_scope profile(Impl::desc(), detail::pool_impl_name<Impl, 3>(lhs), (etl::size(a) + etl::size(lhs)) * sizeof(value_t<A>), etl::size(lhs) * c1 * c2 * c3);
+
         Impl::template apply<>(
             make_temporary(a),
             std::forward<L>(lhs),
@@ -0,0 +1,278 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+//Get the implementations
+#include "etl/impl/embedding.hpp"
+
+namespace etl {
+
+/*!
+ * \brief A gather expression, selecting rows of a table.
+ * \tparam A The table type
+ * \tparam B The indices type
+ */
+template <typename A, typename B>
+struct gather_rows_expr : base_temporary_expr_bin<gather_rows_expr<A, B>, A, B> {
+    using value_type  = value_t<A>;                               ///< The type of value of the expression
+    using this_type   = gather_rows_expr<A, B>;                   ///< The type of this expression
+    using base_type   = base_temporary_expr_bin<this_type, A, B>; ///< The base type
+    using left_traits = decay_traits<A>;                          ///< The traits of the sub type
+
+    static constexpr auto storage_order = left_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The table
+     * \param b The indices
+     */
+    explicit gather_rows_expr(A a, B b) : base_type(a, b) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the gather dimensions
+     * \param a The table
+     * \param b The indices
+     * \param c The output matrix
+     */
+    template <typename C, cpp_enable_if(all_fast<A, B, C>::value)>
+    static void check(const A& a, const B& b, const C& c) {
+        cpp_unused(a);
+        cpp_unused(b);
+        cpp_unused(c);
+
+        static_assert(etl::dimensions<C>() == 2, "The output of gather_rows is a matrix");
+        static_assert(etl::dim<0, C>() == decay_traits<B>::size(), "Invalid number of rows for gather_rows");
+        static_assert(etl::dim<1, C>() == etl::dim<1, A>(), "Invalid number of columns for gather_rows");
+    }
+
+    /*!
+     * \brief Validate the gather dimensions
+     * \param a The table
+     * \param b The indices
+     * \param c The output matrix
+     */
+    template <typename C, cpp_disable_if(all_fast<A, B, C>::value)>
+    static void check(const A& a, const B& b, const C& c) {
+        static_assert(etl::dimensions<C>() == 2, "The output of gather_rows is a matrix");
+
+        cpp_assert(etl::dim<0>(c) == etl::size(b), "Invalid number of rows for gather_rows");
+        cpp_assert(etl::dim<1>(c) == etl::dim<1>(a), "Invalid number of columns for gather_rows");
+
+        cpp_unused(a);
+        cpp_unused(b);
+        cpp_unused(c);
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param c The expression to which assign
+     */
+    template <typename C>
+    void assign_to(C&& c) const {
+        static_assert(all_etl_expr<A, B, C>::value, "gather_rows only supported for ETL expressions");
+        static_assert(all_dma<A, C>::value, "gather_rows is only supported for direct memory access");
+        static_assert(all_row_major<A, C>::value, "gather_rows is only supported for row-major matrices");
+
+        auto& a = this->a();
+        auto& b = this->b();
+
+        check(a, b, c);
+
+        standard_evaluator::pre_assign_rhs(a);
+        standard_evaluator::pre_assign_rhs(b);
+        standard_evaluator::pre_assign_lhs(c);
+
+        detail::gather_rows_impl::apply(a, b, c);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+};
+
+/*!
+ * \brief Traits for a gather expression
+ * \tparam A The table type
+ * \tparam B The indices type
+ */
+template <typename A, typename B>
+struct etl_traits<etl::gather_rows_expr<A, B>> {
+    using expr_t       = etl::gather_rows_expr<A, B>; ///< The expression type
+    using left_expr_t  = std::decay_t<A>;             ///< The left sub expression type
+    using right_expr_t = std::decay_t<B>;             ///< The right sub expression type
+    using left_traits  = etl_traits<left_expr_t>;     ///< The left sub traits
+    using right_traits = etl_traits<right_expr_t>;    ///< The right sub traits
+    using value_type   = value_t<A>;                  ///< The value type of the expression
+
+    static constexpr bool is_etl          = true;                                          ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer  = false;                                         ///< Indicates if the type is a transformer
+    static constexpr bool is_view         = false;                                         ///< Indicates if the type is a view
+    static constexpr bool is_magic_view   = false;                                         ///< Indicates if the type is a magic view
+    static constexpr bool is_fast         = left_traits::is_fast && right_traits::is_fast; ///< Indicates if the expression is fast
+    static constexpr bool is_linear       = true;                                          ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe  = true;                                          ///< Indicates if the expression is thread safe
+    static constexpr bool is_value        = false;                                         ///< Indicates if the expression is of value type
+    static constexpr bool is_direct       = true;                                          ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator    = false;                                         ///< Indicates if the expression is a generator
+    static constexpr bool is_padded       = false;                                         ///< Indicates if the expression is padded
+    static constexpr bool is_aligned      = true;                                          ///< Indicates if the expression is padded
+    static constexpr bool is_gpu          = false;                                         ///< Indicates if the expression can be done on GPU
+    static constexpr bool needs_evaluator = true;                                          ///< Indicates if the expression needs a evaluator visitor
+    static constexpr order storage_order  = left_traits::storage_order;                    ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    using vectorizable = std::true_type;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return DD == 0 ? decay_traits<B>::size()
+                       : decay_traits<A>::template dim<1>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        if (d == 0) {
+            return etl::size(e._b);
+        } else {
+            return etl::dim(e._a, 1);
+        }
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return etl::size(e._b) * etl::dim(e._a, 1);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return decay_traits<B>::size() * decay_traits<A>::template dim<1>();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return 2;
+    }
+};
+
+/*!
+ * \brief Gather the rows of the given table designated by the given indices.
+ *
+ * The row i of the result is the row indices[i] of the table.
+ *
+ * \param table The table (2D matrix) to gather rows from
+ * \param indices The indices of the rows to gather (1D integral vector)
+ * \return An expression representing the gathered rows
+ */
+template <typename A, typename B>
+gather_rows_expr<detail::build_type<A>, detail::build_type<B>> gather_rows(A&& table, B&& indices) {
+    static_assert(all_etl_expr<A, B>::value, "etl::gather_rows can only be used on ETL expressions");
+    static_assert(decay_traits<A>::dimensions() == 2, "etl::gather_rows is only defined for 2D table");
+    static_assert(decay_traits<B>::dimensions() == 1, "etl::gather_rows is only defined for 1D indices");
+    static_assert(std::is_integral<value_t<B>>::value, "etl::gather_rows indices must be integral");
+
+    return gather_rows_expr<detail::build_type<A>, detail::build_type<B>>{table, indices};
+}
+
+/*!
+ * \brief Accumulate each row of grad into the row of table designated by indices.
+ *
+ * This computes table(indices[i]) += grad(i) for each i. Duplicate indices
+ * are accumulated. This is the backward operation of gather_rows.
+ *
+ * \param table The table (2D matrix) to accumulate into
+ * \param indices The indices of the target rows (1D integral vector)
+ * \param grad The rows to accumulate
+ */
+template <typename A, typename B, typename G>
+void scatter_add_rows(A&& table, const B& indices, const G& grad) {
+    static_assert(all_etl_expr<A, B, G>::value, "etl::scatter_add_rows can only be used on ETL expressions");
+    static_assert(all_dma<A, G>::value, "etl::scatter_add_rows is only supported for direct memory access");
+    static_assert(all_row_major<A, G>::value, "etl::scatter_add_rows is only supported for row-major matrices");
+    static_assert(decay_traits<A>::dimensions() == 2, "etl::scatter_add_rows is only defined for 2D table");
+    static_assert(decay_traits<G>::dimensions() == 2, "etl::scatter_add_rows is only defined for 2D gradients");
+    static_assert(decay_traits<B>::dimensions() == 1, "etl::scatter_add_rows is only defined for 1D indices");
+    static_assert(std::is_integral<value_t<B>>::value, "etl::scatter_add_rows indices must be integral");
+
+    cpp_assert(etl::dim<0>(grad) == etl::size(indices), "Invalid number of rows for scatter_add_rows");
+    cpp_assert(etl::dim<1>(grad) == etl::dim<1>(table), "Invalid number of columns for scatter_add_rows");
+
+    detail::scatter_add_rows_impl::apply(table, indices, grad);
+}
+
+} //end of namespace etl
@@ -11,6 +11,7 @@
 
 //Get the implementations
 #include "etl/impl/gemm.hpp"
+#include "etl/impl/structured_gemm.hpp"
 
 namespace etl {
 
@@ -52,6 +52,8 @@ struct pool_2d_expr : base_temporary_expr_un<pool_2d_expr<A, C1, C2, S1, S2, P1,
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_lhs(c);
 
+        detail::profile_scope profile(Impl::desc(), detail::pool_impl_name<Impl, 2>(c), (etl::size(a) + etl::size(c)) * sizeof(value_t<A>), etl::size(c) * C1 * C2);
+
         Impl::template apply<C1, C2, S1, S2, P1, P2>(
             make_temporary(a),
             std::forward<C>(c));
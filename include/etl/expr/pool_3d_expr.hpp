@@ -9,6 +9,9 @@
 
 #include "etl/expr/base_temporary_expr.hpp"
 
+//Get the implementations
+#include "etl/impl/pooling.hpp"
+
 namespace etl {
 
 /*!
@@ -48,6 +51,8 @@ struct pool_3d_expr : base_temporary_expr_un<pool_3d_expr<A, C1, C2, C3, S1, S2,
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_lhs(c);
 
+        detail::profile_scope profile(Impl::desc(), detail::pool_impl_name<Impl, 3>(c), (etl::size(a) + etl::size(c)) * sizeof(value_t<A>), etl::size(c) * C1 * C2 * C3);
+
         Impl::template apply<C1, C2, C3, S1, S2, S3, P1, P2, P3>(
             make_temporary(a),
             std::forward<C>(c));
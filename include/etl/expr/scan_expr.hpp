@@ -0,0 +1,321 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+//Get the implementations
+#include "etl/impl/scan.hpp"
+
+namespace etl {
+
+/*!
+ * \brief A cumulative (scan) expression.
+ *
+ * The result has the same dimensions as the input expression.
+ *
+ * \tparam A The type of the input expression
+ * \tparam Impl The implementation of the scan
+ */
+template <typename A, typename Impl>
+struct scan_expr : base_temporary_expr_un<scan_expr<A, Impl>, A> {
+    using value_type = value_t<A>;                           ///< The type of value of the expression
+    using this_type  = scan_expr<A, Impl>;                   ///< The type of this expression
+    using base_type  = base_temporary_expr_un<this_type, A>; ///< The base type
+    using sub_traits = decay_traits<A>;                      ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The sub expression
+     */
+    explicit scan_expr(A a) : base_type(a) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the scan dimensions
+     * \param a The input matrix
+     * \param c The output matrix
+     */
+    template <typename C, cpp_enable_if(all_fast<A, C>::value)>
+    static void check(const A& a, const C& c) {
+        cpp_unused(a);
+        cpp_unused(c);
+
+        static_assert(etl::dimensions<A>() == etl::dimensions<C>(), "Invalid number of dimensions for scan");
+        static_assert(decay_traits<A>::size() == decay_traits<C>::size(), "Invalid size for scan");
+    }
+
+    /*!
+     * \brief Validate the scan dimensions
+     * \param a The input matrix
+     * \param c The output matrix
+     */
+    template <typename C, cpp_disable_if(all_fast<A, C>::value)>
+    static void check(const A& a, const C& c) {
+        static_assert(etl::dimensions<A>() == etl::dimensions<C>(), "Invalid number of dimensions for scan");
+
+        for (size_t d = 0; d < etl::dimensions<A>(); ++d) {
+            cpp_assert(etl::dim(a, d) == etl::dim(c, d), "Invalid dimensions for scan");
+        }
+
+        cpp_unused(a);
+        cpp_unused(c);
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param c The expression to which assign
+     */
+    template <typename C>
+    void assign_to(C&& c) const {
+        static_assert(all_etl_expr<A, C>::value, "scan only supported for ETL expressions");
+
+        auto& a = this->a();
+
+        check(a, c);
+
+        standard_evaluator::pre_assign_rhs(a);
+        standard_evaluator::pre_assign_lhs(c);
+
+        Impl::apply(make_temporary(a), c);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+};
+
+/*!
+ * \brief Traits for a scan expression
+ * \tparam A The input sub type
+ * \tparam Impl The implementation of the scan
+ */
+template <typename A, typename Impl>
+struct etl_traits<etl::scan_expr<A, Impl>> {
+    using expr_t     = etl::scan_expr<A, Impl>; ///< The expression type
+    using sub_expr_t = std::decay_t<A>;         ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;  ///< The sub traits
+    using value_type = value_t<A>;              ///< The value type of the expression
+
+    static constexpr bool is_etl          = true;                      ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer  = false;                     ///< Indicates if the type is a transformer
+    static constexpr bool is_view         = false;                     ///< Indicates if the type is a view
+    static constexpr bool is_magic_view   = false;                     ///< Indicates if the type is a magic view
+    static constexpr bool is_fast         = sub_traits::is_fast;       ///< Indicates if the expression is fast
+    static constexpr bool is_linear       = true;                      ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe  = true;                      ///< Indicates if the expression is thread safe
+    static constexpr bool is_value        = false;                     ///< Indicates if the expression is of value type
+    static constexpr bool is_direct       = true;                      ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator    = false;                     ///< Indicates if the expression is a generator
+    static constexpr bool is_padded       = false;                     ///< Indicates if the expression is padded
+    static constexpr bool is_aligned      = true;                      ///< Indicates if the expression is padded
+    static constexpr bool is_gpu          = false;                     ///< Indicates if the expression can be done on GPU
+    static constexpr bool needs_evaluator = true;                      ///< Indicates if the expression needs a evaluator visitor
+    static constexpr order storage_order  = sub_traits::storage_order; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    using vectorizable = std::true_type;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return decay_traits<A>::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        return etl::dim(e._a, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return etl::size(e._a);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return decay_traits<A>::size();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return sub_traits::dimensions();
+    }
+};
+
+/*!
+ * \brief Returns the cumulative sum of the given vector.
+ *
+ * The element i of the result is the sum of the elements 0 to i of the input.
+ *
+ * \param a The input vector
+ * \return an expression representing the cumulative sum of a
+ */
+template <typename A>
+scan_expr<detail::build_type<A>, detail::scan_impl<impl::common::scan_sum_op>> cumsum(A&& a) {
+    static_assert(is_etl_expr<A>::value, "etl::cumsum can only be used on ETL expressions");
+    static_assert(decay_traits<A>::dimensions() == 1, "etl::cumsum is only defined for vectors");
+
+    return scan_expr<detail::build_type<A>, detail::scan_impl<impl::common::scan_sum_op>>{a};
+}
+
+/*!
+ * \brief Returns the cumulative product of the given vector.
+ *
+ * The element i of the result is the product of the elements 0 to i of the input.
+ *
+ * \param a The input vector
+ * \return an expression representing the cumulative product of a
+ */
+template <typename A>
+scan_expr<detail::build_type<A>, detail::scan_impl<impl::common::scan_prod_op>> cumprod(A&& a) {
+    static_assert(is_etl_expr<A>::value, "etl::cumprod can only be used on ETL expressions");
+    static_assert(decay_traits<A>::dimensions() == 1, "etl::cumprod is only defined for vectors");
+
+    return scan_expr<detail::build_type<A>, detail::scan_impl<impl::common::scan_prod_op>>{a};
+}
+
+/*!
+ * \brief Returns the cumulative sum of each row of the given matrix.
+ * \param a The input matrix
+ * \return an expression representing the cumulative sum of the rows of a
+ */
+template <typename A>
+scan_expr<detail::build_type<A>, detail::scan_r_impl<impl::common::scan_sum_op>> cumsum_r(A&& a) {
+    static_assert(is_etl_expr<A>::value, "etl::cumsum_r can only be used on ETL expressions");
+    static_assert(decay_traits<A>::dimensions() == 2, "etl::cumsum_r is only defined for matrices");
+
+    return scan_expr<detail::build_type<A>, detail::scan_r_impl<impl::common::scan_sum_op>>{a};
+}
+
+/*!
+ * \brief Returns the cumulative sum of each column of the given matrix.
+ * \param a The input matrix
+ * \return an expression representing the cumulative sum of the columns of a
+ */
+template <typename A>
+scan_expr<detail::build_type<A>, detail::scan_l_impl<impl::common::scan_sum_op>> cumsum_l(A&& a) {
+    static_assert(is_etl_expr<A>::value, "etl::cumsum_l can only be used on ETL expressions");
+    static_assert(decay_traits<A>::dimensions() == 2, "etl::cumsum_l is only defined for matrices");
+
+    return scan_expr<detail::build_type<A>, detail::scan_l_impl<impl::common::scan_sum_op>>{a};
+}
+
+/*!
+ * \brief Returns the cumulative product of each row of the given matrix.
+ * \param a The input matrix
+ * \return an expression representing the cumulative product of the rows of a
+ */
+template <typename A>
+scan_expr<detail::build_type<A>, detail::scan_r_impl<impl::common::scan_prod_op>> cumprod_r(A&& a) {
+    static_assert(is_etl_expr<A>::value, "etl::cumprod_r can only be used on ETL expressions");
+    static_assert(decay_traits<A>::dimensions() == 2, "etl::cumprod_r is only defined for matrices");
+
+    return scan_expr<detail::build_type<A>, detail::scan_r_impl<impl::common::scan_prod_op>>{a};
+}
+
+/*!
+ * \brief Returns the cumulative product of each column of the given matrix.
+ * \param a The input matrix
+ * \return an expression representing the cumulative product of the columns of a
+ */
+template <typename A>
+scan_expr<detail::build_type<A>, detail::scan_l_impl<impl::common::scan_prod_op>> cumprod_l(A&& a) {
+    static_assert(is_etl_expr<A>::value, "etl::cumprod_l can only be used on ETL expressions");
+    static_assert(decay_traits<A>::dimensions() == 2, "etl::cumprod_l is only defined for matrices");
+
+    return scan_expr<detail::build_type<A>, detail::scan_l_impl<impl::common::scan_prod_op>>{a};
+}
+
+/*!
+ * \brief Returns the integral image (summed-area table) of the given matrix.
+ *
+ * The element (i, j) of the result is the sum of all the elements (k, l) of
+ * the input with k <= i and l <= j.
+ *
+ * \param a The input matrix
+ * \return an expression representing the integral image of a
+ */
+template <typename A>
+scan_expr<detail::build_type<A>, detail::integral_image_impl> integral_image(A&& a) {
+    static_assert(is_etl_expr<A>::value, "etl::integral_image can only be used on ETL expressions");
+    static_assert(decay_traits<A>::dimensions() == 2, "etl::integral_image is only defined for matrices");
+
+    return scan_expr<detail::build_type<A>, detail::integral_image_impl>{a};
+}
+
+} //end of namespace etl
@@ -44,10 +44,13 @@ struct transform_op {
     /*!
      * \brief Indicates if the expression is vectorizable using the
      * given vector mode
+     *
+     * The transformer itself decides if it is vectorizable.
+     *
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = std::true_type;
 };
 
 /*!
@@ -852,6 +855,12 @@ public:
     using iterator          = etl::iterator<this_type>;       ///< The iterator type
     using const_iterator    = etl::iterator<const this_type>; ///< The const iterator type
 
+    /*!
+     * \brief The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type = typename V::template vec_type<T>;
+
     /*!
      * \brief Construct a new unary_expr from the given sub-expression
      * \param l The sub expression
@@ -887,6 +896,28 @@ public:
         return value.read_flat(i);
     }
 
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param i The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    vec_type<V> load(size_t i) const {
+        return value.template load<V>(i);
+    }
+
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param i The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    vec_type<V> loadu(size_t i) const {
+        return value.template loadu<V>(i);
+    }
+
     /*!
      * \brief Creates a sub view of the matrix, effectively removing the first dimension and fixing it to the given index.
      * \param i The index to use
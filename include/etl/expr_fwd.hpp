@@ -70,6 +70,9 @@ struct sub_matrix_2d;
 template <typename T, typename Enable = void>
 struct slice_view;
 
+template <typename T>
+struct strided_view;
+
 template <typename T, bool Aligned>
 struct memory_slice_view;
 
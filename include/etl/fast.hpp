@@ -13,6 +13,7 @@
 #pragma once
 
 #include "etl/fast_base.hpp"
+#include "etl/util/tensor_format.hpp" //The serialization format
 
 namespace etl {
 
@@ -461,26 +462,52 @@ void swap(fast_matrix_impl<T, ST, SO, Dims...>& lhs, fast_matrix_impl<T, ST, SO,
 
 /*!
  * \brief Serialize the given matrix using the given serializer
+ *
+ * The matrix is written with a tensor header (see tensor_format.hpp)
+ * followed by its memory in a single block.
+ *
  * \param os The serializer
  * \param matrix The matrix to serialize
  */
 template <typename Stream, typename T, typename ST, order SO, size_t... Dims>
 void serialize(serializer<Stream>& os, const fast_matrix_impl<T, ST, SO, Dims...>& matrix) {
-    for (const auto& value : matrix) {
-        os << value;
-    }
+    detail::serialize_tensor(os, matrix);
 }
 
 /*!
  * \brief Deserialize the given matrix using the given serializer
+ *
+ * Both the tensor format and the old format (the values only) can be
+ * read. If the tensor cannot be read into the matrix, the failbit of the
+ * stream is set.
+ *
  * \param os The deserializer
  * \param matrix The matrix to deserialize
  */
 template <typename Stream, typename T, typename ST, order SO, size_t... Dims>
 void deserialize(deserializer<Stream>& os, fast_matrix_impl<T, ST, SO, Dims...>& matrix) {
-    for (auto& value : matrix) {
-        os >> value;
+    detail::tensor_header header;
+
+    if (detail::read_tensor_header(os, header)) {
+        bool valid = os.stream && detail::check_tensor_header<fast_matrix_impl<T, ST, SO, Dims...>>(header);
+
+        for (size_t d = 0; valid && d < sizeof...(Dims); ++d) {
+            valid = header.dims[d] == matrix.dim(d);
+        }
+
+        if (!valid) {
+            os.stream.setstate(std::ios_base::failbit);
+            return;
+        }
+
+        detail::deserialize_tensor_data(os, header, matrix);
+
+        return;
     }
+
+    os.read(reinterpret_cast<char*>(matrix.memory_start()), matrix.size() * sizeof(T));
+
+    matrix.invalidate_gpu();
 }
 
 } //end of namespace etl
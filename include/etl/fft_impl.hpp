@@ -23,4 +23,22 @@ enum class fft_impl {
     CUFFT ///< The NVidia CuFFT implementation
 };
 
+/*!
+ * \brief Returns the name of the given FFT implementation
+ * \param impl The implementation
+ * \return a string literal naming the implementation
+ */
+inline const char* impl_name(fft_impl impl) {
+    switch (impl) {
+        case fft_impl::STD:
+            return "STD";
+        case fft_impl::MKL:
+            return "MKL";
+        case fft_impl::CUFFT:
+            return "CUFFT";
+    }
+
+    return "UNKNOWN";
+}
+
 } //end of namespace etl
@@ -25,4 +25,24 @@ enum class gemm_impl {
     CUBLAS ///< CUBLAS (GPU) implementation
 };
 
+/*!
+ * \brief Returns the name of the given matrix-matrix multiplication implementation
+ * \param impl The implementation
+ * \return a string literal naming the implementation
+ */
+inline const char* impl_name(gemm_impl impl) {
+    switch (impl) {
+        case gemm_impl::STD:
+            return "STD";
+        case gemm_impl::VEC:
+            return "VEC";
+        case gemm_impl::BLAS:
+            return "BLAS";
+        case gemm_impl::CUBLAS:
+            return "CUBLAS";
+    }
+
+    return "UNKNOWN";
+}
+
 } //end of namespace etl
@@ -15,6 +15,13 @@ namespace impl {
  * \brief Functor for 2D Average Pooling
  */
 struct avg_pool_2d {
+    /*!
+     * \brief Returns the description of the operation
+     */
+    static constexpr const char* desc(){
+        return "avg_pool_2d";
+    }
+
     /*!
      * \brief Pool a block of the sub expression around the border (with padding)
      * \param sub The sub expression
@@ -345,6 +352,13 @@ struct avg_pool_2d {
  * \brief Functor for 3D Average Pooling
  */
 struct avg_pool_3d {
+    /*!
+     * \brief Returns the description of the operation
+     */
+    static constexpr const char* desc(){
+        return "avg_pool_3d";
+    }
+
     /*!
      * \brief Pool a block of the sub expression
      * \param sub The sub expression
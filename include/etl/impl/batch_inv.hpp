@@ -0,0 +1,259 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the batched inverse and determinant of small square
+ * matrices
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/common/batch_inv.hpp"
+#include "etl/impl/std/batch_inv.hpp"
+#include "etl/impl/vec/batch_inv.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Functor for the batched inverse of small square matrices
+ */
+struct batch_inv_impl {
+    /*!
+     * \brief Compute the inverse of the matrices [first, last) with the
+     * closed-form kernel
+     * \tparam N The dimension of the matrices
+     */
+    template <size_t N, typename T>
+    static void closed(const T* a, T* c, size_t first, size_t last) {
+        if (vec_impl_enabled<T>()) {
+            impl::vec::batch_inv_closed<default_vec, N>(a, c, first, last);
+        } else {
+            impl::standard::batch_inv_closed<N>(a, c, first, last);
+        }
+    }
+
+    /*!
+     * \brief Compute the inverse of the matrices [first, last) with the
+     * elimination unrolled for the dimension N
+     * \tparam N The dimension of the matrices
+     */
+    template <size_t N, typename T>
+    static void unrolled(const T* a, T* c, size_t first, size_t last) {
+        if (vec_impl_enabled<T>()) {
+            impl::vec::batch_inv_elimination<default_vec, N>(a, c, first, last);
+        } else {
+            impl::standard::batch_inv_elimination(a, c, std::integral_constant<size_t, N>{}, first, last);
+        }
+    }
+
+    /*!
+     * \brief Compute the inverse of the matrices [first, last) of the batch
+     * \param a The input matrices
+     * \param c The output matrices
+     * \param n The dimension of the matrices
+     * \param first The first matrix
+     * \param last The end of the matrices
+     */
+    template <typename T>
+    static void apply(const T* a, T* c, size_t n, size_t first, size_t last) {
+        switch (n) {
+            case 1: closed<1>(a, c, first, last); break;
+            case 2: closed<2>(a, c, first, last); break;
+            case 3: closed<3>(a, c, first, last); break;
+            case 4: closed<4>(a, c, first, last); break;
+            case 5: unrolled<5>(a, c, first, last); break;
+            case 6: unrolled<6>(a, c, first, last); break;
+            case 7: unrolled<7>(a, c, first, last); break;
+            case 8: unrolled<8>(a, c, first, last); break;
+            default: impl::standard::batch_inv_elimination(a, c, n, first, last); break;
+        }
+    }
+};
+
+/*!
+ * \brief Functor for the batched determinant of small square matrices
+ */
+struct batch_det_impl {
+    /*!
+     * \brief Compute the determinant of the matrices [first, last) with the
+     * closed-form kernel
+     * \tparam N The dimension of the matrices
+     */
+    template <size_t N, typename T>
+    static void closed(const T* a, T* d, size_t first, size_t last) {
+        if (vec_impl_enabled<T>()) {
+            impl::vec::batch_det_closed<default_vec, N>(a, d, first, last);
+        } else {
+            impl::standard::batch_det_closed<N>(a, d, first, last);
+        }
+    }
+
+    /*!
+     * \brief Compute the determinant of the matrices [first, last) with the
+     * elimination unrolled for the dimension N
+     * \tparam N The dimension of the matrices
+     */
+    template <size_t N, typename T>
+    static void unrolled(const T* a, T* d, size_t first, size_t last) {
+        if (vec_impl_enabled<T>()) {
+            impl::vec::batch_det_elimination<default_vec, N>(a, d, first, last);
+        } else {
+            impl::standard::batch_det_elimination(a, d, std::integral_constant<size_t, N>{}, first, last);
+        }
+    }
+
+    /*!
+     * \brief Compute the determinant of the matrices [first, last) of the batch
+     * \param a The input matrices
+     * \param d The output determinants
+     * \param n The dimension of the matrices
+     * \param first The first matrix
+     * \param last The end of the matrices
+     */
+    template <typename T>
+    static void apply(const T* a, T* d, size_t n, size_t first, size_t last) {
+        switch (n) {
+            case 1: closed<1>(a, d, first, last); break;
+            case 2: closed<2>(a, d, first, last); break;
+            case 3: closed<3>(a, d, first, last); break;
+            case 4: closed<4>(a, d, first, last); break;
+            case 5: unrolled<5>(a, d, first, last); break;
+            case 6: unrolled<6>(a, d, first, last); break;
+            case 7: unrolled<7>(a, d, first, last); break;
+            case 8: unrolled<8>(a, d, first, last); break;
+            default: impl::standard::batch_det_elimination(a, d, n, first, last); break;
+        }
+    }
+};
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the inverse of each matrix of the given batch.
+ *
+ * The matrices up to 4x4 are inverted with closed-form kernels, the
+ * matrices up to 8x8 with an unrolled Gauss-Jordan elimination with partial
+ * pivoting, both vectorized across the matrices. The batch is split between threads.
+ * The singular matrices are not detected, their inverse contains infinite
+ * or NaN values.
+ *
+ * \param a The input matrices (B x N x N)
+ * \param c The output matrices (B x N x N)
+ */
+template <typename A, typename C>
+void batch_inv(A&& a, C&& c) {
+    using T = value_t<A>;
+
+    static_assert(is_3d<A>::value && is_3d<C>::value, "batch_inv is only implemented for 3D tensors");
+    static_assert(std::is_floating_point<T>::value, "batch_inv is only implemented for floating point types");
+    static_assert(std::is_same<T, value_t<C>>::value, "batch_inv output must be of the same type as the input");
+    static_assert(decay_traits<A>::storage_order == order::RowMajor, "batch_inv is only implemented for row-major tensors");
+    static_assert(is_dma<C>::value && decay_traits<C>::storage_order == order::RowMajor, "batch_inv needs a row-major tensor with direct memory access as output");
+
+    const size_t B = etl::dim<0>(a);
+    const size_t n = etl::dim<1>(a);
+
+    cpp_assert(etl::dim<2>(a) == n, "batch_inv is only defined for square matrices");
+    cpp_assert(etl::dim<0>(c) == B && etl::dim<1>(c) == n && etl::dim<2>(c) == n, "Invalid dimensions for batch_inv");
+
+    standard_evaluator::pre_assign_rhs(a);
+
+    decltype(auto) aa = make_temporary(a);
+
+    safe_ensure_cpu_up_to_date(aa);
+
+    cpp_assert(aa.memory_start() != c.memory_start(), "batch_inv cannot be computed in place");
+
+    const T* ap = aa.memory_start();
+    T* cp       = c.memory_start();
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        detail::batch_inv_impl::apply(ap, cp, n, first, last);
+    };
+
+    engine_dispatch_1d(batch_fun, 0, B, select_parallel(B * n * n * n) && B > 1);
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the inverse of each matrix of the given batch.
+ * \param a The input matrices (B x N x N)
+ * \return a tensor containing the inverses (B x N x N)
+ */
+template <typename A>
+dyn_matrix<value_t<A>, 3> batch_inv(A&& a) {
+    dyn_matrix<value_t<A>, 3> c(etl::dim<0>(a), etl::dim<1>(a), etl::dim<2>(a));
+
+    batch_inv(a, c);
+
+    return c;
+}
+
+/*!
+ * \brief Compute the determinant of each matrix of the given batch.
+ *
+ * The matrices up to 4x4 use closed-form kernels, the larger matrices use
+ * a LU decomposition with partial pivoting, unrolled and vectorized across
+ * the matrices up to 8x8. The batch is split between threads.
+ *
+ * \param a The input matrices (B x N x N)
+ * \param d The output determinants (B)
+ */
+template <typename A, typename D>
+void batch_det(A&& a, D&& d) {
+    using T = value_t<A>;
+
+    static_assert(is_3d<A>::value && is_1d<D>::value, "batch_det is only implemented for 3D tensors");
+    static_assert(std::is_floating_point<T>::value, "batch_det is only implemented for floating point types");
+    static_assert(std::is_same<T, value_t<D>>::value, "batch_det output must be of the same type as the input");
+    static_assert(decay_traits<A>::storage_order == order::RowMajor, "batch_det is only implemented for row-major tensors");
+    static_assert(is_dma<D>::value, "batch_det needs a vector with direct memory access as output");
+
+    const size_t B = etl::dim<0>(a);
+    const size_t n = etl::dim<1>(a);
+
+    cpp_assert(etl::dim<2>(a) == n, "batch_det is only defined for square matrices");
+    cpp_assert(etl::size(d) == B, "Invalid dimensions for batch_det");
+
+    standard_evaluator::pre_assign_rhs(a);
+
+    decltype(auto) aa = make_temporary(a);
+
+    safe_ensure_cpu_up_to_date(aa);
+
+    const T* ap = aa.memory_start();
+    T* dp       = d.memory_start();
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        detail::batch_det_impl::apply(ap, dp, n, first, last);
+    };
+
+    engine_dispatch_1d(batch_fun, 0, B, select_parallel(B * n * n * n) && B > 1);
+
+    d.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the determinant of each matrix of the given batch.
+ * \param a The input matrices (B x N x N)
+ * \return a vector containing the determinants (B)
+ */
+template <typename A>
+dyn_vector<value_t<A>> batch_det(A&& a) {
+    dyn_vector<value_t<A>> d(etl::dim<0>(a));
+
+    batch_det(a, d);
+
+    return d;
+}
+
+} //end of namespace etl
@@ -150,6 +150,68 @@ inline void cblas_gemv(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     cblas_zgemv(Layout, TransA, M, N, &alpha, A, lda, X, incX, &beta, Y, incY);
 }
 
+// TRMM overloads
+
+/*!
+ * \brief Compute the triangular Matrix-Matrix multiplication B = alpha * op(A) * B or B = alpha * B * op(A).
+ * \param Layout The memory layout
+ * \param Side The side of A in the multiplication
+ * \param Uplo The triangle of A that is used
+ * \param TransA The operation on A
+ * \param Diag Indicates if A has a unit diagonal
+ * \param M The first dimension of B
+ * \param N The second dimension of B
+ * \param alpha The multiplicator on the product
+ * \param A The A matrix
+ * \param lda The leading dimension of A
+ * \param B The B matrix, input and output
+ * \param ldb The leading dimension of B
+ */
+inline void cblas_trmm(CBLAS_LAYOUT Layout, CBLAS_SIDE Side, CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA, CBLAS_DIAG Diag, size_t M, size_t N,
+        const float alpha, const float* A, size_t lda, float* B, size_t ldb) {
+    cblas_strmm(Layout, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+/*!
+ * \copydoc cblas_trmm
+ */
+inline void cblas_trmm(CBLAS_LAYOUT Layout, CBLAS_SIDE Side, CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA, CBLAS_DIAG Diag, size_t M, size_t N,
+        const double alpha, const double* A, size_t lda, double* B, size_t ldb) {
+    cblas_dtrmm(Layout, Side, Uplo, TransA, Diag, M, N, alpha, A, lda, B, ldb);
+}
+
+/*!
+ * \copydoc cblas_trmm
+ */
+inline void cblas_trmm(CBLAS_LAYOUT Layout, CBLAS_SIDE Side, CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA, CBLAS_DIAG Diag, size_t M, size_t N,
+        const etl::complex<float> alpha, const etl::complex<float>* A, size_t lda, etl::complex<float>* B, size_t ldb) {
+    cblas_ctrmm(Layout, Side, Uplo, TransA, Diag, M, N, &alpha, A, lda, B, ldb);
+}
+
+/*!
+ * \copydoc cblas_trmm
+ */
+inline void cblas_trmm(CBLAS_LAYOUT Layout, CBLAS_SIDE Side, CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA, CBLAS_DIAG Diag, size_t M, size_t N,
+        const etl::complex<double> alpha, const etl::complex<double>* A, size_t lda, etl::complex<double>* B, size_t ldb) {
+    cblas_ztrmm(Layout, Side, Uplo, TransA, Diag, M, N, &alpha, A, lda, B, ldb);
+}
+
+/*!
+ * \copydoc cblas_trmm
+ */
+inline void cblas_trmm(CBLAS_LAYOUT Layout, CBLAS_SIDE Side, CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA, CBLAS_DIAG Diag, size_t M, size_t N,
+        const std::complex<float> alpha, const std::complex<float>* A, size_t lda, std::complex<float>* B, size_t ldb) {
+    cblas_ctrmm(Layout, Side, Uplo, TransA, Diag, M, N, &alpha, A, lda, B, ldb);
+}
+
+/*!
+ * \copydoc cblas_trmm
+ */
+inline void cblas_trmm(CBLAS_LAYOUT Layout, CBLAS_SIDE Side, CBLAS_UPLO Uplo, CBLAS_TRANSPOSE TransA, CBLAS_DIAG Diag, size_t M, size_t N,
+        const std::complex<double> alpha, const std::complex<double>* A, size_t lda, std::complex<double>* B, size_t ldb) {
+    cblas_ztrmm(Layout, Side, Uplo, TransA, Diag, M, N, &alpha, A, lda, B, ldb);
+}
+
 /*!
  * \brief Compute the matrix mutplication of a and b and store the result in c
  * param a The lhs of the multiplication
@@ -336,6 +398,80 @@ void gevm(A&& a, B&& b, C&& c) {
     c.invalidate_gpu();
 }
 
+/*!
+ * \brief Compute the matrix mutplication of a and b and store the result
+ * in c, with a a triangular matrix.
+ *
+ * The zero triangle of a is not read. Its diagonal is read, so that a
+ * strictly triangular or unit triangular matrix is handled with its stored
+ * diagonal.
+ *
+ * param a The lhs of the multiplication, a triangular matrix
+ * param b The rhs of the multiplication
+ * param c The result
+ * param lower Indicates if a is lower triangular, otherwise it is upper triangular
+ */
+template <typename A, typename B, typename C>
+void trmm_left(A&& a, B&& b, C&& c, bool lower) {
+    using T = value_t<A>;
+
+    static constexpr bool row_major = decay_traits<A>::storage_order == order::RowMajor;
+
+    T alpha(1.0);
+
+    a.ensure_cpu_up_to_date();
+    b.ensure_cpu_up_to_date();
+
+    direct_copy(b.memory_start(), b.memory_end(), c.memory_start());
+
+    cblas_trmm(
+        row_major ? CblasRowMajor : CblasColMajor,
+        CblasLeft, lower ? CblasLower : CblasUpper, CblasNoTrans, CblasNonUnit,
+        etl::rows(c), etl::columns(c),
+        alpha,
+        a.memory_start(), major_stride(a),
+        c.memory_start(), major_stride(c));
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the matrix mutplication of a and b and store the result
+ * in c, with b a triangular matrix.
+ *
+ * The zero triangle of b is not read. Its diagonal is read, so that a
+ * strictly triangular or unit triangular matrix is handled with its stored
+ * diagonal.
+ *
+ * param a The lhs of the multiplication
+ * param b The rhs of the multiplication, a triangular matrix
+ * param c The result
+ * param lower Indicates if b is lower triangular, otherwise it is upper triangular
+ */
+template <typename A, typename B, typename C>
+void trmm_right(A&& a, B&& b, C&& c, bool lower) {
+    using T = value_t<A>;
+
+    static constexpr bool row_major = decay_traits<B>::storage_order == order::RowMajor;
+
+    T alpha(1.0);
+
+    a.ensure_cpu_up_to_date();
+    b.ensure_cpu_up_to_date();
+
+    direct_copy(a.memory_start(), a.memory_end(), c.memory_start());
+
+    cblas_trmm(
+        row_major ? CblasRowMajor : CblasColMajor,
+        CblasRight, lower ? CblasLower : CblasUpper, CblasNoTrans, CblasNonUnit,
+        etl::rows(c), etl::columns(c),
+        alpha,
+        b.memory_start(), major_stride(b),
+        c.memory_start(), major_stride(c));
+
+    c.invalidate_gpu();
+}
+
 /*!
  * \brief BLAS implementation of a 2D 'valid' convolution C = I * K, with multiple kernels
  * \param input The input matrix
@@ -352,10 +488,6 @@ void blas_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     // real final dimensions
     const size_t f1 = etl::dim<1>(conv);
     const size_t f2 = etl::dim<2>(conv);
@@ -368,7 +500,8 @@ void blas_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
     // Flip the kernels
     prepared_k.deep_fflip_inplace();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+    // The strided im2col only generates the columns of the strided positions
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
     if(p1 || p2){
         etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
@@ -376,45 +509,21 @@ void blas_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
 
         impl::common::pad_2d_input(input, input_padded, p1, p2);
 
-        im2col_direct_tr(input_col, input_padded, k1, k2);
+        im2col_direct_tr(input_col, input_padded, k1, k2, s1, s2);
     } else {
-        im2col_direct_tr(input_col, input, k1, k2);
+        im2col_direct_tr(input_col, input, k1, k2, s1, s2);
     }
 
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
-
-        // tmp_result = prepared_k * input_col
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, c1 * c2, k1 * k2,
-            T(1.0),
-            prepared_k.memory_start(), k1 * k2,
-            input_col.memory_start(), c1 * c2,
-            T(0.0),
-            tmp_result.memory_start(), c1 * c2);
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < f1; ++i) {
-                for (size_t j = 0; j < f2; ++j) {
-                    conv(k, i, j) = tmp_result(k, i * s1, j * s2);
-                }
-            }
-        }
-    } else {
-        // conv = prepared_k * input_col
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, c1 * c2, k1 * k2,
-            T(1.0),
-            prepared_k.memory_start(), k1 * k2,
-            input_col.memory_start(), c1 * c2,
-            T(0.0),
-            conv.memory_start(), f1 * f2);
-    }
+    // conv = prepared_k * input_col
+    cblas_gemm(
+        CblasRowMajor,
+        CblasNoTrans, CblasNoTrans,
+        K, f1 * f2, k1 * k2,
+        T(1.0),
+        prepared_k.memory_start(), k1 * k2,
+        input_col.memory_start(), f1 * f2,
+        T(0.0),
+        conv.memory_start(), f1 * f2);
 
     conv.invalidate_gpu();
 }
@@ -435,10 +544,6 @@ void blas_conv2_valid_multi_flipped(I&& input, K_T&& kernels, C&& conv, size_t s
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     // real final dimensions
     const size_t f1 = etl::dim<1>(conv);
     const size_t f2 = etl::dim<2>(conv);
@@ -446,7 +551,8 @@ void blas_conv2_valid_multi_flipped(I&& input, K_T&& kernels, C&& conv, size_t s
     input.ensure_cpu_up_to_date();
     kernels.ensure_cpu_up_to_date();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+    // The strided im2col only generates the columns of the strided positions
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
     if(p1 || p2){
         etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
@@ -454,45 +560,21 @@ void blas_conv2_valid_multi_flipped(I&& input, K_T&& kernels, C&& conv, size_t s
 
         impl::common::pad_2d_input(input, input_padded, p1, p2);
 
-        im2col_direct_tr(input_col, input_padded, k1, k2);
+        im2col_direct_tr(input_col, input_padded, k1, k2, s1, s2);
     } else {
-        im2col_direct_tr(input_col, input, k1, k2);
+        im2col_direct_tr(input_col, input, k1, k2, s1, s2);
     }
 
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
-
-        // tmp_result = kernels * input_col
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, c1 * c2, k1 * k2,
-            T(1.0),
-            kernels.memory_start(), k1 * k2,
-            input_col.memory_start(), c1 * c2,
-            T(0.0),
-            tmp_result.memory_start(), c1 * c2);
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < f1; ++i) {
-                for (size_t j = 0; j < f2; ++j) {
-                    conv(k, i, j) = tmp_result(k, i * s1, j * s2);
-                }
-            }
-        }
-    } else {
-        // conv = kernels * input_col
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, c1 * c2, k1 * k2,
-            T(1.0),
-            kernels.memory_start(), k1 * k2,
-            input_col.memory_start(), c1 * c2,
-            T(0.0),
-            conv.memory_start(), f1 * f2);
-    }
+    // conv = kernels * input_col
+    cblas_gemm(
+        CblasRowMajor,
+        CblasNoTrans, CblasNoTrans,
+        K, f1 * f2, k1 * k2,
+        T(1.0),
+        kernels.memory_start(), k1 * k2,
+        input_col.memory_start(), f1 * f2,
+        T(0.0),
+        conv.memory_start(), f1 * f2);
 
     conv.invalidate_gpu();
 }
@@ -515,10 +597,6 @@ void blas_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv,
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     // real final dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
@@ -531,7 +609,8 @@ void blas_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv,
     // Flip the kernels
     prepared_k.deep_fflip_inplace();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * c1 * c2);
+    // The strided im2col only generates the columns of the strided positions
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * f1 * f2);
 
     if(p1 || p2){
         etl::dyn_matrix<T, 3> input_padded(N, i1 + 2 * p1, i2 + 2 * p2);
@@ -541,45 +620,20 @@ void blas_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv,
             impl::common::pad_2d_input(input(i), input_padded(i), p1, p2);
         }
 
-        im2col_direct_tr_multi(input_col, input_padded, k1, k2);
+        im2col_direct_tr_multi(input_col, input_padded, k1, k2, s1, s2);
     } else {
-        im2col_direct_tr_multi(input_col, input, k1, k2);
+        im2col_direct_tr_multi(input_col, input, k1, k2, s1, s2);
     }
 
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 4> tmp_result(K, N, c1, c2);
-
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, N * c1 * c2, k1 * k2,
-            T(1.0),
-            prepared_k.memory_start(), k1 * k2,
-            input_col.memory_start(), N * c1 * c2,
-            T(0.0),
-            tmp_result.memory_start(), N * c1 * c2);
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < N; ++i) {
-                for (size_t ii = 0; ii < f1; ++ii) {
-                    for (size_t j = 0; j < f2; ++j) {
-                        conv(k, i, ii, j) = tmp_result(k, i, ii * s1, j * s2);
-                    }
-                }
-            }
-        }
-    } else {
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, N * c1 * c2, k1 * k2,
-            T(1.0),
-            prepared_k.memory_start(), k1 * k2,
-            input_col.memory_start(), N * c1 * c2,
-            T(0.0),
-            conv.memory_start(), N * f1 * f2);
-    }
+    cblas_gemm(
+        CblasRowMajor,
+        CblasNoTrans, CblasNoTrans,
+        K, N * f1 * f2, k1 * k2,
+        T(1.0),
+        prepared_k.memory_start(), k1 * k2,
+        input_col.memory_start(), N * f1 * f2,
+        T(0.0),
+        conv.memory_start(), N * f1 * f2);
 
     conv.invalidate_gpu();
 }
@@ -602,10 +656,6 @@ void blas_conv2_valid_multi_multi_flipped(const I& input, const K_T& kernels, C&
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     // real final dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
@@ -613,7 +663,8 @@ void blas_conv2_valid_multi_multi_flipped(const I& input, const K_T& kernels, C&
     input.ensure_cpu_up_to_date();
     kernels.ensure_cpu_up_to_date();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * c1 * c2);
+    // The strided im2col only generates the columns of the strided positions
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * f1 * f2);
 
     if(p1 || p2){
         etl::dyn_matrix<T, 3> input_padded(N, i1 + 2 * p1, i2 + 2 * p2);
@@ -623,45 +674,20 @@ void blas_conv2_valid_multi_multi_flipped(const I& input, const K_T& kernels, C&
             impl::common::pad_2d_input(input(i), input_padded(i), p1, p2);
         }
 
-        im2col_direct_tr_multi(input_col, input_padded, k1, k2);
+        im2col_direct_tr_multi(input_col, input_padded, k1, k2, s1, s2);
     } else {
-        im2col_direct_tr_multi(input_col, input, k1, k2);
+        im2col_direct_tr_multi(input_col, input, k1, k2, s1, s2);
     }
 
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 4> tmp_result(K, N, c1, c2);
-
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, N * c1 * c2, k1 * k2,
-            T(1.0),
-            kernels.memory_start(), k1 * k2,
-            input_col.memory_start(), N * c1 * c2,
-            T(0.0),
-            tmp_result.memory_start(), N * c1 * c2);
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < N; ++i) {
-                for (size_t ii = 0; ii < f1; ++ii) {
-                    for (size_t j = 0; j < f2; ++j) {
-                        conv(k, i, ii, j) = tmp_result(k, i, ii * s1, j * s2);
-                    }
-                }
-            }
-        }
-    } else {
-        cblas_gemm(
-            CblasRowMajor,
-            CblasNoTrans, CblasNoTrans,
-            K, N * c1 * c2, k1 * k2,
-            T(1.0),
-            kernels.memory_start(), k1 * k2,
-            input_col.memory_start(), N * c1 * c2,
-            T(0.0),
-            conv.memory_start(), N * f1 * f2);
-    }
+    cblas_gemm(
+        CblasRowMajor,
+        CblasNoTrans, CblasNoTrans,
+        K, N * f1 * f2, k1 * k2,
+        T(1.0),
+        kernels.memory_start(), k1 * k2,
+        input_col.memory_start(), N * f1 * f2,
+        T(0.0),
+        conv.memory_start(), N * f1 * f2);
 
     conv.invalidate_gpu();
 }
@@ -701,11 +727,7 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
     auto batch_fun_n = [&](const size_t first, const size_t last) {
         if (last - first) {
             SERIAL_SECTION {
-                // unit-strided result dimensions
-                const size_t sc1 = (n1 - m1 + 2 * p1) + 1;
-                const size_t sc2 = (n2 - m2 + 2 * p2) + 1;
-
-                etl::dyn_matrix<T, 2> input_col(m1 * m2, sc1 * sc2);
+                etl::dyn_matrix<T, 2> input_col(m1 * m2, c1 * c2);
 
                 // Optimize for the most common case
                 if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
@@ -716,18 +738,17 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
                             cblas_gemm(
                                 CblasRowMajor,
                                 CblasNoTrans, CblasNoTrans,
-                                K, sc1 * sc2, m1 * m2,
+                                K, c1 * c2, m1 * m2,
                                 T(1.0),
                                 kernels(c).memory_start(), m1 * m2,
-                                input_col.memory_start(), sc1 * sc2,
+                                input_col.memory_start(), c1 * c2,
                                 T(1.0),
-                                conv(i).memory_start(), sc1 * sc2);
+                                conv(i).memory_start(), c1 * c2);
 
                         }
                     }
                 } else {
                     etl::dyn_matrix<T, 2> input_padded(n1 + 2 * p1, n2 + 2 * p2);
-                    etl::dyn_matrix<T, 3> tmp_result(K, sc1, sc2);
 
                     for (size_t i = first; i < last; ++i) {
                         for (size_t c = 0; c < C; ++c) {
@@ -736,41 +757,20 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
 
                                 impl::common::pad_2d_input(input(i)(c), input_padded, p1, p2);
 
-                                im2col_direct_tr(input_col, input_padded, m1, m2);
+                                im2col_direct_tr(input_col, input_padded, m1, m2, s1, s2);
                             } else {
-                                im2col_direct_tr(input_col, input(i)(c), m1, m2);
+                                im2col_direct_tr(input_col, input(i)(c), m1, m2, s1, s2);
                             }
 
-                            if (s1 > 1 || s2 > 1) {
-                                cblas_gemm(
-                                    CblasRowMajor,
-                                    CblasNoTrans, CblasNoTrans,
-                                    K, sc1 * sc2, m1 * m2,
-                                    T(1.0),
-                                    kernels(c).memory_start(), m1 * m2,
-                                    input_col.memory_start(), sc1 * sc2,
-                                    T(0.0),
-                                    tmp_result.memory_start(), sc1 * sc2);
-
-                                // Strided copy of the large result into the small result
-                                for (size_t k = 0; k < K; ++k) {
-                                    for (size_t ii = 0; ii < c1; ++ii) {
-                                        for (size_t j = 0; j < c2; ++j) {
-                                            conv(i, k, ii, j) += tmp_result(k, ii * s1, j * s2);
-                                        }
-                                    }
-                                }
-                            } else {
-                                cblas_gemm(
-                                    CblasRowMajor,
-                                    CblasNoTrans, CblasNoTrans,
-                                    K, c1 * c2, m1 * m2,
-                                    T(1.0),
-                                    kernels(c).memory_start(), m1 * m2,
-                                    input_col.memory_start(), sc1 * sc2,
-                                    T(1.0),
-                                    conv(i).memory_start(), c1 * c2);
-                            }
+                            cblas_gemm(
+                                CblasRowMajor,
+                                CblasNoTrans, CblasNoTrans,
+                                K, c1 * c2, m1 * m2,
+                                T(1.0),
+                                kernels(c).memory_start(), m1 * m2,
+                                input_col.memory_start(), c1 * c2,
+                                T(1.0),
+                                conv(i).memory_start(), c1 * c2);
                         }
                     }
                 }
@@ -868,10 +868,6 @@ void blas_conv4_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, siz
     const auto k1 = etl::dim<2>(kernel);
     const auto k2 = etl::dim<3>(kernel);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     input.ensure_cpu_up_to_date();
     kernel.ensure_cpu_up_to_date();
 
@@ -882,7 +878,7 @@ void blas_conv4_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, siz
         if (last - first) {
             SERIAL_SECTION {
                 for (size_t c = first; c < last; ++c) {
-                    etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+                    etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
                     for (size_t i = 0; i < I; ++i) {
                         // Optimize for the most common case
@@ -891,10 +887,10 @@ void blas_conv4_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, siz
                             cblas_gemm(
                                 CblasRowMajor,
                                 CblasNoTrans, CblasNoTrans,
-                                K, c1 * c2, k1 * k2,
+                                K, f1 * f2, k1 * k2,
                                 T(1.0),
                                 kernel(i).memory_start(), k1 * k2,
-                                input_col.memory_start(), c1 * c2,
+                                input_col.memory_start(), f1 * f2,
                                 T(1.0),
                                 conv_temp(c).memory_start(), f1 * f2);
                         } else {
@@ -904,43 +900,20 @@ void blas_conv4_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, siz
 
                                 impl::common::pad_2d_input(input(i)(c), input_padded, p1, p2);
 
-                                im2col_direct_tr(input_col, input_padded, k1, k2);
+                                im2col_direct_tr(input_col, input_padded, k1, k2, s1, s2);
                             } else {
-                                im2col_direct_tr(input_col, input(i)(c), k1, k2);
+                                im2col_direct_tr(input_col, input(i)(c), k1, k2, s1, s2);
                             }
 
-                            if (s1 > 1 || s2 > 1) {
-                                etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
-
-                                cblas_gemm(
-                                    CblasRowMajor,
-                                    CblasNoTrans, CblasNoTrans,
-                                    K, c1 * c2, k1 * k2,
-                                    T(1.0),
-                                    kernel(i).memory_start(), k1 * k2,
-                                    input_col.memory_start(), c1 * c2,
-                                    T(0.0),
-                                    tmp_result.memory_start(), c1 * c2);
-
-                                // Strided copy of the large result into the small result
-                                for (size_t k = 0; k < K; ++k) {
-                                    for (size_t ii = 0; ii < f1; ++ii) {
-                                        for (size_t j = 0; j < f2; ++j) {
-                                            conv_temp(c, k, ii, j) += tmp_result(k, ii * s1, j * s2);
-                                        }
-                                    }
-                                }
-                            } else {
-                                cblas_gemm(
-                                    CblasRowMajor,
-                                    CblasNoTrans, CblasNoTrans,
-                                    K, c1 * c2, k1 * k2,
-                                    T(1.0),
-                                    kernel(i).memory_start(), k1 * k2,
-                                    input_col.memory_start(), c1 * c2,
-                                    T(1.0),
-                                    conv_temp(c).memory_start(), f1 * f2);
-                            }
+                            cblas_gemm(
+                                CblasRowMajor,
+                                CblasNoTrans, CblasNoTrans,
+                                K, f1 * f2, k1 * k2,
+                                T(1.0),
+                                kernel(i).memory_start(), k1 * k2,
+                                input_col.memory_start(), f1 * f2,
+                                T(1.0),
+                                conv_temp(c).memory_start(), f1 * f2);
                         }
                     }
                 }
@@ -1017,11 +990,6 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
     const size_t k1 = etl::dim<2>(kernel);
     const size_t k2 = etl::dim<3>(kernel);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
 
@@ -1031,7 +999,7 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
     auto batch_fun_n = [&](const size_t first, const size_t last) {
         if (last - first) {
             SERIAL_SECTION {
-                etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+                etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
                 // Optimize for the most common case
                 if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
@@ -1045,17 +1013,16 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
                         cblas_gemm(
                             CblasRowMajor,
                             CblasNoTrans, CblasNoTrans,
-                            C, c1 * c2, k1 * k2,
+                            C, f1 * f2, k1 * k2,
                             T(1.0),
                             kernel(k).memory_start(), k1 * k2,
-                            input_col.memory_start(), c1 * c2,
+                            input_col.memory_start(), f1 * f2,
                             T(1.0),
                             conv(i).memory_start(), f1 * f2);
                     }
                 }
                 } else {
                     etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
-                    etl::dyn_matrix<T, 3> tmp_result(C, c1, c2);
 
                     for (size_t i = first; i < last; ++i) {
                         for (size_t k = 0; k < K; ++k) {
@@ -1066,43 +1033,21 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
 
                                 impl::common::pad_2d_input(input(i)(k), input_padded, p1, p2);
 
-                                im2col_direct_tr(input_col, input_padded, k1, k2);
+                                im2col_direct_tr(input_col, input_padded, k1, k2, s1, s2);
                             } else {
-                                im2col_direct_tr(input_col, input(i)(k), k1, k2);
+                                im2col_direct_tr(input_col, input(i)(k), k1, k2, s1, s2);
                             }
 
-                            if (s1 > 1 || s2 > 1) {
-                                // tmp_result = kernel(k) * input_col
-                                cblas_gemm(
-                                    CblasRowMajor,
-                                    CblasNoTrans, CblasNoTrans,
-                                    C, c1 * c2, k1 * k2,
-                                    T(1.0),
-                                    kernel(k).memory_start(), k1 * k2,
-                                    input_col.memory_start(), c1 * c2,
-                                    T(0.0),
-                                    tmp_result.memory_start(), c1 * c2);
-
-                                // Strided copy of the large result into the small result
-                                for (size_t c = 0; c < C; ++c) {
-                                    for (size_t m = 0; m < f1; ++m) {
-                                        for (size_t n = 0; n < f2; ++n) {
-                                            conv(i, c, m, n) += tmp_result(c, m * s1, n * s2);
-                                        }
-                                    }
-                                }
-                            } else {
-                                // conv(i) = kernel(k) * input_col
-                                cblas_gemm(
-                                    CblasRowMajor,
-                                    CblasNoTrans, CblasNoTrans,
-                                    C, c1 * c2, k1 * k2,
-                                    T(1.0),
-                                    kernel(k).memory_start(), k1 * k2,
-                                    input_col.memory_start(), c1 * c2,
-                                    T(1.0),
-                                    conv(i).memory_start(), f1 * f2);
-                            }
+                            // conv(i) = kernel(k) * input_col
+                            cblas_gemm(
+                                CblasRowMajor,
+                                CblasNoTrans, CblasNoTrans,
+                                C, f1 * f2, k1 * k2,
+                                T(1.0),
+                                kernel(k).memory_start(), k1 * k2,
+                                input_col.memory_start(), f1 * f2,
+                                T(1.0),
+                                conv(i).memory_start(), f1 * f2);
                         }
                     }
                 }
@@ -1238,6 +1183,40 @@ void gevm(A&& a, B&& b, C&& c) {
     cpp_unreachable("Unsupported feature called: blas gemm");
 }
 
+/*!
+ * \brief Compute the matrix mutplication of a and b and store the result
+ * in c, with a a triangular matrix
+ * param a The lhs of the multiplication, a triangular matrix
+ * param b The rhs of the multiplication
+ * param c The result
+ * param lower Indicates if a is lower triangular, otherwise it is upper triangular
+ */
+template <typename A, typename B, typename C>
+void trmm_left(A&& a, B&& b, C&& c, bool lower) {
+    cpp_unused(a);
+    cpp_unused(b);
+    cpp_unused(c);
+    cpp_unused(lower);
+    cpp_unreachable("Unsupported feature called: blas trmm");
+}
+
+/*!
+ * \brief Compute the matrix mutplication of a and b and store the result
+ * in c, with b a triangular matrix
+ * param a The lhs of the multiplication
+ * param b The rhs of the multiplication, a triangular matrix
+ * param c The result
+ * param lower Indicates if b is lower triangular, otherwise it is upper triangular
+ */
+template <typename A, typename B, typename C>
+void trmm_right(A&& a, B&& b, C&& c, bool lower) {
+    cpp_unused(a);
+    cpp_unused(b);
+    cpp_unused(c);
+    cpp_unused(lower);
+    cpp_unreachable("Unsupported feature called: blas trmm");
+}
+
 /*!
  * \brief BLAS implementation of a 2D 'valid' convolution C = I * K, with multiple kernels
  * \param input The input matrix
@@ -0,0 +1,207 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Closed-form inverse and determinant of the small square matrices
+ * of a batch
+ *
+ * The kernels are written on a generic value type F providing +, -, * and
+ * / so that the same formulas are used for a single matrix (F is the
+ * value type) and for several matrices at once in structure-of-arrays
+ * order (F holds one element of each matrix in a vector register).
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace common {
+
+/*!
+ * \brief The largest dimension of the matrices handled by the closed-form
+ * kernels
+ */
+constexpr size_t batch_inv_closed_max = 4;
+
+/*!
+ * \brief The largest dimension of the matrices handled by the unrolled
+ * elimination kernels
+ */
+constexpr size_t batch_inv_unrolled_max = 8;
+
+/*!
+ * \brief Closed-form kernels for the N x N matrices, in row-major order
+ * \tparam N The dimension of the matrices
+ */
+template <size_t N>
+struct small_matrix_kernel;
+
+/*!
+ * \copydoc small_matrix_kernel
+ */
+template <>
+struct small_matrix_kernel<1> {
+    /*!
+     * \brief Compute the determinant of the matrix m
+     */
+    template <typename F>
+    static F det(const F* m) {
+        return m[0];
+    }
+
+    /*!
+     * \brief Compute the inverse of the matrix m into r
+     */
+    template <typename F>
+    static void inv(const F* m, F* r) {
+        r[0] = F(1) / m[0];
+    }
+};
+
+/*!
+ * \copydoc small_matrix_kernel
+ */
+template <>
+struct small_matrix_kernel<2> {
+    /*!
+     * \brief Compute the determinant of the matrix m
+     */
+    template <typename F>
+    static F det(const F* m) {
+        return m[0] * m[3] - m[1] * m[2];
+    }
+
+    /*!
+     * \brief Compute the inverse of the matrix m into r
+     */
+    template <typename F>
+    static void inv(const F* m, F* r) {
+        F inv_det = F(1) / det(m);
+
+        r[0] = m[3] * inv_det;
+        r[1] = (F(0) - m[1]) * inv_det;
+        r[2] = (F(0) - m[2]) * inv_det;
+        r[3] = m[0] * inv_det;
+    }
+};
+
+/*!
+ * \copydoc small_matrix_kernel
+ */
+template <>
+struct small_matrix_kernel<3> {
+    /*!
+     * \brief Compute the determinant of the matrix m
+     */
+    template <typename F>
+    static F det(const F* m) {
+        return m[0] * (m[4] * m[8] - m[5] * m[7])
+             + m[1] * (m[5] * m[6] - m[3] * m[8])
+             + m[2] * (m[3] * m[7] - m[4] * m[6]);
+    }
+
+    /*!
+     * \brief Compute the inverse of the matrix m into r, with the adjugate
+     */
+    template <typename F>
+    static void inv(const F* m, F* r) {
+        F c00 = m[4] * m[8] - m[5] * m[7];
+        F c10 = m[5] * m[6] - m[3] * m[8];
+        F c20 = m[3] * m[7] - m[4] * m[6];
+
+        F inv_det = F(1) / (m[0] * c00 + m[1] * c10 + m[2] * c20);
+
+        r[0] = c00 * inv_det;
+        r[1] = (m[2] * m[7] - m[1] * m[8]) * inv_det;
+        r[2] = (m[1] * m[5] - m[2] * m[4]) * inv_det;
+        r[3] = c10 * inv_det;
+        r[4] = (m[0] * m[8] - m[2] * m[6]) * inv_det;
+        r[5] = (m[2] * m[3] - m[0] * m[5]) * inv_det;
+        r[6] = c20 * inv_det;
+        r[7] = (m[1] * m[6] - m[0] * m[7]) * inv_det;
+        r[8] = (m[0] * m[4] - m[1] * m[3]) * inv_det;
+    }
+};
+
+/*!
+ * \copydoc small_matrix_kernel
+ *
+ * The determinant and the adjugate are computed from the 2x2 minors of the
+ * first two rows (s) and of the last two rows (c).
+ */
+template <>
+struct small_matrix_kernel<4> {
+    /*!
+     * \brief Compute the determinant of the matrix m
+     */
+    template <typename F>
+    static F det(const F* m) {
+        F s0 = m[0] * m[5] - m[4] * m[1];
+        F s1 = m[0] * m[6] - m[4] * m[2];
+        F s2 = m[0] * m[7] - m[4] * m[3];
+        F s3 = m[1] * m[6] - m[5] * m[2];
+        F s4 = m[1] * m[7] - m[5] * m[3];
+        F s5 = m[2] * m[7] - m[6] * m[3];
+
+        F c5 = m[10] * m[15] - m[14] * m[11];
+        F c4 = m[9] * m[15] - m[13] * m[11];
+        F c3 = m[9] * m[14] - m[13] * m[10];
+        F c2 = m[8] * m[15] - m[12] * m[11];
+        F c1 = m[8] * m[14] - m[12] * m[10];
+        F c0 = m[8] * m[13] - m[12] * m[9];
+
+        return (s0 * c5 - s1 * c4) + (s2 * c3 + s3 * c2) + (s5 * c0 - s4 * c1);
+    }
+
+    /*!
+     * \brief Compute the inverse of the matrix m into r, with the adjugate
+     */
+    template <typename F>
+    static void inv(const F* m, F* r) {
+        F s0 = m[0] * m[5] - m[4] * m[1];
+        F s1 = m[0] * m[6] - m[4] * m[2];
+        F s2 = m[0] * m[7] - m[4] * m[3];
+        F s3 = m[1] * m[6] - m[5] * m[2];
+        F s4 = m[1] * m[7] - m[5] * m[3];
+        F s5 = m[2] * m[7] - m[6] * m[3];
+
+        F c5 = m[10] * m[15] - m[14] * m[11];
+        F c4 = m[9] * m[15] - m[13] * m[11];
+        F c3 = m[9] * m[14] - m[13] * m[10];
+        F c2 = m[8] * m[15] - m[12] * m[11];
+        F c1 = m[8] * m[14] - m[12] * m[10];
+        F c0 = m[8] * m[13] - m[12] * m[9];
+
+        F inv_det = F(1) / ((s0 * c5 - s1 * c4) + (s2 * c3 + s3 * c2) + (s5 * c0 - s4 * c1));
+
+        r[0]  = (m[5] * c5 - m[6] * c4 + m[7] * c3) * inv_det;
+        r[1]  = (m[2] * c4 - m[1] * c5 - m[3] * c3) * inv_det;
+        r[2]  = (m[13] * s5 - m[14] * s4 + m[15] * s3) * inv_det;
+        r[3]  = (m[10] * s4 - m[9] * s5 - m[11] * s3) * inv_det;
+        r[4]  = (m[6] * c2 - m[4] * c5 - m[7] * c1) * inv_det;
+        r[5]  = (m[0] * c5 - m[2] * c2 + m[3] * c1) * inv_det;
+        r[6]  = (m[14] * s2 - m[12] * s5 - m[15] * s1) * inv_det;
+        r[7]  = (m[8] * s5 - m[10] * s2 + m[11] * s1) * inv_det;
+        r[8]  = (m[4] * c4 - m[5] * c2 + m[7] * c0) * inv_det;
+        r[9]  = (m[1] * c2 - m[0] * c4 - m[3] * c0) * inv_det;
+        r[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * inv_det;
+        r[11] = (m[9] * s2 - m[8] * s4 - m[11] * s0) * inv_det;
+        r[12] = (m[5] * c1 - m[4] * c3 - m[6] * c0) * inv_det;
+        r[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * inv_det;
+        r[14] = (m[13] * s1 - m[12] * s3 - m[14] * s0) * inv_det;
+        r[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * inv_det;
+    }
+};
+
+} //end of namespace common
+
+} //end of namespace impl
+
+} //end of namespace etl
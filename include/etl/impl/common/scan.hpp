@@ -0,0 +1,95 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Operations of the cumulative (scan) operators
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace common {
+
+/*!
+ * \brief The addition operation of the cumulative sum
+ */
+struct scan_sum_op {
+    /*!
+     * \brief Returns the neutral element of the operation
+     */
+    template <typename T>
+    static constexpr T neutral() {
+        return T(0);
+    }
+
+    /*!
+     * \brief Apply the operation on two values
+     * \param lhs The left hand side value
+     * \param rhs The right hand side value
+     * \return lhs + rhs
+     */
+    template <typename T>
+    static T apply(T lhs, T rhs) {
+        return lhs + rhs;
+    }
+
+    /*!
+     * \brief Apply the operation on two vectors
+     * \param lhs The left hand side vector
+     * \param rhs The right hand side vector
+     * \return lhs + rhs
+     * \tparam V The vectorization type
+     */
+    template <typename V, typename X>
+    static X apply_vec(X lhs, X rhs) {
+        return V::add(lhs, rhs);
+    }
+};
+
+/*!
+ * \brief The multiplication operation of the cumulative product
+ */
+struct scan_prod_op {
+    /*!
+     * \brief Returns the neutral element of the operation
+     */
+    template <typename T>
+    static constexpr T neutral() {
+        return T(1);
+    }
+
+    /*!
+     * \brief Apply the operation on two values
+     * \param lhs The left hand side value
+     * \param rhs The right hand side value
+     * \return lhs * rhs
+     */
+    template <typename T>
+    static T apply(T lhs, T rhs) {
+        return lhs * rhs;
+    }
+
+    /*!
+     * \brief Apply the operation on two vectors
+     * \param lhs The left hand side vector
+     * \param rhs The right hand side vector
+     * \return lhs * rhs
+     * \tparam V The vectorization type
+     */
+    template <typename V, typename X>
+    static X apply_vec(X lhs, X rhs) {
+        return V::mul(lhs, rhs);
+    }
+};
+
+} //end of namespace common
+} //end of namespace impl
+} //end of namespace etl
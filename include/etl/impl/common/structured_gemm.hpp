@@ -0,0 +1,100 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Structures of the matrices handled by the structure-aware
+ * matrix-matrix multiplication
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace common {
+
+/*!
+ * \brief The zero structure of a square matrix
+ */
+enum class mm_structure {
+    DIAGONAL,       ///< Only the diagonal is non-zero
+    LOWER,          ///< Only the lower triangle (with the diagonal) is non-zero
+    STRICTLY_LOWER, ///< Only the lower triangle (without the diagonal) is non-zero
+    UPPER,          ///< Only the upper triangle (with the diagonal) is non-zero
+    STRICTLY_UPPER  ///< Only the upper triangle (without the diagonal) is non-zero
+};
+
+/*!
+ * \brief Returns the range of the columns that can be non-zero in the given
+ * row of a structured matrix
+ * \param s The structure of the matrix
+ * \param n The dimension of the matrix
+ * \param i The row
+ * \return the [first, last) range of the non-zero columns of the row
+ */
+inline std::pair<size_t, size_t> structure_band(mm_structure s, size_t n, size_t i) noexcept {
+    switch (s) {
+        case mm_structure::DIAGONAL:
+            return {i, i + 1};
+        case mm_structure::LOWER:
+            return {0, i + 1};
+        case mm_structure::STRICTLY_LOWER:
+            return {0, i};
+        case mm_structure::UPPER:
+            return {i, n};
+        case mm_structure::STRICTLY_UPPER:
+            return {i + 1, n};
+    }
+
+    return {0, n};
+}
+
+/*!
+ * \brief Returns the range of the rows that can be non-zero in the given
+ * range of columns of a structured matrix
+ * \param s The structure of the matrix
+ * \param n The dimension of the matrix
+ * \param first The first column
+ * \param last The end of the columns (exclusive)
+ * \return the [first, last) range of the non-zero rows of the columns
+ */
+inline std::pair<size_t, size_t> structure_column_band(mm_structure s, size_t n, size_t first, size_t last) noexcept {
+    switch (s) {
+        case mm_structure::DIAGONAL:
+            return {first, last};
+        case mm_structure::LOWER:
+            return {first, n};
+        case mm_structure::STRICTLY_LOWER:
+            return {first + 1, n};
+        case mm_structure::UPPER:
+            return {0, last};
+        case mm_structure::STRICTLY_UPPER:
+            return {0, last - 1};
+    }
+
+    return {0, n};
+}
+
+/*!
+ * \brief Returns the size of the blocks used by the structured kernels so
+ * that a block of n rows (or columns) fits in the L2 cache
+ * \param n The number of elements of each row (or column) of the block
+ * \tparam T The value type
+ * \return the number of rows (or columns) of a block
+ */
+template <typename T>
+size_t structured_block(size_t n) noexcept {
+    return std::max<size_t>(16, (256 * 1024) / (n * sizeof(T)));
+}
+
+} //end of namespace common
+
+} //end of namespace impl
+
+} //end of namespace etl
@@ -0,0 +1,85 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Implementation of the heap used by the top-k selection
+ *
+ * The heap holds the best k (value, index) pairs found so far, the worst of
+ * them being at the front. Ties are broken in favour of the lowest index.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace common {
+
+/*!
+ * \brief Order of the top-k elements, by decreasing value, then by
+ * increasing index
+ */
+struct topk_greater {
+    /*!
+     * \brief Compare two (value, index) pairs
+     * \param lhs The left hand side pair
+     * \param rhs The right hand side pair
+     * \return true if lhs must come before rhs
+     */
+    template <typename T>
+    bool operator()(const std::pair<T, size_t>& lhs, const std::pair<T, size_t>& rhs) const {
+        return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+    }
+};
+
+/*!
+ * \brief Initialize the heap with the first k elements of the row
+ * \param heap The heap, with space for k elements
+ * \param in The input row
+ * \param k The number of elements to select
+ */
+template <typename T>
+void topk_init(std::pair<T, size_t>* heap, const T* in, size_t k) {
+    for (size_t j = 0; j < k; ++j) {
+        heap[j] = std::make_pair(in[j], j);
+    }
+
+    std::make_heap(heap, heap + k, topk_greater());
+}
+
+/*!
+ * \brief Insert an element in the heap if it is better than the worst
+ * element of the heap
+ * \param heap The heap
+ * \param k The size of the heap
+ * \param value The value of the element
+ * \param index The index of the element
+ */
+template <typename T>
+void topk_push(std::pair<T, size_t>* heap, size_t k, T value, size_t index) {
+    if (value > heap[0].first) {
+        std::pop_heap(heap, heap + k, topk_greater());
+        heap[k - 1] = std::make_pair(value, index);
+        std::push_heap(heap, heap + k, topk_greater());
+    }
+}
+
+/*!
+ * \brief Sort the heap by decreasing values
+ * \param heap The heap
+ * \param k The size of the heap
+ */
+template <typename T>
+void topk_sort(std::pair<T, size_t>* heap, size_t k) {
+    std::sort_heap(heap, heap + k, topk_greater());
+}
+
+} //end of namespace common
+} //end of namespace impl
+} //end of namespace etl
@@ -14,6 +14,44 @@ namespace etl {
 
 namespace detail {
 
+/*!
+ * \brief Returns the number of bytes touched by a 4D convolution
+ */
+template <typename I, typename K, typename C>
+size_t conv4_bytes(const I& input, const K& kernel, const C& conv) {
+    return (etl::size(input) + etl::size(kernel) + etl::size(conv)) * sizeof(value_t<C>);
+}
+
+/*!
+ * \brief Returns the number of floating point operations of a 4D valid
+ * convolution (each output is a dot product over the channels and the kernel)
+ */
+template <typename I, typename K, typename C>
+size_t conv4_valid_flops(const I& input, const K& kernel, const C& conv) {
+    cpp_unused(input);
+    return 2 * etl::size(conv) * (etl::size(kernel) / etl::dim<0>(kernel));
+}
+
+/*!
+ * \brief Returns the number of floating point operations of a 4D valid
+ * convolution computing the filter gradients
+ */
+template <typename I, typename K, typename C>
+size_t conv4_filter_flops(const I& input, const K& kernel, const C& conv) {
+    cpp_unused(input);
+    return 2 * etl::size(conv) * (etl::size(kernel) / etl::dim<1>(kernel));
+}
+
+/*!
+ * \brief Returns the number of floating point operations of a 4D full (or
+ * backward) convolution
+ */
+template <typename I, typename K, typename C>
+size_t conv4_back_flops(const I& input, const K& kernel, const C& conv) {
+    cpp_unused(conv);
+    return 2 * etl::size(input) * (etl::size(kernel) / etl::dim<0>(kernel));
+}
+
 /*!
  * \brief The functor impl for 4D valid conv
  */
@@ -29,6 +67,8 @@ struct conv4_valid_impl {
     static void apply(const I& input, const K& kernel, C&& conv) {
         auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_valid_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::CUDNN) {
             impl::cudnn::conv4_valid(input, kernel, conv, S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::BLAS_VEC) {
@@ -140,6 +180,8 @@ struct conv4_valid_flipped_impl : conv4_valid_impl<S1, S2, P1, P2> {
     static void apply(const I& input, const K& kernel, C&& conv) {
         auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_valid_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::CUDNN) {
             impl::cudnn::conv4_valid_flipped(input, kernel, conv, S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::BLAS_VEC) {
@@ -190,6 +232,8 @@ struct dyn_conv4_valid_impl {
     void apply(const I& input, const K& kernel, C&& conv) const {
         auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_valid_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::CUDNN) {
             impl::cudnn::conv4_valid(input, kernel, conv, s1, s2, p1, p2);
         } else if (impl == etl::conv4_impl::BLAS_VEC) {
@@ -276,6 +320,8 @@ struct dyn_conv4_valid_flipped_impl : dyn_conv4_valid_impl {
     void apply(const I& input, const K& kernel, C&& conv) const {
         auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_valid_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::CUDNN) {
             impl::cudnn::conv4_valid_flipped(input, kernel, conv, s1, s2, p1, p2);
         } else if (impl == etl::conv4_impl::BLAS_VEC) {
@@ -314,6 +360,8 @@ struct conv4_valid_filter_impl {
     static void apply(const I& input, const K& kernel, C&& conv) {
         auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_filter_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::CUDNN) {
             impl::cudnn::conv4_valid_filter(input, kernel, conv, S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::BLAS_VEC) {
@@ -425,6 +473,8 @@ struct conv4_valid_filter_flipped_impl : conv4_valid_filter_impl<S1, S2, P1, P2>
     static void apply(const I& input, const K& kernel, C&& conv) {
         auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_filter_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::CUDNN) {
             if(S1 > 1 || S2 > 1 || P1 || P2){
                 // For some reasons, CUDNN backward filter cross correlation does
@@ -486,6 +536,8 @@ struct dyn_conv4_valid_filter_impl {
     void apply(const I& input, const K& kernel, C&& conv) const {
         auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_filter_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::CUDNN) {
             impl::cudnn::conv4_valid_filter(input, kernel, conv, s1, s2, p1, p2);
         } else if (impl == etl::conv4_impl::BLAS_VEC) {
@@ -572,6 +624,8 @@ struct dyn_conv4_valid_filter_flipped_impl : dyn_conv4_valid_filter_impl {
     void apply(const I& input, const K& kernel, C&& conv) const {
         auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_filter_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::CUDNN) {
             if(s1 > 1 || s2 > 1 || p1 || p2){
                 // For some reasons, CUDNN backward filter cross correlation does
@@ -621,6 +675,8 @@ struct conv4_valid_back_impl {
     static void apply(const I& input, const K& kernel, C&& conv) {
         auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_back_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_back(input, kernel, conv, S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
@@ -726,6 +782,8 @@ struct conv4_valid_back_flipped_impl : conv4_valid_back_impl<S1, S2, P1, P2> {
     static void apply(const I& input, const K& kernel, C&& conv) {
         auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_back_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_back_flipped(input, kernel, conv, S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
@@ -773,6 +831,8 @@ struct dyn_conv4_valid_back_impl {
     void apply(const I& input, const K& kernel, C&& conv) const {
         auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_back_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_back(input, kernel, conv, s1, s2, p1, p2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
@@ -855,6 +915,8 @@ struct dyn_conv4_valid_back_flipped_impl : dyn_conv4_valid_back_impl {
     void apply(const I& input, const K& kernel, C&& conv) const {
         auto impl = select_conv4_valid_back_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_back_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_back_flipped(input, kernel, conv, s1, s2, p1, p2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
@@ -890,6 +952,8 @@ struct conv4_full_impl {
     static void apply(const I& input, const K& kernel, C&& conv) {
         auto impl = select_conv4_full_impl<I, K, C>(etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_back_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::CUDNN) {
             impl::cudnn::conv4_full(input, kernel, conv);
         } else if (impl == etl::conv4_impl::VEC) {
@@ -995,6 +1059,8 @@ struct conv4_full_flipped_impl {
     static void apply(const I& input, const K& kernel, C&& conv) {
         auto impl = select_conv4_full_impl<I, K, C>(etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+        detail::profile_scope profile(desc(), impl_name(impl), conv4_bytes(input, kernel, conv), conv4_back_flops(input, kernel, conv));
+
         if (impl == etl::conv4_impl::CUDNN) {
             impl::cudnn::conv4_full_flipped(input, kernel, conv);
         } else if (impl == etl::conv4_impl::VEC) {
@@ -373,6 +373,24 @@ inline etl::conv4_impl select_default_conv4_valid_impl(size_t i1, size_t i2, siz
     return etl::conv4_impl::STD;
 }
 
+/*!
+ * \brief Returns the candidate bits of the 4D convolution implementations
+ * that can be used for the given types
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ */
+template <typename I, typename K, typename C>
+constexpr size_t conv4_candidates() {
+    return !all_row_major<I, K, C>::value
+               ? impl_bit(etl::conv4_impl::STD)
+               : impl_bit(etl::conv4_impl::STD)
+                     | impl_bit(etl::conv4_impl::VEC, vec_enabled && vectorize_impl)
+                     | impl_bit(etl::conv4_impl::BLAS_VEC, vec_enabled && vectorize_impl)
+                     | impl_bit(etl::conv4_impl::BLAS_MKL, cblas_enabled)
+                     | impl_bit(etl::conv4_impl::CUDNN, cudnn_enabled);
+}
+
 /*!
  * \brief Select the implementation of the conv of I and K in C
  * \tparam I The input type
@@ -382,6 +400,10 @@ inline etl::conv4_impl select_default_conv4_valid_impl(size_t i1, size_t i2, siz
  */
 template <typename I, typename K, typename C>
 inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
+    static selection_site<etl::conv4_impl> site("conv4_valid");
+
+    constexpr size_t candidates = conv4_candidates<I, K, C>();
+
     if (local_context().conv4_selector.forced) {
         auto forced = local_context().conv4_selector.impl;
 
@@ -391,35 +413,35 @@ inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1,
             case conv4_impl::VEC:
                 if (!vec_enabled || !vectorize_impl) {                                                                             // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to VEC conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>(i1, i2, k1, k2);                                                             // COVERAGE_EXCLUDE_LINE
+                    return log_selection(site, {i1, i2, k1, k2}, candidates, select_default_conv4_valid_impl<I, K, C>(i1, i2, k1, k2), selection_reason::UNAVAILABLE); // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                  // COVERAGE_EXCLUDE_LINE
 
-                return forced;
+                return log_selection(site, {i1, i2, k1, k2}, candidates, forced, selection_reason::FORCED);
 
             //BLAS cannot always be used
             case conv4_impl::BLAS_MKL:
                 if (!cblas_enabled) {                                                                                             // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to BLAS conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>(i1, i2, k1, k2);                                                               // COVERAGE_EXCLUDE_LINE
+                    return log_selection(site, {i1, i2, k1, k2}, candidates, select_default_conv4_valid_impl<I, K, C>(i1, i2, k1, k2), selection_reason::UNAVAILABLE); // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                    // COVERAGE_EXCLUDE_LINE
 
-                return forced;
+                return log_selection(site, {i1, i2, k1, k2}, candidates, forced, selection_reason::FORCED);
 
             //CUDNN cannot always be used
             case conv4_impl::CUDNN:
                 if (!cudnn_enabled) {                                                                                             // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to CUDNN conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>(i1, i2, k1, k2);                                                               // COVERAGE_EXCLUDE_LINE
+                    return log_selection(site, {i1, i2, k1, k2}, candidates, select_default_conv4_valid_impl<I, K, C>(i1, i2, k1, k2), selection_reason::UNAVAILABLE); // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                    // COVERAGE_EXCLUDE_LINE
 
-                return forced;
+                return log_selection(site, {i1, i2, k1, k2}, candidates, forced, selection_reason::FORCED);
 
             default:
-                return forced;
+                return log_selection(site, {i1, i2, k1, k2}, candidates, forced, selection_reason::FORCED);
         }
     }
 
-    return select_default_conv4_valid_impl<I, K, C>(i1, i2, k1, k2);
+    return log_selection(site, {i1, i2, k1, k2}, candidates, select_default_conv4_valid_impl<I, K, C>(i1, i2, k1, k2), selection_reason::HEURISTIC);
 }
 
 /*!
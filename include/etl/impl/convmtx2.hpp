@@ -5,8 +5,20 @@
 //  http://opensource.org/licenses/MIT)
 //=======================================================================
 
+/*!
+ * \file
+ * \brief Implementations of the convmtx2 transformation
+ *
+ * The direct memory versions work on a transposed copy of the image, so
+ * that every run of values of the output is a contiguous row segment of the
+ * copy, copied with the vectorized row kernels.
+ */
+
 #pragma once
 
+//Include the row kernels
+#include "etl/impl/im2col.hpp"
+
 namespace etl {
 
 namespace detail {
@@ -19,41 +31,179 @@ struct convmtx2_direct {
      * \brief Apply the convmtx2 to sub into m
      * \param sub The sub expression
      * \param m The output matrix
+     * \tparam K1 The first dimension of the kernel
+     * \tparam K2 The second dimension of the kernel
      */
     template <size_t K1, size_t K2, typename A, typename M>
     static void apply(A&& sub, M& m) {
+        apply(sub, m, K1, K2);
+    }
+
+    /*!
+     * \brief Apply the convmtx2 to sub into m
+     * \param sub The sub expression
+     * \param m The output matrix
+     * \param k1 The first dimension of the kernel
+     * \param k2 The second dimension of the kernel
+     */
+    template <typename A, typename M, cpp_disable_if(all_dma<A, M>::value && all_row_major<A, M>::value)>
+    static void apply(A&& sub, M& m, size_t k1, size_t k2) {
         const size_t i1 = etl::dim<0>(sub);
         const size_t i2 = etl::dim<1>(sub);
 
-        const size_t c_height          = etl::dim<0>(m);
-        constexpr size_t c_width = K1 * K2;
+        const size_t c_height = (i1 + k1 - 1) * (i2 + k2 - 1);
+        const size_t c_width  = k1 * k2;
 
-        cpp_assert(c_height == ((i1 + K1 - 1) * (i2 + K2 - 1)), "Invalid input height");
+        cpp_assert(c_height == etl::dim<0>(m), "Invalid input height");
         cpp_assert(c_width == etl::dim<1>(m), "Invalid input width");
 
-        const auto max_fill       = c_height - ((i1 + K1 - 1) * ((c_width - 1) / K1) + (c_width - 1) % K1);
-        const auto inner_paddings = max_fill - (i1 * i2);
-        const auto inner_padding  = inner_paddings / (i2 - 1);
-
         m = 0;
 
-        for (size_t j = 0; j < c_width; ++j) {
-            auto top_padding    = (i1 + K1 - 1) * (j / K1) + j % K1;
-            auto bottom_padding = top_padding + (i1 * i2) + inner_paddings;
+        // Each column is made of i2 blocks of i1 values, separated by k1 - 1 zeroes
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t j = first; j < last; ++j) {
+                const size_t top_padding = (i1 + k1 - 1) * (j / k1) + j % k1;
 
-            for (size_t i = top_padding; i < bottom_padding; ++i) {
-                auto inner = i - top_padding;
-                auto block = inner / (i1 + inner_padding);
-                auto col   = inner % (i1 + inner_padding);
+                for (size_t block = 0; block < i2; ++block) {
+                    const size_t i = top_padding + block * (i1 + k1 - 1);
 
-                if (col < i1) {
-                    m(i, j) = sub(col, block);
+                    for (size_t col = 0; col < i1; ++col) {
+                        m(i + col, j) = sub(col, block);
+                    }
                 }
             }
+        };
+
+        engine_dispatch_1d(batch_fun, 0, c_width, select_parallel(c_height * c_width) && c_width > 1);
+    }
+
+    /*!
+     * \brief Apply the convmtx2 to sub into m
+     *
+     * The row i = r * (i1 + k1 - 1) + q of the output holds, for each
+     * kernel column jb, the values sub(q - ja, r - jb) for the valid ja.
+     * These are contiguous in the transposed image with reversed rows.
+     *
+     * \param sub The sub expression
+     * \param m The output matrix
+     * \param k1 The first dimension of the kernel
+     * \param k2 The second dimension of the kernel
+     */
+    template <typename A, typename M, cpp_enable_if(all_dma<A, M>::value && all_row_major<A, M>::value)>
+    static void apply(A&& sub, M& m, size_t k1, size_t k2) {
+        using T = value_t<A>;
+
+        const size_t i1 = etl::dim<0>(sub);
+        const size_t i2 = etl::dim<1>(sub);
+
+        const size_t h        = i1 + k1 - 1;
+        const size_t c_height = h * (i2 + k2 - 1);
+        const size_t c_width  = k1 * k2;
+
+        cpp_assert(c_height == etl::dim<0>(m), "Invalid input height");
+        cpp_assert(c_width == etl::dim<1>(m), "Invalid input width");
+
+        // flipped(block, i1 - 1 - col) = sub(col, block)
+        etl::dyn_matrix<T, 2> flipped(i2, i1);
+
+        const auto ss = sub.memory_start();
+        const auto ff = flipped.memory_start();
+        const auto mm = m.memory_start();
+
+        for (size_t col = 0; col < i1; ++col) {
+            for (size_t block = 0; block < i2; ++block) {
+                ff[block * i1 + (i1 - 1 - col)] = ss[col * i2 + block];
+            }
         }
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                const size_t r = i / h;
+                const size_t q = i % h;
+
+                auto row = mm + i * c_width;
+
+                std::fill(row, row + c_width, T(0));
+
+                // The valid ja are such that 0 <= q - ja < i1
+                const size_t ja_first = q >= i1 ? q - i1 + 1 : 0;
+                const size_t ja_last  = std::min(q + 1, k1);
+
+                for (size_t jb = 0; jb < k2 && jb <= r; ++jb) {
+                    if (r - jb < i2) {
+                        // i1 - 1 - q + ja_first >= 0 since ja_first >= q - i1 + 1
+                        const size_t offset = (r - jb) * i1 + (i1 - 1 - q + ja_first);
+
+                        detail::im2col_copy_row(ff + offset, row + jb * k1 + ja_first, ja_last - ja_first, 1);
+                    }
+                }
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, 0, c_height, select_parallel(c_height * c_width) && c_height > 1);
+
+        m.invalidate_gpu();
     }
 };
 
 } //end of namespace detail
 
+/*!
+ * \brief Compute the transposed convolution matrix of sub into m for a kernel of size (k1,k2)
+ *
+ * Each row of m is made of i2 blocks of i1 values, the columns of the
+ * image, separated by k1 - 1 zeroes.
+ *
+ * \param m The output matrix, of dimensions (k1 * k2, (i1 + k1 - 1) * (i2 + k2 - 1))
+ * \param sub The input matrix
+ * \param k1 The first dimension of ther kernel
+ * \param k2 The second dimension of ther kernel
+ */
+template <typename A, typename M>
+void convmtx2_direct_t(M& m, A&& sub, size_t k1, size_t k2) {
+    static_assert(all_dma<A, M>::value, "convmtx2_direct_t has only been implemented for direct memory access");
+
+    using T = value_t<A>;
+
+    const size_t i1 = etl::dim<0>(sub);
+    const size_t i2 = etl::dim<1>(sub);
+
+    const size_t h        = i1 + k1 - 1;
+    const size_t c_height = h * (i2 + k2 - 1);
+    const size_t c_width  = k1 * k2;
+
+    cpp_assert(etl::size(m) == c_height * c_width, "Invalid dimensions for convmtx2_direct_t");
+
+    // sub_t(block, col) = sub(col, block)
+    etl::dyn_matrix<T, 2> sub_t(i2, i1);
+
+    const auto ss = sub.memory_start();
+    const auto tt = sub_t.memory_start();
+    const auto mm = m.memory_start();
+
+    for (size_t col = 0; col < i1; ++col) {
+        for (size_t block = 0; block < i2; ++block) {
+            tt[block * i1 + col] = ss[col * i2 + block];
+        }
+    }
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t j = first; j < last; ++j) {
+            const size_t top_padding = h * (j / k1) + j % k1;
+
+            auto row = mm + j * c_height;
+
+            std::fill(row, row + c_height, T(0));
+
+            for (size_t block = 0; block < i2; ++block) {
+                detail::im2col_copy_row(tt + block * i1, row + top_padding + block * h, i1, 1);
+            }
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, c_width, select_parallel(c_height * c_width) && c_width > 1);
+
+    m.invalidate_gpu();
+}
+
 } //end of namespace etl
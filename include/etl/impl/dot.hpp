@@ -37,7 +37,8 @@ cpp14_constexpr etl::dot_impl select_default_dot_impl() {
         return etl::dot_impl::BLAS;
     }
 
-    if (vec_enabled && all_vectorizable<vector_mode, A, B>::value && std::is_same<default_intrinsic_type<value_t<A>>, default_intrinsic_type<value_t<B>>>::value) {
+    if (vec_enabled && all_vectorizable<vector_mode, A, B>::value && default_intrinsic_traits<value_t<A>>::vectorizable
+        && std::is_same<default_intrinsic_type<value_t<A>>, default_intrinsic_type<value_t<B>>>::value) {
         return etl::dot_impl::VEC;
     }
 
@@ -76,7 +77,8 @@ etl::dot_impl select_dot_impl() {
 
             //VEC cannot always be used
             case dot_impl::VEC:
-                if (!vec_enabled || !decay_traits<A>::template vectorizable<vector_mode>::value || !decay_traits<B>::template vectorizable<vector_mode>::value) {
+                if (!vec_enabled || !decay_traits<A>::template vectorizable<vector_mode>::value || !decay_traits<B>::template vectorizable<vector_mode>::value
+                    || !default_intrinsic_traits<value_t<A>>::vectorizable) {
                     std::cerr << "Forced selection to VEC dot implementation, but not possible for this expression" << std::endl;
                     return select_default_dot_impl<A, B>();
                 }
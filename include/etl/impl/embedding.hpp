@@ -0,0 +1,202 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the embedding (gather / scatter-add of rows) implementations
+ */
+
+#pragma once
+
+#include <numeric> //For std::iota
+
+//Include the implementations
+#include "etl/impl/std/embedding.hpp"
+#include "etl/impl/vec/embedding.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief The number of rows ahead of the current one that are prefetched
+ */
+constexpr size_t embedding_prefetch_distance = 4;
+
+/*!
+ * \brief Hint the processor that the given row will be read soon
+ * \param row Pointer to the first element of the row
+ * \param n The number of elements of the row
+ */
+template <typename T>
+void prefetch_row(const T* row, size_t n) {
+    const char* first = reinterpret_cast<const char*>(row);
+    const char* last  = reinterpret_cast<const char*>(row + n);
+
+    for (; first < last; first += 64) {
+        __builtin_prefetch(first, 0, 3);
+    }
+}
+
+/*!
+ * \brief Copy a row, with the best available kernel
+ */
+template <typename T>
+void embedding_copy_row(const T* in, T* out, size_t n) {
+    if (vec_impl_enabled<T>()) {
+        impl::vec::copy_row(in, out, n);
+    } else {
+        impl::standard::copy_row(in, out, n);
+    }
+}
+
+/*!
+ * \brief Add a row, with the best available kernel
+ */
+template <typename T>
+void embedding_add_row(const T* in, T* out, size_t n) {
+    if (vec_impl_enabled<T>()) {
+        impl::vec::add_row(in, out, n);
+    } else {
+        impl::standard::add_row(in, out, n);
+    }
+}
+
+/*!
+ * \brief Functor for the gathering of rows of a table
+ */
+struct gather_rows_impl {
+    /*!
+     * \brief Copy the rows of a designated by the indices into c
+     * \param a The table
+     * \param indices The indices of the rows to gather
+     * \param c The output matrix
+     */
+    template <typename A, typename I, typename C>
+    static void apply(const A& a, const I& indices, C&& c) {
+        const size_t N = etl::size(indices);
+        const size_t M = etl::dim<0>(a);
+        const size_t K = etl::dim<1>(a);
+
+        a.ensure_cpu_up_to_date();
+        indices.ensure_cpu_up_to_date();
+
+        const auto* in = a.memory_start();
+        auto* out      = c.memory_start();
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                if (i + embedding_prefetch_distance < last) {
+                    prefetch_row(in + size_t(indices[i + embedding_prefetch_distance]) * K, K);
+                }
+
+                const size_t row = indices[i];
+
+                cpp_assert(row < M, "Out of bounds index in gather_rows");
+                cpp_unused(M);
+
+                embedding_copy_row(in + row * K, out + i * K, K);
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, 0, N, select_parallel(N * K) && N > 1);
+
+        c.invalidate_gpu();
+    }
+};
+
+/*!
+ * \brief Functor for the scatter-add of rows into a table
+ */
+struct scatter_add_rows_impl {
+    /*!
+     * \brief Add each row i of b to the row indices[i] of a
+     *
+     * Duplicate indices are supported. In parallel, the indices are sorted
+     * so that all the rows targeting the same row of a are accumulated by
+     * the same thread, without any synchronization.
+     *
+     * \param a The table to accumulate into
+     * \param indices The indices of the target rows
+     * \param b The rows to accumulate
+     */
+    template <typename A, typename I, typename B>
+    static void apply(A&& a, const I& indices, const B& b) {
+        const size_t N = etl::size(indices);
+        const size_t M = etl::dim<0>(a);
+        const size_t K = etl::dim<1>(a);
+
+        a.ensure_cpu_up_to_date();
+        b.ensure_cpu_up_to_date();
+        indices.ensure_cpu_up_to_date();
+
+        const auto* in = b.memory_start();
+        auto* out      = a.memory_start();
+
+        if (N > 1 && select_parallel(N * K)) {
+            // Sort the positions by target row
+
+            std::vector<size_t> order(N);
+            std::iota(order.begin(), order.end(), 0);
+
+            std::stable_sort(order.begin(), order.end(), [&indices](size_t lhs, size_t rhs) {
+                return size_t(indices[lhs]) < size_t(indices[rhs]);
+            });
+
+            // Compute the segments of identical target rows
+
+            std::vector<size_t> segments;
+            segments.reserve(N + 1);
+
+            for (size_t p = 0; p < N; ++p) {
+                if (!p || size_t(indices[order[p]]) != size_t(indices[order[p - 1]])) {
+                    segments.push_back(p);
+                }
+            }
+
+            segments.push_back(N);
+
+            auto batch_fun = [&](const size_t first, const size_t last) {
+                for (size_t s = first; s < last; ++s) {
+                    const size_t row = indices[order[segments[s]]];
+
+                    cpp_assert(row < M, "Out of bounds index in scatter_add_rows");
+                    cpp_unused(M);
+
+                    for (size_t p = segments[s]; p < segments[s + 1]; ++p) {
+                        if (p + 1 < segments[s + 1]) {
+                            prefetch_row(in + order[p + 1] * K, K);
+                        }
+
+                        embedding_add_row(in + order[p] * K, out + row * K, K);
+                    }
+                }
+            };
+
+            engine_dispatch_1d(batch_fun, 0, segments.size() - 1, true);
+        } else {
+            for (size_t i = 0; i < N; ++i) {
+                if (i + embedding_prefetch_distance < N) {
+                    prefetch_row(out + size_t(indices[i + embedding_prefetch_distance]) * K, K);
+                }
+
+                const size_t row = indices[i];
+
+                cpp_assert(row < M, "Out of bounds index in scatter_add_rows");
+                cpp_unused(M);
+
+                embedding_add_row(in + i * K, out + row * K, K);
+            }
+        }
+
+        a.invalidate_gpu();
+    }
+};
+
+} //end of namespace detail
+
+} //end of namespace etl
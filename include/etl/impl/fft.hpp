@@ -25,17 +25,25 @@ enum class precision {
     Z  ///< Double complex precision
 };
 
+/*!
+ * \brief Returns the candidate bits of the FFT implementations that can be used
+ */
+constexpr size_t fft_candidates() {
+    return impl_bit(fft_impl::STD) | impl_bit(fft_impl::MKL, mkl_enabled) | impl_bit(fft_impl::CUFFT, cufft_enabled);
+}
+
 /*!
  * \brief Select a 1D FFT implementation based on the operation size
  *
  * This does not consider the local context configuration.
  *
+ * \param site The call site of the selection
  * \param func The default fallback functor
  * \param args The args to be passed to the default functor
  * \return The implementation to use
  */
 template <typename Functor, typename... Args>
-inline fft_impl select_forced_fft_impl(Functor func, Args&&... args) {
+inline fft_impl select_forced_fft_impl(selection_site<fft_impl>& site, Functor func, Args&&... args) {
     //Note since these boolean will be known at compile time, the conditions will be a lot simplified
     constexpr bool mkl   = mkl_enabled;
     constexpr bool cufft = cufft_enabled;
@@ -47,23 +55,23 @@ inline fft_impl select_forced_fft_impl(Functor func, Args&&... args) {
         case fft_impl::MKL:
             if (!mkl) {                                                                                                       //COVERAGE_EXCLUDE_LINE
                 std::cerr << "Forced selection to MKL fft implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
-                return func(args...);                                                                                         //COVERAGE_EXCLUDE_LINE
+                return log_selection(site, {size_t(args)...}, fft_candidates(), func(args...), selection_reason::UNAVAILABLE); //COVERAGE_EXCLUDE_LINE
             }                                                                                                                 //COVERAGE_EXCLUDE_LINE
 
-            return forced;
+            return log_selection(site, {size_t(args)...}, fft_candidates(), forced, selection_reason::FORCED);
 
         //CUFFT cannot always be used
         case fft_impl::CUFFT:
             if (!cufft) {                                                                                                       //COVERAGE_EXCLUDE_LINE
                 std::cerr << "Forced selection to CUFFT fft implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
-                return func(args...);                                                                                           //COVERAGE_EXCLUDE_LINE
+                return log_selection(site, {size_t(args)...}, fft_candidates(), func(args...), selection_reason::UNAVAILABLE); //COVERAGE_EXCLUDE_LINE
             }                                                                                                                   //COVERAGE_EXCLUDE_LINE
 
-            return forced;
+            return log_selection(site, {size_t(args)...}, fft_candidates(), forced, selection_reason::FORCED);
 
         //In other cases, simply use the forced impl
         default:
-            return forced;
+            return log_selection(site, {size_t(args)...}, fft_candidates(), forced, selection_reason::FORCED);
     }
 }
 
@@ -119,11 +127,13 @@ inline cpp14_constexpr fft_impl select_default_fft1_impl(const size_t n) {
  * \return The implementation to use
  */
 inline fft_impl select_fft1_impl(const size_t n) {
+    static selection_site<fft_impl> site("fft1");
+
     if (local_context().fft_selector.forced) {
-        return select_forced_fft_impl([](size_t n) { return select_default_fft1_impl(n); }, n);
+        return select_forced_fft_impl(site, [](size_t n) { return select_default_fft1_impl(n); }, n);
     }
 
-    return select_default_fft1_impl(n);
+    return log_selection(site, {n}, fft_candidates(), select_default_fft1_impl(n), selection_reason::HEURISTIC);
 }
 
 /*!
@@ -164,11 +174,13 @@ inline cpp14_constexpr fft_impl select_default_fft1_many_impl(const size_t batch
  * \return The implementation to use
  */
 inline fft_impl select_fft1_many_impl(const size_t batch, const size_t n) {
+    static selection_site<fft_impl> site("fft1_many");
+
     if (local_context().fft_selector.forced) {
-        return select_forced_fft_impl([](size_t batch, size_t n) { return select_default_fft1_many_impl(batch, n); }, batch, n);
+        return select_forced_fft_impl(site, [](size_t batch, size_t n) { return select_default_fft1_many_impl(batch, n); }, batch, n);
     }
 
-    return select_default_fft1_many_impl(batch, n);
+    return log_selection(site, {batch, n}, fft_candidates(), select_default_fft1_many_impl(batch, n), selection_reason::HEURISTIC);
 }
 
 /*!
@@ -217,11 +229,13 @@ inline cpp14_constexpr fft_impl select_default_ifft1_impl(const size_t n) {
  * \return The implementation to use
  */
 inline fft_impl select_ifft1_impl(const size_t n) {
+    static selection_site<fft_impl> site("ifft1");
+
     if (local_context().fft_selector.forced) {
-        return select_forced_fft_impl([](size_t n) { return select_default_ifft1_impl(n); }, n);
+        return select_forced_fft_impl(site, [](size_t n) { return select_default_ifft1_impl(n); }, n);
     }
 
-    return select_default_ifft1_impl(n);
+    return log_selection(site, {n}, fft_candidates(), select_default_ifft1_impl(n), selection_reason::HEURISTIC);
 }
 
 /*!
@@ -272,11 +286,13 @@ inline cpp14_constexpr fft_impl select_default_fft2_impl(const size_t n1, size_t
  * \return The implementation to use
  */
 inline fft_impl select_fft2_impl(const size_t n1, size_t n2) {
+    static selection_site<fft_impl> site("fft2");
+
     if (local_context().fft_selector.forced) {
-        return select_forced_fft_impl([](size_t n1, size_t n2) { return select_default_fft2_impl(n1, n2); }, n1, n2);
+        return select_forced_fft_impl(site, [](size_t n1, size_t n2) { return select_default_fft2_impl(n1, n2); }, n1, n2);
     }
 
-    return select_default_fft2_impl(n1, n2);
+    return log_selection(site, {n1, n2}, fft_candidates(), select_default_fft2_impl(n1, n2), selection_reason::HEURISTIC);
 }
 
 /*!
@@ -319,13 +335,15 @@ inline cpp14_constexpr fft_impl select_default_fft2_many_impl(const size_t batch
  * \return The implementation to use
  */
 inline fft_impl select_fft2_many_impl(const size_t batch, const size_t n1, const size_t n2) {
+    static selection_site<fft_impl> site("fft2_many");
+
     if (local_context().fft_selector.forced) {
-        return select_forced_fft_impl([](size_t batch, size_t n1, size_t n2) {
+        return select_forced_fft_impl(site, [](size_t batch, size_t n1, size_t n2) {
             return select_default_fft2_many_impl(batch, n1, n2);
         }, batch, n1, n2);
     }
 
-    return select_default_fft2_many_impl(batch, n1, n2);
+    return log_selection(site, {batch, n1, n2}, fft_candidates(), select_default_fft2_many_impl(batch, n1, n2), selection_reason::HEURISTIC);
 }
 
 /*!
@@ -61,6 +61,18 @@ inline cpp14_constexpr gemm_impl select_default_gemm_impl(const size_t n1, const
     return gemm_impl::STD;
 }
 
+/*!
+ * \brief Returns the candidate bits of the GEMM implementations that can be
+ * used for the given types
+ */
+template <typename A, typename B, typename C>
+constexpr size_t gemm_candidates() {
+    return impl_bit(gemm_impl::STD)
+         | impl_bit(gemm_impl::VEC, vec_enabled && all_vectorizable<vector_mode, A, B, C>::value)
+         | impl_bit(gemm_impl::BLAS, cblas_enabled)
+         | impl_bit(gemm_impl::CUBLAS, cublas_enabled);
+}
+
 /*!
  * \brief Select an implementation of GEMM
  * \param n1 The left dimension of the  multiplication
@@ -70,8 +82,12 @@ inline cpp14_constexpr gemm_impl select_default_gemm_impl(const size_t n1, const
  */
 template <typename A, typename B, typename C>
 inline gemm_impl select_gemm_impl(const size_t n1, const size_t n2, const size_t n3) {
+    static selection_site<gemm_impl> site("gemm");
+
     auto def = select_default_gemm_impl<A, B, C>(n1, n2, n3);
 
+    constexpr size_t candidates = gemm_candidates<A, B, C>();
+
     if (local_context().gemm_selector.forced) {
         auto forced = local_context().gemm_selector.impl;
 
@@ -80,36 +96,36 @@ inline gemm_impl select_gemm_impl(const size_t n1, const size_t n2, const size_t
             case gemm_impl::CUBLAS:
                 if (!cublas_enabled) {                                                                                     //COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to CUBLAS gemm implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
-                    return def;                                                              //COVERAGE_EXCLUDE_LINE
+                    return log_selection(site, {n1, n2, n3}, candidates, def, selection_reason::UNAVAILABLE); //COVERAGE_EXCLUDE_LINE
                 }                                                                                                                     //COVERAGE_EXCLUDE_LINE
 
-                return forced;
+                return log_selection(site, {n1, n2, n3}, candidates, forced, selection_reason::FORCED);
 
             //BLAS cannot always be used
             case gemm_impl::BLAS:
                 if (!cblas_enabled) {                                                                                    //COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to BLAS gemm implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
-                    return def;                                                            //COVERAGE_EXCLUDE_LINE
+                    return log_selection(site, {n1, n2, n3}, candidates, def, selection_reason::UNAVAILABLE); //COVERAGE_EXCLUDE_LINE
                 }                                                                                                                   //COVERAGE_EXCLUDE_LINE
 
-                return forced;
+                return log_selection(site, {n1, n2, n3}, candidates, forced, selection_reason::FORCED);
 
             //VEC cannot always be used
             case gemm_impl::VEC:
                 if (!vec_enabled || !all_vectorizable<vector_mode, A, B, C>::value) {                                               //COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to VEC gemv implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
-                    return def;                                                            //COVERAGE_EXCLUDE_LINE
+                    return log_selection(site, {n1, n2, n3}, candidates, def, selection_reason::UNAVAILABLE); //COVERAGE_EXCLUDE_LINE
                 }                                                                                                                   //COVERAGE_EXCLUDE_LINE
 
-                return forced;
+                return log_selection(site, {n1, n2, n3}, candidates, forced, selection_reason::FORCED);
 
             //In other cases, simply use the forced impl
             default:
-                return forced;
+                return log_selection(site, {n1, n2, n3}, candidates, forced, selection_reason::FORCED);
         }
     }
 
-    return def;
+    return log_selection(site, {n1, n2, n3}, candidates, def, selection_reason::HEURISTIC);
 }
 
 /*!
@@ -262,6 +278,26 @@ inline gemm_impl select_gevm_impl(const size_t n1, const size_t n2) {
     return select_default_gevm_impl<A, B, C>(n1, n2);
 }
 
+/*!
+ * \brief Returns the number of bytes touched by the GEMM C = A * B
+ * \param a The A matrix
+ * \param c The C matrix
+ */
+template <typename A, typename C>
+size_t gemm_bytes(const A& a, const C& c) {
+    return (etl::size(a) + etl::dim<1>(a) * etl::dim<1>(c) + etl::size(c)) * sizeof(value_t<C>);
+}
+
+/*!
+ * \brief Returns the number of floating point operations of the GEMM C = A * B
+ * \param a The A matrix
+ * \param c The C matrix
+ */
+template <typename A, typename C>
+size_t gemm_flops(const A& a, const C& c) {
+    return 2 * etl::size(c) * etl::dim<1>(a);
+}
+
 /*!
  * \brief Functor for matrix-matrix multiplication
  */
@@ -276,6 +312,8 @@ struct mm_mul_impl {
     static void apply_raw(A&& a, B&& b, C&& c) {
         gemm_impl impl = select_gemm_impl<A, B, C>(etl::dim<0>(a), etl::dim<1>(a), etl::dim<1>(c));
 
+        detail::profile_scope profile("gemm", impl_name(impl), gemm_bytes(a, c), gemm_flops(a, c));
+
         if (impl == gemm_impl::STD) {
             etl::impl::standard::mm_mul(make_temporary(std::forward<A>(a)), make_temporary(std::forward<B>(b)), std::forward<C>(c));
         } else if (impl == gemm_impl::VEC) {
@@ -297,6 +335,8 @@ struct mm_mul_impl {
     static void apply_raw(A&& a, B&& b, C&& c) {
         gemm_impl impl = select_gemm_impl<A, B, C>(etl::dim<0>(a), etl::dim<1>(a), etl::dim<1>(c));
 
+        detail::profile_scope profile("gemm", impl_name(impl), gemm_bytes(a, c), gemm_flops(a, c));
+
         if (impl == gemm_impl::STD) {
             etl::impl::standard::mm_mul(make_temporary(std::forward<A>(a)), make_temporary(std::forward<B>(b)), std::forward<C>(c));
         } else if (impl == gemm_impl::VEC) {
@@ -318,6 +358,8 @@ struct mm_mul_impl {
     static void apply_raw(A&& a, B&& b, C&& c) {
         gemm_impl impl = select_gemm_impl<A, B, C>(etl::dim<0>(a), etl::dim<1>(a), etl::dim<1>(c));
 
+        detail::profile_scope profile("gemm", impl_name(impl), gemm_bytes(a, c), gemm_flops(a, c));
+
         if (impl == gemm_impl::STD) {
             etl::impl::standard::mm_mul(make_temporary(std::forward<A>(a)), make_temporary(std::forward<B>(b)), std::forward<C>(c));
         } else if (impl == gemm_impl::VEC) {
@@ -339,6 +381,8 @@ struct mm_mul_impl {
     static void apply_raw(A&& a, B&& b, C&& c) {
         gemm_impl impl = select_gemm_impl<A, B, C>(etl::dim<0>(a), etl::dim<1>(a), etl::dim<1>(c));
 
+        detail::profile_scope profile("gemm", impl_name(impl), gemm_bytes(a, c), gemm_flops(a, c));
+
         if (impl == gemm_impl::STD) {
             etl::impl::standard::mm_mul(a, b, c);
         } else if (impl == gemm_impl::VEC) {
@@ -0,0 +1,225 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Implementations of the im2col transformations
+ *
+ * The direct memory versions copy full row segments of the image (or of its
+ * transpose for im2col_direct) into the columns matrix with the vectorized
+ * row kernels (the same as the embedding ones) and are parallelized over the
+ * columns and the images.
+ */
+
+#pragma once
+
+//Include the row kernels
+#include "etl/impl/std/embedding.hpp"
+#include "etl/impl/vec/embedding.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Copy n elements, taken every s elements of in, to the contiguous out
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements to copy
+ * \param s The stride between two elements of the input
+ */
+template <typename T>
+void im2col_copy_row(const T* in, T* out, size_t n, size_t s) {
+    if (s == 1) {
+        if (vec_impl_enabled<T>()) {
+            impl::vec::copy_row(in, out, n);
+        } else {
+            impl::standard::copy_row(in, out, n);
+        }
+    } else {
+        for (size_t j = 0; j < n; ++j) {
+            out[j] = in[j * s];
+        }
+    }
+}
+
+} //end of namespace detail
+
+//TODO Adapt this to an expression
+
+/*!
+ * \brief Convert an image to a sequence of image columns to be multiplied by kernels of size (k1,k2)
+ * \param m The output matrix
+ * \param sub The input image
+ * \param k1 The first dimension of ther kernel
+ * \param k2 The second dimension of ther kernel
+ */
+template <typename A, typename M, cpp_disable_if(all_dma<A, M>::value)>
+void im2col_direct(M& m, A&& sub, size_t k1, size_t k2) {
+    const size_t i1 = etl::dim<0>(sub);
+    const size_t i2 = etl::dim<1>(sub);
+
+    const size_t m_width = (i1 - k1 + 1) * (i2 - k2 + 1);
+
+    for (size_t b = 0; b < m_width; ++b) {
+        auto s_i = b % (i1 - k1 + 1);
+        auto s_j = b / (i1 - k1 + 1);
+
+        for (size_t b_i = 0; b_i < k1; ++b_i) {
+            for (size_t b_j = 0; b_j < k2; ++b_j) {
+                m(b_j * k1 + b_i, b) = sub(s_i + b_i, s_j + b_j);
+            }
+        }
+    }
+}
+
+// This is a direct memory version
+// Each row of the output is filled from the columns of the image, read as
+// contiguous rows of the transposed image, the rows are processed in
+// parallel
+
+/*!
+ * \brief Convert an image to a sequence of image columns to be multiplied by kernels of size (k1,k2)
+ * \param m The output matrix
+ * \param sub The input image
+ * \param k1 The first dimension of ther kernel
+ * \param k2 The second dimension of ther kernel
+ */
+template <typename A, typename M, cpp_enable_if(all_dma<A, M>::value)>
+void im2col_direct(M& m, A&& sub, size_t k1, size_t k2) {
+    const size_t i1 = etl::dim<0>(sub);
+    const size_t i2 = etl::dim<1>(sub);
+
+    const size_t height = i1 - k1 + 1;
+    const size_t width  = i2 - k2 + 1;
+
+    const auto m_width = height * width;
+
+    // sub_t(j, i) = sub(i, j)
+    etl::dyn_matrix<value_t<A>, 2> sub_t(i2, i1);
+
+    const auto mm = m.memory_start();
+    const auto ss = sub.memory_start();
+    const auto tt = sub_t.memory_start();
+
+    for (size_t i = 0; i < i1; ++i) {
+        for (size_t j = 0; j < i2; ++j) {
+            tt[j * i1 + i] = ss[i * i2 + j];
+        }
+    }
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t r = first; r < last; ++r) {
+            const size_t b_j = r / k1;
+            const size_t b_i = r % k1;
+
+            for (size_t s_j = 0; s_j < width; ++s_j) {
+                detail::im2col_copy_row(tt + (s_j + b_j) * i1 + b_i, mm + r * m_width + s_j * height, height, 1);
+            }
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, k1 * k2, select_parallel(k1 * k2 * m_width) && k1 * k2 > 1);
+}
+
+//im2col version without any need for transpose
+
+/*!
+ * \brief Convert an image to a sequence of image columns to be multiplied by kernels of size (k1,k2).
+ *
+ * This special version does not require any transposition when used. When
+ * the image is strided, only the columns of the strided positions are
+ * generated, the output has then (i1 - k1) / s1 + 1 times (i2 - k2) / s2 + 1
+ * columns.
+ *
+ * \param m The output matrix
+ * \param sub The input image
+ * \param k1 The first dimension of ther kernel
+ * \param k2 The second dimension of ther kernel
+ * \param s1 The first dimension of the stride
+ * \param s2 The second dimension of the stride
+ */
+template <typename A, typename M>
+void im2col_direct_tr(M& m, A&& sub, size_t k1, size_t k2, size_t s1 = 1, size_t s2 = 1) {
+    static_assert(all_dma<A, M>::value, "im2col_direct_tr has only been implemented for direct memory access");
+
+    const size_t i1 = etl::dim<0>(sub);
+    const size_t i2 = etl::dim<1>(sub);
+
+    const auto height = (i1 - k1) / s1 + 1;
+    const auto width  = (i2 - k2) / s2 + 1;
+
+    const auto mm = m.memory_start();
+    const auto ss = sub.memory_start();
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t c = first; c < last; ++c) {
+            const size_t w_source = c % k2;
+            const size_t h_source = c / k2;
+
+            for (size_t h = 0; h < height; ++h) {
+                const size_t block_source = (h * s1 + h_source) * i2 + w_source;
+                const size_t block_target = (c * height + h) * width;
+
+                detail::im2col_copy_row(ss + block_source, mm + block_target, width, s2);
+            }
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, k1 * k2, select_parallel(k1 * k2 * height * width) && k1 * k2 > 1);
+}
+
+/*!
+ * \brief Convert a sequence of images to a sequence of image columns to be multiplied by kernels of size (k1,k2).
+ *
+ * This special version does not require any transposition when used. When
+ * the images are strided, only the columns of the strided positions are
+ * generated.
+ *
+ * \param m The output matrix
+ * \param sub The input image
+ * \param k1 The first dimension of ther kernel
+ * \param k2 The second dimension of ther kernel
+ * \param s1 The first dimension of the stride
+ * \param s2 The second dimension of the stride
+ */
+template <typename A, typename M>
+void im2col_direct_tr_multi(M& m, A&& sub, size_t k1, size_t k2, size_t s1 = 1, size_t s2 = 1) {
+    static_assert(all_dma<A, M>::value, "im2col_direct_tr has only been implemented for direct memory access");
+
+    const auto N  = etl::dim<0>(sub);
+    const auto i1 = etl::dim<1>(sub);
+    const auto i2 = etl::dim<2>(sub);
+
+    const auto height = (i1 - k1) / s1 + 1;
+    const auto width  = (i2 - k2) / s2 + 1;
+
+    const auto mm = m.memory_start();
+    const auto ss = sub.memory_start();
+
+    // Each task fills the columns of one kernel position for one image
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t t = first; t < last; ++t) {
+            const auto w = t / N;
+            const auto i = t % N;
+
+            const auto w_source = w % k2;
+            const auto h_source = w / k2;
+
+            for (size_t h = 0; h < height; ++h) {
+                const auto block_source = ((h * s1 + h_source) * i2 + w_source) + i * (i1 * i2);
+                const auto block_target = (w * N + i) * (height * width) + h * width;
+
+                detail::im2col_copy_row(ss + block_source, mm + block_target, width, s2);
+            }
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, k1 * k2 * N, select_parallel(k1 * k2 * N * height * width) && k1 * k2 * N > 1);
+}
+
+} //end of namespace etl
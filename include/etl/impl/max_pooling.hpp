@@ -15,6 +15,13 @@ namespace impl {
  * \brief Functor for 2D Max Pooling
  */
 struct max_pool_2d {
+    /*!
+     * \brief Returns the description of the operation
+     */
+    static constexpr const char* desc(){
+        return "max_pool_2d";
+    }
+
     /*!
      * \brief Pool a block of the sub expression around the border (with padding)
      * \param sub The sub expression
@@ -351,6 +358,13 @@ struct max_pool_2d {
  * \brief Functor for 3D Max Pooling
  */
 struct max_pool_3d {
+    /*!
+     * \brief Returns the description of the operation
+     */
+    static constexpr const char* desc(){
+        return "max_pool_3d";
+    }
+
     /*!
      * \brief Pool a block of the sub expression
      * \param sub The sub expression
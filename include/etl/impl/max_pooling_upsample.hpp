@@ -109,7 +109,7 @@ struct max_pool_upsample_2d {
      * \tparam C2 The second dimension pooling ratio
      */
     template <size_t C1, size_t C2, typename A, typename B, typename C, typename M, cpp_enable_if(!is_2d<A>::value)>
-    static void apply(A&& in, B&& out, C&& errors, M& m) {
+    static void apply(A&& in, B&& out, C&& errors, M&& m) {
         for(size_t i = 0; i < etl::dim<0>(in); ++i){
             apply<C1, C2>(in(i), out(i), errors(i), m(i));
         }
@@ -123,7 +123,7 @@ struct max_pool_upsample_2d {
      * \param c2 The second dimension pooling ratio
      */
     template <typename A, typename B, typename C, typename M, cpp_enable_if(!is_2d<A>::value)>
-    static void apply(A&& in, B&& out, C&& errors, M& m, size_t c1, size_t c2) {
+    static void apply(A&& in, B&& out, C&& errors, M&& m, size_t c1, size_t c2) {
         for(size_t i = 0; i < etl::dim<0>(in); ++i){
             apply(in(i), out(i), errors(i), m(i), c1, c2);
         }
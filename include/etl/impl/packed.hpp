@@ -0,0 +1,229 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the packed symmetric and triangular kernels (SYMV,
+ * TRMV, TRMM and SYRK)
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/packed.hpp"
+#include "etl/impl/vec/packed.hpp"
+
+namespace etl {
+
+/*!
+ * \brief Compute y = A * x with A a packed symmetric matrix.
+ *
+ * Each element of the packed storage is read only once, which is half the
+ * memory traffic of the dense matrix-vector multiplication.
+ *
+ * \param a The packed symmetric matrix (n x n)
+ * \param x The input vector (n)
+ * \param y The output vector (n)
+ */
+template <typename T, typename X, typename Y>
+void symv(const packed_symmetric_matrix<T>& a, X&& x, Y&& y) {
+    static_assert(is_1d<X>::value && is_1d<Y>::value, "symv is only implemented for vectors");
+    static_assert(is_dma<Y>::value, "symv needs a vector with direct memory access as output");
+
+    const size_t n = a.dimension();
+
+    cpp_assert(etl::size(x) == n && etl::size(y) == n, "Invalid dimensions for symv");
+
+    standard_evaluator::pre_assign_rhs(x);
+
+    decltype(auto) xx = make_temporary(x);
+
+    safe_ensure_cpu_up_to_date(xx);
+
+    cpp_assert(xx.memory_start() != y.memory_start(), "symv cannot be computed in place");
+
+    if (detail::vec_impl_enabled<T>()) {
+        impl::vec::symv<default_vec>(a.packed_memory_start(), n, xx.memory_start(), y.memory_start());
+    } else {
+        impl::standard::symv(a.packed_memory_start(), n, xx.memory_start(), y.memory_start());
+    }
+
+    y.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute A * x with A a packed symmetric matrix.
+ * \param a The packed symmetric matrix (n x n)
+ * \param x The input vector (n)
+ * \return a vector containing the result
+ */
+template <typename T, typename X>
+dyn_vector<T> symv(const packed_symmetric_matrix<T>& a, X&& x) {
+    dyn_vector<T> y(a.dimension());
+    symv(a, x, y);
+    return y;
+}
+
+/*!
+ * \brief Compute y = A * x with A a packed triangular matrix.
+ * \param a The packed triangular matrix (n x n)
+ * \param x The input vector (n)
+ * \param y The output vector (n)
+ */
+template <typename T, packing P, typename X, typename Y, cpp_enable_if(P != packing::SYMMETRIC)>
+void trmv(const packed_matrix<T, P>& a, X&& x, Y&& y) {
+    static_assert(is_1d<X>::value && is_1d<Y>::value, "trmv is only implemented for vectors");
+    static_assert(is_dma<Y>::value, "trmv needs a vector with direct memory access as output");
+
+    const size_t n = a.dimension();
+
+    cpp_assert(etl::size(x) == n && etl::size(y) == n, "Invalid dimensions for trmv");
+
+    standard_evaluator::pre_assign_rhs(x);
+
+    decltype(auto) xx = make_temporary(x);
+
+    safe_ensure_cpu_up_to_date(xx);
+
+    cpp_assert(xx.memory_start() != y.memory_start(), "trmv cannot be computed in place");
+
+    const T* ap = a.packed_memory_start();
+
+    if (detail::vec_impl_enabled<T>()) {
+        if (P == packing::LOWER) {
+            impl::vec::trmv_lower<default_vec>(ap, n, xx.memory_start(), y.memory_start());
+        } else {
+            impl::vec::trmv_upper<default_vec>(ap, n, xx.memory_start(), y.memory_start());
+        }
+    } else {
+        if (P == packing::LOWER) {
+            impl::standard::trmv_lower(ap, n, xx.memory_start(), y.memory_start());
+        } else {
+            impl::standard::trmv_upper(ap, n, xx.memory_start(), y.memory_start());
+        }
+    }
+
+    y.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute A * x with A a packed triangular matrix.
+ * \param a The packed triangular matrix (n x n)
+ * \param x The input vector (n)
+ * \return a vector containing the result
+ */
+template <typename T, packing P, typename X, cpp_enable_if(P != packing::SYMMETRIC)>
+dyn_vector<T> trmv(const packed_matrix<T, P>& a, X&& x) {
+    dyn_vector<T> y(a.dimension());
+    trmv(a, x, y);
+    return y;
+}
+
+/*!
+ * \brief Compute C = A * B with A a packed triangular matrix.
+ * \param a The packed triangular matrix (n x n)
+ * \param b The B matrix (n x k)
+ * \param c The C matrix (n x k)
+ */
+template <typename T, packing P, typename B, typename C, cpp_enable_if(P != packing::SYMMETRIC)>
+void trmm(const packed_matrix<T, P>& a, B&& b, C&& c) {
+    static_assert(is_2d<B>::value && is_2d<C>::value, "trmm is only implemented for matrices");
+    static_assert(is_dma<C>::value, "trmm needs a matrix with direct memory access as output");
+    static_assert(decay_traits<B>::storage_order == order::RowMajor && decay_traits<C>::storage_order == order::RowMajor, "trmm is only implemented for row-major matrices");
+
+    const size_t n = a.dimension();
+    const size_t k = etl::dim<1>(b);
+
+    cpp_assert(etl::dim<0>(b) == n && etl::dim<0>(c) == n && etl::dim<1>(c) == k, "Invalid dimensions for trmm");
+
+    standard_evaluator::pre_assign_rhs(b);
+
+    decltype(auto) bb = make_temporary(b);
+
+    safe_ensure_cpu_up_to_date(bb);
+
+    cpp_assert(bb.memory_start() != c.memory_start(), "trmm cannot be computed in place");
+
+    const T* ap = a.packed_memory_start();
+
+    if (detail::vec_impl_enabled<T>()) {
+        if (P == packing::LOWER) {
+            impl::vec::trmm_lower<default_vec>(ap, n, bb.memory_start(), k, c.memory_start());
+        } else {
+            impl::vec::trmm_upper<default_vec>(ap, n, bb.memory_start(), k, c.memory_start());
+        }
+    } else {
+        if (P == packing::LOWER) {
+            impl::standard::trmm_lower(ap, n, bb.memory_start(), k, c.memory_start());
+        } else {
+            impl::standard::trmm_upper(ap, n, bb.memory_start(), k, c.memory_start());
+        }
+    }
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute A * B with A a packed triangular matrix.
+ * \param a The packed triangular matrix (n x n)
+ * \param b The B matrix (n x k)
+ * \return a matrix containing the result
+ */
+template <typename T, packing P, typename B, cpp_enable_if(P != packing::SYMMETRIC)>
+dyn_matrix<T, 2> trmm(const packed_matrix<T, P>& a, B&& b) {
+    dyn_matrix<T, 2> c(a.dimension(), etl::dim<1>(b));
+    trmm(a, b, c);
+    return c;
+}
+
+/*!
+ * \brief Compute C = A * A^T into a packed symmetric matrix.
+ *
+ * Only the lower triangle of the result is computed.
+ *
+ * \param a The A matrix (n x k)
+ * \param c The packed symmetric matrix (n x n)
+ */
+template <typename A, typename T>
+void syrk(A&& a, packed_symmetric_matrix<T>& c) {
+    static_assert(is_2d<A>::value, "syrk is only implemented for matrices");
+    static_assert(decay_traits<A>::storage_order == order::RowMajor, "syrk is only implemented for row-major matrices");
+    static_assert(std::is_same<value_t<A>, T>::value, "syrk must be computed in a matrix of the same type");
+
+    const size_t n = etl::dim<0>(a);
+    const size_t k = etl::dim<1>(a);
+
+    if (c.dimension() != n) {
+        c = packed_symmetric_matrix<T>(n);
+    }
+
+    standard_evaluator::pre_assign_rhs(a);
+
+    decltype(auto) aa = make_temporary(a);
+
+    safe_ensure_cpu_up_to_date(aa);
+
+    if (detail::vec_impl_enabled<T>()) {
+        impl::vec::syrk<default_vec>(aa.memory_start(), n, k, c.packed_memory_start());
+    } else {
+        impl::standard::syrk(aa.memory_start(), n, k, c.packed_memory_start());
+    }
+}
+
+/*!
+ * \brief Compute A * A^T into a packed symmetric matrix.
+ * \param a The A matrix (n x k)
+ * \return a packed symmetric matrix containing the result
+ */
+template <typename A>
+packed_symmetric_matrix<value_t<A>> syrk(A&& a) {
+    packed_symmetric_matrix<value_t<A>> c(etl::dim<0>(a));
+    syrk(a, c);
+    return c;
+}
+
+} //end of namespace etl
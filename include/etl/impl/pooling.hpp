@@ -14,3 +14,32 @@
 #include "etl/impl/max_pooling_upsample.hpp"
 #include "etl/impl/avg_pooling.hpp"
 #include "etl/impl/upsample.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Returns the name of the implementation of a pooling of D
+ * dimensions into m.
+ *
+ * The max and average poolings of a batch of inputs of D + 1 dimensions
+ * are done in parallel over the batch, the other poolings are serial.
+ *
+ * \param m The output of the pooling
+ * \tparam Impl The pooling functor
+ * \tparam D The number of pooled dimensions
+ */
+template <typename Impl, size_t D, typename M>
+const char* pool_impl_name(const M& m) {
+    constexpr size_t dims = decay_traits<M>::dimensions();
+
+    constexpr bool batch_parallel = std::is_same<Impl, impl::max_pool_2d>::value || std::is_same<Impl, impl::avg_pool_2d>::value
+                                 || std::is_same<Impl, impl::max_pool_3d>::value || std::is_same<Impl, impl::avg_pool_3d>::value;
+
+    return batch_parallel && dims > D && engine_select_parallel(etl::dim(m, dims - D - 1), 2UL) ? "PAR_STD" : "STD";
+}
+
+} //end of namespace detail
+
+} //end of namespace etl
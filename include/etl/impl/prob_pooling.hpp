@@ -83,6 +83,13 @@ inline void pmp_h_kernel(etl::dyn_matrix<T, 2>& exp_sub, etl::dyn_matrix<T, 2>&
  * \brief 2D Implemenetation of Probabilistic Max Pooling for hidden units
  */
 struct pmp_h_impl {
+    /*!
+     * \brief Returns the description of the operation
+     */
+    static constexpr const char* desc(){
+        return "pmp_h";
+    }
+
     /*!
      * \brief Apply the functor
      * \param a The input sub expression
@@ -204,6 +211,13 @@ struct pmp_h_impl {
  * \brief Dynamic Implemenetation of Probabilistic Max Pooling for hidden units
  */
 struct dyn_pmp_h_impl {
+    /*!
+     * \brief Returns the description of the operation
+     */
+    static constexpr const char* desc(){
+        return "pmp_h";
+    }
+
     /*!
      * \brief Apply the functor
      * \param a The input sub expression
@@ -408,6 +422,13 @@ inline void pmp_p_kernel(etl::dyn_matrix<T, 2>& exp_sub, etl::dyn_matrix<T, 2>&
  * \brief Implemenetation of Probabilistic Max Pooling for pooling units
  */
 struct pmp_p_impl {
+    /*!
+     * \brief Returns the description of the operation
+     */
+    static constexpr const char* desc(){
+        return "pmp_p";
+    }
+
     /*!
      * \brief Apply the functor
      * \param a The input sub expression
@@ -529,6 +550,13 @@ struct pmp_p_impl {
  * \brief Dynamic 4D Implemenetation of Probabilistic Max Pooling for pooling units
  */
 struct dyn_pmp_p_impl {
+    /*!
+     * \brief Returns the description of the operation
+     */
+    static constexpr const char* desc(){
+        return "pmp_p";
+    }
+
     /*!
      * \brief Apply the functor
      * \param a The input sub expression
@@ -0,0 +1,334 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the cumulative (scan) implementations
+ *
+ * Long vectors are scanned with a two-level block scan: each block is
+ * scanned locally in parallel, the block totals are then scanned serially
+ * and finally combined with the blocks in parallel.
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/common/scan.hpp"
+#include "etl/impl/std/scan.hpp"
+#include "etl/impl/vec/scan.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Inclusive scan of a row, with the best available kernel
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the row
+ * \param carry The value to combine with the first element
+ * \return The last value of the scan
+ */
+template <typename Op, typename T>
+T scan_row(const T* in, T* out, size_t n, T carry) {
+    if (vec_impl_enabled<T>() && std::is_floating_point<T>::value) {
+        return impl::vec::scan_row<Op>(in, out, n, carry);
+    } else {
+        return impl::standard::scan_row<Op>(in, out, n, carry);
+    }
+}
+
+/*!
+ * \brief Combine a row with the previous row of the scan, with the best
+ * available kernel
+ * \param prev The previous row of the scan
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the rows
+ */
+template <typename Op, typename T>
+void scan_step_row(const T* prev, const T* in, T* out, size_t n) {
+    if (vec_impl_enabled<T>() && std::is_floating_point<T>::value) {
+        impl::vec::scan_step_row<Op>(prev, in, out, n);
+    } else {
+        impl::standard::scan_step_row<Op>(prev, in, out, n);
+    }
+}
+
+/*!
+ * \brief Combine a value with each element of a row, with the best
+ * available kernel
+ * \param out The row
+ * \param n The number of elements of the row
+ * \param value The value to combine
+ */
+template <typename Op, typename T>
+void scan_offset_row(T* out, size_t n, T value) {
+    if (vec_impl_enabled<T>() && std::is_floating_point<T>::value) {
+        impl::vec::scan_offset_row<Op>(out, n, value);
+    } else {
+        impl::standard::scan_offset_row<Op>(out, n, value);
+    }
+}
+
+/*!
+ * \brief Inclusive scan of a contiguous vector, with a parallel block scan
+ * for long vectors
+ * \param in The input vector
+ * \param out The output vector
+ * \param n The number of elements
+ */
+template <typename Op, typename T>
+void scan_flat(const T* in, T* out, size_t n) {
+    const size_t blocks = std::min(etl::parallel_threads(), n);
+
+    if (!select_parallel(n) || blocks < 2) {
+        scan_row<Op>(in, out, n, Op::template neutral<T>());
+        return;
+    }
+
+    const size_t block_size = (n + blocks - 1) / blocks;
+
+    std::vector<T> totals(blocks, Op::template neutral<T>());
+
+    // 1. Scan each block independently
+
+    auto local_fun = [&](const size_t first, const size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            const size_t start = std::min(n, b * block_size);
+            const size_t end   = std::min(n, start + block_size);
+
+            totals[b] = scan_row<Op>(in + start, out + start, end - start, Op::template neutral<T>());
+        }
+    };
+
+    engine_dispatch_1d(local_fun, 0, blocks, true);
+
+    // 2. Exclusive scan of the block totals
+
+    T carry = Op::template neutral<T>();
+
+    for (size_t b = 0; b < blocks; ++b) {
+        auto total = totals[b];
+        totals[b]  = carry;
+        carry      = Op::apply(carry, total);
+    }
+
+    // 3. Combine the blocks with the totals of the previous blocks
+
+    auto offset_fun = [&](const size_t first, const size_t last) {
+        for (size_t b = std::max(first, size_t(1)); b < last; ++b) {
+            const size_t start = std::min(n, b * block_size);
+            const size_t end   = std::min(n, start + block_size);
+
+            scan_offset_row<Op>(out + start, end - start, totals[b]);
+        }
+    };
+
+    engine_dispatch_1d(offset_fun, 0, blocks, true);
+}
+
+/*!
+ * \brief Scan of each row of a contiguous row-major matrix
+ * \param in The input matrix
+ * \param out The output matrix
+ * \param N The number of rows
+ * \param M The number of columns
+ */
+template <typename Op, typename T>
+void scan_rows(const T* in, T* out, size_t N, size_t M) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            scan_row<Op>(in + i * M, out + i * M, M, Op::template neutral<T>());
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, N, select_parallel(N * M) && N > 1);
+}
+
+/*!
+ * \brief Scan of each column of a contiguous row-major matrix.
+ *
+ * The rows are combined one after another, the columns are split between
+ * the threads.
+ *
+ * \param in The input matrix
+ * \param out The output matrix
+ * \param N The number of rows
+ * \param M The number of columns
+ */
+template <typename Op, typename T>
+void scan_columns(const T* in, T* out, size_t N, size_t M) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        if (in != out) {
+            std::copy(in + first, in + last, out + first);
+        }
+
+        for (size_t i = 1; i < N; ++i) {
+            scan_step_row<Op>(out + (i - 1) * M + first, in + i * M + first, out + i * M + first, last - first);
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, M, select_parallel(N * M) && M > 1);
+}
+
+/*!
+ * \brief Functor for the cumulative operation of a vector
+ * \tparam Op The scan operation
+ */
+template <typename Op>
+struct scan_impl {
+    /*!
+     * \brief Apply the cumulative operation on a and store the result in c
+     * \param a The input vector
+     * \param c The output vector
+     */
+    template <typename A, typename C, cpp_enable_if(all_dma<A, C>::value)>
+    static void apply(const A& a, C&& c) {
+        a.ensure_cpu_up_to_date();
+
+        scan_flat<Op>(a.memory_start(), c.memory_start(), etl::size(a));
+
+        c.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Apply the cumulative operation on a and store the result in c
+     * \param a The input vector
+     * \param c The output vector
+     */
+    template <typename A, typename C, cpp_disable_if(all_dma<A, C>::value)>
+    static void apply(const A& a, C&& c) {
+        auto carry = Op::template neutral<value_t<A>>();
+
+        for (size_t i = 0; i < etl::size(a); ++i) {
+            carry = Op::apply(carry, a[i]);
+            c[i]  = carry;
+        }
+    }
+};
+
+/*!
+ * \brief Functor for the cumulative operation along each row of a matrix
+ * \tparam Op The scan operation
+ */
+template <typename Op>
+struct scan_r_impl {
+    /*!
+     * \brief Apply the cumulative operation on a and store the result in c
+     * \param a The input matrix
+     * \param c The output matrix
+     */
+    template <typename A, typename C, cpp_enable_if(all_dma<A, C>::value && all_row_major<A, C>::value)>
+    static void apply(const A& a, C&& c) {
+        a.ensure_cpu_up_to_date();
+
+        scan_rows<Op>(a.memory_start(), c.memory_start(), etl::dim<0>(a), etl::dim<1>(a));
+
+        c.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Apply the cumulative operation on a and store the result in c
+     * \param a The input matrix
+     * \param c The output matrix
+     */
+    template <typename A, typename C, cpp_disable_if(all_dma<A, C>::value && all_row_major<A, C>::value)>
+    static void apply(const A& a, C&& c) {
+        for (size_t i = 0; i < etl::dim<0>(a); ++i) {
+            auto carry = Op::template neutral<value_t<A>>();
+
+            for (size_t j = 0; j < etl::dim<1>(a); ++j) {
+                carry   = Op::apply(carry, a(i, j));
+                c(i, j) = carry;
+            }
+        }
+    }
+};
+
+/*!
+ * \brief Functor for the cumulative operation along each column of a matrix
+ * \tparam Op The scan operation
+ */
+template <typename Op>
+struct scan_l_impl {
+    /*!
+     * \brief Apply the cumulative operation on a and store the result in c
+     * \param a The input matrix
+     * \param c The output matrix
+     */
+    template <typename A, typename C, cpp_enable_if(all_dma<A, C>::value && all_row_major<A, C>::value)>
+    static void apply(const A& a, C&& c) {
+        a.ensure_cpu_up_to_date();
+
+        scan_columns<Op>(a.memory_start(), c.memory_start(), etl::dim<0>(a), etl::dim<1>(a));
+
+        c.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Apply the cumulative operation on a and store the result in c
+     * \param a The input matrix
+     * \param c The output matrix
+     */
+    template <typename A, typename C, cpp_disable_if(all_dma<A, C>::value && all_row_major<A, C>::value)>
+    static void apply(const A& a, C&& c) {
+        for (size_t j = 0; j < etl::dim<1>(a); ++j) {
+            auto carry = Op::template neutral<value_t<A>>();
+
+            for (size_t i = 0; i < etl::dim<0>(a); ++i) {
+                carry   = Op::apply(carry, a(i, j));
+                c(i, j) = carry;
+            }
+        }
+    }
+};
+
+/*!
+ * \brief Functor for the integral image (summed-area table) of a matrix
+ */
+struct integral_image_impl {
+    /*!
+     * \brief Compute the integral image of a and store the result in c
+     * \param a The input matrix
+     * \param c The output matrix
+     */
+    template <typename A, typename C, cpp_enable_if(all_dma<A, C>::value && all_row_major<A, C>::value)>
+    static void apply(const A& a, C&& c) {
+        using op = impl::common::scan_sum_op;
+
+        a.ensure_cpu_up_to_date();
+
+        const size_t N = etl::dim<0>(a);
+        const size_t M = etl::dim<1>(a);
+
+        scan_rows<op>(a.memory_start(), c.memory_start(), N, M);
+        scan_columns<op>(c.memory_start(), c.memory_start(), N, M);
+
+        c.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Compute the integral image of a and store the result in c
+     * \param a The input matrix
+     * \param c The output matrix
+     */
+    template <typename A, typename C, cpp_disable_if(all_dma<A, C>::value && all_row_major<A, C>::value)>
+    static void apply(const A& a, C&& c) {
+        scan_r_impl<impl::common::scan_sum_op>::apply(a, c);
+
+        for (size_t i = 1; i < etl::dim<0>(a); ++i) {
+            for (size_t j = 0; j < etl::dim<1>(a); ++j) {
+                c(i, j) += c(i - 1, j);
+            }
+        }
+    }
+};
+
+} //end of namespace detail
+
+} //end of namespace etl
@@ -0,0 +1,207 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the batched inverse and determinant of
+ * small square matrices
+ *
+ * The matrices of the batch are contiguous and in row-major order. The
+ * matrices up to 4x4 use the closed-form kernels, the larger ones use an
+ * elimination with partial pivoting, whose loops are unrolled by the
+ * compiler when the dimension is known at compile-time.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Compute the inverse of the matrices [first, last) of the batch
+ * with the closed-form kernel
+ * \param a The input matrices
+ * \param c The output matrices
+ * \param first The first matrix
+ * \param last The end of the matrices
+ * \tparam N The dimension of the matrices
+ */
+template <size_t N, typename T>
+void batch_inv_closed(const T* a, T* c, size_t first, size_t last) {
+    for (size_t b = first; b < last; ++b) {
+        common::small_matrix_kernel<N>::inv(a + b * N * N, c + b * N * N);
+    }
+}
+
+/*!
+ * \brief Compute the determinant of the matrices [first, last) of the batch
+ * with the closed-form kernel
+ * \param a The input matrices
+ * \param d The output determinants
+ * \param first The first matrix
+ * \param last The end of the matrices
+ * \tparam N The dimension of the matrices
+ */
+template <size_t N, typename T>
+void batch_det_closed(const T* a, T* d, size_t first, size_t last) {
+    for (size_t b = first; b < last; ++b) {
+        d[b] = common::small_matrix_kernel<N>::det(a + b * N * N);
+    }
+}
+
+/*!
+ * \brief Compute the inverse of the matrix a with a Gauss-Jordan
+ * elimination with partial pivoting
+ * \param a The input matrix
+ * \param c The output matrix
+ * \param n The dimension of the matrix, either a size_t or a std::integral_constant
+ * \param m A working matrix of the same size
+ */
+template <typename T, typename S>
+void gauss_jordan_inv(const T* a, T* c, S n, T* m) {
+    std::copy_n(a, n * n, m);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            c[i * n + j] = i == j ? T(1) : T(0);
+        }
+    }
+
+    for (size_t k = 0; k < n; ++k) {
+        size_t p = k;
+
+        for (size_t i = k + 1; i < n; ++i) {
+            if (std::abs(m[i * n + k]) > std::abs(m[p * n + k])) {
+                p = i;
+            }
+        }
+
+        if (p != k) {
+            std::swap_ranges(m + k * n + k, m + k * n + n, m + p * n + k);
+            std::swap_ranges(c + k * n, c + k * n + n, c + p * n);
+        }
+
+        const T inv_pivot = T(1) / m[k * n + k];
+
+        for (size_t j = k + 1; j < n; ++j) {
+            m[k * n + j] *= inv_pivot;
+        }
+
+        for (size_t j = 0; j < n; ++j) {
+            c[k * n + j] *= inv_pivot;
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            const T f = m[i * n + k];
+
+            if (i == k || f == T(0)) {
+                continue;
+            }
+
+            for (size_t j = k + 1; j < n; ++j) {
+                m[i * n + j] -= f * m[k * n + j];
+            }
+
+            for (size_t j = 0; j < n; ++j) {
+                c[i * n + j] -= f * c[k * n + j];
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute the determinant of the matrix a with a LU decomposition
+ * with partial pivoting
+ * \param a The input matrix
+ * \param n The dimension of the matrix, either a size_t or a std::integral_constant
+ * \param m A working matrix of the same size
+ * \return the determinant of a
+ */
+template <typename T, typename S>
+T lu_det(const T* a, S n, T* m) {
+    std::copy_n(a, n * n, m);
+
+    T det(1);
+
+    for (size_t k = 0; k < n; ++k) {
+        size_t p = k;
+
+        for (size_t i = k + 1; i < n; ++i) {
+            if (std::abs(m[i * n + k]) > std::abs(m[p * n + k])) {
+                p = i;
+            }
+        }
+
+        if (m[p * n + k] == T(0)) {
+            return T(0);
+        }
+
+        if (p != k) {
+            std::swap_ranges(m + k * n + k, m + k * n + n, m + p * n + k);
+            det = -det;
+        }
+
+        const T pivot = m[k * n + k];
+
+        det *= pivot;
+
+        for (size_t i = k + 1; i < n; ++i) {
+            const T f = m[i * n + k] / pivot;
+
+            for (size_t j = k + 1; j < n; ++j) {
+                m[i * n + j] -= f * m[k * n + j];
+            }
+        }
+    }
+
+    return det;
+}
+
+/*!
+ * \brief Compute the inverse of the matrices [first, last) of the batch
+ * with a Gauss-Jordan elimination
+ * \param a The input matrices
+ * \param c The output matrices
+ * \param n The dimension of the matrices, either a size_t or a std::integral_constant
+ * \param first The first matrix
+ * \param last The end of the matrices
+ */
+template <typename T, typename S>
+void batch_inv_elimination(const T* a, T* c, S n, size_t first, size_t last) {
+    std::vector<T> m(n * n);
+
+    for (size_t b = first; b < last; ++b) {
+        gauss_jordan_inv(a + b * n * n, c + b * n * n, n, m.data());
+    }
+}
+
+/*!
+ * \brief Compute the determinant of the matrices [first, last) of the batch
+ * with a LU decomposition
+ * \param a The input matrices
+ * \param d The output determinants
+ * \param n The dimension of the matrices, either a size_t or a std::integral_constant
+ * \param first The first matrix
+ * \param last The end of the matrices
+ */
+template <typename T, typename S>
+void batch_det_elimination(const T* a, T* d, S n, size_t first, size_t last) {
+    std::vector<T> m(n * n);
+
+    for (size_t b = first; b < last; ++b) {
+        d[b] = lu_det(a + b * n * n, n, m.data());
+    }
+}
+
+} //end of namespace standard
+
+} //end of namespace impl
+
+} //end of namespace etl
@@ -98,7 +98,8 @@ void householder(AT& A, QT& Q, RT& R) {
     const auto m = etl::dim<0>(A);
     const auto n = etl::dim<1>(A);
 
-    std::vector<QT> q(m);
+    // Q is already m x m, which also gives the dimensions of dynamic matrices
+    std::vector<QT> q(m, Q);
 
     etl::dyn_matrix<T> z(m, n);
     z = A;
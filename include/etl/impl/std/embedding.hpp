@@ -0,0 +1,49 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the embedding row kernels
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Copy a row of n elements from in to out
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the row
+ */
+template <typename T>
+void copy_row(const T* in, T* out, size_t n) {
+    for (size_t j = 0; j < n; ++j) {
+        out[j] = in[j];
+    }
+}
+
+/*!
+ * \brief Add a row of n elements from in to out
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the row
+ */
+template <typename T>
+void add_row(const T* in, T* out, size_t n) {
+    for (size_t j = 0; j < n; ++j) {
+        out[j] += in[j];
+    }
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
@@ -0,0 +1,182 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the packed symmetric and triangular kernels
+ *
+ * The lower packed storage holds the rows of the lower triangle one after
+ * the other, (i, j) being at i * (i + 1) / 2 + j. The upper packed storage
+ * holds the columns of the upper triangle one after the other, (i, j)
+ * being at j * (j + 1) / 2 + i. In both cases, each stored row (or column)
+ * is contiguous and each element is read only once by the kernels.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Compute the dot product of two contiguous arrays
+ * \param a The first array
+ * \param b The second array
+ * \param n The number of elements
+ * \return the dot product of a and b
+ */
+template <typename T>
+T packed_dot(const T* a, const T* b, size_t n) {
+    T r1 = T();
+    T r2 = T();
+
+    size_t i = 0;
+
+    for (; i + 1 < n; i += 2) {
+        r1 += a[i] * b[i];
+        r2 += a[i + 1] * b[i + 1];
+    }
+
+    if (i < n) {
+        r1 += a[i] * b[i];
+    }
+
+    return r1 + r2;
+}
+
+/*!
+ * \brief Compute y += alpha * x on contiguous arrays
+ * \param alpha The scalar factor
+ * \param x The input array
+ * \param y The output array
+ * \param n The number of elements
+ */
+template <typename T>
+void packed_axpy(T alpha, const T* x, T* y, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+/*!
+ * \brief Compute y = A * x with A a symmetric matrix in lower packed storage
+ * \param ap The lower packed storage of A
+ * \param n The dimension of A
+ * \param x The input vector
+ * \param y The output vector
+ */
+template <typename T>
+void symv(const T* ap, size_t n, const T* x, T* y) {
+    for (size_t i = 0; i < n; ++i) {
+        const T* row = ap + i * (i + 1) / 2;
+
+        // The row i of the lower triangle is also the column i of the upper triangle
+        y[i] = packed_dot(row, x, i) + row[i] * x[i];
+        packed_axpy(x[i], row, y, i);
+    }
+}
+
+/*!
+ * \brief Compute y = A * x with A a lower triangular matrix in lower packed storage
+ * \param ap The lower packed storage of A
+ * \param n The dimension of A
+ * \param x The input vector
+ * \param y The output vector
+ */
+template <typename T>
+void trmv_lower(const T* ap, size_t n, const T* x, T* y) {
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = packed_dot(ap + i * (i + 1) / 2, x, i + 1);
+    }
+}
+
+/*!
+ * \brief Compute y = A * x with A an upper triangular matrix in upper packed storage
+ * \param ap The upper packed storage of A
+ * \param n The dimension of A
+ * \param x The input vector
+ * \param y The output vector
+ */
+template <typename T>
+void trmv_upper(const T* ap, size_t n, const T* x, T* y) {
+    std::fill_n(y, n, T());
+
+    for (size_t j = 0; j < n; ++j) {
+        packed_axpy(x[j], ap + j * (j + 1) / 2, y, j + 1);
+    }
+}
+
+/*!
+ * \brief Compute C = A * B with A a lower triangular matrix in lower packed
+ * storage and B and C row-major matrices
+ * \param ap The lower packed storage of A
+ * \param n The dimension of A
+ * \param b The B matrix (n x k)
+ * \param k The number of columns of B
+ * \param c The C matrix (n x k)
+ */
+template <typename T>
+void trmm_lower(const T* ap, size_t n, const T* b, size_t k, T* c) {
+    std::fill_n(c, n * k, T());
+
+    for (size_t i = 0; i < n; ++i) {
+        const T* row = ap + i * (i + 1) / 2;
+
+        for (size_t l = 0; l <= i; ++l) {
+            packed_axpy(row[l], b + l * k, c + i * k, k);
+        }
+    }
+}
+
+/*!
+ * \brief Compute C = A * B with A an upper triangular matrix in upper packed
+ * storage and B and C row-major matrices
+ * \param ap The upper packed storage of A
+ * \param n The dimension of A
+ * \param b The B matrix (n x k)
+ * \param k The number of columns of B
+ * \param c The C matrix (n x k)
+ */
+template <typename T>
+void trmm_upper(const T* ap, size_t n, const T* b, size_t k, T* c) {
+    std::fill_n(c, n * k, T());
+
+    for (size_t j = 0; j < n; ++j) {
+        const T* col = ap + j * (j + 1) / 2;
+
+        for (size_t i = 0; i <= j; ++i) {
+            packed_axpy(col[i], b + j * k, c + i * k, k);
+        }
+    }
+}
+
+/*!
+ * \brief Compute C = A * A^T with A a row-major matrix and C a symmetric
+ * matrix in lower packed storage
+ * \param a The A matrix (n x k)
+ * \param n The number of rows of A
+ * \param k The number of columns of A
+ * \param cp The lower packed storage of C
+ */
+template <typename T>
+void syrk(const T* a, size_t n, size_t k, T* cp) {
+    for (size_t i = 0; i < n; ++i) {
+        T* row = cp + i * (i + 1) / 2;
+
+        for (size_t j = 0; j <= i; ++j) {
+            row[j] = packed_dot(a + i * k, a + j * k, k);
+        }
+    }
+}
+
+} //end of namespace standard
+
+} //end of namespace impl
+
+} //end of namespace etl
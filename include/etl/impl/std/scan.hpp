@@ -0,0 +1,71 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the cumulative (scan) row kernels
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Inclusive scan of a row
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the row
+ * \param carry The value to combine with the first element
+ * \return The last value of the scan
+ * \tparam Op The scan operation
+ */
+template <typename Op, typename T>
+T scan_row(const T* in, T* out, size_t n, T carry) {
+    for (size_t j = 0; j < n; ++j) {
+        carry  = Op::apply(carry, in[j]);
+        out[j] = carry;
+    }
+
+    return carry;
+}
+
+/*!
+ * \brief Combine a row with the previous row of the scan, out = prev op in
+ * \param prev The previous row of the scan
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the rows
+ * \tparam Op The scan operation
+ */
+template <typename Op, typename T>
+void scan_step_row(const T* prev, const T* in, T* out, size_t n) {
+    for (size_t j = 0; j < n; ++j) {
+        out[j] = Op::apply(prev[j], in[j]);
+    }
+}
+
+/*!
+ * \brief Combine a value with each element of a row, out = value op out
+ * \param out The row
+ * \param n The number of elements of the row
+ * \param value The value to combine
+ * \tparam Op The scan operation
+ */
+template <typename Op, typename T>
+void scan_offset_row(T* out, size_t n, T value) {
+    for (size_t j = 0; j < n; ++j) {
+        out[j] = Op::apply(value, out[j]);
+    }
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
@@ -0,0 +1,158 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the structure-aware matrix-matrix
+ * multiplication
+ *
+ * All the matrices are in row-major order. Each row of the result is
+ * computed as a sum of scaled rows, only the rows (or the parts of rows)
+ * that can be non-zero in the structured matrix are read.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Compute y = alpha * x on contiguous arrays
+ * \param alpha The scalar factor
+ * \param x The input array
+ * \param y The output array
+ * \param n The number of elements
+ */
+template <typename T>
+void row_scal(T alpha, const T* x, T* y, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = alpha * x[i];
+    }
+}
+
+/*!
+ * \brief Compute y += alpha * x on contiguous arrays
+ * \param alpha The scalar factor
+ * \param x The input array
+ * \param y The output array
+ * \param n The number of elements
+ */
+template <typename T>
+void row_axpy(T alpha, const T* x, T* y, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+/*!
+ * \brief Compute C = A * B for the columns [first, last) of C, with A a
+ * structured square matrix
+ *
+ * The work is split by columns since the number of non-zero elements of
+ * the rows of a triangular A is not balanced.
+ *
+ * \param s The structure of A
+ * \param a The A matrix (n x n)
+ * \param b The B matrix (n x k)
+ * \param c The C matrix (n x k)
+ * \param n The dimension of A
+ * \param k The number of columns of B
+ * \param first The first column to compute
+ * \param last The end of the columns to compute
+ */
+template <typename T>
+void structured_gemm_left(common::mm_structure s, const T* a, const T* b, T* c, size_t n, size_t k, size_t first, size_t last) {
+    const size_t block = common::structured_block<T>(n);
+
+    // The columns are processed by blocks to keep the used part of B in cache
+    for (size_t jj = first; jj < last; jj += block) {
+        const size_t w = std::min(block, last - jj);
+
+        for (size_t i = 0; i < n; ++i) {
+            auto band = common::structure_band(s, n, i);
+
+            const T* ai = a + i * n;
+            T* ci       = c + i * k + jj;
+
+            if (band.first == band.second) {
+                std::fill_n(ci, w, T(0));
+                continue;
+            }
+
+            row_scal(ai[band.first], b + band.first * k + jj, ci, w);
+
+            for (size_t l = band.first + 1; l < band.second; ++l) {
+                row_axpy(ai[l], b + l * k + jj, ci, w);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute C = A * D for the rows [first, last) of C, with D a
+ * diagonal matrix
+ * \param a The A matrix (m x n)
+ * \param d The diagonal of D (n)
+ * \param c The C matrix (m x n)
+ * \param n The dimension of D
+ * \param first The first row to compute
+ * \param last The end of the rows to compute
+ */
+template <typename T>
+void diagonal_gemm_right(const T* a, const T* d, T* c, size_t n, size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+        const T* ai = a + i * n;
+        T* ci       = c + i * n;
+
+        for (size_t j = 0; j < n; ++j) {
+            ci[j] = ai[j] * d[j];
+        }
+    }
+}
+
+/*!
+ * \brief Compute C = A * B for the rows [first, last) of C, with B a
+ * triangular matrix
+ * \param s The structure of B, which cannot be diagonal
+ * \param a The A matrix (m x n)
+ * \param b The B matrix (n x n)
+ * \param c The C matrix (m x n)
+ * \param n The dimension of B
+ * \param first The first row to compute
+ * \param last The end of the rows to compute
+ */
+template <typename T>
+void structured_gemm_right(common::mm_structure s, const T* a, const T* b, T* c, size_t n, size_t first, size_t last) {
+    const size_t block = common::structured_block<T>(n);
+
+    std::fill_n(c + first * n, (last - first) * n, T(0));
+
+    // The rows of B are processed by blocks to keep them in cache
+    for (size_t ll = 0; ll < n; ll += block) {
+        const size_t ll_end = std::min(ll + block, n);
+
+        for (size_t i = first; i < last; ++i) {
+            const T* ai = a + i * n;
+            T* ci       = c + i * n;
+
+            for (size_t l = ll; l < ll_end; ++l) {
+                auto band = common::structure_band(s, n, l);
+
+                row_axpy(ai[l], b + l * n + band.first, ci + band.first, band.second - band.first);
+            }
+        }
+    }
+}
+
+} //end of namespace standard
+
+} //end of namespace impl
+
+} //end of namespace etl
@@ -0,0 +1,45 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the top-k selection of a row
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Select the k largest elements of a row
+ *
+ * At the end, the heap contains the selected elements sorted by
+ * decreasing values.
+ *
+ * \param in The input row
+ * \param n The number of elements of the row
+ * \param k The number of elements to select
+ * \param heap The heap, with space for k elements
+ */
+template <typename T>
+void topk_row(const T* in, size_t n, size_t k, std::pair<T, size_t>* heap) {
+    common::topk_init(heap, in, k);
+
+    for (size_t j = k; j < n; ++j) {
+        common::topk_push(heap, k, in[j], j);
+    }
+
+    common::topk_sort(heap, k);
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
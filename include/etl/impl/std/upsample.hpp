@@ -0,0 +1,55 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the upsampling row kernels
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Upsample a row of n elements, each element of in is replicated c
+ * times in out
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the input row
+ * \param c The upsampling factor
+ */
+template <typename T>
+void upsample_row(const T* in, T* out, size_t n, size_t c) {
+    for (size_t k = 0; k < n; ++k) {
+        for (size_t kk = 0; kk < c; ++kk) {
+            out[k * c + kk] = in[k];
+        }
+    }
+}
+
+/*!
+ * \brief Linear interpolation of two rows, out = a + l * (b - a)
+ * \param a The first row
+ * \param b The second row
+ * \param out The output row
+ * \param n The number of elements of the rows
+ * \param l The interpolation weight of the second row
+ */
+template <typename T>
+void lerp_row(const T* a, const T* b, T* out, size_t n, T l) {
+    for (size_t j = 0; j < n; ++j) {
+        out[j] = a[j] + l * (b[j] - a[j]);
+    }
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
@@ -0,0 +1,166 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the structure-aware matrix-matrix multiplication of
+ * diagonal and triangular matrices
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/common/structured_gemm.hpp"
+#include "etl/impl/std/structured_gemm.hpp"
+#include "etl/impl/vec/structured_gemm.hpp"
+#include "etl/impl/blas/gemm.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Returns the zero structure of the given diagonal or triangular
+ * matrix type
+ */
+template <typename M>
+constexpr impl::common::mm_structure mm_structure_of() {
+    return is_diagonal_matrix<M>::value ? impl::common::mm_structure::DIAGONAL
+         : is_strictly_lower_matrix<M>::value ? impl::common::mm_structure::STRICTLY_LOWER
+         : (is_lower_matrix<M>::value || is_uni_lower_matrix<M>::value) ? impl::common::mm_structure::LOWER
+         : is_strictly_upper_matrix<M>::value ? impl::common::mm_structure::STRICTLY_UPPER
+         : impl::common::mm_structure::UPPER;
+}
+
+/*!
+ * \brief Indicates if the given structure is lower triangular
+ */
+constexpr bool is_lower_structure(impl::common::mm_structure s) {
+    return s == impl::common::mm_structure::LOWER || s == impl::common::mm_structure::STRICTLY_LOWER;
+}
+
+/*!
+ * \brief Functor for the matrix-matrix multiplication with a diagonal or
+ * triangular matrix.
+ *
+ * Only the elements that can be non-zero in the structured matrix are
+ * used: the product with a diagonal matrix is a scaling of the rows (or
+ * the columns) in O(n^2) and the products with a triangular matrix skip
+ * the zero triangle. When BLAS is available, the products with a
+ * triangular matrix are computed by TRMM.
+ */
+struct structured_mm_mul_impl {
+    /*!
+     * \brief Compute C = A * B, with A a diagonal or triangular matrix
+     * \param a The A matrix
+     * \param b The B matrix
+     * \param c The C matrix (output)
+     */
+    template <typename A, typename B, typename C, cpp_enable_if(is_structured_matrix<A>::value && is_dma<C>::value && decay_traits<C>::storage_order == order::RowMajor)>
+    static void apply_raw(A&& a, B&& b, C&& c) {
+        using T = value_t<A>;
+
+        static constexpr auto s = mm_structure_of<A>();
+
+        if (cblas_enabled && s != impl::common::mm_structure::DIAGONAL) {
+            impl::blas::trmm_left(a, b, c, is_lower_structure(s));
+            return;
+        }
+
+        const size_t n = etl::dim<0>(a);
+        const size_t k = etl::dim<1>(b);
+
+        safe_ensure_cpu_up_to_date(a);
+        safe_ensure_cpu_up_to_date(b);
+
+        const T* ap = a.memory_start();
+        const T* bp = b.memory_start();
+        T* cp       = c.memory_start();
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            if (vec_impl_enabled<T>()) {
+                impl::vec::structured_gemm_left<default_vec>(s, ap, bp, cp, n, k, first, last);
+            } else {
+                impl::standard::structured_gemm_left(s, ap, bp, cp, n, k, first, last);
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, 0, k, select_parallel(n * k) && k > 1);
+
+        c.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Compute C = A * B, with B a diagonal or triangular matrix
+     * \param a The A matrix
+     * \param b The B matrix
+     * \param c The C matrix (output)
+     */
+    template <typename A, typename B, typename C, cpp_enable_if(!is_structured_matrix<A>::value && is_dma<C>::value && decay_traits<C>::storage_order == order::RowMajor)>
+    static void apply_raw(A&& a, B&& b, C&& c) {
+        using T = value_t<A>;
+
+        static constexpr auto s = mm_structure_of<B>();
+
+        if (cblas_enabled && s != impl::common::mm_structure::DIAGONAL) {
+            impl::blas::trmm_right(a, b, c, is_lower_structure(s));
+            return;
+        }
+
+        const size_t m = etl::dim<0>(a);
+        const size_t n = etl::dim<1>(a);
+
+        safe_ensure_cpu_up_to_date(a);
+        safe_ensure_cpu_up_to_date(b);
+
+        const T* ap = a.memory_start();
+        const T* bp = b.memory_start();
+        T* cp       = c.memory_start();
+
+        std::vector<T> d(s == impl::common::mm_structure::DIAGONAL ? n : 0);
+
+        for (size_t j = 0; j < d.size(); ++j) {
+            d[j] = bp[j * n + j];
+        }
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            if (vec_impl_enabled<T>()) {
+                if (s == impl::common::mm_structure::DIAGONAL) {
+                    impl::vec::diagonal_gemm_right<default_vec>(ap, d.data(), cp, n, first, last);
+                } else {
+                    impl::vec::structured_gemm_right<default_vec>(s, ap, bp, cp, n, first, last);
+                }
+            } else {
+                if (s == impl::common::mm_structure::DIAGONAL) {
+                    impl::standard::diagonal_gemm_right(ap, d.data(), cp, n, first, last);
+                } else {
+                    impl::standard::structured_gemm_right(s, ap, bp, cp, n, first, last);
+                }
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, 0, m, select_parallel(m * n) && m > 1);
+
+        c.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Compute C = A * B when C is not a row-major matrix with direct
+     * memory access, with the general matrix-matrix multiplication
+     * \param a The A matrix
+     * \param b The B matrix
+     * \param c The C matrix (output)
+     */
+    template <typename A, typename B, typename C, cpp_enable_if(!(is_dma<C>::value && decay_traits<C>::storage_order == order::RowMajor))>
+    static void apply_raw(A&& a, B&& b, C&& c) {
+        mm_mul_impl::apply_raw(std::forward<A>(a), std::forward<B>(b), std::forward<C>(c));
+    }
+};
+
+} //end of namespace detail
+
+} //end of namespace etl
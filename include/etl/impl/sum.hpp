@@ -32,6 +32,15 @@ namespace etl {
 
 namespace detail {
 
+/*!
+ * \brief Indicates if the VEC sum implementation can be used for an
+ * expression of type E
+ */
+template <typename E>
+constexpr bool sum_vec_possible() {
+    return vec_enabled && all_vectorizable<vector_mode, E>::value && default_intrinsic_traits<value_t<E>>::vectorizable;
+}
+
 /*!
  * \brief Select the sum implementation for an expression of type E
  *
@@ -49,56 +58,74 @@ cpp14_constexpr etl::sum_impl select_default_sum_impl(bool gpu_up_to_date) {
         return etl::sum_impl::CUBLAS;
     }
 
-    if (vec_enabled && all_vectorizable<vector_mode, E>::value) {
+    if (sum_vec_possible<E>()) {
         return etl::sum_impl::VEC;
     }
 
     return etl::sum_impl::STD;
 }
 
+/*!
+ * \brief Returns the candidate bits of the sum implementations that can be
+ * used for an expression of type E
+ */
+template <typename E>
+constexpr size_t sum_candidates() {
+    return impl_bit(etl::sum_impl::STD)
+         | impl_bit(etl::sum_impl::VEC, sum_vec_possible<E>())
+         | impl_bit(etl::sum_impl::BLAS, cblas_enabled && all_dma<E>::value && all_floating<E>::value)
+         | impl_bit(etl::sum_impl::CUBLAS, cublas_enabled && all_dma<E>::value && all_floating<E>::value);
+}
+
 /*!
  * \brief Select the sum implementation for an expression of type E
  * \tparam E The type of expression
+ * \param n The size of the expression
+ * \param gpu_up_to_date Indicates if the GPU memory of the expression is up to date
  * \return The implementation to use
  */
 template <typename E>
-etl::sum_impl select_sum_impl(bool gpu_up_to_date) {
+etl::sum_impl select_sum_impl(size_t n, bool gpu_up_to_date) {
+    static selection_site<etl::sum_impl> site("sum");
+
+    constexpr size_t candidates = sum_candidates<E>();
+
     if (local_context().sum_selector.forced) {
         auto forced = local_context().sum_selector.impl;
 
         switch (forced) {
             //VEC cannot always be used
             case sum_impl::VEC:
-                if (!vec_enabled || !decay_traits<E>::template vectorizable<vector_mode>::value) {                                //COVERAGE_EXCLUDE_LINE
+                if (!sum_vec_possible<E>()) {                                                                                      //COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to VEC sum implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
-                    return select_default_sum_impl<E>(gpu_up_to_date);                                                                          //COVERAGE_EXCLUDE_LINE
+                    return log_selection(site, {n}, candidates, select_default_sum_impl<E>(gpu_up_to_date), selection_reason::UNAVAILABLE); //COVERAGE_EXCLUDE_LINE
                 }                                                                                                                 //COVERAGE_EXCLUDE_LINE
 
-                return forced;
+                return log_selection(site, {n}, candidates, forced, selection_reason::FORCED);
 
             case sum_impl::CUBLAS:
                 if (!cublas_enabled || !all_dma<E>::value || !all_floating<E>::value) {                                //COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to CUBLAS sum implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
-                    return select_default_sum_impl<E>(gpu_up_to_date);                                                                          //COVERAGE_EXCLUDE_LINE
+                    return log_selection(site, {n}, candidates, select_default_sum_impl<E>(gpu_up_to_date), selection_reason::UNAVAILABLE); //COVERAGE_EXCLUDE_LINE
                 }                                                                                                                 //COVERAGE_EXCLUDE_LINE
 
-                return forced;
+                return log_selection(site, {n}, candidates, forced, selection_reason::FORCED);
 
             case sum_impl::BLAS:
                 if (!cblas_enabled || !all_dma<E>::value || !all_floating<E>::value) {                                //COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to BLAS sum implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
-                    return select_default_sum_impl<E>(gpu_up_to_date);                                                                          //COVERAGE_EXCLUDE_LINE
+                    return log_selection(site, {n}, candidates, select_default_sum_impl<E>(gpu_up_to_date), selection_reason::UNAVAILABLE); //COVERAGE_EXCLUDE_LINE
                 }                                                                                                                 //COVERAGE_EXCLUDE_LINE
 
-                return forced;
+                return log_selection(site, {n}, candidates, forced, selection_reason::FORCED);
 
             //In other cases, simply use the forced impl
             default:
-                return forced;
+                return log_selection(site, {n}, candidates, forced, selection_reason::FORCED);
         }
     }
 
-    return select_default_sum_impl<E>(gpu_up_to_date);
+    return log_selection(site, {n}, candidates, select_default_sum_impl<E>(gpu_up_to_date), selection_reason::HEURISTIC);
 }
 
 /*!
@@ -114,7 +141,9 @@ struct sum_impl {
     static value_t<E> apply(const E& e) {
         using T = value_t<E>;
 
-        auto impl = select_sum_impl<E>(safe_is_gpu_up_to_date(e));
+        auto impl = select_sum_impl<E>(etl::size(e), safe_is_gpu_up_to_date(e));
+
+        detail::profile_scope profile("sum", impl_name(impl), etl::size(e) * sizeof(value_t<E>), etl::size(e));
 
         T acc(0);
 
@@ -144,7 +173,9 @@ struct sum_impl {
      */
     template <typename E>
     static value_t<E> apply(const E& e) {
-        const auto impl = select_sum_impl<E>(safe_is_gpu_up_to_date(e));
+        const auto impl = select_sum_impl<E>(etl::size(e), safe_is_gpu_up_to_date(e));
+
+        detail::profile_scope profile("sum", impl_name(impl), etl::size(e) * sizeof(value_t<E>), etl::size(e));
 
         if (impl == etl::sum_impl::VEC) {
             return impl::vec::sum(e);
@@ -172,7 +203,9 @@ struct asum_impl {
     static value_t<E> apply(const E& e) {
         using T = value_t<E>;
 
-        auto impl = select_sum_impl<E>(safe_is_gpu_up_to_date(e));
+        auto impl = select_sum_impl<E>(etl::size(e), safe_is_gpu_up_to_date(e));
+
+        detail::profile_scope profile("asum", impl_name(impl), etl::size(e) * sizeof(value_t<E>), etl::size(e));
 
         T acc(0);
 
@@ -202,7 +235,9 @@ struct asum_impl {
      */
     template <typename E>
     static value_t<E> apply(const E& e) {
-        const auto impl = select_sum_impl<E>(safe_is_gpu_up_to_date(e));
+        const auto impl = select_sum_impl<E>(etl::size(e), safe_is_gpu_up_to_date(e));
+
+        detail::profile_scope profile("asum", impl_name(impl), etl::size(e) * sizeof(value_t<E>), etl::size(e));
 
         if (impl == etl::sum_impl::VEC) {
             return impl::vec::asum(e);
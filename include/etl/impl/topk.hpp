@@ -0,0 +1,127 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the row-wise top-k selection implementations
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/common/topk.hpp"
+#include "etl/impl/std/topk.hpp"
+#include "etl/impl/vec/topk.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Functor for the row-wise top-k selection
+ */
+struct topk_impl {
+    /*!
+     * \brief Select the k largest elements of each row of a
+     * \param a The input matrix
+     * \param k The number of elements to select per row
+     * \param values The output values
+     * \param indices The output indices
+     */
+    template <typename A, typename V, typename I>
+    static void apply(const A& a, size_t k, V&& values, I&& indices) {
+        using T = value_t<A>;
+
+        constexpr bool row_major = decay_traits<A>::storage_order == order::RowMajor;
+
+        const size_t N = etl::dim<0>(a);
+        const size_t M = etl::dim<1>(a);
+
+        safe_ensure_cpu_up_to_date(a);
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            std::vector<std::pair<T, size_t>> heap(k);
+            std::vector<T> row(row_major ? 0 : M);
+
+            for (size_t i = first; i < last; ++i) {
+                const T* in;
+
+                if (row_major) {
+                    in = a.memory_start() + i * M;
+                } else {
+                    for (size_t j = 0; j < M; ++j) {
+                        row[j] = a(i, j);
+                    }
+
+                    in = row.data();
+                }
+
+                if (vec_impl_enabled<T>() && std::is_floating_point<T>::value) {
+                    impl::vec::topk_row(in, M, k, heap.data());
+                } else {
+                    impl::standard::topk_row(in, M, k, heap.data());
+                }
+
+                for (size_t j = 0; j < k; ++j) {
+                    values(i, j)  = heap[j].first;
+                    indices(i, j) = heap[j].second;
+                }
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, 0, N, select_parallel(N * M) && N > 1);
+    }
+};
+
+} //end of namespace detail
+
+/*!
+ * \brief Select the k largest elements of each row of the given matrix.
+ *
+ * The selected elements of each row are sorted by decreasing values, ties
+ * being broken by increasing indices.
+ *
+ * \param a The input matrix (N x M)
+ * \param k The number of elements to select per row
+ * \param values The selected values (N x k)
+ * \param indices The indices of the selected values (N x k)
+ */
+template <typename A, typename V, typename I>
+void topk(A&& a, size_t k, V&& values, I&& indices) {
+    static_assert(is_2d<A>::value && is_2d<V>::value && is_2d<I>::value, "topk is only implemented for matrices");
+    static_assert(std::is_same<value_t<A>, value_t<V>>::value, "topk values must be of the same type as the input");
+
+    cpp_assert(k > 0 && k <= etl::dim<1>(a), "Invalid number of elements for topk");
+    cpp_assert(etl::dim<0>(values) == etl::dim<0>(a) && etl::dim<1>(values) == k, "Invalid dimensions for topk values");
+    cpp_assert(etl::dim<0>(indices) == etl::dim<0>(a) && etl::dim<1>(indices) == k, "Invalid dimensions for topk indices");
+
+    standard_evaluator::pre_assign_rhs(a);
+
+    detail::topk_impl::apply(make_temporary(a), k, values, indices);
+}
+
+/*!
+ * \brief Select the k largest elements of each row of the given matrix.
+ *
+ * The selected elements of each row are sorted by decreasing values, ties
+ * being broken by increasing indices.
+ *
+ * \param a The input matrix (N x M)
+ * \param k The number of elements to select per row
+ * \return a pair with the selected values (N x k) and their indices (N x k)
+ */
+template <typename A>
+std::pair<dyn_matrix<value_t<A>, 2>, dyn_matrix<size_t, 2>> topk(A&& a, size_t k) {
+    dyn_matrix<value_t<A>, 2> values(etl::dim<0>(a), k);
+    dyn_matrix<size_t, 2> indices(etl::dim<0>(a), k);
+
+    topk(a, k, values, indices);
+
+    return std::make_pair(std::move(values), std::move(indices));
+}
+
+} //end of namespace etl
@@ -7,11 +7,90 @@
 
 #pragma once
 
+//Include the row kernels
+#include "etl/impl/std/embedding.hpp"
+#include "etl/impl/vec/embedding.hpp"
+#include "etl/impl/std/upsample.hpp"
+#include "etl/impl/vec/upsample.hpp"
+
 namespace etl {
 
-namespace impl {
+namespace detail {
+
+/*!
+ * \brief Upsample a row, with the best available kernel
+ */
+template <typename T, cpp_enable_if(vec_impl_enabled<T>())>
+void upsample_row(const T* in, T* out, size_t n, size_t c) {
+    impl::vec::upsample_row(in, out, n, c);
+}
+
+/*!
+ * \copydoc upsample_row
+ */
+template <typename T, cpp_disable_if(vec_impl_enabled<T>())>
+void upsample_row(const T* in, T* out, size_t n, size_t c) {
+    impl::standard::upsample_row(in, out, n, c);
+}
+
+/*!
+ * \brief Copy a row, with the best available kernel
+ */
+template <typename T, cpp_enable_if(vec_impl_enabled<T>())>
+void upsample_copy_row(const T* in, T* out, size_t n) {
+    impl::vec::copy_row(in, out, n);
+}
 
-// TODO Optimize upsampling like max pooling upsampling was optimized
+/*!
+ * \copydoc upsample_copy_row
+ */
+template <typename T, cpp_disable_if(vec_impl_enabled<T>())>
+void upsample_copy_row(const T* in, T* out, size_t n) {
+    impl::standard::copy_row(in, out, n);
+}
+
+/*!
+ * \brief Interpolate two rows, with the best available kernel
+ */
+template <typename T, cpp_enable_if(vec_impl_enabled<T>())>
+void upsample_lerp_row(const T* a, const T* b, T* out, size_t n, T l) {
+    impl::vec::lerp_row(a, b, out, n, l);
+}
+
+/*!
+ * \copydoc upsample_lerp_row
+ */
+template <typename T, cpp_disable_if(vec_impl_enabled<T>())>
+void upsample_lerp_row(const T* a, const T* b, T* out, size_t n, T l) {
+    impl::standard::lerp_row(a, b, out, n, l);
+}
+
+/*!
+ * \brief Compute the source position of an output position for bilinear
+ * upsampling, with the centers of the pixels aligned
+ * \param o The output position
+ * \param c The upsampling factor
+ * \param n The input dimension
+ * \param i0 The first input position
+ * \param i1 The second input position
+ * \param l The weight of the second input position
+ */
+template <typename T>
+void bilinear_source(size_t o, size_t c, size_t n, size_t& i0, size_t& i1, T& l) {
+    double src = (o + 0.5) / c - 0.5;
+
+    if (src < 0.0) {
+        src = 0.0;
+    }
+
+    i0 = std::min(size_t(src), n - 1);
+    i1 = std::min(i0 + 1, n - 1);
+    l  = T(src - double(i0));
+}
+
+} //end of namespace detail
+
+namespace impl {
 
 /*!
  * \brief Functor for 2D Upsampling
@@ -43,7 +122,7 @@ struct upsample_2d {
      * \tparam C1 The first dimension pooling ratio
      * \tparam C2 The second dimension pooling ratio
      */
-    template <size_t C1, size_t C2, typename A, typename M, cpp_enable_if(is_2d<A>::value)>
+    template <size_t C1, size_t C2, typename A, typename M, cpp_enable_if(is_2d<A>::value && !(all_dma<A, M>::value && all_row_major<A, M>::value))>
     static void apply(A&& in, M&& m) {
         for (size_t j = 0; j < etl::dim<0>(in); ++j) {
             for (size_t k = 0; k < etl::dim<1>(in); ++k) {
@@ -78,7 +157,7 @@ struct upsample_2d {
      * \param c1 The first dimension pooling ratio
      * \param c2 The second dimension pooling ratio
      */
-    template <typename A, typename M, cpp_enable_if(is_2d<A>::value)>
+    template <typename A, typename M, cpp_enable_if(is_2d<A>::value && !(all_dma<A, M>::value && all_row_major<A, M>::value))>
     static void apply(A&& in, M&& m, size_t c1, size_t c2) {
         for (size_t j = 0; j < etl::dim<0>(in); ++j) {
             for (size_t k = 0; k < etl::dim<1>(in); ++k) {
@@ -96,7 +175,7 @@ struct upsample_2d {
      * \tparam C1 The first dimension pooling ratio
      * \tparam C2 The second dimension pooling ratio
      */
-    template <size_t C1, size_t C2, typename A, typename M, cpp_enable_if(!is_2d<A>::value)>
+    template <size_t C1, size_t C2, typename A, typename M, cpp_enable_if(!is_2d<A>::value && !(all_dma<A, M>::value && all_row_major<A, M>::value))>
     static void apply(A&& in, M& m) {
         for (size_t i = 0; i < etl::dim<0>(in); ++i) {
             apply<C1, C2>(in(i), m(i));
@@ -110,12 +189,69 @@ struct upsample_2d {
      * \param c1 The first dimension pooling ratio
      * \param c2 The second dimension pooling ratio
      */
-    template <typename A, typename M, cpp_enable_if(!is_2d<A>::value)>
+    template <typename A, typename M, cpp_enable_if(!is_2d<A>::value && !(all_dma<A, M>::value && all_row_major<A, M>::value))>
     static void apply(A&& in, M& m, size_t c1, size_t c2) {
         for (size_t i = 0; i < etl::dim<0>(in); ++i) {
             apply(in(i), m(i), c1, c2);
         }
     }
+
+    // Direct memory handling
+
+    /*!
+     * \brief Apply the functor on sub and store the result in m
+     *
+     * The matrices are seen as a sequence of 2D planes (batch and channels)
+     * and the output is computed row by row, in parallel. Each input row is
+     * upsampled in the first row of its block and the other rows of the
+     * block are copies of this first row.
+     *
+     * \param in The sub expression
+     * \param m The storage matrix
+     * \param c1 The first dimension pooling ratio
+     * \param c2 The second dimension pooling ratio
+     */
+    template <typename A, typename M, cpp_enable_if(all_dma<A, M>::value && all_row_major<A, M>::value)>
+    static void apply(A&& in, M&& m, size_t c1, size_t c2) {
+        const size_t W  = etl::dim(in, decay_traits<A>::dimensions() - 1);
+        const size_t OW = W * c2;
+
+        // The number of input rows, in all the planes
+        const size_t R = etl::size(in) / W;
+
+        in.ensure_cpu_up_to_date();
+
+        const auto* ss = in.memory_start();
+        auto* mm       = m.memory_start();
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t r = first; r < last; ++r) {
+                auto* out = mm + r * c1 * OW;
+
+                detail::upsample_row(ss + r * W, out, W, c2);
+
+                for (size_t jj = 1; jj < c1; ++jj) {
+                    detail::upsample_copy_row(out, out + jj * OW, OW);
+                }
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, 0, R, select_parallel(etl::size(m)) && R > 1);
+
+        m.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Apply the functor on sub and store the result in m
+     * \param in The sub expression
+     * \param m The storage matrix
+     * \tparam C1 The first dimension pooling ratio
+     * \tparam C2 The second dimension pooling ratio
+     */
+    template <size_t C1, size_t C2, typename A, typename M, cpp_enable_if(all_dma<A, M>::value && all_row_major<A, M>::value)>
+    static void apply(A&& in, M&& m) {
+        apply(in, m, C1, C2);
+    }
 };
 
 /*!
@@ -154,7 +290,7 @@ struct upsample_3d {
      * \tparam C2 The second dimension pooling ratio
      * \tparam C3 The third dimension pooling ratio
      */
-    template <size_t C1, size_t C2, size_t C3, typename A, typename M, cpp_enable_if(is_3d<A>::value)>
+    template <size_t C1, size_t C2, size_t C3, typename A, typename M, cpp_enable_if(is_3d<A>::value && !(all_dma<A, M>::value && all_row_major<A, M>::value))>
     static void apply(A&& in, M&& m) {
         for (size_t i = 0; i < etl::dim<0>(in); ++i) {
             for (size_t j = 0; j < etl::dim<1>(in); ++j) {
@@ -197,7 +333,7 @@ struct upsample_3d {
      * \param c2 The second dimension pooling ratio
      * \param c3 The third dimension pooling ratio
      */
-    template <typename A, typename M, cpp_enable_if(is_3d<A>::value)>
+    template <typename A, typename M, cpp_enable_if(is_3d<A>::value && !(all_dma<A, M>::value && all_row_major<A, M>::value))>
     static void apply(A&& in, M&& m, size_t c1, size_t c2, size_t c3) {
         for (size_t i = 0; i < etl::dim<0>(in); ++i) {
             for (size_t j = 0; j < etl::dim<1>(in); ++j) {
@@ -218,7 +354,7 @@ struct upsample_3d {
      * \tparam C2 The second dimension pooling ratio
      * \tparam C3 The third dimension pooling ratio
      */
-    template <size_t C1, size_t C2, size_t C3, typename A, typename M, cpp_enable_if(!is_3d<A>::value)>
+    template <size_t C1, size_t C2, size_t C3, typename A, typename M, cpp_enable_if(!is_3d<A>::value && !(all_dma<A, M>::value && all_row_major<A, M>::value))>
     static void apply(A&& in, M& m) {
         for (size_t i = 0; i < etl::dim<0>(in); ++i) {
             apply<C1, C2, C3>(in(i), m(i));
@@ -233,12 +369,181 @@ struct upsample_3d {
      * \param c2 The second dimension pooling ratio
      * \param c3 The third dimension pooling ratio
      */
-    template <typename A, typename M, cpp_enable_if(!is_3d<A>::value)>
+    template <typename A, typename M, cpp_enable_if(!is_3d<A>::value && !(all_dma<A, M>::value && all_row_major<A, M>::value))>
     static void apply(A&& in, M& m, size_t c1, size_t c2, size_t c3) {
         for (size_t i = 0; i < etl::dim<0>(in); ++i) {
             apply(in(i), m(i), c1, c2, c3);
         }
     }
+
+    // Direct memory handling
+
+    /*!
+     * \brief Apply the functor on sub and store the result in m
+     *
+     * The matrices are seen as a sequence of 3D volumes (batch and channels)
+     * and the output is computed slice by slice, in parallel. Each input
+     * slice is upsampled in the first slice of its block and the other
+     * slices of the block are copies of this first slice.
+     *
+     * \param in The sub expression
+     * \param m The storage matrix
+     * \param c1 The first dimension pooling ratio
+     * \param c2 The second dimension pooling ratio
+     * \param c3 The third dimension pooling ratio
+     */
+    template <typename A, typename M, cpp_enable_if(all_dma<A, M>::value && all_row_major<A, M>::value)>
+    static void apply(A&& in, M&& m, size_t c1, size_t c2, size_t c3) {
+        constexpr size_t D = decay_traits<A>::dimensions();
+
+        const size_t H  = etl::dim(in, D - 2);
+        const size_t W  = etl::dim(in, D - 1);
+        const size_t OH = H * c2;
+        const size_t OW = W * c3;
+
+        // The number of input slices, in all the volumes
+        const size_t S = etl::size(in) / (H * W);
+
+        in.ensure_cpu_up_to_date();
+
+        const auto* ss = in.memory_start();
+        auto* mm       = m.memory_start();
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t s = first; s < last; ++s) {
+                auto* out = mm + s * c1 * OH * OW;
+
+                for (size_t j = 0; j < H; ++j) {
+                    auto* out_row = out + j * c2 * OW;
+
+                    detail::upsample_row(ss + (s * H + j) * W, out_row, W, c3);
+
+                    for (size_t jj = 1; jj < c2; ++jj) {
+                        detail::upsample_copy_row(out_row, out_row + jj * OW, OW);
+                    }
+                }
+
+                for (size_t i = 1; i < c1; ++i) {
+                    detail::upsample_copy_row(out, out + i * OH * OW, OH * OW);
+                }
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, 0, S, select_parallel(etl::size(m)) && S > 1);
+
+        m.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Apply the functor on sub and store the result in m
+     * \param in The sub expression
+     * \param m The storage matrix
+     * \tparam C1 The first dimension pooling ratio
+     * \tparam C2 The second dimension pooling ratio
+     * \tparam C3 The third dimension pooling ratio
+     */
+    template <size_t C1, size_t C2, size_t C3, typename A, typename M, cpp_enable_if(all_dma<A, M>::value && all_row_major<A, M>::value)>
+    static void apply(A&& in, M&& m) {
+        apply(in, m, C1, C2, C3);
+    }
+};
+
+/*!
+ * \brief Functor for 2D bilinear Upsampling
+ *
+ * The centers of the input and output pixels are aligned and the borders
+ * are clamped.
+ */
+struct bilinear_upsample_2d {
+    /*!
+     * \brief Apply the functor on sub and store the result in m
+     *
+     * The input rows are first interpolated horizontally, then each output
+     * row is the interpolation of two of these rows. The 2D planes (batch
+     * and channels) are processed in parallel.
+     *
+     * \param in The sub expression
+     * \param m The storage matrix
+     * \param c1 The first dimension upsampling ratio
+     * \param c2 The second dimension upsampling ratio
+     */
+    template <typename A, typename M>
+    static void apply(A&& in, M&& m, size_t c1, size_t c2) {
+        static_assert(all_dma<A, M>::value, "bilinear upsampling has only been implemented for direct memory access");
+        static_assert(all_row_major<A, M>::value, "bilinear upsampling has only been implemented for row major matrices");
+        static_assert(std::is_floating_point<value_t<A>>::value, "bilinear upsampling is only supported for floating point");
+
+        using T = value_t<A>;
+
+        constexpr size_t D = decay_traits<A>::dimensions();
+
+        const size_t H  = etl::dim(in, D - 2);
+        const size_t W  = etl::dim(in, D - 1);
+        const size_t OH = H * c1;
+        const size_t OW = W * c2;
+
+        // The number of 2D planes
+        const size_t P = etl::size(in) / (H * W);
+
+        // The horizontal sources are the same for each row
+        std::vector<size_t> x0(OW);
+        std::vector<size_t> x1(OW);
+        std::vector<T> lx(OW);
+
+        for (size_t x = 0; x < OW; ++x) {
+            detail::bilinear_source(x, c2, W, x0[x], x1[x], lx[x]);
+        }
+
+        in.ensure_cpu_up_to_date();
+
+        const auto* ss = in.memory_start();
+        auto* mm       = m.memory_start();
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            etl::dyn_matrix<T, 2> rows(H, OW);
+
+            auto* rr = rows.memory_start();
+
+            for (size_t p = first; p < last; ++p) {
+                const auto* plane = ss + p * H * W;
+                auto* out         = mm + p * OH * OW;
+
+                for (size_t j = 0; j < H; ++j) {
+                    const auto* in_row = plane + j * W;
+
+                    for (size_t x = 0; x < OW; ++x) {
+                        rr[j * OW + x] = in_row[x0[x]] + lx[x] * (in_row[x1[x]] - in_row[x0[x]]);
+                    }
+                }
+
+                for (size_t y = 0; y < OH; ++y) {
+                    size_t y0;
+                    size_t y1;
+                    T ly;
+
+                    detail::bilinear_source(y, c1, H, y0, y1, ly);
+
+                    detail::upsample_lerp_row(rr + y0 * OW, rr + y1 * OW, out + y * OW, OW, ly);
+                }
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, 0, P, select_parallel(etl::size(m)) && P > 1);
+
+        m.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Apply the functor on sub and store the result in m
+     * \param in The sub expression
+     * \param m The storage matrix
+     * \tparam C1 The first dimension upsampling ratio
+     * \tparam C2 The second dimension upsampling ratio
+     */
+    template <size_t C1, size_t C2, typename A, typename M>
+    static void apply(A&& in, M&& m) {
+        apply(in, m, C1, C2);
+    }
 };
 
 } //end of namespace impl
@@ -0,0 +1,404 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the batched inverse and determinant
+ * of small square matrices
+ *
+ * The kernels are vectorized across the matrices: each block of vec_size
+ * matrices is transposed in structure-of-arrays order, so that each vector
+ * register holds the same element of every matrix of the block.
+ *
+ * The eliminations keep the partial pivoting of the standard versions: the
+ * pivot of each matrix is searched, and its rows swapped, lane by lane in
+ * O(n) per column while the O(n^2) updates are done on full registers.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief One element of vec_size matrices, in a vector register, with the
+ * arithmetic operators used by the closed-form kernels
+ * \tparam V The vectorization type
+ * \tparam T The value type
+ */
+template <typename V, typename T>
+struct soa_value {
+    using vec_type = typename V::template vec_type<T>; ///< The type of the register
+
+    vec_type value; ///< The elements of the matrices
+
+    /*!
+     * \brief Construct a zero soa_value
+     */
+    soa_value() : value(V::template zero<T>()) {}
+
+    /*!
+     * \brief Construct a soa_value from a register
+     */
+    soa_value(vec_type v) : value(v) {}
+
+    /*!
+     * \brief Construct a soa_value with the same scalar in each lane
+     */
+    template <typename S, cpp_enable_if(std::is_arithmetic<S>::value)>
+    soa_value(S scalar) : value(V::set(T(scalar))) {}
+
+    /*!
+     * \brief Add two soa_value
+     */
+    friend soa_value operator+(soa_value lhs, soa_value rhs) {
+        return V::add(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Subtract two soa_value
+     */
+    friend soa_value operator-(soa_value lhs, soa_value rhs) {
+        return V::sub(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Multiply two soa_value
+     */
+    friend soa_value operator*(soa_value lhs, soa_value rhs) {
+        return V::mul(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Divide two soa_value
+     */
+    friend soa_value operator/(soa_value lhs, soa_value rhs) {
+        return V::div(lhs.value, rhs.value);
+    }
+};
+
+/*!
+ * \brief Transpose the block of vec_size matrices starting at the matrix b
+ * in structure-of-arrays order
+ * \param a The input matrices
+ * \param b The first matrix of the block
+ * \param buffer The N * N * vec_size output elements
+ * \tparam V The vectorization type
+ * \tparam N The dimension of the matrices
+ */
+template <typename V, size_t N, typename T>
+void soa_transpose(const T* a, size_t b, T* buffer) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    for (size_t l = 0; l < vec_size; ++l) {
+        for (size_t e = 0; e < N * N; ++e) {
+            buffer[e * vec_size + l] = a[(b + l) * N * N + e];
+        }
+    }
+}
+
+/*!
+ * \brief Transpose back the block of vec_size matrices starting at the
+ * matrix b from structure-of-arrays order
+ * \param buffer The N * N * vec_size input elements
+ * \param c The output matrices
+ * \param b The first matrix of the block
+ * \tparam V The vectorization type
+ * \tparam N The dimension of the matrices
+ */
+template <typename V, size_t N, typename T>
+void soa_transpose_back(const T* buffer, T* c, size_t b) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    for (size_t l = 0; l < vec_size; ++l) {
+        for (size_t e = 0; e < N * N; ++e) {
+            c[(b + l) * N * N + e] = buffer[e * vec_size + l];
+        }
+    }
+}
+
+/*!
+ * \brief Load the block of vec_size matrices starting at the matrix b in
+ * structure-of-arrays order
+ * \param a The input matrices
+ * \param b The first matrix of the block
+ * \param buffer A buffer of N * N * vec_size elements
+ * \param m The N * N output registers
+ * \tparam V The vectorization type
+ * \tparam N The dimension of the matrices
+ */
+template <typename V, size_t N, typename T>
+void soa_load(const T* a, size_t b, T* buffer, soa_value<V, T>* m) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    soa_transpose<V, N>(a, b, buffer);
+
+    for (size_t e = 0; e < N * N; ++e) {
+        m[e] = V::loadu(buffer + e * vec_size);
+    }
+}
+
+/*!
+ * \brief Find the row of the largest pivot of the column k of the matrix
+ * in the lane l of the block
+ * \param m The matrices of the block, in structure-of-arrays order
+ * \param l The lane of the matrix
+ * \param k The current column
+ * \return the row of the pivot
+ * \tparam V The vectorization type
+ * \tparam N The dimension of the matrices
+ */
+template <typename V, size_t N, typename T>
+size_t soa_pivot(const T* m, size_t l, size_t k) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    size_t p = k;
+    T max    = std::abs(m[(k * N + k) * vec_size + l]);
+
+    for (size_t i = k + 1; i < N; ++i) {
+        const T v = std::abs(m[(i * N + k) * vec_size + l]);
+
+        if (v > max) {
+            max = v;
+            p   = i;
+        }
+    }
+
+    return p;
+}
+
+/*!
+ * \brief Swap the columns [first, N) of the rows k and p of the matrix in
+ * the lane l of the block
+ * \param m The matrices of the block, in structure-of-arrays order
+ * \param l The lane of the matrix
+ * \param k The first row
+ * \param p The second row
+ * \param first The first column to swap
+ * \tparam V The vectorization type
+ * \tparam N The dimension of the matrices
+ */
+template <typename V, size_t N, typename T>
+void soa_swap_rows(T* m, size_t l, size_t k, size_t p, size_t first) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    for (size_t j = first; j < N; ++j) {
+        std::swap(m[(k * N + j) * vec_size + l], m[(p * N + j) * vec_size + l]);
+    }
+}
+
+/*!
+ * \brief Compute the inverse of the matrices [first, last) of the batch
+ * with the closed-form kernel
+ * \param a The input matrices
+ * \param c The output matrices
+ * \param first The first matrix
+ * \param last The end of the matrices
+ * \tparam V The vectorization type
+ * \tparam N The dimension of the matrices
+ */
+template <typename V, size_t N, typename T>
+void batch_inv_closed(const T* a, T* c, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    T buffer[N * N * vec_size];
+
+    soa_value<V, T> m[N * N];
+    soa_value<V, T> r[N * N];
+
+    size_t b = first;
+
+    for (; b + vec_size <= last; b += vec_size) {
+        soa_load<V, N>(a, b, buffer, m);
+
+        common::small_matrix_kernel<N>::inv(m, r);
+
+        for (size_t e = 0; e < N * N; ++e) {
+            V::storeu(buffer + e * vec_size, r[e].value);
+        }
+
+        soa_transpose_back<V, N>(buffer, c, b);
+    }
+
+    standard::batch_inv_closed<N>(a, c, b, last);
+}
+
+/*!
+ * \brief Compute the determinant of the matrices [first, last) of the batch
+ * with the closed-form kernel
+ * \param a The input matrices
+ * \param d The output determinants
+ * \param first The first matrix
+ * \param last The end of the matrices
+ * \tparam V The vectorization type
+ * \tparam N The dimension of the matrices
+ */
+template <typename V, size_t N, typename T>
+void batch_det_closed(const T* a, T* d, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    T buffer[N * N * vec_size];
+
+    soa_value<V, T> m[N * N];
+
+    size_t b = first;
+
+    for (; b + vec_size <= last; b += vec_size) {
+        soa_load<V, N>(a, b, buffer, m);
+
+        V::storeu(d + b, common::small_matrix_kernel<N>::det(m).value);
+    }
+
+    standard::batch_det_closed<N>(a, d, b, last);
+}
+
+/*!
+ * \brief Compute the inverse of the matrices [first, last) of the batch
+ * with a Gauss-Jordan elimination with partial pivoting
+ * \param a The input matrices
+ * \param c The output matrices
+ * \param first The first matrix
+ * \param last The end of the matrices
+ * \tparam V The vectorization type
+ * \tparam N The dimension of the matrices
+ */
+template <typename V, size_t N, typename T>
+void batch_inv_elimination(const T* a, T* c, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    T m[N * N * vec_size];
+    T r[N * N * vec_size];
+
+    auto mm = [&m](size_t i, size_t j) { return m + (i * N + j) * vec_size; };
+    auto rr = [&r](size_t i, size_t j) { return r + (i * N + j) * vec_size; };
+
+    size_t b = first;
+
+    for (; b + vec_size <= last; b += vec_size) {
+        soa_transpose<V, N>(a, b, m);
+
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < N; ++j) {
+                V::storeu(rr(i, j), V::set(i == j ? T(1) : T(0)));
+            }
+        }
+
+        for (size_t k = 0; k < N; ++k) {
+            for (size_t l = 0; l < vec_size; ++l) {
+                const size_t p = soa_pivot<V, N>(m, l, k);
+
+                if (p != k) {
+                    soa_swap_rows<V, N>(m, l, k, p, k);
+                    soa_swap_rows<V, N>(r, l, k, p, 0);
+                }
+            }
+
+            const auto inv_pivot = V::div(V::set(T(1)), V::loadu(mm(k, k)));
+
+            for (size_t j = k + 1; j < N; ++j) {
+                V::storeu(mm(k, j), V::mul(V::loadu(mm(k, j)), inv_pivot));
+            }
+
+            for (size_t j = 0; j < N; ++j) {
+                V::storeu(rr(k, j), V::mul(V::loadu(rr(k, j)), inv_pivot));
+            }
+
+            for (size_t i = 0; i < N; ++i) {
+                if (i == k) {
+                    continue;
+                }
+
+                const auto f = V::loadu(mm(i, k));
+
+                for (size_t j = k + 1; j < N; ++j) {
+                    V::storeu(mm(i, j), V::sub(V::loadu(mm(i, j)), V::mul(f, V::loadu(mm(k, j)))));
+                }
+
+                for (size_t j = 0; j < N; ++j) {
+                    V::storeu(rr(i, j), V::sub(V::loadu(rr(i, j)), V::mul(f, V::loadu(rr(k, j)))));
+                }
+            }
+        }
+
+        soa_transpose_back<V, N>(r, c, b);
+    }
+
+    standard::batch_inv_elimination(a, c, std::integral_constant<size_t, N>{}, b, last);
+}
+
+/*!
+ * \brief Compute the determinant of the matrices [first, last) of the batch
+ * with a LU decomposition with partial pivoting
+ *
+ * The determinant of a matrix without any non-zero pivot is set to zero,
+ * its pivot is replaced by one to keep the other lanes finite.
+ *
+ * \param a The input matrices
+ * \param d The output determinants
+ * \param first The first matrix
+ * \param last The end of the matrices
+ * \tparam V The vectorization type
+ * \tparam N The dimension of the matrices
+ */
+template <typename V, size_t N, typename T>
+void batch_det_elimination(const T* a, T* d, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    T m[N * N * vec_size];
+    T sign[vec_size];
+
+    auto mm = [&m](size_t i, size_t j) { return m + (i * N + j) * vec_size; };
+
+    size_t b = first;
+
+    for (; b + vec_size <= last; b += vec_size) {
+        soa_transpose<V, N>(a, b, m);
+
+        std::fill_n(sign, vec_size, T(1));
+
+        auto det = V::set(T(1));
+
+        for (size_t k = 0; k < N; ++k) {
+            for (size_t l = 0; l < vec_size; ++l) {
+                const size_t p = soa_pivot<V, N>(m, l, k);
+
+                if (mm(p, k)[l] == T(0)) {
+                    sign[l]     = T(0);
+                    mm(k, k)[l] = T(1);
+                } else if (p != k) {
+                    soa_swap_rows<V, N>(m, l, k, p, k);
+                    sign[l] = -sign[l];
+                }
+            }
+
+            const auto pivot = V::loadu(mm(k, k));
+
+            det = V::mul(det, pivot);
+
+            for (size_t i = k + 1; i < N; ++i) {
+                const auto f = V::div(V::loadu(mm(i, k)), pivot);
+
+                for (size_t j = k + 1; j < N; ++j) {
+                    V::storeu(mm(i, j), V::sub(V::loadu(mm(i, j)), V::mul(f, V::loadu(mm(k, j)))));
+                }
+            }
+        }
+
+        V::storeu(d + b, V::mul(det, V::loadu(sign)));
+    }
+
+    standard::batch_det_elimination(a, d, std::integral_constant<size_t, N>{}, b, last);
+}
+
+} //end of namespace vec
+
+} //end of namespace impl
+
+} //end of namespace etl
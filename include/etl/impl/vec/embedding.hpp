@@ -0,0 +1,113 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the embedding row kernels
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Copy a row of n elements from in to out
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the row
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void copy_row(const T* in, T* out, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    size_t j = 0;
+
+    for (; j + 4 * vec_size - 1 < n; j += 4 * vec_size) {
+        auto r1 = vec_type::loadu(in + j + 0 * vec_size);
+        auto r2 = vec_type::loadu(in + j + 1 * vec_size);
+        auto r3 = vec_type::loadu(in + j + 2 * vec_size);
+        auto r4 = vec_type::loadu(in + j + 3 * vec_size);
+
+        vec_type::storeu(out + j + 0 * vec_size, r1);
+        vec_type::storeu(out + j + 1 * vec_size, r2);
+        vec_type::storeu(out + j + 2 * vec_size, r3);
+        vec_type::storeu(out + j + 3 * vec_size, r4);
+    }
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        vec_type::storeu(out + j, vec_type::loadu(in + j));
+    }
+
+    for (; j < n; ++j) {
+        out[j] = in[j];
+    }
+}
+
+/*!
+ * \brief Add a row of n elements from in to out
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the row
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void add_row(const T* in, T* out, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    size_t j = 0;
+
+    for (; j + 2 * vec_size - 1 < n; j += 2 * vec_size) {
+        auto r1 = vec_type::add(vec_type::loadu(out + j + 0 * vec_size), vec_type::loadu(in + j + 0 * vec_size));
+        auto r2 = vec_type::add(vec_type::loadu(out + j + 1 * vec_size), vec_type::loadu(in + j + 1 * vec_size));
+
+        vec_type::storeu(out + j + 0 * vec_size, r1);
+        vec_type::storeu(out + j + 1 * vec_size, r2);
+    }
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        vec_type::storeu(out + j, vec_type::add(vec_type::loadu(out + j), vec_type::loadu(in + j)));
+    }
+
+    for (; j < n; ++j) {
+        out[j] += in[j];
+    }
+}
+
+/*!
+ * \brief Copy a row of n elements from in to out
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the row
+ */
+template <typename T>
+void copy_row(const T* in, T* out, size_t n) {
+    copy_row<default_vec>(in, out, n);
+}
+
+/*!
+ * \brief Add a row of n elements from in to out
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the row
+ */
+template <typename T>
+void add_row(const T* in, T* out, size_t n) {
+    add_row<default_vec>(in, out, n);
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
@@ -37,10 +37,6 @@ void blas_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     // real final dimensions
     const size_t f1 = etl::dim<1>(conv);
     const size_t f2 = etl::dim<2>(conv);
@@ -53,7 +49,8 @@ void blas_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
     // Flip the kernels
     prepared_k.deep_fflip_inplace();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+    // The strided im2col only generates the columns of the strided positions
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
     if(p1 || p2){
         etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
@@ -61,31 +58,14 @@ void blas_conv2_valid_multi(const I& input, const K_T& kernels, C&& conv, size_t
 
         impl::common::pad_2d_input(input, input_padded, p1, p2);
 
-        im2col_direct_tr(input_col, input_padded, k1, k2);
+        im2col_direct_tr(input_col, input_padded, k1, k2, s1, s2);
     } else {
-        im2col_direct_tr(input_col, input, k1, k2);
+        im2col_direct_tr(input_col, input, k1, k2, s1, s2);
     }
 
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
-
-        gemm_large_kernel_rr<default_vec>(
-            prepared_k.memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-            K, c1 * c2, k1 * k2, T(0));
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < f1; ++i) {
-                for (size_t j = 0; j < f2; ++j) {
-                    conv(k, i, j) = tmp_result(k, i * s1, j * s2);
-                }
-            }
-        }
-    } else {
-        gemm_large_kernel_rr<default_vec>(
-            prepared_k.memory_start(), input_col.memory_start(), conv.memory_start(),
-            K, f1 * f2, k1 * k2, T(0));
-    }
+    gemm_large_kernel_rr<default_vec>(
+        prepared_k.memory_start(), input_col.memory_start(), conv.memory_start(),
+        K, f1 * f2, k1 * k2, T(0));
 
     conv.invalidate_gpu();
 }
@@ -109,10 +89,6 @@ void blas_conv2_valid_multi_flipped(I&& input, K_T&& kernels, C&& conv, size_t s
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     // real final dimensions
     const size_t f1 = etl::dim<1>(conv);
     const size_t f2 = etl::dim<2>(conv);
@@ -120,7 +96,8 @@ void blas_conv2_valid_multi_flipped(I&& input, K_T&& kernels, C&& conv, size_t s
     input.ensure_cpu_up_to_date();
     kernels.ensure_cpu_up_to_date();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+    // The strided im2col only generates the columns of the strided positions
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
     if(p1 || p2){
         etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
@@ -128,31 +105,14 @@ void blas_conv2_valid_multi_flipped(I&& input, K_T&& kernels, C&& conv, size_t s
 
         impl::common::pad_2d_input(input, input_padded, p1, p2);
 
-        im2col_direct_tr(input_col, input_padded, k1, k2);
+        im2col_direct_tr(input_col, input_padded, k1, k2, s1, s2);
     } else {
-        im2col_direct_tr(input_col, input, k1, k2);
+        im2col_direct_tr(input_col, input, k1, k2, s1, s2);
     }
 
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
-
-        gemm_large_kernel_rr<default_vec>(
-            kernels.memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-            K, c1 * c2, k1 * k2, T(0));
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < f1; ++i) {
-                for (size_t j = 0; j < f2; ++j) {
-                    conv(k, i, j) = tmp_result(k, i * s1, j * s2);
-                }
-            }
-        }
-    } else {
-        gemm_large_kernel_rr<default_vec>(
-            kernels.memory_start(), input_col.memory_start(), conv.memory_start(),
-            K, f1 * f2, k1 * k2, T(0));
-    }
+    gemm_large_kernel_rr<default_vec>(
+        kernels.memory_start(), input_col.memory_start(), conv.memory_start(),
+        K, f1 * f2, k1 * k2, T(0));
 
     conv.invalidate_gpu();
 }
@@ -178,10 +138,6 @@ void blas_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv,
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     // real final dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
@@ -194,7 +150,8 @@ void blas_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv,
     // Flip the kernels
     prepared_k.deep_fflip_inplace();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * c1 * c2);
+    // The strided im2col only generates the columns of the strided positions
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * f1 * f2);
 
     if(p1 || p2){
         etl::dyn_matrix<T, 3> input_padded(N, i1 + 2 * p1, i2 + 2 * p2);
@@ -204,33 +161,14 @@ void blas_conv2_valid_multi_multi(const I& input, const K_T& kernels, C&& conv,
             impl::common::pad_2d_input(input(i), input_padded(i), p1, p2);
         }
 
-        im2col_direct_tr_multi(input_col, input_padded, k1, k2);
+        im2col_direct_tr_multi(input_col, input_padded, k1, k2, s1, s2);
     } else {
-        im2col_direct_tr_multi(input_col, input, k1, k2);
+        im2col_direct_tr_multi(input_col, input, k1, k2, s1, s2);
     }
 
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 4> tmp_result(K, N, c1, c2);
-
-        gemm_large_kernel_rr<default_vec>(
-            prepared_k.memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-            K, N * c1 * c2, k1 * k2, T(0));
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < N; ++i) {
-                for (size_t ii = 0; ii < f1; ++ii) {
-                    for (size_t j = 0; j < f2; ++j) {
-                        conv(k, i, ii, j) = tmp_result(k, i, ii * s1, j * s2);
-                    }
-                }
-            }
-        }
-    } else {
-        gemm_large_kernel_rr<default_vec>(
-            prepared_k.memory_start(), input_col.memory_start(), conv.memory_start(),
-            K, N * c1 * c2, k1 * k2, T(0));
-    }
+    gemm_large_kernel_rr<default_vec>(
+        prepared_k.memory_start(), input_col.memory_start(), conv.memory_start(),
+        K, N * f1 * f2, k1 * k2, T(0));
 
     conv.invalidate_gpu();
 }
@@ -256,10 +194,6 @@ void blas_conv2_valid_multi_multi_flipped(const I& input, const K_T& kernels, C&
     const size_t k1 = etl::dim<1>(kernels);
     const size_t k2 = etl::dim<2>(kernels);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     // real final dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
@@ -267,7 +201,8 @@ void blas_conv2_valid_multi_multi_flipped(const I& input, const K_T& kernels, C&
     input.ensure_cpu_up_to_date();
     kernels.ensure_cpu_up_to_date();
 
-    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * c1 * c2);
+    // The strided im2col only generates the columns of the strided positions
+    etl::dyn_matrix<T, 2> input_col(k1 * k2, N * f1 * f2);
 
     if(p1 || p2){
         etl::dyn_matrix<T, 3> input_padded(N, i1 + 2 * p1, i2 + 2 * p2);
@@ -277,33 +212,14 @@ void blas_conv2_valid_multi_multi_flipped(const I& input, const K_T& kernels, C&
             impl::common::pad_2d_input(input(i), input_padded(i), p1, p2);
         }
 
-        im2col_direct_tr_multi(input_col, input_padded, k1, k2);
+        im2col_direct_tr_multi(input_col, input_padded, k1, k2, s1, s2);
     } else {
-        im2col_direct_tr_multi(input_col, input, k1, k2);
+        im2col_direct_tr_multi(input_col, input, k1, k2, s1, s2);
     }
 
-    if(s1 > 1 || s2 > 1){
-        etl::dyn_matrix<T, 4> tmp_result(K, N, c1, c2);
-
-        gemm_large_kernel_rr<default_vec>(
-            kernels.memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-            K, N * c1 * c2, k1 * k2, T(0));
-
-        // Strided copy of the large result into the small result
-        for (size_t k = 0; k < K; ++k) {
-            for (size_t i = 0; i < N; ++i) {
-                for (size_t ii = 0; ii < f1; ++ii) {
-                    for (size_t j = 0; j < f2; ++j) {
-                        conv(k, i, ii, j) = tmp_result(k, i, ii * s1, j * s2);
-                    }
-                }
-            }
-        }
-    } else {
-        gemm_large_kernel_rr<default_vec>(
-            kernels.memory_start(), input_col.memory_start(), conv.memory_start(),
-            K, N * c1 * c2, k1 * k2, T(0));
-    }
+    gemm_large_kernel_rr<default_vec>(
+        kernels.memory_start(), input_col.memory_start(), conv.memory_start(),
+        K, N * f1 * f2, k1 * k2, T(0));
 
     conv.invalidate_gpu();
 }
@@ -346,11 +262,7 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
     auto batch_fun_n = [&](const size_t first, const size_t last) {
         if (last - first) {
             SERIAL_SECTION {
-                // unit-strided result dimensions
-                const size_t sc1 = (n1 - m1 + 2 * p1) + 1;
-                const size_t sc2 = (n2 - m2 + 2 * p2) + 1;
-
-                etl::dyn_matrix<T, 2> input_col(m1 * m2, sc1 * sc2);
+                etl::dyn_matrix<T, 2> input_col(m1 * m2, c1 * c2);
 
                 // Optimize for the most common case
                 if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
@@ -365,7 +277,6 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
                     }
                 } else {
                     etl::dyn_matrix<T, 2> input_padded(n1 + 2 * p1, n2 + 2 * p2);
-                    etl::dyn_matrix<T, 3> tmp_result(K, sc1, sc2);
 
                     for (size_t i = first; i < last; ++i) {
                         for (size_t c = 0; c < C; ++c) {
@@ -374,29 +285,14 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
 
                                 impl::common::pad_2d_input(input(i)(c), input_padded, p1, p2);
 
-                                im2col_direct_tr(input_col, input_padded, m1, m2);
+                                im2col_direct_tr(input_col, input_padded, m1, m2, s1, s2);
                             } else {
-                                im2col_direct_tr(input_col, input(i)(c), m1, m2);
+                                im2col_direct_tr(input_col, input(i)(c), m1, m2, s1, s2);
                             }
 
-                            if (s1 > 1 || s2 > 1) {
-                                gemm_large_kernel_rr<default_vec>(
-                                    kernels(c).memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-                                    K, sc1 * sc2, m1 * m2, T(0.0));
-
-                                // Strided copy of the large result into the small result
-                                for (size_t k = 0; k < K; ++k) {
-                                    for (size_t ii = 0; ii < c1; ++ii) {
-                                        for (size_t j = 0; j < c2; ++j) {
-                                            conv(i, k, ii, j) += tmp_result(k, ii * s1, j * s2);
-                                        }
-                                    }
-                                }
-                            } else {
-                                gemm_large_kernel_rr<default_vec>(
-                                    kernels(c).memory_start(), input_col.memory_start(), conv(i).memory_start(),
-                                    K, c1 * c2, m1 * m2, T(1.0));
-                            }
+                            gemm_large_kernel_rr<default_vec>(
+                                kernels(c).memory_start(), input_col.memory_start(), conv(i).memory_start(),
+                                K, c1 * c2, m1 * m2, T(1.0));
                         }
                     }
                 }
@@ -497,10 +393,6 @@ void blas_conv4_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, siz
     const auto k1 = etl::dim<2>(kernel);
     const auto k2 = etl::dim<3>(kernel);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
     input.ensure_cpu_up_to_date();
     kernel.ensure_cpu_up_to_date();
 
@@ -511,7 +403,7 @@ void blas_conv4_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, siz
         if (last - first) {
             SERIAL_SECTION {
                 for (size_t c = first; c < last; ++c) {
-                    etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+                    etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
                     for (size_t i = 0; i < I; ++i) {
                         // Optimize for the most common case
@@ -527,31 +419,14 @@ void blas_conv4_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, siz
 
                                 impl::common::pad_2d_input(input(i)(c), input_padded, p1, p2);
 
-                                im2col_direct_tr(input_col, input_padded, k1, k2);
+                                im2col_direct_tr(input_col, input_padded, k1, k2, s1, s2);
                             } else {
-                                im2col_direct_tr(input_col, input(i)(c), k1, k2);
+                                im2col_direct_tr(input_col, input(i)(c), k1, k2, s1, s2);
                             }
 
-                            if (s1 > 1 || s2 > 1) {
-                                etl::dyn_matrix<T, 3> tmp_result(K, c1, c2);
-
-                                gemm_large_kernel_rr<default_vec>(
-                                    kernel(i).memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-                                    K, c1 * c2, k1 * k2, T(0.0));
-
-                                // Strided copy of the large result into the small result
-                                for (size_t k = 0; k < K; ++k) {
-                                    for (size_t ii = 0; ii < f1; ++ii) {
-                                        for (size_t j = 0; j < f2; ++j) {
-                                            conv_temp(c, k, ii, j) += tmp_result(k, ii * s1, j * s2);
-                                        }
-                                    }
-                                }
-                            } else {
-                                gemm_large_kernel_rr<default_vec>(
-                                    kernel(i).memory_start(), input_col.memory_start(), conv_temp(c).memory_start(),
-                                    K, f1 * f2, k1 * k2, T(1.0));
-                            }
+                            gemm_large_kernel_rr<default_vec>(
+                                kernel(i).memory_start(), input_col.memory_start(), conv_temp(c).memory_start(),
+                                K, f1 * f2, k1 * k2, T(1.0));
                         }
                     }
                 }
@@ -628,11 +503,6 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
     const size_t k1 = etl::dim<2>(kernel);
     const size_t k2 = etl::dim<3>(kernel);
 
-    // unit-strided result dimensions
-    const size_t c1 = (i1 - k1 + 2 * p1) + 1;
-    const size_t c2 = (i2 - k2 + 2 * p2) + 1;
-
-    // real final dimensions
     const size_t f1 = etl::dim<2>(conv);
     const size_t f2 = etl::dim<3>(conv);
 
@@ -642,7 +512,7 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
     auto batch_fun_n = [&](const size_t first, const size_t last) {
         if (last - first) {
             SERIAL_SECTION {
-                etl::dyn_matrix<T, 2> input_col(k1 * k2, c1 * c2);
+                etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
 
                 // Optimize for the most common case
                 if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
@@ -654,12 +524,11 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
                             // conv(i) = kernel(k) * input_col
                             gemm_large_kernel_rr<default_vec>(
                                 kernel(k).memory_start(), input_col.memory_start(), conv(i).memory_start(),
-                                C, c1 * c2, k1 * k2, T(1.0));
+                                C, f1 * f2, k1 * k2, T(1.0));
                         }
                     }
                 } else {
                     etl::dyn_matrix<T, 2> input_padded(i1 + 2 * p1, i2 + 2 * p2);
-                    etl::dyn_matrix<T, 3> tmp_result(C, c1, c2);
 
                     for (size_t i = first; i < last; ++i) {
                         for (size_t k = 0; k < K; ++k) {
@@ -668,31 +537,15 @@ void blas_conv4_valid_back_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_
                             if (p1 || p2) {
                                 input_padded = T(0);
                                 impl::common::pad_2d_input(input(i)(k), input_padded, p1, p2);
-                                im2col_direct_tr(input_col, input_padded, k1, k2);
+                                im2col_direct_tr(input_col, input_padded, k1, k2, s1, s2);
                             } else {
-                                im2col_direct_tr(input_col, input(i)(k), k1, k2);
+                                im2col_direct_tr(input_col, input(i)(k), k1, k2, s1, s2);
                             }
 
-                            if (s1 > 1 || s2 > 1) {
-                                // tmp_result = kernel(k) * input_col
-                                gemm_large_kernel_rr<default_vec>(
-                                    kernel(k).memory_start(), input_col.memory_start(), tmp_result.memory_start(),
-                                    C, c1 * c2, k1 * k2, T(0.0));
-
-                                // Strided copy of the large result into the small result
-                                for (size_t c = 0; c < C; ++c) {
-                                    for (size_t m = 0; m < f1; ++m) {
-                                        for (size_t n = 0; n < f2; ++n) {
-                                            conv(i, c, m, n) += tmp_result(c, m * s1, n * s2);
-                                        }
-                                    }
-                                }
-                            } else {
-                                // conv(i) = kernel(k) * input_col
-                                gemm_large_kernel_rr<default_vec>(
-                                    kernel(k).memory_start(), input_col.memory_start(), conv(i).memory_start(),
-                                    C, c1 * c2, k1 * k2, T(1.0));
-                            }
+                            // conv(i) = kernel(k) * input_col
+                            gemm_large_kernel_rr<default_vec>(
+                                kernel(k).memory_start(), input_col.memory_start(), conv(i).memory_start(),
+                                C, f1 * f2, k1 * k2, T(1.0));
                         }
                     }
                 }
@@ -0,0 +1,215 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the packed symmetric and triangular kernels
+ *
+ * The kernels are the same as the standard ones, only the dot products and
+ * the axpy on the contiguous rows (or columns) of the packed storage are
+ * vectorized.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Compute the dot product of two contiguous arrays
+ * \param a The first array
+ * \param b The second array
+ * \param n The number of elements
+ * \tparam V The vectorization type
+ * \return the dot product of a and b
+ */
+template <typename V, typename T>
+T packed_dot(const T* a, const T* b, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto r1 = vec_type::template zero<T>();
+    auto r2 = vec_type::template zero<T>();
+
+    size_t i = 0;
+
+    for (; i + 2 * vec_size <= n; i += 2 * vec_size) {
+        r1 = vec_type::fmadd(vec_type::loadu(a + i), vec_type::loadu(b + i), r1);
+        r2 = vec_type::fmadd(vec_type::loadu(a + i + vec_size), vec_type::loadu(b + i + vec_size), r2);
+    }
+
+    for (; i + vec_size <= n; i += vec_size) {
+        r1 = vec_type::fmadd(vec_type::loadu(a + i), vec_type::loadu(b + i), r1);
+    }
+
+    T result = vec_type::hadd(vec_type::add(r1, r2));
+
+    for (; i < n; ++i) {
+        result += a[i] * b[i];
+    }
+
+    return result;
+}
+
+/*!
+ * \brief Compute y += alpha * x on contiguous arrays
+ * \param alpha The scalar factor
+ * \param x The input array
+ * \param y The output array
+ * \param n The number of elements
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void packed_axpy(T alpha, const T* x, T* y, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto a1 = vec_type::set(alpha);
+
+    size_t i = 0;
+
+    for (; i + 2 * vec_size <= n; i += 2 * vec_size) {
+        vec_type::storeu(y + i, vec_type::fmadd(a1, vec_type::loadu(x + i), vec_type::loadu(y + i)));
+        vec_type::storeu(y + i + vec_size, vec_type::fmadd(a1, vec_type::loadu(x + i + vec_size), vec_type::loadu(y + i + vec_size)));
+    }
+
+    for (; i + vec_size <= n; i += vec_size) {
+        vec_type::storeu(y + i, vec_type::fmadd(a1, vec_type::loadu(x + i), vec_type::loadu(y + i)));
+    }
+
+    for (; i < n; ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+/*!
+ * \brief Compute y = A * x with A a symmetric matrix in lower packed storage
+ * \param ap The lower packed storage of A
+ * \param n The dimension of A
+ * \param x The input vector
+ * \param y The output vector
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void symv(const T* ap, size_t n, const T* x, T* y) {
+    for (size_t i = 0; i < n; ++i) {
+        const T* row = ap + i * (i + 1) / 2;
+
+        // The row i of the lower triangle is also the column i of the upper triangle
+        y[i] = packed_dot<V>(row, x, i) + row[i] * x[i];
+        packed_axpy<V>(x[i], row, y, i);
+    }
+}
+
+/*!
+ * \brief Compute y = A * x with A a lower triangular matrix in lower packed storage
+ * \param ap The lower packed storage of A
+ * \param n The dimension of A
+ * \param x The input vector
+ * \param y The output vector
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void trmv_lower(const T* ap, size_t n, const T* x, T* y) {
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = packed_dot<V>(ap + i * (i + 1) / 2, x, i + 1);
+    }
+}
+
+/*!
+ * \brief Compute y = A * x with A an upper triangular matrix in upper packed storage
+ * \param ap The upper packed storage of A
+ * \param n The dimension of A
+ * \param x The input vector
+ * \param y The output vector
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void trmv_upper(const T* ap, size_t n, const T* x, T* y) {
+    std::fill_n(y, n, T());
+
+    for (size_t j = 0; j < n; ++j) {
+        packed_axpy<V>(x[j], ap + j * (j + 1) / 2, y, j + 1);
+    }
+}
+
+/*!
+ * \brief Compute C = A * B with A a lower triangular matrix in lower packed
+ * storage and B and C row-major matrices
+ * \param ap The lower packed storage of A
+ * \param n The dimension of A
+ * \param b The B matrix (n x k)
+ * \param k The number of columns of B
+ * \param c The C matrix (n x k)
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void trmm_lower(const T* ap, size_t n, const T* b, size_t k, T* c) {
+    std::fill_n(c, n * k, T());
+
+    for (size_t i = 0; i < n; ++i) {
+        const T* row = ap + i * (i + 1) / 2;
+
+        for (size_t l = 0; l <= i; ++l) {
+            packed_axpy<V>(row[l], b + l * k, c + i * k, k);
+        }
+    }
+}
+
+/*!
+ * \brief Compute C = A * B with A an upper triangular matrix in upper packed
+ * storage and B and C row-major matrices
+ * \param ap The upper packed storage of A
+ * \param n The dimension of A
+ * \param b The B matrix (n x k)
+ * \param k The number of columns of B
+ * \param c The C matrix (n x k)
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void trmm_upper(const T* ap, size_t n, const T* b, size_t k, T* c) {
+    std::fill_n(c, n * k, T());
+
+    for (size_t j = 0; j < n; ++j) {
+        const T* col = ap + j * (j + 1) / 2;
+
+        for (size_t i = 0; i <= j; ++i) {
+            packed_axpy<V>(col[i], b + j * k, c + i * k, k);
+        }
+    }
+}
+
+/*!
+ * \brief Compute C = A * A^T with A a row-major matrix and C a symmetric
+ * matrix in lower packed storage
+ * \param a The A matrix (n x k)
+ * \param n The number of rows of A
+ * \param k The number of columns of A
+ * \param cp The lower packed storage of C
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void syrk(const T* a, size_t n, size_t k, T* cp) {
+    for (size_t i = 0; i < n; ++i) {
+        T* row = cp + i * (i + 1) / 2;
+
+        for (size_t j = 0; j <= i; ++j) {
+            row[j] = packed_dot<V>(a + i * k, a + j * k, k);
+        }
+    }
+}
+
+} //end of namespace vec
+
+} //end of namespace impl
+
+} //end of namespace etl
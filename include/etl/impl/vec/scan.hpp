@@ -0,0 +1,370 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the cumulative (scan) row kernels
+ *
+ * The scan of a row is done one vector at a time: each vector is scanned
+ * in-register with log2(n) shift-and-combine steps and combined with the
+ * broadcast last value of the previous vector.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief In-register scan of a vector.
+ *
+ * This generic version goes through memory, it is used when no shuffle
+ * version is available for the vector mode.
+ *
+ * \tparam V The vectorization type
+ * \tparam T The value type
+ */
+template <typename V, typename T>
+struct vec_scan {
+    static constexpr size_t vec_size = V::template traits<T>::size; ///< The number of elements of a vector
+
+    /*!
+     * \brief Inclusive scan of the elements of a vector
+     * \param x The vector
+     * \return the scanned vector
+     * \tparam Op The scan operation
+     */
+    template <typename Op, typename X>
+    static X scan(X x) {
+        T tmp[vec_size];
+
+        V::storeu(tmp, x);
+
+        for (size_t i = 1; i < vec_size; ++i) {
+            tmp[i] = Op::apply(tmp[i - 1], tmp[i]);
+        }
+
+        return V::loadu(tmp);
+    }
+
+    /*!
+     * \brief Broadcast the last element of a vector
+     * \param x The vector
+     * \return A vector with all elements set to the last element of x
+     */
+    template <typename X>
+    static X broadcast_last(X x) {
+        T tmp[vec_size];
+
+        V::storeu(tmp, x);
+
+        return V::set(tmp[vec_size - 1]);
+    }
+};
+
+#ifdef __SSE3__
+
+/*!
+ * \brief In-register scan of a SSE vector of single-precision values.
+ */
+template <>
+struct vec_scan<sse_vec, float> {
+    /*!
+     * \brief Inclusive scan of a raw SSE vector
+     * \param x The vector
+     * \return the scanned vector
+     * \tparam Op The scan operation
+     */
+    template <typename Op>
+    static __m128 scan_raw(__m128 x) {
+        const __m128 neutral = _mm_set1_ps(Op::template neutral<float>());
+
+        // [n, x0, x1, x2]
+        __m128 s1 = _mm_move_ss(_mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)), neutral);
+        x         = Op::template apply_vec<sse_vec>(sse_simd_float(x), sse_simd_float(s1)).value;
+
+        // [n, n, x0, x1]
+        __m128 s2 = _mm_movelh_ps(neutral, x);
+        return Op::template apply_vec<sse_vec>(sse_simd_float(x), sse_simd_float(s2)).value;
+    }
+
+    /*!
+     * \brief Inclusive scan of the elements of a vector
+     * \param x The vector
+     * \return the scanned vector
+     * \tparam Op The scan operation
+     */
+    template <typename Op>
+    static sse_simd_float scan(sse_simd_float x) {
+        return scan_raw<Op>(x.value);
+    }
+
+    /*!
+     * \brief Broadcast the last element of a vector
+     * \param x The vector
+     * \return A vector with all elements set to the last element of x
+     */
+    static sse_simd_float broadcast_last(sse_simd_float x) {
+        return _mm_shuffle_ps(x.value, x.value, 0xFF);
+    }
+};
+
+/*!
+ * \brief In-register scan of a SSE vector of double-precision values.
+ */
+template <>
+struct vec_scan<sse_vec, double> {
+    /*!
+     * \brief Inclusive scan of a raw SSE vector
+     * \param x The vector
+     * \return the scanned vector
+     * \tparam Op The scan operation
+     */
+    template <typename Op>
+    static __m128d scan_raw(__m128d x) {
+        const __m128d neutral = _mm_set1_pd(Op::template neutral<double>());
+
+        // [n, x0]
+        __m128d s1 = _mm_unpacklo_pd(neutral, x);
+        return Op::template apply_vec<sse_vec>(sse_simd_double(x), sse_simd_double(s1)).value;
+    }
+
+    /*!
+     * \brief Inclusive scan of the elements of a vector
+     * \param x The vector
+     * \return the scanned vector
+     * \tparam Op The scan operation
+     */
+    template <typename Op>
+    static sse_simd_double scan(sse_simd_double x) {
+        return scan_raw<Op>(x.value);
+    }
+
+    /*!
+     * \brief Broadcast the last element of a vector
+     * \param x The vector
+     * \return A vector with all elements set to the last element of x
+     */
+    static sse_simd_double broadcast_last(sse_simd_double x) {
+        return _mm_unpackhi_pd(x.value, x.value);
+    }
+};
+
+#endif
+
+#ifdef __AVX__
+
+/*!
+ * \brief In-register scan of an AVX vector of single-precision values.
+ *
+ * Each 128-bit lane is scanned independently and the last value of the low
+ * lane is then combined into the high lane.
+ */
+template <>
+struct vec_scan<avx_vec, float> {
+    /*!
+     * \brief Inclusive scan of the elements of a vector
+     * \param x The vector
+     * \return the scanned vector
+     * \tparam Op The scan operation
+     */
+    template <typename Op>
+    static avx_simd_float scan(avx_simd_float x) {
+        __m128 lo = vec_scan<sse_vec, float>::scan_raw<Op>(_mm256_castps256_ps128(x.value));
+        __m128 hi = vec_scan<sse_vec, float>::scan_raw<Op>(_mm256_extractf128_ps(x.value, 1));
+
+        hi = Op::template apply_vec<sse_vec>(sse_simd_float(_mm_shuffle_ps(lo, lo, 0xFF)), sse_simd_float(hi)).value;
+
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+    }
+
+    /*!
+     * \brief Broadcast the last element of a vector
+     * \param x The vector
+     * \return A vector with all elements set to the last element of x
+     */
+    static avx_simd_float broadcast_last(avx_simd_float x) {
+        __m128 hi = _mm256_extractf128_ps(x.value, 1);
+        __m128 b  = _mm_shuffle_ps(hi, hi, 0xFF);
+
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(b), b, 1);
+    }
+};
+
+/*!
+ * \brief In-register scan of an AVX vector of double-precision values.
+ *
+ * Each 128-bit lane is scanned independently and the last value of the low
+ * lane is then combined into the high lane.
+ */
+template <>
+struct vec_scan<avx_vec, double> {
+    /*!
+     * \brief Inclusive scan of the elements of a vector
+     * \param x The vector
+     * \return the scanned vector
+     * \tparam Op The scan operation
+     */
+    template <typename Op>
+    static avx_simd_double scan(avx_simd_double x) {
+        __m128d lo = vec_scan<sse_vec, double>::scan_raw<Op>(_mm256_castpd256_pd128(x.value));
+        __m128d hi = vec_scan<sse_vec, double>::scan_raw<Op>(_mm256_extractf128_pd(x.value, 1));
+
+        hi = Op::template apply_vec<sse_vec>(sse_simd_double(_mm_unpackhi_pd(lo, lo)), sse_simd_double(hi)).value;
+
+        return _mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1);
+    }
+
+    /*!
+     * \brief Broadcast the last element of a vector
+     * \param x The vector
+     * \return A vector with all elements set to the last element of x
+     */
+    static avx_simd_double broadcast_last(avx_simd_double x) {
+        __m128d hi = _mm256_extractf128_pd(x.value, 1);
+        __m128d b  = _mm_unpackhi_pd(hi, hi);
+
+        return _mm256_insertf128_pd(_mm256_castpd128_pd256(b), b, 1);
+    }
+};
+
+#endif
+
+/*!
+ * \brief Inclusive scan of a row
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the row
+ * \param carry The value to combine with the first element
+ * \return The last value of the scan
+ * \tparam V The vectorization type
+ * \tparam Op The scan operation
+ */
+template <typename V, typename Op, typename T>
+T scan_row(const T* in, T* out, size_t n, T carry) {
+    using vec_type = V;
+    using scan     = vec_scan<V, T>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    size_t j = 0;
+
+    if (n >= vec_size) {
+        auto c = vec_type::set(carry);
+
+        for (; j + vec_size - 1 < n; j += vec_size) {
+            auto x = scan::template scan<Op>(vec_type::loadu(in + j));
+
+            x = Op::template apply_vec<vec_type>(c, x);
+
+            vec_type::storeu(out + j, x);
+
+            c = scan::broadcast_last(x);
+        }
+
+        carry = out[j - 1];
+    }
+
+    for (; j < n; ++j) {
+        carry  = Op::apply(carry, in[j]);
+        out[j] = carry;
+    }
+
+    return carry;
+}
+
+/*!
+ * \brief Combine a row with the previous row of the scan, out = prev op in
+ * \param prev The previous row of the scan
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the rows
+ * \tparam V The vectorization type
+ * \tparam Op The scan operation
+ */
+template <typename V, typename Op, typename T>
+void scan_step_row(const T* prev, const T* in, T* out, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    size_t j = 0;
+
+    for (; j + 2 * vec_size - 1 < n; j += 2 * vec_size) {
+        auto r1 = Op::template apply_vec<vec_type>(vec_type::loadu(prev + j + 0 * vec_size), vec_type::loadu(in + j + 0 * vec_size));
+        auto r2 = Op::template apply_vec<vec_type>(vec_type::loadu(prev + j + 1 * vec_size), vec_type::loadu(in + j + 1 * vec_size));
+
+        vec_type::storeu(out + j + 0 * vec_size, r1);
+        vec_type::storeu(out + j + 1 * vec_size, r2);
+    }
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        vec_type::storeu(out + j, Op::template apply_vec<vec_type>(vec_type::loadu(prev + j), vec_type::loadu(in + j)));
+    }
+
+    for (; j < n; ++j) {
+        out[j] = Op::apply(prev[j], in[j]);
+    }
+}
+
+/*!
+ * \brief Combine a value with each element of a row, out = value op out
+ * \param out The row
+ * \param n The number of elements of the row
+ * \param value The value to combine
+ * \tparam V The vectorization type
+ * \tparam Op The scan operation
+ */
+template <typename V, typename Op, typename T>
+void scan_offset_row(T* out, size_t n, T value) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto v = vec_type::set(value);
+
+    size_t j = 0;
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        vec_type::storeu(out + j, Op::template apply_vec<vec_type>(v, vec_type::loadu(out + j)));
+    }
+
+    for (; j < n; ++j) {
+        out[j] = Op::apply(value, out[j]);
+    }
+}
+
+/*!
+ * \copydoc scan_row
+ */
+template <typename Op, typename T>
+T scan_row(const T* in, T* out, size_t n, T carry) {
+    return scan_row<default_vec, Op>(in, out, n, carry);
+}
+
+/*!
+ * \copydoc scan_step_row
+ */
+template <typename Op, typename T>
+void scan_step_row(const T* prev, const T* in, T* out, size_t n) {
+    scan_step_row<default_vec, Op>(prev, in, out, n);
+}
+
+/*!
+ * \copydoc scan_offset_row
+ */
+template <typename Op, typename T>
+void scan_offset_row(T* out, size_t n, T value) {
+    scan_offset_row<default_vec, Op>(out, n, value);
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
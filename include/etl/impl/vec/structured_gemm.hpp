@@ -0,0 +1,241 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the structure-aware matrix-matrix
+ * multiplication
+ *
+ * Each narrow block of columns of B is packed and the corresponding block
+ * of each row of C is accumulated in registers, only over the rows of B
+ * that can be non-zero.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Compute y = alpha * x on contiguous arrays
+ * \param alpha The scalar factor
+ * \param x The input array
+ * \param y The output array
+ * \param n The number of elements
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void row_scal(T alpha, const T* x, T* y, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto a1 = vec_type::set(alpha);
+
+    size_t i = 0;
+
+    for (; i + 2 * vec_size <= n; i += 2 * vec_size) {
+        vec_type::storeu(y + i, vec_type::mul(a1, vec_type::loadu(x + i)));
+        vec_type::storeu(y + i + vec_size, vec_type::mul(a1, vec_type::loadu(x + i + vec_size)));
+    }
+
+    for (; i + vec_size <= n; i += vec_size) {
+        vec_type::storeu(y + i, vec_type::mul(a1, vec_type::loadu(x + i)));
+    }
+
+    for (; i < n; ++i) {
+        y[i] = alpha * x[i];
+    }
+}
+
+/*!
+ * \brief Compute c = sum(x[l] * b[l, :]) for l in [lo, hi) on w contiguous
+ * columns of b, keeping the partial sums in registers
+ * \param x The factors of the rows of b
+ * \param b The first column of b
+ * \param ldb The leading dimension of b
+ * \param lo The first row of b
+ * \param hi The end of the rows of b
+ * \param c The output array
+ * \param w The number of columns
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void structured_row(const T* x, const T* b, size_t ldb, size_t lo, size_t hi, T* c, size_t w) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    size_t j = 0;
+
+    for (; j + 4 * vec_size <= w; j += 4 * vec_size) {
+        auto r1 = vec_type::template zero<T>();
+        auto r2 = vec_type::template zero<T>();
+        auto r3 = vec_type::template zero<T>();
+        auto r4 = vec_type::template zero<T>();
+
+        for (size_t l = lo; l < hi; ++l) {
+            auto a1 = vec_type::set(x[l]);
+
+            const T* bl = b + l * ldb + j;
+
+            r1 = vec_type::fmadd(a1, vec_type::loadu(bl + 0 * vec_size), r1);
+            r2 = vec_type::fmadd(a1, vec_type::loadu(bl + 1 * vec_size), r2);
+            r3 = vec_type::fmadd(a1, vec_type::loadu(bl + 2 * vec_size), r3);
+            r4 = vec_type::fmadd(a1, vec_type::loadu(bl + 3 * vec_size), r4);
+        }
+
+        vec_type::storeu(c + j + 0 * vec_size, r1);
+        vec_type::storeu(c + j + 1 * vec_size, r2);
+        vec_type::storeu(c + j + 2 * vec_size, r3);
+        vec_type::storeu(c + j + 3 * vec_size, r4);
+    }
+
+    for (; j + vec_size <= w; j += vec_size) {
+        auto r1 = vec_type::template zero<T>();
+
+        for (size_t l = lo; l < hi; ++l) {
+            r1 = vec_type::fmadd(vec_type::set(x[l]), vec_type::loadu(b + l * ldb + j), r1);
+        }
+
+        vec_type::storeu(c + j, r1);
+    }
+
+    for (; j < w; ++j) {
+        T r1 = T(0);
+
+        for (size_t l = lo; l < hi; ++l) {
+            r1 += x[l] * b[l * ldb + j];
+        }
+
+        c[j] = r1;
+    }
+}
+
+/*!
+ * \brief Compute C = A * B for the columns [first, last) of C, with A a
+ * structured square matrix
+ *
+ * The work is split by columns since the number of non-zero elements of
+ * the rows of a triangular A is not balanced.
+ *
+ * \param s The structure of A
+ * \param a The A matrix (n x n)
+ * \param b The B matrix (n x k)
+ * \param c The C matrix (n x k)
+ * \param n The dimension of A
+ * \param k The number of columns of B
+ * \param first The first column to compute
+ * \param last The end of the columns to compute
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void structured_gemm_left(common::mm_structure s, const T* a, const T* b, T* c, size_t n, size_t k, size_t first, size_t last) {
+    static constexpr size_t block = 4 * V::template traits<T>::size;
+
+    // The product with a diagonal matrix is a scaling of the rows of B
+    if (s == common::mm_structure::DIAGONAL) {
+        for (size_t i = 0; i < n; ++i) {
+            row_scal<V>(a[i * n + i], b + i * k + first, c + i * k + first, last - first);
+        }
+
+        return;
+    }
+
+    std::vector<T> packed(n * block);
+
+    for (size_t jj = first; jj < last; jj += block) {
+        const size_t w = std::min(block, last - jj);
+
+        // Pack the block of columns of B to read it contiguously
+        for (size_t l = 0; l < n; ++l) {
+            std::copy_n(b + l * k + jj, w, packed.data() + l * w);
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            auto band = common::structure_band(s, n, i);
+
+            structured_row<V>(a + i * n, packed.data(), w, band.first, band.second, c + i * k + jj, w);
+        }
+    }
+}
+
+/*!
+ * \brief Compute C = A * D for the rows [first, last) of C, with D a
+ * diagonal matrix
+ * \param a The A matrix (m x n)
+ * \param d The diagonal of D (n)
+ * \param c The C matrix (m x n)
+ * \param n The dimension of D
+ * \param first The first row to compute
+ * \param last The end of the rows to compute
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void diagonal_gemm_right(const T* a, const T* d, T* c, size_t n, size_t first, size_t last) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    for (size_t i = first; i < last; ++i) {
+        const T* ai = a + i * n;
+        T* ci       = c + i * n;
+
+        size_t j = 0;
+
+        for (; j + vec_size <= n; j += vec_size) {
+            vec_type::storeu(ci + j, vec_type::mul(vec_type::loadu(ai + j), vec_type::loadu(d + j)));
+        }
+
+        for (; j < n; ++j) {
+            ci[j] = ai[j] * d[j];
+        }
+    }
+}
+
+/*!
+ * \brief Compute C = A * B for the rows [first, last) of C, with B a
+ * triangular matrix
+ * \param s The structure of B, which cannot be diagonal
+ * \param a The A matrix (m x n)
+ * \param b The B matrix (n x n)
+ * \param c The C matrix (m x n)
+ * \param n The dimension of B
+ * \param first The first row to compute
+ * \param last The end of the rows to compute
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void structured_gemm_right(common::mm_structure s, const T* a, const T* b, T* c, size_t n, size_t first, size_t last) {
+    static constexpr size_t block = 4 * V::template traits<T>::size;
+
+    std::vector<T> packed(n * block);
+
+    for (size_t jj = 0; jj < n; jj += block) {
+        const size_t w = std::min(block, n - jj);
+
+        auto band = common::structure_column_band(s, n, jj, jj + w);
+
+        // Pack the non-zero part of the block of columns of B to read it contiguously
+        for (size_t l = band.first; l < band.second; ++l) {
+            std::copy_n(b + l * n + jj, w, packed.data() + l * w);
+        }
+
+        for (size_t i = first; i < last; ++i) {
+            structured_row<V>(a + i * n, packed.data(), w, band.first, band.second, c + i * n + jj, w);
+        }
+    }
+}
+
+} //end of namespace vec
+
+} //end of namespace impl
+
+} //end of namespace etl
@@ -158,7 +158,7 @@ value_t<L> selected_asum(const L& lhs) {
  * \param lhs The lhs expression
  * \return the sum of the elements of lhs
  */
-template <typename L, cpp_enable_if((vec_enabled && all_vectorizable<vector_mode, L>::value))>
+template <typename L, cpp_enable_if((vec_enabled && all_vectorizable<vector_mode, L>::value && default_intrinsic_traits<value_t<L>>::vectorizable))>
 value_t<L> sum(const L& lhs) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
@@ -171,7 +171,7 @@ value_t<L> sum(const L& lhs) {
  * \param lhs The lhs expression
  * \return the absolute sum of the elements of lhs
  */
-template <typename L, cpp_enable_if((vec_enabled && all_vectorizable<vector_mode, L>::value))>
+template <typename L, cpp_enable_if((vec_enabled && all_vectorizable<vector_mode, L>::value && default_intrinsic_traits<value_t<L>>::vectorizable))>
 value_t<L> asum(const L& lhs) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
 
@@ -184,7 +184,7 @@ value_t<L> asum(const L& lhs) {
  * \param lhs The lhs expression
  * \return the sum of the elements of lhs
  */
-template <typename L, cpp_disable_if((vec_enabled && all_vectorizable<vector_mode, L>::value))>
+template <typename L, cpp_disable_if((vec_enabled && all_vectorizable<vector_mode, L>::value && default_intrinsic_traits<value_t<L>>::vectorizable))>
 value_t<L> sum(const L& lhs) {
     cpp_unused(lhs);
     cpp_unreachable("vec::sum called with invalid parameters");
@@ -195,7 +195,7 @@ value_t<L> sum(const L& lhs) {
  * \param lhs The lhs expression
  * \return the asum of the elements of lhs
  */
-template <typename L, cpp_disable_if((vec_enabled && all_vectorizable<vector_mode, L>::value))>
+template <typename L, cpp_disable_if((vec_enabled && all_vectorizable<vector_mode, L>::value && default_intrinsic_traits<value_t<L>>::vectorizable))>
 value_t<L> asum(const L& lhs) {
     cpp_unused(lhs);
     cpp_unreachable("vec::asum called with invalid parameters");
@@ -0,0 +1,93 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the top-k selection of a row
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Select the k largest elements of a row
+ *
+ * The row is processed by blocks of four vectors. The maximum of each block
+ * is computed with vector instructions and compared to the worst selected
+ * element. Only the blocks with a larger maximum go through the heap,
+ * which is rare once the heap contains good candidates.
+ *
+ * At the end, the heap contains the selected elements sorted by
+ * decreasing values.
+ *
+ * \param in The input row
+ * \param n The number of elements of the row
+ * \param k The number of elements to select
+ * \param heap The heap, with space for k elements
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void topk_row(const T* in, size_t n, size_t k, std::pair<T, size_t>* heap) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+    static constexpr size_t block    = 4 * vec_size;
+
+    common::topk_init(heap, in, k);
+
+    T maxes[vec_size];
+
+    size_t j = k;
+
+    for (; j + block - 1 < n; j += block) {
+        auto r1 = vec_type::loadu(in + j + 0 * vec_size);
+        auto r2 = vec_type::loadu(in + j + 1 * vec_size);
+        auto r3 = vec_type::loadu(in + j + 2 * vec_size);
+        auto r4 = vec_type::loadu(in + j + 3 * vec_size);
+
+        vec_type::storeu(maxes, vec_type::max(vec_type::max(r1, r2), vec_type::max(r3, r4)));
+
+        T block_max = maxes[0];
+
+        for (size_t v = 1; v < vec_size; ++v) {
+            block_max = std::max(block_max, maxes[v]);
+        }
+
+        if (block_max > heap[0].first) {
+            for (size_t jj = j; jj < j + block; ++jj) {
+                common::topk_push(heap, k, in[jj], jj);
+            }
+        }
+    }
+
+    for (; j < n; ++j) {
+        common::topk_push(heap, k, in[j], j);
+    }
+
+    common::topk_sort(heap, k);
+}
+
+/*!
+ * \brief Select the k largest elements of a row
+ * \param in The input row
+ * \param n The number of elements of the row
+ * \param k The number of elements to select
+ * \param heap The heap, with space for k elements
+ */
+template <typename T>
+void topk_row(const T* in, size_t n, size_t k, std::pair<T, size_t>* heap) {
+    topk_row<default_vec>(in, n, k, heap);
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
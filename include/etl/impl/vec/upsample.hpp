@@ -0,0 +1,221 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the upsampling row kernels
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Upsample a row of n elements by a factor of 2
+ *
+ * Each vector of the input is interleaved with itself into two vectors of
+ * the output.
+ *
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the input row
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void upsample_row_2x(const T* in, T* out, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    size_t k = 0;
+
+    for (; k + vec_size - 1 < n; k += vec_size) {
+        auto r1 = vec_type::loadu(in + k);
+
+        interleave_storeu<V>(out + 2 * k, r1, r1);
+    }
+
+    for (; k < n; ++k) {
+        out[2 * k + 0] = in[k];
+        out[2 * k + 1] = in[k];
+    }
+}
+
+/*!
+ * \brief Upsample a row of n elements by a factor of 4
+ *
+ * Each vector of the input is interleaved with itself twice into four
+ * vectors of the output.
+ *
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the input row
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void upsample_row_4x(const T* in, T* out, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    alignas(vec_type::template traits<T>::alignment) T twice[2 * vec_size];
+
+    size_t k = 0;
+
+    for (; k + vec_size - 1 < n; k += vec_size) {
+        auto r1 = vec_type::loadu(in + k);
+
+        interleave_storeu<V>(twice, r1, r1);
+
+        auto r2 = vec_type::load(twice);
+        auto r3 = vec_type::load(twice + vec_size);
+
+        interleave_storeu<V>(out + 4 * k, r2, r2);
+        interleave_storeu<V>(out + 4 * k + 2 * vec_size, r3, r3);
+    }
+
+    for (; k < n; ++k) {
+        for (size_t kk = 0; kk < 4; ++kk) {
+            out[4 * k + kk] = in[k];
+        }
+    }
+}
+
+/*!
+ * \brief Upsample a row of n elements, each element of in is replicated c
+ * times in out
+ *
+ * The factors 2 and 4 interleave vectors of the input with themselves.
+ * The other factors broadcast each element into a register and store it
+ * with vector stores. When the factor is smaller than a vector, the store
+ * of each element overlaps the block of the next elements, which is
+ * overwritten by their own stores.
+ *
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the input row
+ * \param c The upsampling factor
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void upsample_row(const T* in, T* out, size_t n, size_t c) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    if (c == 1) {
+        copy_row<V>(in, out, n);
+    } else if (c == 2) {
+        upsample_row_2x<V>(in, out, n);
+    } else if (c == 4 && vec_size >= 4) {
+        upsample_row_4x<V>(in, out, n);
+    } else if (c >= vec_size) {
+        for (size_t k = 0; k < n; ++k) {
+            auto r1 = vec_type::set(in[k]);
+
+            T* block = out + k * c;
+
+            size_t kk = 0;
+
+            for (; kk + vec_size - 1 < c; kk += vec_size) {
+                vec_type::storeu(block + kk, r1);
+            }
+
+            for (; kk < c; ++kk) {
+                block[kk] = in[k];
+            }
+        }
+    } else {
+        size_t k = 0;
+
+        for (; k * c + vec_size <= n * c; ++k) {
+            vec_type::storeu(out + k * c, vec_type::set(in[k]));
+        }
+
+        for (; k < n; ++k) {
+            for (size_t kk = 0; kk < c; ++kk) {
+                out[k * c + kk] = in[k];
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Linear interpolation of two rows, out = a + l * (b - a)
+ * \param a The first row
+ * \param b The second row
+ * \param out The output row
+ * \param n The number of elements of the rows
+ * \param l The interpolation weight of the second row
+ * \tparam V The vectorization type
+ */
+template <typename V, typename T>
+void lerp_row(const T* a, const T* b, T* out, size_t n, T l) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto lv = vec_type::set(l);
+
+    size_t j = 0;
+
+    for (; j + 2 * vec_size - 1 < n; j += 2 * vec_size) {
+        auto a1 = vec_type::loadu(a + j + 0 * vec_size);
+        auto a2 = vec_type::loadu(a + j + 1 * vec_size);
+
+        auto d1 = vec_type::sub(vec_type::loadu(b + j + 0 * vec_size), a1);
+        auto d2 = vec_type::sub(vec_type::loadu(b + j + 1 * vec_size), a2);
+
+        vec_type::storeu(out + j + 0 * vec_size, vec_type::fmadd(lv, d1, a1));
+        vec_type::storeu(out + j + 1 * vec_size, vec_type::fmadd(lv, d2, a2));
+    }
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        auto a1 = vec_type::loadu(a + j);
+        auto d1 = vec_type::sub(vec_type::loadu(b + j), a1);
+
+        vec_type::storeu(out + j, vec_type::fmadd(lv, d1, a1));
+    }
+
+    for (; j < n; ++j) {
+        out[j] = a[j] + l * (b[j] - a[j]);
+    }
+}
+
+/*!
+ * \brief Upsample a row of n elements, each element of in is replicated c
+ * times in out
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the input row
+ * \param c The upsampling factor
+ */
+template <typename T>
+void upsample_row(const T* in, T* out, size_t n, size_t c) {
+    upsample_row<default_vec>(in, out, n, c);
+}
+
+/*!
+ * \brief Linear interpolation of two rows, out = a + l * (b - a)
+ * \param a The first row
+ * \param b The second row
+ * \param out The output row
+ * \param n The number of elements of the rows
+ * \param l The interpolation weight of the second row
+ */
+template <typename T>
+void lerp_row(const T* a, const T* b, T* out, size_t n, T l) {
+    lerp_row<default_vec>(a, b, out, n, l);
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
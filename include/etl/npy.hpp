@@ -0,0 +1,1195 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Reader and writer of the NumPy .npy and .npz formats
+ *
+ * A .npy file is made of a magic string, a version, a header (a Python
+ * dictionary literal with the type, the order and the shape of the array)
+ * and then the raw memory of the array. The C order of NumPy corresponds to
+ * order::RowMajor and the Fortran order to order::ColumnMajor.
+ *
+ * A .npz file is a zip archive of .npy files. Only stored (uncompressed)
+ * archives are supported.
+ *
+ * As the rest of ETL, these functions do not throw, they return false when
+ * the file cannot be read or written.
+ */
+
+#pragma once
+
+#include <cstring> //For memcpy
+#include <fstream>
+#include <string>
+
+#include "etl/util/tensor_format.hpp" //For the size checks
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ETL_NPY_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace etl {
+
+namespace detail {
+
+constexpr size_t npy_magic_size = 6;  ///< The size of the magic string of the npy format
+constexpr size_t npy_alignment  = 64; ///< The alignment of the data in the npy files written by ETL
+
+/*!
+ * \brief Returns the magic string of the npy format
+ */
+inline const char* npy_magic() {
+    return "\x93NUMPY";
+}
+
+/*!
+ * \brief Returns the NumPy type descriptor of the type T.
+ *
+ * The values are always written in little endian.
+ */
+template <typename T>
+const char* npy_descr() {
+    return std::is_same<T, float>::value ? "<f4"
+         : std::is_same<T, double>::value ? "<f8"
+         : std::is_same<T, bool>::value ? "|b1"
+         : std::is_same<T, int8_t>::value ? "|i1"
+         : std::is_same<T, int16_t>::value ? "<i2"
+         : std::is_same<T, int32_t>::value ? "<i4"
+         : std::is_same<T, int64_t>::value ? "<i8"
+         : std::is_same<T, uint8_t>::value ? "|u1"
+         : std::is_same<T, uint16_t>::value ? "<u2"
+         : std::is_same<T, uint32_t>::value ? "<u4"
+         : std::is_same<T, uint64_t>::value ? "<u8"
+         : (std::is_same<T, std::complex<float>>::value || std::is_same<T, etl::complex<float>>::value) ? "<c8"
+         : (std::is_same<T, std::complex<double>>::value || std::is_same<T, etl::complex<double>>::value) ? "<c16"
+         : nullptr;
+}
+
+/*!
+ * \brief Indicates if the given descriptor read from a file corresponds to the type T
+ * \param descr The descriptor read from the file
+ */
+template <typename T>
+bool npy_descr_match(const std::string& descr) {
+    const char* expected = npy_descr<T>();
+
+    if (!expected || descr.size() < 2) {
+        return false;
+    }
+
+    // Native order ('=') is little endian as well on the supported platforms
+    const bool little = descr[0] == '<' || descr[0] == '|' || descr[0] == '=';
+
+    return little && descr.substr(1) == expected + 1;
+}
+
+/*!
+ * \brief The header of a npy array
+ */
+struct npy_header {
+    std::string descr;          ///< The type descriptor
+    bool fortran_order = false; ///< Indicates if the data is in Fortran (column-major) order
+    std::vector<size_t> shape;  ///< The shape of the array
+    size_t data_offset = 0;     ///< The offset of the data from the start of the array
+
+    /*!
+     * \brief Returns the number of elements of the array
+     */
+    size_t size() const {
+        size_t s = 1;
+
+        for (auto d : shape) {
+            s *= d;
+        }
+
+        return s;
+    }
+};
+
+/*!
+ * \brief Parse the dictionary of a npy header
+ * \param dict The dictionary literal
+ * \param header The header to fill
+ * \return true if the dictionary is valid, false otherwise
+ */
+inline bool npy_parse_dict(const std::string& dict, npy_header& header) {
+    // 1. The type descriptor
+
+    auto descr = dict.find("'descr'");
+
+    if (descr == std::string::npos) {
+        return false;
+    }
+
+    auto first = dict.find('\'', dict.find(':', descr));
+    auto last  = first == std::string::npos ? first : dict.find('\'', first + 1);
+
+    if (last == std::string::npos) {
+        return false;
+    }
+
+    header.descr = dict.substr(first + 1, last - first - 1);
+
+    // 2. The order
+
+    auto fortran = dict.find("'fortran_order'");
+
+    if (fortran == std::string::npos) {
+        return false;
+    }
+
+    auto value = dict.find_first_not_of(" :", fortran + 15);
+
+    header.fortran_order = value != std::string::npos && dict.compare(value, 4, "True") == 0;
+
+    // 3. The shape
+
+    auto shape = dict.find("'shape'");
+
+    if (shape == std::string::npos) {
+        return false;
+    }
+
+    auto open  = dict.find('(', shape);
+    auto close = open == std::string::npos ? open : dict.find(')', open);
+
+    if (close == std::string::npos) {
+        return false;
+    }
+
+    header.shape.clear();
+
+    for (size_t i = open + 1; i < close;) {
+        if (dict[i] >= '0' && dict[i] <= '9') {
+            size_t d = 0;
+
+            while (i < close && dict[i] >= '0' && dict[i] <= '9') {
+                d = d * 10 + size_t(dict[i] - '0');
+                ++i;
+            }
+
+            header.shape.push_back(d);
+        } else {
+            ++i;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Read the header of a npy array from a stream
+ * \param is The stream, positioned at the start of the array
+ * \param header The header to fill
+ * \return true if the header is valid, false otherwise
+ */
+inline bool npy_read_header(std::istream& is, npy_header& header) {
+    char preamble[npy_magic_size + 2];
+
+    if (!is.read(preamble, sizeof(preamble)) || std::memcmp(preamble, npy_magic(), npy_magic_size) != 0) {
+        return false;
+    }
+
+    const auto major = uint8_t(preamble[npy_magic_size]);
+
+    uint32_t length = 0;
+
+    if (major == 1) {
+        uint8_t l[2];
+        is.read(reinterpret_cast<char*>(l), 2);
+        length = uint32_t(l[0]) | (uint32_t(l[1]) << 8);
+    } else if (major == 2 || major == 3) {
+        uint8_t l[4];
+        is.read(reinterpret_cast<char*>(l), 4);
+        length = uint32_t(l[0]) | (uint32_t(l[1]) << 8) | (uint32_t(l[2]) << 16) | (uint32_t(l[3]) << 24);
+    } else {
+        return false;
+    }
+
+    std::string dict(length, ' ');
+
+    if (!is.read(&dict[0], length)) {
+        return false;
+    }
+
+    header.data_offset = sizeof(preamble) + (major == 1 ? 2 : 4) + length;
+
+    return npy_parse_dict(dict, header);
+}
+
+/*!
+ * \brief Read the header of a npy array from memory
+ * \param data The memory of the array
+ * \param n The number of bytes available
+ * \param header The header to fill
+ * \return true if the header is valid, false otherwise
+ */
+inline bool npy_read_header(const char* data, size_t n, npy_header& header) {
+    if (n < npy_magic_size + 4 || std::memcmp(data, npy_magic(), npy_magic_size) != 0) {
+        return false;
+    }
+
+    const auto major = uint8_t(data[npy_magic_size]);
+    const auto l     = reinterpret_cast<const uint8_t*>(data + npy_magic_size + 2);
+
+    size_t offset;
+    size_t length;
+
+    if (major == 1) {
+        offset = npy_magic_size + 4;
+        length = size_t(l[0]) | (size_t(l[1]) << 8);
+    } else if ((major == 2 || major == 3) && n >= npy_magic_size + 6) {
+        offset = npy_magic_size + 6;
+        length = size_t(l[0]) | (size_t(l[1]) << 8) | (size_t(l[2]) << 16) | (size_t(l[3]) << 24);
+    } else {
+        return false;
+    }
+
+    if (offset + length > n) {
+        return false;
+    }
+
+    header.data_offset = offset + length;
+
+    return npy_parse_dict(std::string(data + offset, length), header);
+}
+
+/*!
+ * \brief Create the header (preamble and dictionary) of a npy array
+ * \param matrix The matrix to save
+ * \return the header, padded so that the data is aligned on npy_alignment bytes
+ */
+template <typename M>
+std::string npy_make_header(const M& matrix) {
+    std::string dict = "{'descr': '";
+    dict += npy_descr<value_t<M>>();
+    dict += "', 'fortran_order': ";
+    dict += decay_traits<M>::storage_order == order::RowMajor ? "False" : "True";
+    dict += ", 'shape': (";
+
+    for (size_t d = 0; d < etl::dimensions(matrix); ++d) {
+        if (d > 0) {
+            dict += ", ";
+        }
+
+        dict += std::to_string(etl::dim(matrix, d));
+    }
+
+    // A tuple of one element needs a trailing comma
+    if (etl::dimensions(matrix) == 1) {
+        dict += ",";
+    }
+
+    dict += "), }";
+
+    const bool large         = dict.size() + npy_magic_size + 5 > 65535;
+    const size_t preamble    = npy_magic_size + (large ? 6 : 4);
+    const size_t total       = ((preamble + dict.size() + 1 + npy_alignment - 1) / npy_alignment) * npy_alignment;
+    const size_t dict_length = total - preamble;
+
+    dict.append(dict_length - dict.size() - 1, ' ');
+    dict += '\n';
+
+    std::string header(npy_magic(), npy_magic_size);
+
+    header += char(large ? 2 : 1);
+    header += char(0);
+
+    header += char(dict_length & 0xFF);
+    header += char((dict_length >> 8) & 0xFF);
+
+    if (large) {
+        header += char((dict_length >> 16) & 0xFF);
+        header += char((dict_length >> 24) & 0xFF);
+    }
+
+    return header + dict;
+}
+
+/*!
+ * \brief Returns the number of bytes of the memory of the matrix
+ */
+template <typename M>
+size_t npy_data_size(const M& matrix) {
+    return etl::size(matrix) * sizeof(value_t<M>);
+}
+
+/*!
+ * \brief Build a custom_dyn_matrix_impl from dimensions stored in a container
+ */
+template <typename T, order SO, size_t D, typename Dims, size_t... I>
+custom_dyn_matrix_impl<T, SO, D> npy_custom(T* memory, const Dims& dims, const std::index_sequence<I...>& /*seq*/) {
+    return custom_dyn_matrix_impl<T, SO, D>(memory, dims[I]...);
+}
+
+/*!
+ * \brief Prepare a dyn matrix to receive the array: it is resized
+ * \param matrix The matrix
+ * \param header The header of the array
+ * \return true
+ */
+template <typename T, order SO, size_t D>
+bool npy_prepare(dyn_matrix_impl<T, SO, D>& matrix, const npy_header& header) {
+    std::array<size_t, D> dims;
+    std::copy_n(header.shape.begin(), D, dims.begin());
+
+    matrix.resize_arr(dims);
+
+    return true;
+}
+
+/*!
+ * \brief Prepare a matrix of fixed dimensions to receive the array
+ * \param matrix The matrix
+ * \param header The header of the array
+ * \return true if the array has the same dimensions as the matrix, false otherwise
+ */
+template <typename M>
+bool npy_prepare(M& matrix, const npy_header& header) {
+    for (size_t d = 0; d < etl::dimensions(matrix); ++d) {
+        if (header.shape[d] != etl::dim(matrix, d)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Validate the header of an array to be read into a matrix and prepare the matrix
+ * \param matrix The matrix
+ * \param header The header of the array
+ * \return true if the array can be read into the matrix, false otherwise
+ */
+template <typename M>
+bool npy_check(M& matrix, const npy_header& header) {
+    return npy_descr_match<value_t<M>>(header.descr)
+        && header.shape.size() == decay_traits<M>::dimensions()
+        && npy_prepare(matrix, header);
+}
+
+/*!
+ * \brief Convert an array from one storage order to the other
+ * \param src The source array
+ * \param dst The destination array
+ * \param dims The dimensions of the array
+ * \param src_fortran Indicates if the source is in Fortran order (then the destination is in C order)
+ */
+template <typename T>
+void npy_convert_order(const T* src, T* dst, const std::vector<size_t>& dims, bool src_fortran) {
+    const size_t D = dims.size();
+
+    size_t n = 1;
+    std::vector<size_t> strides(D);
+
+    // The strides of the column-major order
+    for (size_t d = 0; d < D; ++d) {
+        strides[d] = n;
+        n *= dims[d];
+    }
+
+    std::vector<size_t> index(D, 0);
+
+    size_t cm = 0;
+
+    // Iterate in row-major order, updating the column-major position
+    for (size_t rm = 0; rm < n; ++rm) {
+        if (src_fortran) {
+            dst[rm] = src[cm];
+        } else {
+            dst[cm] = src[rm];
+        }
+
+        for (size_t d = D; d-- > 0;) {
+            cm += strides[d];
+
+            if (++index[d] < dims[d]) {
+                break;
+            }
+
+            cm -= strides[d] * dims[d];
+            index[d] = 0;
+        }
+    }
+}
+
+/*!
+ * \brief Copy the data of an array to a matrix, converting the storage order if necessary
+ * \param matrix The matrix, with the dimensions of the array
+ * \param header The header of the array
+ * \param data The data of the array
+ */
+template <typename M>
+void npy_assign(M& matrix, const npy_header& header, const value_t<M>* data) {
+    const bool same_order = header.fortran_order == (decay_traits<M>::storage_order == order::ColumnMajor);
+
+    if (same_order) {
+        std::memcpy(matrix.memory_start(), data, npy_data_size(matrix));
+    } else {
+        npy_convert_order(data, matrix.memory_start(), header.shape, header.fortran_order);
+    }
+
+    matrix.invalidate_gpu();
+}
+
+/*!
+ * \brief Read an array from a stream into a matrix
+ * \param is The stream, positioned at the start of the array
+ * \param matrix The matrix to fill
+ * \return true if the array has been read, false otherwise
+ */
+template <typename M>
+bool npy_load(std::istream& is, M& matrix) {
+    npy_header header;
+
+    if (!npy_read_header(is, header)) {
+        return false;
+    }
+
+    // The shape is validated against the rest of the stream before allocating the memory
+    size_t bytes;
+
+    if (!checked_data_size(header.shape.begin(), header.shape.end(), sizeof(value_t<M>), bytes) || bytes > stream_remaining(is) || !npy_check(matrix, header)) {
+        return false;
+    }
+
+    const bool same_order = header.fortran_order == (decay_traits<M>::storage_order == order::ColumnMajor);
+
+    // Read directly into the matrix when the order is the same
+    if (same_order) {
+        is.read(reinterpret_cast<char*>(matrix.memory_start()), npy_data_size(matrix));
+        matrix.invalidate_gpu();
+        return bool(is);
+    }
+
+    std::vector<value_t<M>> data(etl::size(matrix));
+
+    if (!is.read(reinterpret_cast<char*>(data.data()), npy_data_size(matrix))) {
+        return false;
+    }
+
+    npy_assign(matrix, header, data.data());
+
+    return true;
+}
+
+/*!
+ * \brief Compute the CRC-32 (as used by zip) of a block of memory.
+ *
+ * The computation is done 8 bytes at a time with the slicing-by-8
+ * algorithm.
+ *
+ * \param crc The CRC of the previous blocks (0 for the first block)
+ * \param data The memory
+ * \param n The number of bytes
+ * \return The CRC of the previous blocks and of this block
+ */
+inline uint32_t crc32(uint32_t crc, const void* data, size_t n) {
+    static const auto tables = [] {
+        std::array<std::array<uint32_t, 256>, 8> t;
+
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+
+            for (size_t k = 0; k < 8; ++k) {
+                c = (c & 1) ? 0xEDB88320U ^ (c >> 1) : c >> 1;
+            }
+
+            t[0][i] = c;
+        }
+
+        for (uint32_t i = 0; i < 256; ++i) {
+            for (size_t s = 1; s < 8; ++s) {
+                t[s][i] = (t[s - 1][i] >> 8) ^ t[0][t[s - 1][i] & 0xFF];
+            }
+        }
+
+        return t;
+    }();
+
+    auto bytes = static_cast<const uint8_t*>(data);
+
+    crc = ~crc;
+
+    for (; n >= 8; n -= 8, bytes += 8) {
+        uint32_t lo;
+        uint32_t hi;
+
+        std::memcpy(&lo, bytes, 4);
+        std::memcpy(&hi, bytes + 4, 4);
+
+        lo ^= crc;
+
+        crc = tables[7][lo & 0xFF] ^ tables[6][(lo >> 8) & 0xFF] ^ tables[5][(lo >> 16) & 0xFF] ^ tables[4][lo >> 24]
+            ^ tables[3][hi & 0xFF] ^ tables[2][(hi >> 8) & 0xFF] ^ tables[1][(hi >> 16) & 0xFF] ^ tables[0][hi >> 24];
+    }
+
+    for (; n; --n, ++bytes) {
+        crc = tables[0][(crc ^ *bytes) & 0xFF] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+/*!
+ * \brief Write a little endian integer to a stream
+ * \param os The stream
+ * \param value The value to write
+ * \tparam B The number of bytes to write
+ */
+template <size_t B>
+void zip_put(std::ostream& os, uint64_t value) {
+    char bytes[B];
+
+    for (size_t i = 0; i < B; ++i) {
+        bytes[i] = char((value >> (8 * i)) & 0xFF);
+    }
+
+    os.write(bytes, B);
+}
+
+/*!
+ * \brief Read a little endian integer from memory
+ * \param data The memory
+ * \tparam B The number of bytes to read
+ * \return the integer
+ */
+template <size_t B>
+uint64_t zip_get(const char* data) {
+    uint64_t value = 0;
+
+    for (size_t i = 0; i < B; ++i) {
+        value |= uint64_t(uint8_t(data[i])) << (8 * i);
+    }
+
+    return value;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Save a matrix in the .npy format.
+ *
+ * The type of the values, the storage order and the dimensions of the
+ * matrix are saved in the header of the file.
+ *
+ * \param path The path to the file
+ * \param matrix The matrix to save (dyn, fast or custom matrix)
+ * \return true if the matrix has been saved, false otherwise
+ */
+template <typename M>
+bool save_npy(const std::string& path, const M& matrix) {
+    static_assert(all_dma<M>::value, "save_npy is only implemented for direct memory access");
+
+    if (!detail::npy_descr<value_t<M>>()) {
+        return false;
+    }
+
+    std::ofstream os(path, std::ios::binary);
+
+    auto header = detail::npy_make_header(matrix);
+
+    matrix.ensure_cpu_up_to_date();
+
+    os.write(header.data(), header.size());
+    os.write(reinterpret_cast<const char*>(matrix.memory_start()), detail::npy_data_size(matrix));
+
+    return bool(os);
+}
+
+/*!
+ * \brief Load a matrix from a .npy file.
+ *
+ * A dyn matrix is resized to the shape of the array, a fast or custom
+ * matrix must have the same dimensions as the array. The type of the
+ * values must be the type of the file. If the order of the file is not the
+ * order of the matrix, the data is converted.
+ *
+ * \param path The path to the file
+ * \param matrix The matrix to fill (dyn, fast or custom matrix)
+ * \return true if the matrix has been loaded, false otherwise
+ */
+template <typename M>
+bool load_npy(const std::string& path, M& matrix) {
+    static_assert(all_dma<M>::value, "load_npy is only implemented for direct memory access");
+
+    std::ifstream is(path, std::ios::binary);
+
+    return is && detail::npy_load(is, matrix);
+}
+
+/*!
+ * \brief A .npy array mapped in memory.
+ *
+ * When the file can be mapped and its data is correctly aligned and in the
+ * requested order, the matrix directly uses the memory of the mapped file
+ * (copy-on-write, the file is never modified). Otherwise, the data is
+ * copied (and converted to the requested order).
+ *
+ * \tparam T The type of the values
+ * \tparam SO The storage order of the matrix
+ * \tparam D The number of dimensions
+ */
+template <typename T, order SO, size_t D>
+struct mapped_npy {
+    using matrix_type = custom_dyn_matrix_impl<T, SO, D>; ///< The type of matrix view
+
+    /*!
+     * \brief Construct an invalid mapping
+     */
+    mapped_npy() = default;
+
+    /*!
+     * \brief Map the given .npy file
+     * \param path The path to the file
+     */
+    explicit mapped_npy(const std::string& path) {
+#ifdef ETL_NPY_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+
+        if (fd < 0) {
+            return;
+        }
+
+        struct stat st;
+
+        if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* base = ::mmap(nullptr, size_t(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+            if (base != MAP_FAILED) {
+                map_base = base;
+                map_size = size_t(st.st_size);
+            }
+        }
+
+        ::close(fd);
+
+        if (map_base) {
+            init(static_cast<char*>(map_base), map_size);
+        }
+#else
+        std::ifstream is(path, std::ios::binary | std::ios::ate);
+
+        if (is) {
+            std::vector<char> content(size_t(is.tellg()));
+            is.seekg(0);
+            is.read(content.data(), content.size());
+            init(content.data(), content.size());
+        }
+#endif
+    }
+
+    mapped_npy(const mapped_npy& rhs) = delete;
+    mapped_npy& operator=(const mapped_npy& rhs) = delete;
+
+    /*!
+     * \brief Move construct a mapping
+     * \param rhs The mapping to move from
+     */
+    mapped_npy(mapped_npy&& rhs) noexcept {
+        *this = std::move(rhs);
+    }
+
+    /*!
+     * \brief Move assign a mapping
+     * \param rhs The mapping to move from
+     * \return a reference to this mapping
+     */
+    mapped_npy& operator=(mapped_npy&& rhs) noexcept {
+        if (this != &rhs) {
+            release();
+
+            map_base = rhs.map_base;
+            map_size = rhs.map_size;
+            owned    = std::move(rhs.owned);
+            data     = rhs.data;
+            dims     = rhs.dims;
+
+            rhs.map_base = nullptr;
+            rhs.map_size = 0;
+            rhs.data     = nullptr;
+        }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Unmap the file
+     */
+    ~mapped_npy() {
+        release();
+    }
+
+    /*!
+     * \brief Indicates if the array has been successfully loaded
+     */
+    bool valid() const noexcept {
+        return data != nullptr;
+    }
+
+    /*!
+     * \brief Indicates if the matrix directly uses the memory of the mapped file
+     */
+    bool is_mapped() const noexcept {
+        return data != nullptr && owned.empty();
+    }
+
+    /*!
+     * \brief Returns a matrix view on the array.
+     *
+     * The view must not outlive the mapping.
+     */
+    matrix_type matrix() const {
+        return detail::npy_custom<T, SO, D>(data, dims, std::make_index_sequence<D>());
+    }
+
+private:
+    void* map_base = nullptr;   ///< The base address of the mapping
+    size_t map_size = 0;        ///< The size of the mapping
+    std::vector<T> owned;       ///< The memory of the array when it cannot be used in place
+    T* data = nullptr;          ///< Pointer to the values of the array
+    std::array<size_t, D> dims; ///< The dimensions of the array
+
+    /*!
+     * \brief Initialize the mapping from the content of the file
+     * \param content The content of the file
+     * \param n The number of bytes of the file
+     */
+    void init(char* content, size_t n) {
+        detail::npy_header header;
+
+        if (!detail::npy_read_header(content, n, header) || !detail::npy_descr_match<T>(header.descr) || header.shape.size() != D) {
+            release();
+            return;
+        }
+
+        size_t bytes;
+
+        if (!detail::checked_data_size(header.shape.begin(), header.shape.end(), sizeof(T), bytes) || bytes > n - header.data_offset) {
+            release();
+            return;
+        }
+
+        std::copy_n(header.shape.begin(), D, dims.begin());
+
+        char* payload = content + header.data_offset;
+
+        const bool same_order = header.fortran_order == (SO == order::ColumnMajor);
+        const bool aligned    = reinterpret_cast<uintptr_t>(payload) % alignof(T) == 0;
+
+        if (map_base && same_order && aligned) {
+            data = reinterpret_cast<T*>(payload);
+            return;
+        }
+
+        // The data cannot be used in place, it is copied
+
+        std::vector<T> source(header.size());
+        std::memcpy(source.data(), payload, header.size() * sizeof(T));
+
+        owned.resize(header.size());
+
+        auto m = detail::npy_custom<T, SO, D>(owned.data(), dims, std::make_index_sequence<D>());
+        detail::npy_assign(m, header, source.data());
+
+        release();
+
+        data = owned.data();
+    }
+
+    /*!
+     * \brief Release the mapping of the file
+     */
+    void release() {
+#ifdef ETL_NPY_MMAP
+        if (map_base) {
+            ::munmap(map_base, map_size);
+        }
+#endif
+
+        map_base = nullptr;
+        map_size = 0;
+    }
+};
+
+/*!
+ * \brief Map a .npy file in memory.
+ *
+ * The matrix of the returned mapping uses directly the memory of the file
+ * when possible, see mapped_npy.
+ *
+ * \param path The path to the file
+ * \tparam T The type of the values
+ * \tparam D The number of dimensions
+ * \tparam SO The storage order of the matrix
+ * \return the mapping, invalid if the file cannot be read as a D-dimensional array of T
+ */
+template <typename T, size_t D, order SO = order::RowMajor>
+mapped_npy<T, SO, D> map_npy(const std::string& path) {
+    return mapped_npy<T, SO, D>(path);
+}
+
+/*!
+ * \brief Writer of uncompressed .npz archives.
+ *
+ * The archive is completed when the writer is closed or destructed.
+ */
+struct npz_writer {
+    /*!
+     * \brief Create a new archive
+     * \param path The path of the archive
+     */
+    explicit npz_writer(const std::string& path) : stream(path, std::ios::binary) {}
+
+    npz_writer(const npz_writer& rhs) = delete;
+    npz_writer& operator=(const npz_writer& rhs) = delete;
+
+    /*!
+     * \brief Close the archive
+     */
+    ~npz_writer() {
+        close();
+    }
+
+    /*!
+     * \brief Add a matrix to the archive
+     * \param name The name of the array (without the .npy extension)
+     * \param matrix The matrix to save
+     * \return true if the matrix has been written, false otherwise
+     */
+    template <typename M>
+    bool add(const std::string& name, const M& matrix) {
+        static_assert(all_dma<M>::value, "npz_writer is only implemented for direct memory access");
+
+        if (closed || !detail::npy_descr<value_t<M>>()) {
+            return false;
+        }
+
+        matrix.ensure_cpu_up_to_date();
+
+        const auto header     = detail::npy_make_header(matrix);
+        const auto data       = reinterpret_cast<const char*>(matrix.memory_start());
+        const auto data_size  = detail::npy_data_size(matrix);
+        const uint64_t size   = header.size() + data_size;
+        const uint64_t offset = uint64_t(stream.tellp());
+
+        // Zip64 is not supported when writing
+        if (size >= 0xFFFFFFFFULL || offset >= 0xFFFFFFFFULL) {
+            return false;
+        }
+
+        entry e;
+        e.name   = name + ".npy";
+        e.size   = size;
+        e.offset = offset;
+        e.crc    = detail::crc32(detail::crc32(0, header.data(), header.size()), data, data_size);
+
+        write_header(e, 0x04034b50);
+
+        stream.write(e.name.data(), e.name.size());
+        stream.write(header.data(), header.size());
+        stream.write(data, data_size);
+
+        entries.push_back(e);
+
+        return bool(stream);
+    }
+
+    /*!
+     * \brief Complete the archive with its central directory
+     * \return true if the archive has been written, false otherwise
+     */
+    bool close() {
+        if (closed) {
+            return bool(stream);
+        }
+
+        closed = true;
+
+        const uint64_t cd_offset = uint64_t(stream.tellp());
+
+        for (auto& e : entries) {
+            write_header(e, 0x02014b50);
+            stream.write(e.name.data(), e.name.size());
+        }
+
+        const uint64_t cd_size = uint64_t(stream.tellp()) - cd_offset;
+
+        detail::zip_put<4>(stream, 0x06054b50); // End of central directory
+        detail::zip_put<2>(stream, 0);
+        detail::zip_put<2>(stream, 0);
+        detail::zip_put<2>(stream, entries.size());
+        detail::zip_put<2>(stream, entries.size());
+        detail::zip_put<4>(stream, cd_size);
+        detail::zip_put<4>(stream, cd_offset);
+        detail::zip_put<2>(stream, 0);
+
+        stream.close();
+
+        return !stream.fail();
+    }
+
+private:
+    /*!
+     * \brief An entry of the archive
+     */
+    struct entry {
+        std::string name; ///< The name of the file
+        uint64_t size;    ///< The size of the file
+        uint64_t offset;  ///< The offset of the local header
+        uint32_t crc;     ///< The CRC-32 of the file
+    };
+
+    std::ofstream stream;       ///< The stream to the archive
+    std::vector<entry> entries; ///< The entries already written
+    bool closed = false;        ///< Indicates if the archive has been closed
+
+    /*!
+     * \brief Write the local or central header of an entry, without the name
+     * \param e The entry
+     * \param signature The signature of the header
+     */
+    void write_header(const entry& e, uint32_t signature) {
+        const bool central = signature == 0x02014b50;
+
+        detail::zip_put<4>(stream, signature);
+
+        if (central) {
+            detail::zip_put<2>(stream, 20); // Version made by
+        }
+
+        detail::zip_put<2>(stream, 20);   // Version needed
+        detail::zip_put<2>(stream, 0);    // Flags
+        detail::zip_put<2>(stream, 0);    // Method (stored)
+        detail::zip_put<2>(stream, 0);    // Time
+        detail::zip_put<2>(stream, 0x21); // Date (1980-01-01)
+        detail::zip_put<4>(stream, e.crc);
+        detail::zip_put<4>(stream, e.size);
+        detail::zip_put<4>(stream, e.size);
+        detail::zip_put<2>(stream, e.name.size());
+        detail::zip_put<2>(stream, 0); // Extra length
+
+        if (central) {
+            detail::zip_put<2>(stream, 0); // Comment length
+            detail::zip_put<2>(stream, 0); // Disk
+            detail::zip_put<2>(stream, 0); // Internal attributes
+            detail::zip_put<4>(stream, 0); // External attributes
+            detail::zip_put<4>(stream, e.offset);
+        }
+    }
+};
+
+/*!
+ * \brief Reader of uncompressed .npz archives.
+ *
+ * Zip64 archives (as written by NumPy for large arrays) are supported.
+ */
+struct npz_reader {
+    /*!
+     * \brief Open an archive and read its central directory
+     * \param path The path of the archive
+     */
+    explicit npz_reader(const std::string& path) : stream(path, std::ios::binary) {
+        read_directory();
+    }
+
+    /*!
+     * \brief Indicates if the archive has been opened successfully
+     */
+    bool valid() const noexcept {
+        return is_valid;
+    }
+
+    /*!
+     * \brief Returns the names of the arrays of the archive (without the .npy extension)
+     */
+    std::vector<std::string> names() const {
+        std::vector<std::string> result;
+
+        for (auto& e : entries) {
+            result.push_back(e.name.size() > 4 && e.name.compare(e.name.size() - 4, 4, ".npy") == 0 ? e.name.substr(0, e.name.size() - 4) : e.name);
+        }
+
+        return result;
+    }
+
+    /*!
+     * \brief Load an array of the archive into a matrix
+     * \param name The name of the array (with or without the .npy extension)
+     * \param matrix The matrix to fill, see load_npy
+     * \return true if the matrix has been loaded, false otherwise
+     */
+    template <typename M>
+    bool load(const std::string& name, M& matrix) {
+        static_assert(all_dma<M>::value, "npz_reader is only implemented for direct memory access");
+
+        for (auto& e : entries) {
+            if (e.name == name || e.name == name + ".npy") {
+                if (e.method != 0) {
+                    return false;
+                }
+
+                char local[30];
+
+                stream.clear();
+                stream.seekg(e.offset);
+
+                if (!stream.read(local, sizeof(local)) || detail::zip_get<4>(local) != 0x04034b50) {
+                    return false;
+                }
+
+                stream.seekg(detail::zip_get<2>(local + 26) + detail::zip_get<2>(local + 28), std::ios::cur);
+
+                return detail::npy_load(stream, matrix);
+            }
+        }
+
+        return false;
+    }
+
+private:
+    /*!
+     * \brief An entry of the archive
+     */
+    struct entry {
+        std::string name; ///< The name of the file
+        uint64_t offset;  ///< The offset of the local header
+        uint32_t method;  ///< The compression method
+    };
+
+    std::ifstream stream;       ///< The stream to the archive
+    std::vector<entry> entries; ///< The entries of the archive
+    bool is_valid = false;      ///< Indicates if the archive is valid
+
+    /*!
+     * \brief Read the central directory of the archive
+     */
+    void read_directory() {
+        if (!stream.seekg(0, std::ios::end)) {
+            return;
+        }
+
+        const uint64_t file_size = uint64_t(stream.tellg());
+        const uint64_t tail_size = std::min<uint64_t>(file_size, 65535 + 22);
+
+        std::vector<char> tail(tail_size);
+
+        stream.seekg(file_size - tail_size);
+
+        if (tail_size < 22 || !stream.read(tail.data(), tail_size)) {
+            return;
+        }
+
+        // 1. Find the end of central directory record
+
+        size_t eocd = tail_size - 22 + 1;
+
+        do {
+            --eocd;
+        } while (eocd > 0 && detail::zip_get<4>(&tail[eocd]) != 0x06054b50);
+
+        if (detail::zip_get<4>(&tail[eocd]) != 0x06054b50) {
+            return;
+        }
+
+        uint64_t count     = detail::zip_get<2>(&tail[eocd + 10]);
+        uint64_t cd_size   = detail::zip_get<4>(&tail[eocd + 12]);
+        uint64_t cd_offset = detail::zip_get<4>(&tail[eocd + 16]);
+
+        // 2. Zip64 end of central directory record
+
+        if ((count == 0xFFFF || cd_size == 0xFFFFFFFF || cd_offset == 0xFFFFFFFF) && eocd >= 20 && detail::zip_get<4>(&tail[eocd - 20]) == 0x07064b50) {
+            char record[56];
+
+            stream.seekg(detail::zip_get<8>(&tail[eocd - 20 + 8]));
+
+            if (!stream.read(record, sizeof(record)) || detail::zip_get<4>(record) != 0x06064b50) {
+                return;
+            }
+
+            count     = detail::zip_get<8>(record + 32);
+            cd_size   = detail::zip_get<8>(record + 40);
+            cd_offset = detail::zip_get<8>(record + 48);
+        }
+
+        // 3. Read the central directory
+
+        std::vector<char> cd(cd_size);
+
+        stream.seekg(cd_offset);
+
+        if (!stream.read(cd.data(), cd_size)) {
+            return;
+        }
+
+        size_t p = 0;
+
+        for (size_t i = 0; i < count; ++i) {
+            if (p + 46 > cd_size || detail::zip_get<4>(&cd[p]) != 0x02014b50) {
+                return;
+            }
+
+            const size_t name_length    = detail::zip_get<2>(&cd[p + 28]);
+            const size_t extra_length   = detail::zip_get<2>(&cd[p + 30]);
+            const size_t comment_length = detail::zip_get<2>(&cd[p + 32]);
+
+            if (p + 46 + name_length + extra_length + comment_length > cd_size) {
+                return;
+            }
+
+            entry e;
+            e.method = uint32_t(detail::zip_get<2>(&cd[p + 10]));
+            e.offset = detail::zip_get<4>(&cd[p + 42]);
+            e.name   = std::string(&cd[p + 46], name_length);
+
+            // The zip64 extra field contains the values that do not fit
+            if (e.offset == 0xFFFFFFFF) {
+                const uint64_t usize = detail::zip_get<4>(&cd[p + 24]);
+                const uint64_t csize = detail::zip_get<4>(&cd[p + 20]);
+
+                for (size_t x = p + 46 + name_length; x + 4 <= p + 46 + name_length + extra_length;) {
+                    const size_t id     = detail::zip_get<2>(&cd[x]);
+                    const size_t length = detail::zip_get<2>(&cd[x + 2]);
+
+                    if (id == 0x0001) {
+                        const size_t skip = (usize == 0xFFFFFFFF ? 8 : 0) + (csize == 0xFFFFFFFF ? 8 : 0);
+                        e.offset          = detail::zip_get<8>(&cd[x + 4 + skip]);
+                        break;
+                    }
+
+                    x += 4 + length;
+                }
+            }
+
+            entries.push_back(e);
+
+            p += 46 + name_length + extra_length + comment_length;
+        }
+
+        is_valid = true;
+    }
+};
+
+/*!
+ * \brief Load an array of a .npz archive into a matrix
+ * \param path The path of the archive
+ * \param name The name of the array (with or without the .npy extension)
+ * \param matrix The matrix to fill, see load_npy
+ * \return true if the matrix has been loaded, false otherwise
+ */
+template <typename M>
+bool load_npz(const std::string& path, const std::string& name, M& matrix) {
+    npz_reader reader(path);
+    return reader.valid() && reader.load(name, matrix);
+}
+
+} //end of namespace etl
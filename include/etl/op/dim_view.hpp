@@ -30,6 +30,12 @@ struct dim_view {
     using return_type       = return_helper<sub_type, decltype(std::declval<sub_type>()(0, 0))>;       ///< The type returned by the view
     using const_return_type = const_return_helper<sub_type, decltype(std::declval<sub_type>()(0, 0))>; ///< The const type return by the view
 
+    /*!
+     * \brief The vectorization type for V
+     */
+    template<typename V = default_vec>
+    using vec_type = typename V::template vec_type<value_type>;
+
 private:
 
     T sub;               ///< The Sub expression
@@ -159,6 +165,36 @@ public:
         return sub.memory_start() + (i + 1) * subsize(sub);
     }
 
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(size_t x) const noexcept {
+        return loadu<V>(x);
+    }
+
+    /*!
+     * \brief Load several elements of the expression at once
+     *
+     * The elements of a row are contiguous while the elements of a column
+     * are gathered (with a hardware gather if available).
+     *
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(size_t x) const noexcept {
+        if (D == 1) {
+            return sub.template loadu<V>(i * etl::dim<1>(sub) + x);
+        } else { //D == 2
+            return strided_load<V>(sub, x * etl::dim<1>(sub) + i, etl::dim<1>(sub));
+        }
+    }
+
     // Assignment functions
 
     /*!
@@ -285,7 +321,7 @@ struct etl_traits<etl::dim_view<T, D>> {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<etl_traits<sub_expr_t>::template vectorizable<V>::value && storage_order == order::RowMajor>;
 
     /*!
      * \brief Returns the size of the given expression
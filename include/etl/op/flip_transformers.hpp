@@ -18,6 +18,12 @@ struct hflip_transformer {
     using sub_type   = T;          ///< The type on which the expression works
     using value_type = value_t<T>; ///< The type of valuie
 
+    /*!
+     * \brief The vectorization type for V
+     */
+    template<typename V = default_vec>
+    using vec_type = typename V::template vec_type<value_type>;
+
     friend etl_traits<hflip_transformer>;
 
 private:
@@ -98,6 +104,65 @@ public:
         return sub(i, columns(sub) - 1 - j);
     }
 
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(size_t x) const noexcept {
+        return loadu<V>(x);
+    }
+
+    /*!
+     * \brief Load several elements of the expression at once
+     *
+     * The elements are contiguous in reverse order in the sub expression,
+     * they are loaded at once and reversed.
+     *
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec, bool C = matrix, cpp_disable_if(C)>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(size_t x) const noexcept {
+        return reverse_loadu<V, value_type>(sub, size(sub) - 1 - x);
+    }
+
+    /*!
+     * \brief Load several elements of the expression at once
+     *
+     * The elements of each row are contiguous in reverse order in the sub
+     * expression, they are loaded at once and reversed. The vectors
+     * spanning two rows are gathered.
+     *
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec, bool C = matrix, cpp_enable_if(C)>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(size_t x) const noexcept {
+        const size_t n   = dim<1>(sub);
+        const size_t i_i = x / n;
+        const size_t i_j = x % n;
+
+        constexpr size_t lanes = V::template traits<value_type>::size;
+
+        const size_t last = i_i * n + (n - 1 - i_j);
+
+        if (i_j + lanes <= n) {
+            return reverse_loadu<V, value_type>(sub, last);
+        }
+
+        // The vector spans two rows
+        if (n >= lanes) {
+            return indexed_load<V>(sub, [n, i_j, last](size_t l) { return i_j + l < n ? last - l : last + 2 * n - l; });
+        }
+
+        return indexed_load<V>(sub, [n, x](size_t l) { return ((x + l) / n) * n + (n - 1 - (x + l) % n); });
+    }
+
     /*!
      * \brief Test if this expression aliases with the given expression
      * \param rhs The other expression to test
@@ -139,6 +204,12 @@ struct vflip_transformer {
     using sub_type   = T;          ///< The type on which the expression works
     using value_type = value_t<T>; ///< The type of valuie
 
+    /*!
+     * \brief The vectorization type for V
+     */
+    template<typename V = default_vec>
+    using vec_type = typename V::template vec_type<value_type>;
+
     friend etl_traits<vflip_transformer>;
 
 private:
@@ -219,6 +290,61 @@ public:
         return sub(rows(sub) - 1 - i, j);
     }
 
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(size_t x) const noexcept {
+        return loadu<V>(x);
+    }
+
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec, bool C = matrix, cpp_disable_if(C)>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(size_t x) const noexcept {
+        return sub.template loadu<V>(x);
+    }
+
+    /*!
+     * \brief Load several elements of the expression at once
+     *
+     * The rows are in reverse order, but each row is still contiguous in
+     * the sub expression. Only the vectors spanning two rows are gathered.
+     *
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec, bool C = matrix, cpp_enable_if(C)>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(size_t x) const noexcept {
+        const size_t m   = dim<0>(sub);
+        const size_t n   = dim<1>(sub);
+        const size_t i_i = x / n;
+        const size_t i_j = x % n;
+
+        constexpr size_t lanes = V::template traits<value_type>::size;
+
+        const size_t first = (m - 1 - i_i) * n + i_j;
+
+        if (i_j + lanes <= n) {
+            return sub.template loadu<V>(first);
+        }
+
+        // The vector spans two rows
+        if (n >= lanes) {
+            return indexed_load<V>(sub, [n, i_j, first](size_t l) { return i_j + l < n ? first + l : first + l - 2 * n; });
+        }
+
+        return indexed_load<V>(sub, [m, n, x](size_t l) { return (m - 1 - (x + l) / n) * n + (x + l) % n; });
+    }
+
     /*!
      * \brief Test if this expression aliases with the given expression
      * \param rhs The other expression to test
@@ -260,6 +386,12 @@ struct fflip_transformer {
     using sub_type   = T;          ///< The type on which the expression works
     using value_type = value_t<T>; ///< The type of valuie
 
+    /*!
+     * \brief The vectorization type for V
+     */
+    template<typename V = default_vec>
+    using vec_type = typename V::template vec_type<value_type>;
+
     friend etl_traits<fflip_transformer>;
 
 private:
@@ -319,6 +451,36 @@ public:
         return sub(rows(sub) - 1 - i, columns(sub) - 1 - j);
     }
 
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(size_t x) const noexcept {
+        return loadu<V>(x);
+    }
+
+    /*!
+     * \brief Load several elements of the expression at once
+     *
+     * The elements of a matrix are contiguous in reverse order in the sub
+     * expression, they are loaded at once and reversed.
+     *
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(size_t x) const noexcept {
+        if (dimensions(sub) == 1) {
+            return sub.template loadu<V>(x);
+        }
+
+        return reverse_loadu<V, value_type>(sub, size(sub) - 1 - x);
+    }
+
     /*!
      * \brief Test if this expression aliases with the given expression
      * \param rhs The other expression to test
@@ -385,7 +547,7 @@ struct etl_traits<T, std::enable_if_t<cpp::or_c<
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<etl_traits<sub_expr_t>::template vectorizable<V>::value && storage_order == order::RowMajor>;
 
     /*!
      * \brief Returns the size of the given expression
@@ -145,7 +145,15 @@ public:
      */
     template <typename V = default_vec>
     auto load(size_t x) const noexcept {
-        return sub.template loadu<V>(x + first * (etl::size(sub) / etl::dim<0>(sub)));
+        const size_t offset = first * (etl::size(sub) / etl::dim<0>(sub));
+
+        // When the offset is a multiple of the vector size, x + offset is
+        // aligned from the beginning of the sub expression as well
+        if (offset % V::template traits<value_type>::size == 0) {
+            return sub.template load<V>(x + offset);
+        } else {
+            return sub.template loadu<V>(x + offset);
+        }
     }
 
     /*!
@@ -416,7 +424,11 @@ public:
      */
     template <typename V = default_vec>
     auto load(size_t x) const noexcept {
-        return V::loadu(memory + x);
+        if (is_aligned_memory<V, aligned_sub_view_able<T>::value>(memory)) {
+            return V::load(memory + x);
+        } else {
+            return V::loadu(memory + x);
+        }
     }
 
     /*!
@@ -427,7 +439,11 @@ public:
      */
     template <typename V = default_vec>
     void store(vec_type<V> in, size_t x) noexcept {
-        return V::storeu(memory + x, in);
+        if (is_aligned_memory<V, aligned_sub_view_able<T>::value>(memory)) {
+            V::store(memory + x, in);
+        } else {
+            V::storeu(memory + x, in);
+        }
     }
 
     /*!
@@ -449,8 +465,11 @@ public:
      */
     template <typename V = default_vec>
     void stream(vec_type<V> in, size_t x) noexcept {
-        //TODO If the slice view is aligned (at compile-time), use stream store here
-        return V::storeu(memory + x, in);
+        if (is_aligned_memory<V, aligned_sub_view_able<T>::value>(memory)) {
+            V::stream(memory + x, in);
+        } else {
+            V::storeu(memory + x, in);
+        }
     }
 
     /*!
@@ -761,7 +780,7 @@ struct etl_traits<etl::slice_view<T>> {
     static constexpr bool is_direct               = fast_slice_view_able<T>::value;      ///< Indicates if the expression has direct memory access
     static constexpr bool is_generator            = false;                               ///< Indicates if the expression is a generator
     static constexpr bool is_padded               = false;                               ///< Indicates if the expression is padded
-    static constexpr bool is_aligned              = false;                               ///< Indicates if the expression is padded
+    static constexpr bool is_aligned              = aligned_sub_view_able<T>::value;     ///< Indicates if the expression is aligned
     static constexpr bool needs_evaluator = sub_traits::needs_evaluator; ///< Indicates if the exxpression needs a evaluator visitor
     static constexpr order storage_order          = sub_traits::storage_order;           ///< The expression's storage order
 
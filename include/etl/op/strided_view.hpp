@@ -0,0 +1,497 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Contains the strided_view implementation
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief View that shows every step-th index of some dimensions of an
+ * expression.
+ *
+ * Each dimension of the view is described by its first index and its step
+ * inside the sub expression. The view is an lvalue (it can be assigned to)
+ * but it has no direct memory access since its elements are not
+ * contiguous. Hence, the view is only vectorized as a right-hand side, the
+ * assignments to the view are done element by element.
+ *
+ * \tparam T The type of expression on which the view is made
+ */
+template <typename T>
+struct strided_view final :
+    iterable<strided_view<T>, false>,
+    assignable<strided_view<T>, value_t<T>>,
+    value_testable<strided_view<T>>,
+    inplace_assignable<strided_view<T>>
+{
+    static_assert(is_etl_expr<T>::value, "strided_view<T> only works with ETL expressions");
+
+    using this_type            = strided_view<T>;                                                      ///< The type of this expression
+    using iterable_base_type   = iterable<this_type, false>;                                           ///< The iterable base type
+    using assignable_base_type = assignable<this_type, value_t<T>>;                                    ///< The assignable base type
+    using sub_type             = T;                                                                    ///< The sub type
+    using value_type           = value_t<sub_type>;                                                    ///< The value contained in the expression
+    using memory_type          = memory_t<sub_type>;                                                   ///< The memory acess type
+    using const_memory_type    = const_memory_t<sub_type>;                                             ///< The const memory access type
+    using return_type          = return_helper<sub_type, decltype(std::declval<sub_type>()[0])>;       ///< The type returned by the view
+    using const_return_type    = const_return_helper<sub_type, decltype(std::declval<sub_type>()[0])>; ///< The const type return by the view
+    using iterator             = etl::iterator<this_type>;                                             ///< The iterator type
+    using const_iterator       = etl::iterator<const this_type>;                                       ///< The const iterator type
+
+    /*!
+     * \brief The vectorization type for V
+     */
+    template<typename V = default_vec>
+    using vec_type               = typename V::template vec_type<value_type>;
+
+    using assignable_base_type::operator=;
+    using iterable_base_type::begin;
+    using iterable_base_type::end;
+
+private:
+    static constexpr size_t N            = decay_traits<sub_type>::dimensions();     ///< The number of dimensions
+    static constexpr order storage_order = decay_traits<sub_type>::storage_order;   ///< The storage order
+    static constexpr size_t inner_d      = storage_order == order::RowMajor ? N - 1 : 0; ///< The contiguous dimension
+
+    sub_type sub_expr;            ///< The Sub expression
+    std::array<size_t, N> first;  ///< The first index of each dimension inside the sub expression
+    std::array<size_t, N> step;   ///< The step of each dimension inside the sub expression
+    std::array<size_t, N> dims;   ///< The dimensions of the view
+    std::array<size_t, N> jump;   ///< The flat distance inside the sub expression between two indices of each dimension
+    size_t offset;                ///< The flat index of the first element inside the sub expression
+    size_t _size;                 ///< The size of the view
+
+    friend struct etl_traits<strided_view>;
+
+    /*!
+     * \brief Compute the flat offset and the jumps from the first indices
+     * and the steps
+     */
+    void init() {
+        size_t stride = 1;
+
+        offset = 0;
+        _size  = 1;
+
+        for (size_t i = 0; i < N; ++i) {
+            const size_t d = storage_order == order::RowMajor ? N - 1 - i : i;
+
+            jump[d] = step[d] * stride;
+            offset += first[d] * stride;
+            _size *= dims[d];
+            stride *= etl::dim(sub_expr, d);
+        }
+    }
+
+    /*!
+     * \brief Keep every s-th index of the range [f, l) of the dth dimension of the view
+     */
+    void restride(size_t d, size_t f, size_t l, size_t s) {
+        cpp_assert(d < N, "Invalid dimension for strided_view");
+        cpp_assert(s > 0, "Invalid step for strided_view");
+        cpp_assert(f < l && l <= dims[d], "Invalid range for strided_view");
+
+        first[d] += f * step[d];
+        step[d] *= s;
+        dims[d] = (l - f + s - 1) / s;
+
+        init();
+    }
+
+    /*!
+     * \brief Compute the flat index inside the sub expression of the given flat index
+     * \param j The flat index inside the view
+     * \param idx The array to fill with the indices of each dimension
+     * \return the flat index inside the sub expression
+     */
+    size_t sub_index(size_t j, std::array<size_t, N>& idx) const noexcept {
+        size_t s = offset;
+
+        for (size_t i = 0; i < N; ++i) {
+            const size_t d = storage_order == order::RowMajor ? N - 1 - i : i;
+
+            idx[d] = i == N - 1 ? j : j % dims[d];
+            j /= dims[d];
+            s += idx[d] * jump[d];
+        }
+
+        return s;
+    }
+
+    /*!
+     * \brief Compute the flat index inside the sub expression of the given flat index
+     * \param j The flat index inside the view
+     * \return the flat index inside the sub expression
+     */
+    size_t sub_index(size_t j) const noexcept {
+        std::array<size_t, N> idx;
+        return sub_index(j, idx);
+    }
+
+    /*!
+     * \brief Access to the element at the given position of the sub expression
+     * \param expr The sub expression
+     * \param args The indices inside the view
+     * \return a reference to the element at the given position.
+     */
+    template <typename E, size_t... I, typename... S>
+    decltype(auto) sub_access(E&& expr, std::index_sequence<I...> /*seq*/, S... args) const {
+        return expr((first[I] + static_cast<size_t>(args) * step[I])...);
+    }
+
+public:
+    /*!
+     * \brief Construct a new strided_view over the given sub expression
+     * \param sub_expr The sub expression
+     * \param d The strided dimension
+     * \param f The first index of the strided dimension
+     * \param l The last index (exclusive) of the strided dimension
+     * \param s The step between two indices of the strided dimension
+     */
+    strided_view(sub_type sub_expr, size_t d, size_t f, size_t l, size_t s) : sub_expr(sub_expr) {
+        for (size_t i = 0; i < N; ++i) {
+            first[i] = 0;
+            step[i]  = 1;
+            dims[i]  = etl::dim(sub_expr, i);
+        }
+
+        restride(d, f, l, s);
+    }
+
+    /*!
+     * \brief Construct a new strided_view by striding another dimension of
+     * a strided_view
+     * \param base The strided view
+     * \param d The strided dimension
+     * \param f The first index of the strided dimension
+     * \param l The last index (exclusive) of the strided dimension
+     * \param s The step between two indices of the strided dimension
+     */
+    strided_view(const strided_view& base, size_t d, size_t f, size_t l, size_t s) : strided_view(base) {
+        restride(d, f, l, s);
+    }
+
+    /*!
+     * \brief Returns the element at the given index
+     * \param j The index
+     * \return a reference to the element at the given index.
+     */
+    const_return_type operator[](size_t j) const {
+        cpp_assert(j < _size, "Invalid index inside strided_view");
+
+        return sub_expr[sub_index(j)];
+    }
+
+    /*!
+     * \brief Returns the element at the given index
+     * \param j The index
+     * \return a reference to the element at the given index.
+     */
+    return_type operator[](size_t j) {
+        cpp_assert(j < _size, "Invalid index inside strided_view");
+
+        return sub_expr[sub_index(j)];
+    }
+
+    /*!
+     * \brief Returns the value at the given index
+     * This function never has side effects.
+     * \param j The index
+     * \return the value at the given index.
+     */
+    value_type read_flat(size_t j) const noexcept {
+        return sub_expr.read_flat(sub_index(j));
+    }
+
+    /*!
+     * \brief Access to the element at the given (args...) position
+     * \param args The indices
+     * \return a reference to the element at the given position.
+     */
+    template <typename... S, cpp_enable_if((sizeof...(S) == decay_traits<sub_type>::dimensions()))>
+    const_return_type operator()(S... args) const {
+        return sub_access(sub_expr, std::make_index_sequence<sizeof...(S)>(), args...);
+    }
+
+    /*!
+     * \brief Access to the element at the given (args...) position
+     * \param args The indices
+     * \return a reference to the element at the given position.
+     */
+    template <typename... S, cpp_enable_if((sizeof...(S) == decay_traits<sub_type>::dimensions()))>
+    return_type operator()(S... args) {
+        return sub_access(sub_expr, std::make_index_sequence<sizeof...(S)>(), args...);
+    }
+
+    /*!
+     * \brief Creates a sub view of the matrix, effectively removing the first dimension and fixing it to the given index.
+     * \param x The index to use
+     * \return a sub view of the matrix at position x.
+     */
+    template <typename TT = sub_type, cpp_enable_if((decay_traits<TT>::dimensions() > 1))>
+    auto operator()(size_t x) const {
+        return etl::sub(*this, x);
+    }
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param rhs The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E>
+    bool alias(const E& rhs) const noexcept {
+        return sub_expr.alias(rhs);
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_to(L&& lhs)  const {
+        std_assign_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_add_to(L&& lhs)  const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_sub_to(L&& lhs)  const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mul_to(L&& lhs)  const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_div_to(L&& lhs)  const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mod_to(L&& lhs)  const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    // Internals
+
+    /*!
+     * \brief Apply the given visitor to this expression and its descendants.
+     * \param visitor The visitor to apply
+     */
+    void visit(const detail::back_propagate_visitor& visitor) const {
+        sub_expr.visit(visitor);
+    }
+
+    /*!
+     * \brief Apply the given visitor to this expression and its descendants.
+     * \param visitor The visitor to apply
+     */
+    void visit(const detail::temporary_allocator_visitor& visitor) const {
+        sub_expr.visit(visitor);
+    }
+
+    /*!
+     * \brief Apply the given visitor to this expression and its descendants.
+     * \param visitor The visitor to apply
+     */
+    void visit(detail::evaluator_visitor& visitor) const {
+        bool old_need_value = visitor.need_value;
+        visitor.need_value = true;
+        sub_expr.visit(visitor);
+        visitor.need_value = old_need_value;
+    }
+
+    // When the vector does not cross the contiguous dimension, its elements
+    // are either contiguous in the sub expression, every other element of
+    // two contiguous vectors or gathered with a constant stride. Otherwise,
+    // the lanes are gathered one by one
+
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(size_t x) const noexcept {
+        return loadu<V>(x);
+    }
+
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(size_t x) const noexcept {
+        constexpr size_t lanes = V::template traits<value_type>::size;
+
+        std::array<size_t, N> idx;
+        size_t s = sub_index(x, idx);
+
+        if (idx[inner_d] + lanes <= dims[inner_d]) {
+            if (step[inner_d] == 1) {
+                return sub_expr.template loadu<V>(s);
+            }
+
+            if (step[inner_d] == 2 && s + 2 * lanes <= etl::size(sub_expr)) {
+                return deinterleave_loadu<V, value_type>(sub_expr, s);
+            }
+
+            return strided_load<V>(sub_expr, s, step[inner_d]);
+        }
+
+        return loadu_lanes<V>(idx, s);
+    }
+
+    /*!
+     * \brief Load several elements of the expression one by one, the
+     * vector crosses the contiguous dimension
+     *
+     * The lanes are gathered in order, the indices are incremented rather
+     * than recomputed for each lane. This is kept out of loadu so that
+     * the vector paths are not burdened by the state of the lanes.
+     *
+     * \param idx The indices of the first element inside the view
+     * \param s The flat index of the first element inside the sub expression
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V>
+    vec_type<V> loadu_lanes(std::array<size_t, N> idx, size_t s) const noexcept {
+        return gather_load<V, value_type>([this, &idx, &s](size_t /*l*/) {
+            const auto value = sub_expr.read_flat(s);
+
+            for (size_t i = 0; i < N; ++i) {
+                const size_t d = storage_order == order::RowMajor ? N - 1 - i : i;
+
+                s += jump[d];
+
+                if (++idx[d] < dims[d]) {
+                    break;
+                }
+
+                s -= dims[d] * jump[d];
+                idx[d] = 0;
+            }
+
+            return value;
+        });
+    }
+
+    /*!
+     * \brief Print a representation of the view on the given stream
+     * \param os The output stream
+     * \param v The view to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const strided_view& v) {
+        os << "strided(" << v.sub_expr;
+
+        for (size_t d = 0; d < N; ++d) {
+            os << ", " << v.first[d] << ":" << v.step[d] << ":" << v.dims[d];
+        }
+
+        return os << ")";
+    }
+};
+
+/*!
+ * \brief Specialization for strided_view
+ */
+template <typename T>
+struct etl_traits<etl::strided_view<T>> {
+    using expr_t     = etl::strided_view<T>;            ///< The expression type
+    using sub_expr_t = std::decay_t<T>;                 ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;          ///< The sub traits
+    using value_type = typename sub_traits::value_type; ///< The value type of the expression
+
+    static constexpr bool is_etl          = true;                        ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer  = false;                       ///< Indicates if the type is a transformer
+    static constexpr bool is_view         = true;                        ///< Indicates if the type is a view
+    static constexpr bool is_magic_view   = false;                       ///< Indicates if the type is a magic view
+    static constexpr bool is_fast         = false;                       ///< Indicates if the expression is fast
+    static constexpr bool is_linear       = sub_traits::is_linear;       ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe  = sub_traits::is_thread_safe;  ///< Indicates if the expression is thread safe
+    static constexpr bool is_value        = false;                       ///< Indicates if the expression is of value type
+    static constexpr bool is_direct       = false;                       ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator    = false;                       ///< Indicates if the expression is a generator
+    static constexpr bool is_padded       = false;                       ///< Indicates if the expression is padded
+    static constexpr bool is_aligned      = false;                       ///< Indicates if the expression is padded
+    static constexpr bool needs_evaluator = sub_traits::needs_evaluator; ///< Indicates if the exxpression needs a evaluator visitor
+    static constexpr order storage_order  = sub_traits::storage_order;   ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    using vectorizable = typename sub_traits::template vectorizable<V>;
+
+    /*!
+     * \brief Returns the size of the given expression
+     * \param v The expression to get the size for
+     * \returns the size of the given expression
+     */
+    static size_t size(const expr_t& v) noexcept {
+        return v._size;
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the given expression
+     * \param v The expression
+     * \param d The dimension to get
+     * \return The dth dimension of the given expression
+     */
+    static size_t dim(const expr_t& v, size_t d) noexcept {
+        return v.dims[d];
+    }
+
+    /*!
+     * \brief Returns the number of expressions for this type
+     * \return the number of dimensions of this type
+     */
+    static constexpr size_t dimensions() noexcept {
+        return sub_traits::dimensions();
+    }
+};
+
+} //end of namespace etl
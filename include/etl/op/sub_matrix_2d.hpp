@@ -285,7 +285,47 @@ public:
         visitor.need_value = old_need_value;
     }
 
-    // TODO A sub_matrix_2d can be vectorized in 2D, but not in 1D
+    // The rows of the sub matrix are contiguous in the sub expression, but
+    // the vectors that span two rows must be gathered
+
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(size_t x) const noexcept {
+        return loadu<V>(x);
+    }
+
+    /*!
+     * \brief Load several elements of the expression at once
+     * \param x The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several elements of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(size_t x) const noexcept {
+        const auto i = x / n;
+        const auto j = x % n;
+
+        constexpr size_t lanes = V::template traits<value_type>::size;
+
+        const size_t first = (base_i + i) * base_n + base_j + j;
+
+        if (j + lanes <= n) {
+            return sub_expr.template loadu<V>(first);
+        }
+
+        // The vector spans two rows
+        if (n >= lanes) {
+            const size_t next = base_n - n;
+            return indexed_load<V>(sub_expr, [j, first, next, this](size_t l) { return j + l < n ? first + l : first + l + next; });
+        }
+
+        return indexed_load<V>(sub_expr, [this, x](size_t l) { return (base_i + (x + l) / n) * base_n + base_j + (x + l) % n; });
+    }
 
     /*!
      * \brief Print a representation of the view on the given stream
@@ -329,7 +369,7 @@ struct etl_traits<etl::sub_matrix_2d<T, Aligned>> {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::false_type;
+    using vectorizable = cpp::bool_constant<sub_traits::template vectorizable<V>::value && storage_order == order::RowMajor>;
 
     /*!
      * \brief Returns the size of the given expression
@@ -183,7 +183,13 @@ public:
      */
     template <typename V = default_vec>
     ETL_STRONG_INLINE(vec_type<V>) load(size_t x) const noexcept {
-        return sub_expr.template loadu<V>(x + sub_offset);
+        // When the offset is a multiple of the vector size, x + sub_offset is
+        // aligned from the beginning of the sub expression as well
+        if (sub_offset % V::template traits<value_type>::size == 0) {
+            return sub_expr.template load<V>(x + sub_offset);
+        } else {
+            return sub_expr.template loadu<V>(x + sub_offset);
+        }
     }
 
     /*!
@@ -477,7 +483,11 @@ public:
      */
     template <typename V = default_vec>
     void store(vec_type<V> in, size_t x) noexcept {
-        return V::storeu(memory + x, in);
+        if (is_aligned_memory<V, aligned_sub_view_able<T>::value>(memory)) {
+            V::store(memory + x, in);
+        } else {
+            V::storeu(memory + x, in);
+        }
     }
 
     /*!
@@ -499,8 +509,11 @@ public:
      */
     template <typename V = default_vec>
     void stream(vec_type<V> in, size_t x) noexcept {
-        //TODO If the sub view is aligned (at compile-time), use stream store here
-        return V::storeu(memory + x, in);
+        if (is_aligned_memory<V, aligned_sub_view_able<T>::value>(memory)) {
+            V::stream(memory + x, in);
+        } else {
+            V::storeu(memory + x, in);
+        }
     }
 
     /*!
@@ -511,7 +524,11 @@ public:
      */
     template <typename V = default_vec>
     vec_type<V> load(size_t x) const noexcept {
-        return V::loadu(memory + x);
+        if (is_aligned_memory<V, aligned_sub_view_able<T>::value>(memory)) {
+            return V::load(memory + x);
+        } else {
+            return V::loadu(memory + x);
+        }
     }
 
     /*!
@@ -852,7 +869,7 @@ struct etl_traits<etl::sub_view<T, Aligned>> {
     static constexpr bool is_direct       = sub_traits::is_direct && sub_traits::storage_order == order::RowMajor; ///< Indicates if the expression has direct memory access
     static constexpr bool is_generator    = false;                                                                 ///< Indicates if the expression is a generator
     static constexpr bool is_padded       = false;                                                                 ///< Indicates if the expression is padded
-    static constexpr bool is_aligned      = false;                                                                 ///< Indicates if the expression is padded
+    static constexpr bool is_aligned      = aligned_sub_view_able<T>::value;                                       ///< Indicates if the expression is aligned
     static constexpr bool needs_evaluator = sub_traits::needs_evaluator;                                           ///< Indicates if the exxpression needs a evaluator visitor
     static constexpr order storage_order  = sub_traits::storage_order;                                             ///< The expression's storage order
 
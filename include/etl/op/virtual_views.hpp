@@ -38,6 +38,12 @@ struct magic_view {
 
     const size_t n; ///< The dimensions of the magic matrix
 
+    /*!
+     * \brief The vectorization type for VV
+     */
+    template <typename VV = default_vec>
+    using vec_type = typename VV::template vec_type<value_type>;
+
     /*!
      * \brief Construct a new magic_view with the given dimension
      */
@@ -92,6 +98,31 @@ struct magic_view {
         return detail::compute<value_type>(n, i, j);
     }
 
+    /*!
+     * \brief Load several elements of the matrix at once
+     * \param i The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam VV The vectorization mode to use
+     * \return a vector containing several elements of the matrix
+     */
+    template <typename VV = default_vec>
+    vec_type<VV> load(size_t i) const {
+        return loadu<VV>(i);
+    }
+
+    /*!
+     * \brief Load several elements of the matrix at once
+     *
+     * The values are computed one by one and then gathered in a vector.
+     *
+     * \param i The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam VV The vectorization mode to use
+     * \return a vector containing several elements of the matrix
+     */
+    template <typename VV = default_vec>
+    vec_type<VV> loadu(size_t i) const {
+        return gather_load<VV, value_type>([this, i](size_t l) { return detail::compute<value_type>(n, (i + l) / n, (i + l) % n); });
+    }
+
     /*!
      * \brief Test if this expression aliases with the given expression
      * \param rhs The other expression to test
@@ -121,6 +152,12 @@ template <typename V, size_t N>
 struct fast_magic_view {
     using value_type = V; ///< The value type
 
+    /*!
+     * \brief The vectorization type for VV
+     */
+    template <typename VV = default_vec>
+    using vec_type = typename VV::template vec_type<value_type>;
+
     /*!
      * \brief Returns the element at the given index
      * \param i The index
@@ -169,6 +206,31 @@ struct fast_magic_view {
         return detail::compute<value_type>(N, i, j);
     }
 
+    /*!
+     * \brief Load several elements of the matrix at once
+     * \param i The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam VV The vectorization mode to use
+     * \return a vector containing several elements of the matrix
+     */
+    template <typename VV = default_vec>
+    vec_type<VV> load(size_t i) const {
+        return loadu<VV>(i);
+    }
+
+    /*!
+     * \brief Load several elements of the matrix at once
+     *
+     * The values are computed one by one and then gathered in a vector.
+     *
+     * \param i The position at which to start. This will be aligned from the beginning (multiple of the vector size).
+     * \tparam VV The vectorization mode to use
+     * \return a vector containing several elements of the matrix
+     */
+    template <typename VV = default_vec>
+    vec_type<VV> loadu(size_t i) const {
+        return gather_load<VV, value_type>([this, i](size_t l) { return detail::compute<value_type>(N, (i + l) / N, (i + l) % N); });
+    }
+
     /*!
      * \brief Test if this expression aliases with the given expression
      * \param rhs The other expression to test
@@ -220,7 +282,7 @@ struct etl_traits<etl::magic_view<V>> {
      * \tparam VV The vector mode
      */
     template <vector_mode_t VV>
-    using vectorizable = std::false_type;
+    using vectorizable = std::true_type;
 
     /*!
      * \brief Returns the size of the given expression
@@ -280,7 +342,7 @@ struct etl_traits<etl::fast_magic_view<V, N>> {
      * \tparam VV The vector mode
      */
     template <vector_mode_t VV>
-    using vectorizable = std::false_type;
+    using vectorizable = std::true_type;
 
     /*!
      * \brief Returns the size of an expression of this fast type.
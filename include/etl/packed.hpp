@@ -0,0 +1,436 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Contains the packed symmetric and triangular matrices
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief The structure of a packed matrix
+ */
+enum class packing {
+    SYMMETRIC, ///< Symmetric matrix, the lower triangle is stored row by row
+    LOWER,     ///< Lower triangular matrix, stored row by row
+    UPPER      ///< Upper triangular matrix, stored column by column
+};
+
+/*!
+ * \brief A square matrix of which only one triangle is stored, in
+ * n * (n + 1) / 2 contiguous elements.
+ *
+ * The matrix can be used as a read-only ETL expression. The assignment
+ * of an expression evaluates it only once and validates its structure at
+ * the same time, the matrix being unchanged if the validation fails.
+ *
+ * \tparam T The value type
+ * \tparam P The structure of the matrix
+ */
+template <typename T, packing P>
+struct packed_matrix final {
+    static constexpr packing structure   = P;              ///< The structure of the matrix
+    static constexpr order storage_order = order::RowMajor; ///< The storage order of the flat indices
+
+    using this_type         = packed_matrix<T, P>;                                             ///< The type of this matrix
+    using value_type        = T;                                                               ///< The value type
+    using memory_type       = value_type*;                                                     ///< The memory type
+    using const_memory_type = const value_type*;                                               ///< The const memory type
+    using storage_impl      = cpp::aligned_vector<T, default_intrinsic_traits<T>::alignment>; ///< The packed storage type
+
+private:
+    size_t n;             ///< The dimension of the matrix
+    storage_impl packed;  ///< The packed storage
+
+    /*!
+     * \brief Indicates if the (i, j) element is stored
+     */
+    static constexpr bool is_stored(size_t i, size_t j) noexcept {
+        return P == packing::UPPER ? i <= j : j <= i;
+    }
+
+    /*!
+     * \brief Returns the index of the stored (i, j) element inside the packed storage
+     */
+    static constexpr size_t packed_index(size_t i, size_t j) noexcept {
+        return P == packing::UPPER ? j * (j + 1) / 2 + i : i * (i + 1) / 2 + j;
+    }
+
+    /*!
+     * \brief Throw the exception corresponding to the structure of the matrix
+     */
+    [[noreturn]] static void invalid_structure() {
+        if (P == packing::SYMMETRIC) {
+            throw symmetric_exception();
+        } else if (P == packing::LOWER) {
+            throw lower_exception();
+        } else {
+            throw upper_exception();
+        }
+    }
+
+    /*!
+     * \brief Pack the given matrix, with direct memory access, into the
+     * given storage, validating its structure.
+     * \param m The matrix to pack
+     * \param d The dimension of the matrix
+     * \param storage The storage to fill
+     * \return true if the matrix has the structure, false otherwise
+     */
+    template <typename M>
+    static bool pack(const M& m, size_t d, storage_impl& storage) {
+        for (size_t i = 0; i < d; ++i) {
+            for (size_t j = 0; j < d; ++j) {
+                if (is_stored(i, j)) {
+                    // The stored lower element (i, j) must be equal to the upper element (j, i)
+                    if (P == packing::SYMMETRIC && m(i, j) != m(j, i)) {
+                        return false;
+                    }
+
+                    storage[packed_index(i, j)] = m(i, j);
+                } else if (P != packing::SYMMETRIC && m(i, j) != value_type(0)) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+public:
+    /*!
+     * \brief Construct an empty packed matrix
+     */
+    packed_matrix() noexcept : n(0) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Construct a packed matrix of the given dimension and fill its
+     * stored triangle with the given value
+     * \param n The dimension of the matrix
+     * \param value The value of the stored elements
+     */
+    explicit packed_matrix(size_t n, value_type value = value_type()) : n(n), packed(n * (n + 1) / 2, value) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Construct a packed matrix from the given expression
+     * \param e The expression, which must have the structure of the matrix
+     */
+    template <typename E, cpp_enable_if(is_etl_expr<E>::value, !std::is_same<std::decay_t<E>, packed_matrix>::value)>
+    explicit packed_matrix(E&& e) : n(0) {
+        *this = e;
+    }
+
+    packed_matrix(const packed_matrix& rhs) = default;
+    packed_matrix& operator=(const packed_matrix& rhs) = default;
+    packed_matrix(packed_matrix&& rhs) noexcept = default;
+    packed_matrix& operator=(packed_matrix&& rhs) noexcept = default;
+
+    /*!
+     * \brief Assign the values of the ETL expression to the packed matrix.
+     *
+     * The expression is evaluated once and its structure is validated
+     * while it is packed. If the validation fails, the matrix is unchanged
+     * and an exception is thrown.
+     *
+     * \param e The ETL expression to get the values from
+     * \return a reference to the packed matrix
+     */
+    template <typename E, cpp_enable_if(is_etl_expr<E>::value, !std::is_same<std::decay_t<E>, packed_matrix>::value)>
+    packed_matrix& operator=(E&& e) {
+        static_assert(decay_traits<E>::dimensions() == 2, "Packed matrices can only be assigned from matrices");
+        cpp_assert(etl::dim<0>(e) == etl::dim<1>(e), "Packed matrices can only be assigned from square matrices");
+
+        const size_t d = etl::dim<0>(e);
+
+        standard_evaluator::pre_assign_rhs(e);
+
+        decltype(auto) m = make_temporary(e);
+
+        safe_ensure_cpu_up_to_date(m);
+
+        storage_impl storage(d * (d + 1) / 2);
+
+        if (!pack(m, d, storage)) {
+            invalid_structure();
+        }
+
+        n      = d;
+        packed = std::move(storage);
+
+        return *this;
+    }
+
+    /*!
+     * \brief Returns the dimension of the matrix
+     */
+    size_t dimension() const noexcept {
+        return n;
+    }
+
+    /*!
+     * \brief Returns the number of stored elements
+     */
+    size_t packed_size() const noexcept {
+        return packed.size();
+    }
+
+    /*!
+     * \brief Returns a pointer to the first element of the packed storage
+     */
+    memory_type packed_memory_start() noexcept {
+        return packed.data();
+    }
+
+    /*!
+     * \brief Returns a pointer to the first element of the packed storage
+     */
+    const_memory_type packed_memory_start() const noexcept {
+        return packed.data();
+    }
+
+    /*!
+     * \brief Returns the value of the (i, j) element
+     * \param i The row
+     * \param j The column
+     * \return the value of the (i, j) element
+     */
+    value_type operator()(size_t i, size_t j) const noexcept(assert_nothrow) {
+        cpp_assert(i < n && j < n, "Out of bounds");
+
+        if (is_stored(i, j)) {
+            return packed[packed_index(i, j)];
+        } else if (P == packing::SYMMETRIC) {
+            return packed[packed_index(j, i)];
+        } else {
+            return value_type(0);
+        }
+    }
+
+    /*!
+     * \brief Returns the value at the given flat index
+     * \param f The flat index, in row-major order
+     * \return the value at the given flat index
+     */
+    value_type operator[](size_t f) const noexcept(assert_nothrow) {
+        return (*this)(f / n, f % n);
+    }
+
+    /*!
+     * \brief Returns the value at the given flat index
+     * This function never has side effects.
+     * \param f The flat index, in row-major order
+     * \return the value at the given flat index
+     */
+    value_type read_flat(size_t f) const noexcept(assert_nothrow) {
+        return (*this)(f / n, f % n);
+    }
+
+    /*!
+     * \brief Set the value of the (i, j) element.
+     *
+     * For a symmetric matrix, this also sets the (j, i) element. For a
+     * triangular matrix, setting a non-zero value outside the triangle
+     * throws an exception.
+     *
+     * \param i The row
+     * \param j The column
+     * \param value The new value
+     */
+    void set(size_t i, size_t j, value_type value) {
+        cpp_assert(i < n && j < n, "Out of bounds");
+
+        if (is_stored(i, j)) {
+            packed[packed_index(i, j)] = value;
+        } else if (P == packing::SYMMETRIC) {
+            packed[packed_index(j, i)] = value;
+        } else if (value != value_type(0)) {
+            invalid_structure();
+        }
+    }
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param rhs The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E>
+    bool alias(const E& rhs) const noexcept {
+        return static_cast<const void*>(this) == static_cast<const void*>(&rhs);
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_to(L&& lhs)  const {
+        std_assign_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_add_to(L&& lhs)  const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_sub_to(L&& lhs)  const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mul_to(L&& lhs)  const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_div_to(L&& lhs)  const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mod_to(L&& lhs)  const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    // Internals
+
+    /*!
+     * \brief Apply the given visitor to this expression and its descendants.
+     * \param visitor The visitor to apply
+     */
+    template<typename V>
+    void visit(V&& visitor) const {
+        cpp_unused(visitor);
+    }
+
+    /*!
+     * \brief Ensures that the CPU memory is up to date, which is always the case
+     */
+    void ensure_cpu_up_to_date() const {
+        //Nothing to do
+    }
+
+    /*!
+     * \brief Prints the type of the packed matrix to the given stream
+     * \param os The output stream
+     * \param matrix The packed matrix to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const packed_matrix& matrix) {
+        static constexpr const char* names[] = {"PS", "PL", "PU"};
+        return os << names[static_cast<size_t>(P)] << "[" << matrix.n << "," << matrix.n << "]";
+    }
+};
+
+/*!
+ * \brief A symmetric matrix in packed storage
+ */
+template <typename T>
+using packed_symmetric_matrix = packed_matrix<T, packing::SYMMETRIC>;
+
+/*!
+ * \brief A lower triangular matrix in packed storage
+ */
+template <typename T>
+using packed_lower_matrix = packed_matrix<T, packing::LOWER>;
+
+/*!
+ * \brief An upper triangular matrix in packed storage
+ */
+template <typename T>
+using packed_upper_matrix = packed_matrix<T, packing::UPPER>;
+
+/*!
+ * \brief Specialization for packed_matrix
+ */
+template <typename T, packing P>
+struct etl_traits<etl::packed_matrix<T, P>> {
+    using expr_t     = etl::packed_matrix<T, P>; ///< The expression type
+    using value_type = T;                        ///< The value type of the expression
+
+    static constexpr bool is_etl          = true;            ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer  = false;           ///< Indicates if the type is a transformer
+    static constexpr bool is_view         = false;           ///< Indicates if the type is a view
+    static constexpr bool is_magic_view   = false;           ///< Indicates if the type is a magic view
+    static constexpr bool is_fast         = false;           ///< Indicates if the expression is fast
+    static constexpr bool is_linear       = true;            ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe  = true;            ///< Indicates if the expression is thread safe
+    static constexpr bool is_value        = false;           ///< Indicates if the expression is of value type
+    static constexpr bool is_direct       = false;           ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator    = false;           ///< Indicates if the expression is a generator
+    static constexpr bool is_padded       = false;           ///< Indicates if the expression is padded
+    static constexpr bool is_aligned      = false;           ///< Indicates if the expression is padded
+    static constexpr bool needs_evaluator = false;           ///< Indicates if the exxpression needs a evaluator visitor
+    static constexpr order storage_order  = order::RowMajor; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    using vectorizable = std::false_type;
+
+    /*!
+     * \brief Returns the size of the given expression
+     * \param v The expression to get the size for
+     * \returns the size of the given expression
+     */
+    static size_t size(const expr_t& v) noexcept {
+        return v.dimension() * v.dimension();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the given expression
+     * \param v The expression
+     * \param d The dimension to get
+     * \return The dth dimension of the given expression
+     */
+    static size_t dim(const expr_t& v, size_t d) noexcept {
+        cpp_unused(d);
+        return v.dimension();
+    }
+
+    /*!
+     * \brief Returns the number of expressions for this type
+     * \return the number of dimensions of this type
+     */
+    static constexpr size_t dimensions() noexcept {
+        return 2;
+    }
+};
+
+} //end of namespace etl
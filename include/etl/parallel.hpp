@@ -16,7 +16,7 @@ namespace etl {
  * \return true if the evaluation should be done in paralle, false otherwise
  */
 inline bool select_parallel(size_t n, size_t threshold = parallel_threshold) {
-    return threads > 1 && ((parallel_support && local_context().parallel)|| (is_parallel && n >= threshold && !local_context().serial));
+    return parallel_threads() > 1 && ((parallel_support && local_context().parallel)|| (is_parallel && n >= threshold && !local_context().serial));
 }
 
 /*!
@@ -28,7 +28,7 @@ inline bool select_parallel(size_t n, size_t threshold = parallel_threshold) {
  * \return true if the evaluation should be done in paralle, false otherwise
  */
 inline bool select_parallel_2d(size_t n1, size_t t1, size_t n2, size_t t2) {
-    return threads > 1 && ((parallel_support && local_context().parallel) || (is_parallel && n1 >= t1 && n2 >= t2 && !local_context().serial));
+    return parallel_threads() > 1 && ((parallel_support && local_context().parallel) || (is_parallel && n1 >= t1 && n2 >= t2 && !local_context().serial));
 }
 
 } //end of namespace etl
@@ -18,7 +18,7 @@ namespace etl {
  * \return true if the evaluation should be done in paralle, false otherwise
  */
 inline bool engine_select_parallel(size_t n, size_t threshold = parallel_threshold) {
-    return threads > 1 && !local_context().serial && (local_context().parallel || (is_parallel && n >= threshold));
+    return parallel_threads() > 1 && !local_context().serial && (local_context().parallel || (is_parallel && n >= threshold));
 }
 
 /*!
@@ -27,7 +27,7 @@ inline bool engine_select_parallel(size_t n, size_t threshold = parallel_thresho
  * \return true if the evaluation should be done in paralle, false otherwise
  */
 inline bool engine_select_parallel(bool select) {
-    return threads > 1 && !local_context().serial && (local_context().parallel || select);
+    return parallel_threads() > 1 && !local_context().serial && (local_context().parallel || select);
 }
 
 /*!
@@ -53,7 +53,7 @@ inline void engine_dispatch_1d(Functor&& functor, size_t first, size_t last, siz
 
     if (n) {
         if (engine_select_parallel(n, threshold)) {
-            const size_t T     = std::min(n, etl::threads);
+            const size_t T     = std::min(n, parallel_threads());
             const size_t batch = n / T;
 
             ETL_PARALLEL_SESSION {
@@ -74,6 +74,8 @@ inline void engine_dispatch_1d(Functor&& functor, size_t first, size_t last, siz
 }
 
 inline std::pair<size_t, size_t> thread_blocks(size_t M, size_t N) {
+    const size_t threads = parallel_threads();
+
     if (M >= N) {
         size_t m = std::min(threads, std::max(1UL, size_t(round(std::sqrt(threads * double(M) / double(N))))));
         size_t n = threads / m;
@@ -176,7 +178,7 @@ inline void engine_dispatch_1d(Functor&& functor, size_t first, size_t last, boo
 
     if (n) {
         if (engine_select_parallel(select)) {
-            const size_t T     = std::min(n, etl::threads);
+            const size_t T     = std::min(n, parallel_threads());
             const size_t batch = n / T;
 
             ETL_PARALLEL_SESSION {
@@ -211,7 +213,7 @@ inline void engine_dispatch_1d_acc(Functor&& functor, AccFunctor&& acc_functor,
 
     if(n){
         if (engine_select_parallel(n, threshold)) {
-            const size_t T     = std::min(n, etl::threads);
+            const size_t T     = std::min(n, parallel_threads());
             const size_t batch = n / T;
 
             std::vector<TT> futures(T);
@@ -261,7 +263,7 @@ inline void engine_dispatch_1d_acc_slice(E&& expr, Functor&& functor, AccFunctor
 
     if(n){
         if (engine_select_parallel(n, threshold)) {
-            const size_t T = std::min(n, etl::threads);
+            const size_t T = std::min(n, parallel_threads());
 
             std::vector<TT> futures(T);
 
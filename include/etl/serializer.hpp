@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "etl/util/tensor_codec.hpp"
+
 namespace etl {
 
 /*!
@@ -19,6 +21,9 @@ struct serializer {
 
     stream_t stream; ///< The stream
 
+    tensor_codec codec = tensor_codec::NONE;                 ///< The codec used to write the memory of the matrices
+    size_t block_size  = detail::tensor_default_block_size; ///< The size of the compressed blocks, in bytes
+
     /*!
      * \brief Construct the serializer by forwarding the arguments
      * to the stream
@@ -28,6 +33,31 @@ struct serializer {
     explicit serializer(Args&&... args)
             : stream(std::forward<Args>(args)...) {}
 
+    /*!
+     * \brief Compress the memory of the next matrices written to the stream.
+     *
+     * The compressed matrices are read back transparently by the
+     * deserializer.
+     *
+     * \param codec The codec to use
+     * \param block_size The size of the compressed blocks, in bytes
+     * \return the serializer
+     */
+    serializer& compress(tensor_codec codec = tensor_codec::SHUFFLE_LZ, size_t block_size = detail::tensor_default_block_size) {
+        this->codec      = codec;
+        this->block_size = block_size;
+        return *this;
+    }
+
+    /*!
+     * \brief Outputs a block of raw bytes to the stream
+     * \param data The bytes to write to the stream
+     * \param n The number of bytes to write
+     */
+    void write(const char* data, size_t n) {
+        stream.write(reinterpret_cast<const char_t*>(data), n);
+    }
+
     /*!
      * \brief Outputs the given value to the stream
      * \param value The value to write to the stream
@@ -35,7 +65,7 @@ struct serializer {
      */
     template <typename T, cpp_enable_if(std::is_arithmetic<T>::value)>
     serializer& operator<<(const T& value) {
-        stream.write(reinterpret_cast<const char_t*>(&value), sizeof(T));
+        write(reinterpret_cast<const char*>(&value), sizeof(T));
         return *this;
     }
 
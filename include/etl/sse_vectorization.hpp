@@ -703,6 +703,70 @@ struct sse_vec {
         return _mm_round_pd(x.value, (_MM_FROUND_TO_POS_INF |_MM_FROUND_NO_EXC));
     }
 
+    /*!
+     * \brief Reverse the order of the elements of the vector
+     */
+    ETL_STATIC_INLINE(sse_simd_float) reverse(sse_simd_float x) {
+        return _mm_shuffle_ps(x.value, x.value, _MM_SHUFFLE(0, 1, 2, 3));
+    }
+
+    /*!
+     * \brief Reverse the order of the elements of the vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) reverse(sse_simd_double x) {
+        return _mm_shuffle_pd(x.value, x.value, 1);
+    }
+
+    /*!
+     * \brief Return the even elements of the concatenation of lo and hi
+     * \param lo The first elements
+     * \param hi The next elements
+     */
+    ETL_STATIC_INLINE(sse_simd_float) deinterleave(sse_simd_float lo, sse_simd_float hi) {
+        return _mm_shuffle_ps(lo.value, hi.value, _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    /*!
+     * \copydoc deinterleave(sse_simd_float, sse_simd_float)
+     */
+    ETL_STATIC_INLINE(sse_simd_double) deinterleave(sse_simd_double lo, sse_simd_double hi) {
+        return _mm_unpacklo_pd(lo.value, hi.value);
+    }
+
+    /*!
+     * \brief Return the first half of the interleaving of a and b,
+     * a[0], b[0], a[1], b[1], ...
+     * \param a The even elements
+     * \param b The odd elements
+     */
+    ETL_STATIC_INLINE(sse_simd_float) interleave_lo(sse_simd_float a, sse_simd_float b) {
+        return _mm_unpacklo_ps(a.value, b.value);
+    }
+
+    /*!
+     * \copydoc interleave_lo(sse_simd_float, sse_simd_float)
+     */
+    ETL_STATIC_INLINE(sse_simd_double) interleave_lo(sse_simd_double a, sse_simd_double b) {
+        return _mm_unpacklo_pd(a.value, b.value);
+    }
+
+    /*!
+     * \brief Return the second half of the interleaving of a and b,
+     * a[n / 2], b[n / 2], a[n / 2 + 1], b[n / 2 + 1], ...
+     * \param a The even elements
+     * \param b The odd elements
+     */
+    ETL_STATIC_INLINE(sse_simd_float) interleave_hi(sse_simd_float a, sse_simd_float b) {
+        return _mm_unpackhi_ps(a.value, b.value);
+    }
+
+    /*!
+     * \copydoc interleave_hi(sse_simd_float, sse_simd_float)
+     */
+    ETL_STATIC_INLINE(sse_simd_double) interleave_hi(sse_simd_double a, sse_simd_double b) {
+        return _mm_unpackhi_pd(a.value, b.value);
+    }
+
     /*!
      * \brief Fill a packed vector  by replicating a value
      */
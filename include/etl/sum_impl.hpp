@@ -24,4 +24,24 @@ enum class sum_impl {
     CUBLAS ///< BLAS implementation
 };
 
+/*!
+ * \brief Returns the name of the given sum implementation
+ * \param impl The implementation
+ * \return a string literal naming the implementation
+ */
+inline const char* impl_name(sum_impl impl) {
+    switch (impl) {
+        case sum_impl::STD:
+            return "STD";
+        case sum_impl::VEC:
+            return "VEC";
+        case sum_impl::BLAS:
+            return "BLAS";
+        case sum_impl::CUBLAS:
+            return "CUBLAS";
+    }
+
+    return "UNKNOWN";
+}
+
 } //end of namespace etl
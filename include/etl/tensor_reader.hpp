@@ -0,0 +1,237 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Random access reader of serialized tensors
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief A random access reader of a tensor written by the serializer.
+ *
+ * Only the header of the tensor is read at construction. Ranges of values
+ * can then be read without reading the complete tensor. For compressed
+ * tensors, only the blocks containing the range are decompressed.
+ *
+ * The stream must support seeking (file or string streams).
+ */
+template <typename Stream>
+struct tensor_reader {
+    using stream_t = Stream; ///< The type of stream to use
+
+private:
+    deserializer<stream_t> input;        ///< The input
+    detail::tensor_header header_;       ///< The header of the tensor
+    bool valid_ = false;                 ///< Indicates if the tensor is valid
+    std::streamoff data_start = 0;       ///< The position of the data in the stream
+    std::streamoff data_end   = 0;       ///< The position of the end of the stream
+    std::vector<std::streamoff> offsets; ///< The position of each compressed block
+    std::vector<uint32_t> sizes;         ///< The size of each compressed block
+
+public:
+    /*!
+     * \brief Construct the reader by forwarding the arguments
+     * to the stream and read the header of the tensor
+     * \param args The arguments to forward to the stream constructor
+     */
+    template <typename... Args>
+    explicit tensor_reader(Args&&... args)
+            : input(std::forward<Args>(args)...) {
+        valid_ = detail::read_tensor_header(input, header_) && input.stream;
+
+        if (!valid_) {
+            return;
+        }
+
+        data_start = std::streamoff(input.stream.tellg());
+
+        // The size of the data is validated before allocating the index of the blocks
+        const size_t available = input.remaining();
+
+        if (!detail::check_tensor_data_size(header_, available)) {
+            valid_ = false;
+            return;
+        }
+
+        data_end = available == std::numeric_limits<size_t>::max() ? std::numeric_limits<std::streamoff>::max() : data_start + std::streamoff(available);
+
+        if (header_.codec == tensor_codec::SHUFFLE_LZ) {
+            valid_ = header_.block_size > 0 && header_.block_size <= detail::tensor_max_block_size && index_blocks();
+        } else {
+            valid_ = header_.codec == tensor_codec::NONE;
+        }
+    }
+
+    /*!
+     * \brief Indicates if a valid tensor has been found in the stream
+     */
+    bool valid() const {
+        return valid_;
+    }
+
+    /*!
+     * \brief Returns the header of the tensor
+     */
+    const detail::tensor_header& header() const {
+        return header_;
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the tensor
+     */
+    size_t dimensions() const {
+        return header_.dimensions;
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the tensor
+     */
+    size_t dim(size_t d) const {
+        return header_.dims[d];
+    }
+
+    /*!
+     * \brief Returns the number of values of the tensor
+     */
+    size_t size() const {
+        return header_.size();
+    }
+
+    /*!
+     * \brief Returns the number of compressed blocks of the tensor, 0 if
+     * the tensor is not compressed
+     */
+    size_t blocks() const {
+        return offsets.size();
+    }
+
+    /*!
+     * \brief Read a range of values of the tensor.
+     *
+     * The values are in the storage order of the tensor. For compressed
+     * tensors, the blocks covering the range are decompressed in parallel.
+     *
+     * \param first The index of the first value to read
+     * \param n The number of values to read
+     * \param out The memory where to write the values
+     * \return true if the values have been read, false otherwise
+     */
+    template <typename T>
+    bool read(size_t first, size_t n, T* out) {
+        if (!valid_ || header_.dtype != detail::tensor_dtype_of<T>() || header_.value_size != sizeof(T) || first > size() || n > size() - first) {
+            return false;
+        }
+
+        if (!n) {
+            return true;
+        }
+
+        input.stream.clear();
+
+        if (header_.codec == tensor_codec::NONE) {
+            input.stream.seekg(data_start + std::streamoff(first * sizeof(T)));
+            input.read(reinterpret_cast<char*>(out), n * sizeof(T));
+
+            return bool(input.stream);
+        }
+
+        const size_t bytes       = size() * sizeof(T);
+        const size_t block_size  = header_.block_size;
+        const size_t first_byte  = first * sizeof(T);
+        const size_t last_byte   = (first + n) * sizeof(T);
+        const size_t first_block = first_byte / block_size;
+        const size_t last_block  = (last_byte - 1) / block_size + 1;
+
+        const size_t count = last_block - first_block;
+
+        std::vector<std::vector<uint8_t>> compressed(count);
+
+        for (size_t b = first_block; b < last_block; ++b) {
+            compressed[b - first_block].resize(sizes[b] & ~detail::block_raw_flag);
+
+            input.stream.seekg(offsets[b]);
+            input.read(reinterpret_cast<char*>(compressed[b - first_block].data()), compressed[b - first_block].size());
+        }
+
+        if (!input.stream) {
+            return false;
+        }
+
+        std::vector<char> status(count, 1);
+
+        auto batch_fun = [&](const size_t f, const size_t l) {
+            std::vector<uint8_t> tmp;
+
+            for (size_t b = f; b < l; ++b) {
+                const size_t block_first = b * block_size;
+                const size_t block_n     = detail::block_bytes(b, bytes, block_size);
+
+                const size_t lo = std::max(block_first, first_byte);
+                const size_t hi = std::min(block_first + block_n, last_byte);
+
+                auto dst = reinterpret_cast<uint8_t*>(out) + (lo - first_byte);
+
+                // Blocks fully inside the range are decompressed in place
+                if (lo == block_first && hi == block_first + block_n) {
+                    status[b - first_block] = detail::decompress_block(compressed[b - first_block].data(), sizes[b], sizeof(T), dst, block_n);
+                } else {
+                    tmp.resize(block_n);
+
+                    status[b - first_block] = detail::decompress_block(compressed[b - first_block].data(), sizes[b], sizeof(T), tmp.data(), block_n);
+
+                    std::memcpy(dst, tmp.data() + (lo - block_first), hi - lo);
+                }
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, first_block, last_block, select_parallel(n) && count > 1);
+
+        return std::all_of(status.begin(), status.end(), [](char s) { return s != 0; });
+    }
+
+private:
+    /*!
+     * \brief Find the position of all the compressed blocks
+     * \return true if all the blocks have been found, false otherwise
+     */
+    bool index_blocks() {
+        const size_t bytes = size() * header_.value_size;
+        const size_t count = detail::block_count(bytes, header_.block_size);
+
+        offsets.resize(count);
+        sizes.resize(count);
+
+        std::streamoff position = data_start;
+
+        for (size_t b = 0; b < count; ++b) {
+            char size[4];
+
+            input.stream.seekg(position);
+            input.read(size, 4);
+
+            std::memcpy(&sizes[b], size, 4);
+
+            const size_t c = sizes[b] & ~detail::block_raw_flag;
+
+            // The block must fit in the rest of the stream, as it is allocated before being read
+            if (!input.stream || c > detail::lz_bound(header_.block_size) || std::streamoff(c) > data_end - (position + 4)) {
+                return false;
+            }
+
+            offsets[b] = position + 4;
+            position   = offsets[b] + std::streamoff(c);
+        }
+
+        return true;
+    }
+};
+
+} //end of namespace etl
@@ -41,13 +41,14 @@ struct conf_thread_engine {
      */
     template <class Functor, typename... Args>
     static void schedule(Functor&& fun, Args&&... args) {
-        get_pool().do_task(std::forward<Functor>(fun), std::forward<Args>(args)...);
+        get_pool().do_task(detail::trace_task(std::forward<Functor>(fun), args...), std::forward<Args>(args)...);
     }
 
     /*!
      * \brief Wait for all the scheduled threads to finish their task
      */
     static void wait(){
+        detail::trace_wait trace;
         get_pool().wait();
     }
 
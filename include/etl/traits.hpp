@@ -176,6 +176,17 @@ using is_uni_lower_matrix = cpp::is_specialization_of<etl::uni_lower_matrix, std
 template <typename T>
 using is_uni_upper_matrix = cpp::is_specialization_of<etl::uni_upper_matrix, std::decay_t<T>>;
 
+/*!
+ * \brief Traits indicating if the given ETL type is a diagonal or a
+ * triangular matrix, with a known zero structure
+ * \tparam T The type to test
+ */
+template <typename T>
+using is_structured_matrix = cpp::or_c<
+    is_diagonal_matrix<T>,
+    is_lower_matrix<T>, is_strictly_lower_matrix<T>, is_uni_lower_matrix<T>,
+    is_upper_matrix<T>, is_strictly_upper_matrix<T>, is_uni_upper_matrix<T>>;
+
 /*!
  * \brief Traits indicating if the given ETL type is a unary expression.
  * \tparam T The type to test
@@ -251,6 +262,12 @@ using is_sub_view = traits_detail::is_sub_view<std::decay_t<T>>;
 template <typename T>
 using is_slice_view = cpp::is_specialization_of<etl::slice_view, std::decay_t<T>>;
 
+/*!
+ * \brief Traits to test if the given expression is a strided_view
+ */
+template <typename T>
+using is_strided_view = cpp::is_specialization_of<etl::strided_view, std::decay_t<T>>;
+
 /*!
  * \brief Traits to test if the given expression is a dyn_matrix_view
  */
@@ -590,6 +607,42 @@ using fast_sub_matrix_able = has_direct_access<T>;
 template <typename T>
 using fast_slice_view_able = fast_sub_view_able<T>;
 
+/*!
+ * \brief Traits indicating if the memory of all the sub views and slices
+ * (on the first dimension) of this type is known to be aligned at
+ * compile-time.
+ *
+ * This is the case for the aligned fast matrices with a sub size multiple of
+ * the vector alignment.
+ */
+template <typename T, typename Enable = void>
+struct aligned_sub_view_able : std::false_type {};
+
+/*!
+ * \copydoc aligned_sub_view_able
+ */
+template <typename T>
+struct aligned_sub_view_able<T, std::enable_if_t<fast_sub_view_able<T>::value && decay_traits<T>::is_fast && decay_traits<T>::is_aligned && (decay_traits<T>::dimensions() > 1)>>
+        : cpp::bool_constant<(decay_traits<T>::size() / decay_traits<T>::template dim<0>() * sizeof(value_t<T>)) % default_intrinsic_traits<value_t<T>>::alignment == 0> {};
+
+/*!
+ * \brief Indicates if the given memory is aligned for the vector mode V.
+ *
+ * When the memory is known to be aligned at compile-time (Aligned), the
+ * runtime test is optimized away.
+ *
+ * \param memory The memory to test
+ * \tparam V The vector implementation
+ * \tparam Aligned Indicates if the memory is known to be aligned to the default alignment
+ * \return true if the memory can be used with aligned loads and stores, false otherwise
+ */
+template <typename V, bool Aligned, typename T>
+ETL_STRONG_INLINE(bool) is_aligned_memory(const T* memory) noexcept {
+    constexpr size_t A = V::template traits<std::remove_const_t<T>>::alignment;
+
+    return (Aligned && A <= default_intrinsic_traits<std::remove_const_t<T>>::alignment) || reinterpret_cast<uintptr_t>(memory) % A == 0;
+}
+
 /*!
  * \brief Traits to test if an expression is inplace transpose-able
  * \tparam T The type to test
@@ -1108,4 +1161,64 @@ bool safe_is_gpu_up_to_date(E&& expr){
     return false;
 }
 
+/*!
+ * \brief Load a vector of the values expr[index(l)] of the expression.
+ *
+ * The expression has direct memory access, the values are loaded with a
+ * hardware gather if the vector implementation has one.
+ *
+ * \param expr The expression
+ * \param index A functor returning the index in expr of the given lane
+ */
+template <typename V, typename E, typename F, cpp_enable_if(all_dma<E>::value)>
+ETL_STRONG_INLINE(typename V::template vec_type<value_t<E>>) indexed_load(const E& expr, F&& index) {
+    return gather_load<V>(expr.memory_start(), index);
+}
+
+/*!
+ * \brief Load a vector of the values expr[index(l)] of the expression.
+ *
+ * The expression does not have direct memory access, the values are
+ * computed one by one.
+ *
+ * \param expr The expression
+ * \param index A functor returning the index in expr of the given lane
+ */
+template <typename V, typename E, typename F, cpp_disable_if(all_dma<E>::value)>
+ETL_STRONG_INLINE(typename V::template vec_type<value_t<E>>) indexed_load(const E& expr, F&& index) {
+    return gather_load<V, value_t<E>>([&expr, &index](size_t l) { return expr[index(l)]; });
+}
+
+/*!
+ * \brief Load a vector of the values expr[first + l * stride] of the
+ * expression.
+ *
+ * The expression has direct memory access, the values are loaded with a
+ * hardware gather if the vector implementation has one.
+ *
+ * \param expr The expression
+ * \param first The index of the first value
+ * \param stride The distance between two values
+ */
+template <typename V, typename E, cpp_enable_if(all_dma<E>::value)>
+ETL_STRONG_INLINE(typename V::template vec_type<value_t<E>>) strided_load(const E& expr, size_t first, size_t stride) {
+    return strided_load<V>(expr.memory_start() + first, stride);
+}
+
+/*!
+ * \brief Load a vector of the values expr[first + l * stride] of the
+ * expression.
+ *
+ * The expression does not have direct memory access, the values are
+ * computed one by one.
+ *
+ * \param expr The expression
+ * \param first The index of the first value
+ * \param stride The distance between two values
+ */
+template <typename V, typename E, cpp_disable_if(all_dma<E>::value)>
+ETL_STRONG_INLINE(typename V::template vec_type<value_t<E>>) strided_load(const E& expr, size_t first, size_t stride) {
+    return gather_load<V, value_t<E>>([&expr, first, stride](size_t l) { return expr[first + l * stride]; });
+}
+
 } //end of namespace etl
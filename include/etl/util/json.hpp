@@ -0,0 +1,50 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Minimal JSON output helpers, shared by the profile, the trace and
+ * the benchmark exports
+ */
+
+#pragma once
+
+#include <ostream>
+#include <string>
+
+namespace etl {
+
+/*!
+ * \brief Write a string as a quoted JSON string.
+ *
+ * The quotes and the backslashes are escaped and the control characters
+ * are written as \\u00XX.
+ *
+ * \param os The stream to write to
+ * \param value The string to write
+ */
+inline void write_json_string(std::ostream& os, const std::string& value) {
+    const char* hex = "0123456789abcdef";
+
+    os << '"';
+
+    for (char c : value) {
+        auto u = static_cast<unsigned char>(c);
+
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (u < 0x20) {
+            os << "\\u00" << hex[u >> 4] << hex[u & 0xF];
+        } else {
+            os << c;
+        }
+    }
+
+    os << '"';
+}
+
+} //end of namespace etl
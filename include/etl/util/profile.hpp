@@ -0,0 +1,474 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Per-expression profiling (ETL_PROFILE)
+ *
+ * When ETL_PROFILE is defined, the evaluation of the main operations
+ * (assignments, GEMM, convolutions, pooling and reductions) is recorded:
+ * call count, total and maximum time, bytes touched, floating point
+ * operations and the selected implementation. The records are aggregated
+ * in a table per thread and merged when they are dumped.
+ *
+ * When ETL_PROFILE is not defined, all the functions are empty.
+ */
+
+#pragma once
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "etl/util/json.hpp"
+
+namespace etl {
+
+/*!
+ * \brief The aggregated profile of an operation with an implementation
+ */
+struct profile_record {
+    std::string operation; ///< The name of the operation
+    std::string impl;      ///< The selected implementation
+    size_t count    = 0;   ///< The number of calls
+    size_t total_ns = 0;   ///< The total time, in nanoseconds
+    size_t max_ns   = 0;   ///< The maximum time of one call, in nanoseconds
+    size_t bytes    = 0;   ///< The total number of bytes touched
+    size_t flops    = 0;   ///< The total number of floating point operations
+};
+
+} //end of namespace etl
+
+#ifndef ETL_PROFILE
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Profile the current scope (disabled)
+ */
+struct profile_scope {
+    /*!
+     * \brief Start profiling an operation (disabled)
+     */
+    profile_scope(const char* operation, const char* impl, size_t bytes, size_t flops) : site(operation) {
+        cpp_unused(impl);
+        cpp_unused(bytes);
+        cpp_unused(flops);
+    }
+
+private:
+    trace_site site; ///< The operation is the dispatch site of its parallel tasks
+};
+
+/*!
+ * \brief Set the implementation of the current profiled operation (disabled)
+ */
+inline void profile_set_impl(const char* impl) {
+    cpp_unused(impl);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Returns the aggregated profile records (none)
+ */
+inline std::vector<profile_record> profile_records() {
+    return {};
+}
+
+/*!
+ * \brief Reset all the profile records
+ */
+inline void reset_profile() {
+    //No profile
+}
+
+/*!
+ * \brief Dump the profile records in JSON
+ * \param os The stream to write to
+ */
+inline void dump_profile_json(std::ostream& os) {
+    cpp_unused(os);
+}
+
+/*!
+ * \brief Dump the profile records in CSV
+ * \param os The stream to write to
+ */
+inline void dump_profile_csv(std::ostream& os) {
+    cpp_unused(os);
+}
+
+} //end of namespace etl
+
+#else
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <ostream>
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief A profile entry of a thread.
+ *
+ * The entry is only written by its thread, the counters are atomic so that
+ * they can be read while the profile is dumped.
+ */
+struct profile_entry {
+    std::atomic<const char*> operation; ///< The name of the operation
+    std::atomic<const char*> impl;      ///< The selected implementation
+    std::atomic<size_t> count;          ///< The number of calls
+    std::atomic<size_t> total_ns;       ///< The total time, in nanoseconds
+    std::atomic<size_t> max_ns;         ///< The maximum time of one call, in nanoseconds
+    std::atomic<size_t> bytes;          ///< The total number of bytes touched
+    std::atomic<size_t> flops;          ///< The total number of floating point operations
+};
+
+/*!
+ * \brief Add value to a counter only written by the current thread
+ */
+inline void profile_add(std::atomic<size_t>& counter, size_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+struct profile_table;
+
+/*!
+ * \brief The registry of the profile tables of all the threads
+ */
+struct profile_registry {
+    std::mutex lock;                     ///< The lock protecting the registry
+    std::vector<profile_table*> tables;  ///< The tables of the running threads
+    std::vector<profile_record> retired; ///< The records of the terminated threads and of the full tables
+    std::atomic<size_t> epoch{0};        ///< The epoch, incremented when the profile is reset
+};
+
+/*!
+ * \brief Returns the global profile registry
+ */
+inline profile_registry& get_profile_registry() {
+    static profile_registry registry;
+    return registry;
+}
+
+/*!
+ * \brief The profile entries of one thread.
+ *
+ * The entries are accumulated without any lock and merged when the profile
+ * is dumped. When the profile is reset, the epoch of the registry changes
+ * and the thread discards its entries on its next record.
+ */
+struct profile_table {
+    static constexpr size_t capacity = 64; ///< The maximum number of entries
+
+    profile_entry entries[capacity]; ///< The entries
+    std::atomic<size_t> size{0};     ///< The number of published entries
+    std::atomic<size_t> epoch{0};    ///< The epoch of the entries
+
+    /*!
+     * \brief Record a call of an operation
+     */
+    void record(const char* operation, const char* impl, size_t ns, size_t bytes, size_t flops) {
+        auto& registry = get_profile_registry();
+
+        const size_t current = registry.epoch.load(std::memory_order_acquire);
+
+        if (epoch.load(std::memory_order_relaxed) != current) {
+            size.store(0, std::memory_order_relaxed);
+            epoch.store(current, std::memory_order_release);
+        }
+
+        const size_t n = size.load(std::memory_order_relaxed);
+
+        for (size_t i = 0; i < n; ++i) {
+            auto& entry = entries[i];
+
+            if (entry.operation.load(std::memory_order_relaxed) == operation && entry.impl.load(std::memory_order_relaxed) == impl) {
+                profile_add(entry.count, 1);
+                profile_add(entry.total_ns, ns);
+                profile_add(entry.bytes, bytes);
+                profile_add(entry.flops, flops);
+
+                if (ns > entry.max_ns.load(std::memory_order_relaxed)) {
+                    entry.max_ns.store(ns, std::memory_order_relaxed);
+                }
+
+                return;
+            }
+        }
+
+        if (n < capacity) {
+            auto& entry = entries[n];
+
+            entry.operation.store(operation, std::memory_order_relaxed);
+            entry.impl.store(impl, std::memory_order_relaxed);
+            entry.count.store(1, std::memory_order_relaxed);
+            entry.total_ns.store(ns, std::memory_order_relaxed);
+            entry.max_ns.store(ns, std::memory_order_relaxed);
+            entry.bytes.store(bytes, std::memory_order_relaxed);
+            entry.flops.store(flops, std::memory_order_relaxed);
+
+            size.store(n + 1, std::memory_order_release);
+        } else {
+            // The table is full, the call is directly merged in the registry
+
+            profile_record record;
+            record.operation = operation;
+            record.impl      = impl ? impl : "";
+            record.count     = 1;
+            record.total_ns  = ns;
+            record.max_ns    = ns;
+            record.bytes     = bytes;
+            record.flops     = flops;
+
+            std::lock_guard<std::mutex> l(registry.lock);
+
+            if (registry.epoch.load(std::memory_order_relaxed) == current) {
+                registry.retired.push_back(record);
+            }
+        }
+    }
+
+    /*!
+     * \brief Call the functor on each entry of the current epoch
+     * \param current The current epoch of the registry
+     * \param functor The functor to call on each profile_record
+     */
+    template <typename Functor>
+    void for_each(size_t current, Functor functor) const {
+        if (epoch.load(std::memory_order_acquire) != current) {
+            return;
+        }
+
+        const size_t n = size.load(std::memory_order_acquire);
+
+        for (size_t i = 0; i < n; ++i) {
+            auto& entry = entries[i];
+
+            profile_record record;
+            auto* impl       = entry.impl.load(std::memory_order_relaxed);
+            record.operation = entry.operation.load(std::memory_order_relaxed);
+            record.impl      = impl ? impl : "";
+            record.count     = entry.count.load(std::memory_order_relaxed);
+            record.total_ns  = entry.total_ns.load(std::memory_order_relaxed);
+            record.max_ns    = entry.max_ns.load(std::memory_order_relaxed);
+            record.bytes     = entry.bytes.load(std::memory_order_relaxed);
+            record.flops     = entry.flops.load(std::memory_order_relaxed);
+
+            functor(record);
+        }
+    }
+};
+
+/*!
+ * \brief The profile table of a thread, registered during the lifetime of
+ * the thread
+ */
+struct profile_thread_table {
+    profile_table table; ///< The table of the thread
+
+    profile_thread_table() {
+        auto& registry = get_profile_registry();
+
+        std::lock_guard<std::mutex> l(registry.lock);
+
+        table.epoch.store(registry.epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        registry.tables.push_back(&table);
+    }
+
+    ~profile_thread_table() {
+        auto& registry = get_profile_registry();
+
+        std::lock_guard<std::mutex> l(registry.lock);
+
+        registry.tables.erase(std::remove(registry.tables.begin(), registry.tables.end(), &table), registry.tables.end());
+
+        table.for_each(registry.epoch.load(std::memory_order_relaxed), [&registry](const profile_record& record) {
+            registry.retired.push_back(record);
+        });
+    }
+};
+
+/*!
+ * \brief Returns the profile table of the current thread
+ */
+inline profile_table& local_profile_table() {
+    static thread_local profile_thread_table local_table;
+    return local_table.table;
+}
+
+/*!
+ * \brief Profile the current scope.
+ *
+ * The operation is recorded when the scope is destroyed.
+ */
+struct profile_scope {
+    /*!
+     * \brief Start profiling an operation
+     * \param operation The name of the operation
+     * \param impl The implementation, can be set later with profile_set_impl
+     * \param bytes The number of bytes touched by the operation
+     * \param flops The number of floating point operations of the operation
+     */
+    profile_scope(const char* operation, const char* impl, size_t bytes, size_t flops)
+            : operation(operation), impl(impl), bytes(bytes), flops(flops), parent(current()), site(operation), start(timer_clock::now()) {
+        current() = this;
+    }
+
+    profile_scope(const profile_scope& rhs) = delete;
+    profile_scope& operator=(const profile_scope& rhs) = delete;
+
+    /*!
+     * \brief Record the operation
+     */
+    ~profile_scope() {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_clock::now() - start).count();
+
+        current() = parent;
+
+        local_profile_table().record(operation, impl, size_t(ns), bytes, flops);
+    }
+
+    /*!
+     * \brief Returns the innermost profile scope of the current thread
+     */
+    static profile_scope*& current() {
+        static thread_local profile_scope* scope = nullptr;
+        return scope;
+    }
+
+    const char* operation; ///< The name of the operation
+    const char* impl;      ///< The selected implementation
+    size_t bytes;          ///< The number of bytes touched
+    size_t flops;          ///< The number of floating point operations
+
+private:
+    profile_scope* parent;                     ///< The enclosing scope
+    trace_site site;                           ///< The operation is the dispatch site of its parallel tasks
+    std::chrono::time_point<timer_clock> start; ///< The start time of the operation
+};
+
+/*!
+ * \brief Set the implementation of the current profiled operation
+ * \param impl The selected implementation
+ */
+inline void profile_set_impl(const char* impl) {
+    if (auto* scope = profile_scope::current()) {
+        scope->impl = impl;
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Returns the profile records of all the threads, aggregated by
+ * operation and implementation and sorted by total time (DESC)
+ */
+inline std::vector<profile_record> profile_records() {
+    auto& registry = detail::get_profile_registry();
+
+    std::map<std::pair<std::string, std::string>, profile_record> records;
+
+    auto merge = [&records](const profile_record& entry) {
+        auto& record = records[std::make_pair(entry.operation, entry.impl)];
+
+        record.count += entry.count;
+        record.total_ns += entry.total_ns;
+        record.max_ns = std::max(record.max_ns, entry.max_ns);
+        record.bytes += entry.bytes;
+        record.flops += entry.flops;
+    };
+
+    {
+        std::lock_guard<std::mutex> l(registry.lock);
+
+        const size_t current = registry.epoch.load(std::memory_order_relaxed);
+
+        for (auto& entry : registry.retired) {
+            merge(entry);
+        }
+
+        for (auto* table : registry.tables) {
+            table->for_each(current, merge);
+        }
+    }
+
+    std::vector<profile_record> result;
+
+    for (auto& record : records) {
+        result.push_back(record.second);
+        result.back().operation = record.first.first;
+        result.back().impl      = record.first.second;
+    }
+
+    std::sort(result.begin(), result.end(), [](auto& lhs, auto& rhs) { return lhs.total_ns > rhs.total_ns; });
+
+    return result;
+}
+
+/*!
+ * \brief Reset all the profile records
+ */
+inline void reset_profile() {
+    auto& registry = detail::get_profile_registry();
+
+    std::lock_guard<std::mutex> l(registry.lock);
+
+    registry.retired.clear();
+    registry.epoch.fetch_add(1, std::memory_order_release);
+}
+
+/*!
+ * \brief Dump the profile records in JSON
+ * \param os The stream to write to
+ */
+inline void dump_profile_json(std::ostream& os) {
+    auto records = profile_records();
+
+    os << "[";
+
+    for (size_t i = 0; i < records.size(); ++i) {
+        auto& record = records[i];
+
+        os << (i ? ",\n " : "\n ") << "{\"operation\": ";
+        write_json_string(os, record.operation);
+        os << ", \"impl\": ";
+        write_json_string(os, record.impl);
+        os << ", \"count\": " << record.count
+           << ", \"total_ns\": " << record.total_ns
+           << ", \"max_ns\": " << record.max_ns
+           << ", \"bytes\": " << record.bytes
+           << ", \"flops\": " << record.flops << "}";
+    }
+
+    os << "\n]\n";
+}
+
+/*!
+ * \brief Dump the profile records in CSV
+ * \param os The stream to write to
+ */
+inline void dump_profile_csv(std::ostream& os) {
+    os << "operation,impl,count,total_ns,max_ns,bytes,flops\n";
+
+    for (auto& record : profile_records()) {
+        os << record.operation << ',' << record.impl << ',' << record.count << ',' << record.total_ns << ',' << record.max_ns << ','
+           << record.bytes << ',' << record.flops << '\n';
+    }
+}
+
+} //end of namespace etl
+
+#endif
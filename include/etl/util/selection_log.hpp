@@ -0,0 +1,477 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Log of the implementation selections (ETL_SELECTION_LOG)
+ *
+ * When ETL_SELECTION_LOG is defined, the decisions of the implementation
+ * selectors (GEMM, sum, 4D valid convolution and FFT) are recorded with
+ * the shape of the operation, the implementations that could have been
+ * used, the selected implementation and the reason of the selection. The
+ * decisions can be summarized in a report with the histogram of the
+ * implementations of each operation.
+ *
+ * When ETL_SELECTION_LOG is not defined, nothing is recorded.
+ */
+
+#pragma once
+
+#include <initializer_list>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace etl {
+
+/*!
+ * \brief The reason of the selection of an implementation
+ */
+enum class selection_reason {
+    HEURISTIC,  ///< Selected by the default heuristic (thresholds and configuration)
+    FORCED,     ///< Forced by the local context
+    UNAVAILABLE ///< Forced by the local context but not available, selected by the default heuristic
+};
+
+/*!
+ * \brief Returns the name of the given selection reason
+ * \param reason The reason
+ * \return a string literal naming the reason
+ */
+inline const char* reason_name(selection_reason reason) {
+    switch (reason) {
+        case selection_reason::HEURISTIC:
+            return "heuristic";
+        case selection_reason::FORCED:
+            return "forced";
+        case selection_reason::UNAVAILABLE:
+            return "unavailable";
+    }
+
+    return "unknown";
+}
+
+/*!
+ * \brief The aggregated selections of an operation with the same shape,
+ * implementation and reason
+ */
+struct selection_record {
+    std::string operation;  ///< The name of the operation
+    std::string shape;      ///< The shape of the operation (e.g. 128x64x32)
+    std::string candidates; ///< The implementations that could be selected
+    std::string impl;       ///< The selected implementation
+    selection_reason reason = selection_reason::HEURISTIC; ///< The reason of the selection
+    size_t count = 0;       ///< The number of selections
+};
+
+namespace detail {
+
+/*!
+ * \brief Returns the candidate bit of the given implementation
+ * \param impl The implementation
+ * \param available Indicates if the implementation can be selected
+ */
+template <typename Impl>
+constexpr size_t impl_bit(Impl impl, bool available = true) {
+    return available ? size_t(1) << size_t(impl) : size_t(0);
+}
+
+} //end of namespace detail
+
+} //end of namespace etl
+
+#ifndef ETL_SELECTION_LOG
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief A call site of an implementation selector (disabled)
+ */
+template <typename Impl>
+struct selection_site {
+    /*!
+     * \brief Construct the site of the given operation (disabled)
+     */
+    constexpr explicit selection_site(const char* operation) {
+        cpp_unused(operation);
+    }
+};
+
+/*!
+ * \brief Log the selection of an implementation (disabled)
+ * \return The selected implementation
+ */
+template <typename Impl>
+Impl log_selection(selection_site<Impl>& site, std::initializer_list<size_t> shape, size_t candidates, Impl impl, selection_reason reason) {
+    cpp_unused(site);
+    cpp_unused(shape);
+    cpp_unused(candidates);
+    cpp_unused(reason);
+    return impl;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Returns the logged selections (none)
+ */
+inline std::vector<selection_record> selection_records() {
+    return {};
+}
+
+/*!
+ * \brief Clear the log of the selections
+ */
+inline void reset_selection_log() {
+    //No log
+}
+
+/*!
+ * \brief Write the report of the selections
+ * \param os The stream to write to
+ */
+inline void dump_selection_report(std::ostream& os) {
+    cpp_unused(os);
+}
+
+} //end of namespace etl
+
+#else
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <tuple>
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief The largest number of dimensions of a logged shape
+ */
+constexpr size_t selection_max_dims = 4;
+
+/*!
+ * \brief The selections of a call site with the same shape, candidates,
+ * implementation and reason. The key is immutable once published.
+ */
+struct selection_entry {
+    size_t shape[selection_max_dims]; ///< The shape of the operation
+    size_t dims;                      ///< The number of dimensions of the shape
+    size_t candidates;                ///< The candidate bits
+    size_t impl;                      ///< The selected implementation
+    selection_reason reason;          ///< The reason of the selection
+    std::atomic<size_t> count;        ///< The number of selections
+};
+
+/*!
+ * \brief A call site of an implementation selector.
+ *
+ * A site is a static of its selector and is registered once in the global
+ * log, its index being its id. The selections are counted in the entries
+ * of the site: only the first selection of a new key takes the lock of the
+ * site, the following ones only increment an atomic counter.
+ */
+struct selection_site_base {
+    static constexpr size_t capacity = 32; ///< The maximum number of entries
+
+    const char* operation;               ///< The name of the operation
+    const char* (*name)(size_t);         ///< Returns the name of an implementation
+    size_t id;                           ///< The index of the site in the log
+    selection_entry entries[capacity];   ///< The entries
+    std::atomic<size_t> size{0};         ///< The number of published entries
+    std::atomic<size_t> overflow{0};     ///< The selections not fitting in the entries
+    std::mutex lock;                     ///< The lock protecting the insertion of entries
+
+    selection_site_base(const char* operation, const char* (*name)(size_t));
+
+    selection_site_base(const selection_site_base& rhs) = delete;
+    selection_site_base& operator=(const selection_site_base& rhs) = delete;
+
+    /*!
+     * \brief Returns the entry of the given key in the n first entries, nullptr if none
+     */
+    selection_entry* find(size_t n, const size_t* shape, size_t dims, size_t candidates, size_t impl, selection_reason reason) {
+        for (size_t i = 0; i < n; ++i) {
+            auto& entry = entries[i];
+
+            if (entry.impl == impl && entry.reason == reason && entry.candidates == candidates && entry.dims == dims && std::equal(shape, shape + dims, entry.shape)) {
+                return &entry;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /*!
+     * \brief Count a selection
+     */
+    void record(std::initializer_list<size_t> shape, size_t candidates, size_t impl, selection_reason reason) {
+        const size_t dims = std::min(shape.size(), selection_max_dims);
+
+        if (auto* entry = find(size.load(std::memory_order_acquire), shape.begin(), dims, candidates, impl, reason)) {
+            entry->count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::lock_guard<std::mutex> l(lock);
+
+        const size_t n = size.load(std::memory_order_relaxed);
+
+        if (auto* entry = find(n, shape.begin(), dims, candidates, impl, reason)) {
+            entry->count.fetch_add(1, std::memory_order_relaxed);
+        } else if (n < capacity) {
+            auto& entry = entries[n];
+
+            std::copy_n(shape.begin(), dims, entry.shape);
+            entry.dims       = dims;
+            entry.candidates = candidates;
+            entry.impl       = impl;
+            entry.reason     = reason;
+            entry.count.store(1, std::memory_order_relaxed);
+
+            size.store(n + 1, std::memory_order_release);
+        } else {
+            overflow.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+};
+
+/*!
+ * \brief The log of the selections, the registry of the call sites
+ */
+struct selection_log {
+    std::mutex lock;                          ///< The lock protecting the registration of the sites
+    std::vector<selection_site_base*> sites; ///< The registered sites
+};
+
+/*!
+ * \brief Returns the global selection log
+ */
+inline selection_log& get_selection_log() {
+    static selection_log log;
+    return log;
+}
+
+/*!
+ * \brief Construct and register the site of the given operation
+ * \param operation The name of the operation
+ * \param name The function returning the name of an implementation
+ */
+inline selection_site_base::selection_site_base(const char* operation, const char* (*name)(size_t)) : operation(operation), name(name) {
+    auto& log = get_selection_log();
+
+    std::lock_guard<std::mutex> l(log.lock);
+
+    id = log.sites.size();
+    log.sites.push_back(this);
+}
+
+/*!
+ * \brief A call site of an implementation selector of implementations of type Impl
+ */
+template <typename Impl>
+struct selection_site : selection_site_base {
+    /*!
+     * \brief Construct the site of the given operation
+     */
+    explicit selection_site(const char* operation) : selection_site_base(operation, &impl_name_of) {}
+
+    /*!
+     * \brief Returns the name of the given implementation
+     */
+    static const char* impl_name_of(size_t impl) {
+        return impl_name(Impl(impl));
+    }
+};
+
+/*!
+ * \brief Log the selection of an implementation
+ * \param site The call site of the selection
+ * \param shape The dimensions of the operation
+ * \param candidates The candidate bits of the implementations that can be selected
+ * \param impl The selected implementation
+ * \param reason The reason of the selection
+ * \return The selected implementation
+ */
+template <typename Impl>
+Impl log_selection(selection_site<Impl>& site, std::initializer_list<size_t> shape, size_t candidates, Impl impl, selection_reason reason) {
+    site.record(shape, candidates, size_t(impl), reason);
+    return impl;
+}
+
+/*!
+ * \brief Returns the comma-separated names of the candidate implementations
+ * \param site The call site
+ * \param candidates The candidate bits
+ */
+inline std::string selection_candidates(const selection_site_base& site, size_t candidates) {
+    std::string names;
+
+    for (size_t i = 0; i < sizeof(size_t) * 8; ++i) {
+        if (candidates & (size_t(1) << i)) {
+            if (!names.empty()) {
+                names += ',';
+            }
+
+            names += site.name(i);
+        }
+    }
+
+    return names;
+}
+
+/*!
+ * \brief Returns the shape as a string (e.g. 128x64x32)
+ */
+inline std::string selection_shape(const selection_entry& entry) {
+    std::string shape;
+
+    for (size_t d = 0; d < entry.dims; ++d) {
+        if (d) {
+            shape += 'x';
+        }
+
+        shape += std::to_string(entry.shape[d]);
+    }
+
+    return shape;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Returns the logged selections, aggregated by operation, shape,
+ * implementation and reason, sorted by operation and then by count (DESC)
+ */
+inline std::vector<selection_record> selection_records() {
+    auto& log = detail::get_selection_log();
+
+    std::map<std::tuple<std::string, std::string, std::string, std::string, selection_reason>, size_t> selections;
+
+    {
+        std::lock_guard<std::mutex> l(log.lock);
+
+        for (auto* site : log.sites) {
+            const size_t n = site->size.load(std::memory_order_acquire);
+
+            for (size_t i = 0; i < n; ++i) {
+                auto& entry = site->entries[i];
+
+                if (const size_t count = entry.count.load(std::memory_order_relaxed)) {
+                    selections[std::make_tuple(std::string(site->operation), detail::selection_shape(entry),
+                                               detail::selection_candidates(*site, entry.candidates), std::string(site->name(entry.impl)), entry.reason)] += count;
+                }
+            }
+
+            if (const size_t count = site->overflow.load(std::memory_order_relaxed)) {
+                selections[std::make_tuple(std::string(site->operation), std::string("other"), std::string(), std::string("other"), selection_reason::HEURISTIC)] += count;
+            }
+        }
+    }
+
+    std::vector<selection_record> records;
+
+    for (auto& selection : selections) {
+        records.emplace_back();
+
+        auto& record      = records.back();
+        record.operation  = std::get<0>(selection.first);
+        record.shape      = std::get<1>(selection.first);
+        record.candidates = std::get<2>(selection.first);
+        record.impl       = std::get<3>(selection.first);
+        record.reason     = std::get<4>(selection.first);
+        record.count      = selection.second;
+    }
+
+    std::stable_sort(records.begin(), records.end(), [](auto& lhs, auto& rhs) {
+        return lhs.operation < rhs.operation || (lhs.operation == rhs.operation && lhs.count > rhs.count);
+    });
+
+    return records;
+}
+
+/*!
+ * \brief Clear the log of the selections
+ */
+inline void reset_selection_log() {
+    auto& log = detail::get_selection_log();
+
+    std::lock_guard<std::mutex> l(log.lock);
+
+    // The keys are kept, only the counters are cleared
+    for (auto* site : log.sites) {
+        const size_t n = site->size.load(std::memory_order_acquire);
+
+        for (size_t i = 0; i < n; ++i) {
+            site->entries[i].count.store(0, std::memory_order_relaxed);
+        }
+
+        site->overflow.store(0, std::memory_order_relaxed);
+    }
+}
+
+/*!
+ * \brief Write the report of the selections.
+ *
+ * For each operation, the histogram of the selected implementations and
+ * reasons is written, followed by the detail of the selections of each
+ * shape.
+ *
+ * \param os The stream to write to
+ */
+inline void dump_selection_report(std::ostream& os) {
+    auto records = selection_records();
+
+    auto old_flags     = os.flags();
+    auto old_precision = os.precision();
+
+    using histogram_key = std::pair<std::string, selection_reason>;
+
+    for (size_t first = 0; first < records.size();) {
+        size_t last = first;
+        size_t total = 0;
+
+        std::map<histogram_key, size_t> histogram;
+
+        while (last < records.size() && records[last].operation == records[first].operation) {
+            total += records[last].count;
+            histogram[std::make_pair(records[last].impl, records[last].reason)] += records[last].count;
+            ++last;
+        }
+
+        os << records[first].operation << " (" << total << " selections)\n";
+
+        for (auto& entry : histogram) {
+            os << "  " << std::left << std::setw(12) << entry.first.first << std::setw(12) << reason_name(entry.first.second)
+               << std::right << std::setw(10) << entry.second << std::setw(8) << std::fixed << std::setprecision(1)
+               << 100.0 * entry.second / total << "%\n";
+        }
+
+        for (size_t i = first; i < last; ++i) {
+            auto& record = records[i];
+
+            os << "    " << std::left << std::setw(20) << record.shape << std::setw(12) << record.impl << std::setw(12)
+               << reason_name(record.reason) << std::right << std::setw(10) << record.count << "  [" << record.candidates << "]\n";
+        }
+
+        first = last;
+    }
+
+    os.flags(old_flags);
+    os.precision(old_precision);
+}
+
+} //end of namespace etl
+
+#endif
@@ -0,0 +1,509 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Compression codec of the serialized tensors
+ *
+ * The memory of the tensor is split in blocks of fixed size. Each block is
+ * byte-shuffled (the first bytes of all the values, then the second bytes,
+ * ...) and then compressed with a small LZ77 coder (LZ4-like sequences of
+ * literals and matches). The blocks are compressed and decompressed in
+ * parallel.
+ *
+ * Each block is written as a 32-bit size, whose highest bit indicates that
+ * the block is stored without LZ compression, followed by its payload. The
+ * blocks can therefore be located without decompressing them.
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief The compression codec of a serialized tensor
+ */
+enum class tensor_codec : uint8_t {
+    NONE       = 0, ///< The memory is written as is
+    SHUFFLE_LZ = 1  ///< The memory is byte-shuffled and compressed by blocks
+};
+
+namespace detail {
+
+constexpr size_t lz_min_match    = 4;          ///< The minimum length of a match
+constexpr size_t lz_last_literals = 5;         ///< The number of bytes at the end of a block that are always literals
+constexpr size_t lz_hash_log     = 14;         ///< The log of the size of the hash table
+constexpr size_t lz_max_offset   = 65535;      ///< The maximum offset of a match
+constexpr uint32_t block_raw_flag = 1U << 31; ///< Flag of a block stored without LZ compression
+
+constexpr size_t tensor_default_block_size = 256 * 1024;       ///< The default size of the compressed blocks, in bytes
+constexpr size_t tensor_max_block_size     = 1024 * 1024 * 1024; ///< The maximum size of the compressed blocks, in bytes
+
+/*!
+ * \brief Returns the maximum size of a compressed block of n bytes
+ */
+inline size_t lz_bound(size_t n) {
+    return n + n / 255 + 16;
+}
+
+/*!
+ * \brief Read 4 bytes of memory
+ */
+inline uint32_t lz_read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+
+/*!
+ * \brief Hash 4 bytes of memory into the hash table
+ */
+inline uint32_t lz_hash(uint32_t v) {
+    return (v * 2654435761U) >> (32 - lz_hash_log);
+}
+
+/*!
+ * \brief Write a length extension (sequence of 255 and the rest)
+ * \param op The output pointer
+ * \param length The length to write
+ * \return the output pointer after the length
+ */
+inline uint8_t* lz_write_length(uint8_t* op, size_t length) {
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+
+    *op++ = uint8_t(length);
+
+    return op;
+}
+
+/*!
+ * \brief Write a sequence of literals followed by a match
+ * \param op The output pointer
+ * \param literals The literals
+ * \param literal_length The number of literals
+ * \param offset The offset of the match
+ * \param match_length The length of the match, 0 for the last sequence
+ * \return the output pointer after the sequence
+ */
+inline uint8_t* lz_write_sequence(uint8_t* op, const uint8_t* literals, size_t literal_length, size_t offset, size_t match_length) {
+    const size_t ml = match_length ? match_length - lz_min_match : 0;
+
+    *op++ = uint8_t((std::min<size_t>(literal_length, 15) << 4) | std::min<size_t>(ml, 15));
+
+    if (literal_length >= 15) {
+        op = lz_write_length(op, literal_length - 15);
+    }
+
+    std::memcpy(op, literals, literal_length);
+    op += literal_length;
+
+    if (match_length) {
+        *op++ = uint8_t(offset & 0xFF);
+        *op++ = uint8_t(offset >> 8);
+
+        if (ml >= 15) {
+            op = lz_write_length(op, ml - 15);
+        }
+    }
+
+    return op;
+}
+
+/*!
+ * \brief Compress a block of memory
+ * \param in The memory to compress
+ * \param n The number of bytes to compress
+ * \param out The output memory, of at least lz_bound(n) bytes
+ * \param table The hash table, of (1 << lz_hash_log) entries
+ * \return The number of compressed bytes
+ */
+inline size_t lz_compress(const uint8_t* in, size_t n, uint8_t* out, uint32_t* table) {
+    std::fill_n(table, size_t(1) << lz_hash_log, uint32_t(-1));
+
+    uint8_t* op = out;
+
+    size_t anchor = 0;
+    size_t ip     = 0;
+
+    if (n > lz_min_match + lz_last_literals) {
+        const size_t limit = n - lz_last_literals;
+
+        while (ip + lz_min_match <= limit) {
+            const uint32_t sequence = lz_read32(in + ip);
+            const uint32_t h        = lz_hash(sequence);
+            const uint32_t ref      = table[h];
+
+            table[h] = uint32_t(ip);
+
+            if (ref != uint32_t(-1) && ip - ref <= lz_max_offset && lz_read32(in + ref) == sequence) {
+                size_t length = lz_min_match;
+
+                // Extend the match, 8 bytes at a time first
+                while (ip + length + 8 <= limit) {
+                    uint64_t a;
+                    uint64_t b;
+
+                    std::memcpy(&a, in + ref + length, 8);
+                    std::memcpy(&b, in + ip + length, 8);
+
+                    if (a != b) {
+                        break;
+                    }
+
+                    length += 8;
+                }
+
+                while (ip + length < limit && in[ref + length] == in[ip + length]) {
+                    ++length;
+                }
+
+                op = lz_write_sequence(op, in + anchor, ip - anchor, ip - ref, length);
+
+                ip += length;
+                anchor = ip;
+
+                // Index a position inside the match to find the next ones
+                if (ip >= 2 && ip - 2 + lz_min_match <= n) {
+                    table[lz_hash(lz_read32(in + ip - 2))] = uint32_t(ip - 2);
+                }
+            } else {
+                // Accelerate in the incompressible regions
+                ip += 1 + ((ip - anchor) >> 6);
+            }
+        }
+    }
+
+    op = lz_write_sequence(op, in + anchor, n - anchor, 0, 0);
+
+    return size_t(op - out);
+}
+
+/*!
+ * \brief Decompress a block of memory.
+ *
+ * All the accesses are checked, a corrupted block is detected and does not
+ * cause any access outside the buffers.
+ *
+ * \param in The compressed block
+ * \param n The number of compressed bytes
+ * \param out The output memory
+ * \param out_n The expected number of decompressed bytes
+ * \return true if the block has been decompressed, false if it is corrupted
+ */
+inline bool lz_decompress(const uint8_t* in, size_t n, uint8_t* out, size_t out_n) {
+    const uint8_t* ip     = in;
+    const uint8_t* ip_end = in + n;
+
+    size_t op = 0;
+
+    auto read_length = [&](size_t& length) {
+        uint8_t b;
+
+        do {
+            if (ip == ip_end) {
+                return false;
+            }
+
+            b = *ip++;
+            length += b;
+        } while (b == 255);
+
+        return true;
+    };
+
+    while (ip < ip_end) {
+        const uint8_t token = *ip++;
+
+        size_t literal_length = token >> 4;
+
+        if (literal_length == 15 && !read_length(literal_length)) {
+            return false;
+        }
+
+        if (literal_length > size_t(ip_end - ip) || literal_length > out_n - op) {
+            return false;
+        }
+
+        std::memcpy(out + op, ip, literal_length);
+
+        ip += literal_length;
+        op += literal_length;
+
+        // The last sequence has no match
+        if (ip == ip_end) {
+            break;
+        }
+
+        if (ip_end - ip < 2) {
+            return false;
+        }
+
+        const size_t offset = size_t(ip[0]) | (size_t(ip[1]) << 8);
+        ip += 2;
+
+        size_t match_length = token & 15;
+
+        if (match_length == 15 && !read_length(match_length)) {
+            return false;
+        }
+
+        match_length += lz_min_match;
+
+        if (offset == 0 || offset > op || match_length > out_n - op) {
+            return false;
+        }
+
+        uint8_t* dst       = out + op;
+        const uint8_t* src = dst - offset;
+
+        if (offset >= match_length) {
+            std::memcpy(dst, src, match_length);
+        } else {
+            for (size_t i = 0; i < match_length; ++i) {
+                dst[i] = src[i];
+            }
+        }
+
+        op += match_length;
+    }
+
+    return op == out_n;
+}
+
+/*!
+ * \brief Byte-shuffle values: all the first bytes, then all the second bytes, ...
+ * \param in The values
+ * \param out The shuffled bytes
+ * \param n The number of bytes
+ * \param w The size of one value
+ */
+inline void byte_shuffle(const uint8_t* in, uint8_t* out, size_t n, size_t w) {
+    const size_t count = n / w;
+
+    for (size_t b = 0; b < w; ++b) {
+        uint8_t* o = out + b * count;
+
+        for (size_t i = 0; i < count; ++i) {
+            o[i] = in[i * w + b];
+        }
+    }
+
+    // The bytes of an incomplete value are not shuffled
+    std::copy(in + count * w, in + n, out + count * w);
+}
+
+/*!
+ * \brief Reverse the byte shuffle of values
+ * \param in The shuffled bytes
+ * \param out The values
+ * \param n The number of bytes
+ * \param w The size of one value
+ */
+inline void byte_unshuffle(const uint8_t* in, uint8_t* out, size_t n, size_t w) {
+    const size_t count = n / w;
+
+    for (size_t b = 0; b < w; ++b) {
+        const uint8_t* s = in + b * count;
+
+        for (size_t i = 0; i < count; ++i) {
+            out[i * w + b] = s[i];
+        }
+    }
+
+    std::copy(in + count * w, in + n, out + count * w);
+}
+
+/*!
+ * \brief Returns the size of the given block
+ * \param b The index of the block
+ * \param bytes The total number of bytes
+ * \param block_size The size of the blocks
+ */
+inline size_t block_bytes(size_t b, size_t bytes, size_t block_size) {
+    return std::min(block_size, bytes - b * block_size);
+}
+
+/*!
+ * \brief Returns the number of blocks of the given memory
+ * \param bytes The total number of bytes
+ * \param block_size The size of the blocks
+ */
+inline size_t block_count(size_t bytes, size_t block_size) {
+    return (bytes + block_size - 1) / block_size;
+}
+
+/*!
+ * \brief Compress a block: byte-shuffle and LZ
+ * \param in The memory of the block
+ * \param n The number of bytes of the block
+ * \param w The size of one value
+ * \param out The compressed block, resized to its size
+ * \return The size of the block, with block_raw_flag if not compressed
+ */
+inline uint32_t compress_block(const uint8_t* in, size_t n, size_t w, std::vector<uint8_t>& out) {
+    std::vector<uint8_t> shuffled(n);
+    std::vector<uint32_t> table(size_t(1) << lz_hash_log);
+
+    byte_shuffle(in, shuffled.data(), n, w);
+
+    out.resize(lz_bound(n));
+
+    const size_t c = lz_compress(shuffled.data(), n, out.data(), table.data());
+
+    if (c >= n) {
+        out = std::move(shuffled);
+        return uint32_t(n) | block_raw_flag;
+    }
+
+    out.resize(c);
+
+    return uint32_t(c);
+}
+
+/*!
+ * \brief Decompress a block: LZ and byte-unshuffle
+ * \param in The compressed block
+ * \param size The size of the block, with block_raw_flag if not compressed
+ * \param w The size of one value
+ * \param out The memory of the block
+ * \param n The number of bytes of the block
+ * \return true if the block has been decompressed, false if it is corrupted
+ */
+inline bool decompress_block(const uint8_t* in, uint32_t size, size_t w, uint8_t* out, size_t n) {
+    const size_t c = size & ~block_raw_flag;
+
+    if (size & block_raw_flag) {
+        if (c != n) {
+            return false;
+        }
+
+        byte_unshuffle(in, out, n, w);
+
+        return true;
+    }
+
+    std::vector<uint8_t> shuffled(n);
+
+    if (!lz_decompress(in, c, shuffled.data(), n)) {
+        return false;
+    }
+
+    byte_unshuffle(shuffled.data(), out, n, w);
+
+    return true;
+}
+
+/*!
+ * \brief Compress memory by blocks and write the blocks to a serializer.
+ *
+ * The blocks are compressed in parallel, in batches, to bound the
+ * additional memory.
+ *
+ * \param os The serializer
+ * \param data The memory to compress
+ * \param bytes The number of bytes
+ * \param w The size of one value
+ * \param block_size The size of the blocks
+ */
+template <typename Serializer>
+void write_compressed_blocks(Serializer& os, const char* data, size_t bytes, size_t w, size_t block_size) {
+    const size_t blocks = block_count(bytes, block_size);
+    const size_t batch  = 4 * std::max(etl::parallel_threads(), size_t(1));
+
+    std::vector<std::vector<uint8_t>> compressed(std::min(batch, blocks));
+    std::vector<uint32_t> sizes(compressed.size());
+
+    for (size_t first = 0; first < blocks; first += batch) {
+        const size_t last = std::min(blocks, first + batch);
+
+        auto batch_fun = [&](const size_t f, const size_t l) {
+            for (size_t b = f; b < l; ++b) {
+                sizes[b - first] = compress_block(
+                    reinterpret_cast<const uint8_t*>(data) + b * block_size, block_bytes(b, bytes, block_size), w, compressed[b - first]);
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, first, last, etl::select_parallel((last - first) * block_size / w) && last - first > 1);
+
+        for (size_t b = first; b < last; ++b) {
+            char size[4];
+            std::memcpy(size, &sizes[b - first], 4);
+
+            os.write(size, 4);
+            os.write(reinterpret_cast<const char*>(compressed[b - first].data()), compressed[b - first].size());
+        }
+    }
+}
+
+/*!
+ * \brief Read blocks from a deserializer and decompress them to memory.
+ *
+ * The blocks are read sequentially, in batches, and each batch is
+ * decompressed in parallel.
+ *
+ * \param is The deserializer
+ * \param data The memory to fill
+ * \param bytes The number of bytes
+ * \param w The size of one value
+ * \param block_size The size of the blocks
+ * \return true if all the blocks have been decompressed, false otherwise
+ */
+template <typename Deserializer>
+bool read_compressed_blocks(Deserializer& is, char* data, size_t bytes, size_t w, size_t block_size) {
+    const size_t blocks = block_count(bytes, block_size);
+    const size_t batch  = 4 * std::max(etl::parallel_threads(), size_t(1));
+
+    std::vector<std::vector<uint8_t>> compressed(std::min(batch, blocks));
+    std::vector<uint32_t> sizes(compressed.size());
+
+    bool valid = true;
+
+    for (size_t first = 0; valid && first < blocks; first += batch) {
+        const size_t last = std::min(blocks, first + batch);
+
+        for (size_t b = first; b < last; ++b) {
+            char size[4];
+            is.read(size, 4);
+            std::memcpy(&sizes[b - first], size, 4);
+
+            const size_t c = sizes[b - first] & ~block_raw_flag;
+
+            if (!is.stream || c > lz_bound(block_size)) {
+                return false;
+            }
+
+            compressed[b - first].resize(c);
+            is.read(reinterpret_cast<char*>(compressed[b - first].data()), c);
+        }
+
+        if (!is.stream) {
+            return false;
+        }
+
+        std::vector<char> status(last - first, 1);
+
+        auto batch_fun = [&](const size_t f, const size_t l) {
+            for (size_t b = f; b < l; ++b) {
+                status[b - first] = decompress_block(
+                    compressed[b - first].data(), sizes[b - first], w, reinterpret_cast<uint8_t*>(data) + b * block_size, block_bytes(b, bytes, block_size));
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, first, last, etl::select_parallel((last - first) * block_size / w) && last - first > 1);
+
+        valid = std::all_of(status.begin(), status.end(), [](char s) { return s != 0; });
+    }
+
+    return valid;
+}
+
+} //end of namespace detail
+
+} //end of namespace etl
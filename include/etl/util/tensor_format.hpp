@@ -0,0 +1,508 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Binary tensor format used by the serializer.
+ *
+ * A serialized tensor is made of a header followed by the memory of the
+ * tensor, either raw and written in a single block or compressed by blocks
+ * (see tensor_codec.hpp). The header is laid out as follows (all the values
+ * are in the byte order of the host):
+ *
+ *  - 8 bytes: magic ("\x93ETLTNSR")
+ *  - 4 bytes: version of the format
+ *  - 1 byte: type of the values (tensor_dtype)
+ *  - 1 byte: storage order (0: row-major, 1: column-major)
+ *  - 1 byte: number of dimensions D
+ *  - 1 byte: size of one value, in bytes
+ *  - 4 bytes: alignment of the data, relative to the start of the header
+ *  - 4 bytes: size of the header, including the padding
+ *  - 8 bytes: checksum of the data
+ *  - Since version 2: 1 byte: codec (tensor_codec), 3 bytes: reserved,
+ *    4 bytes: size of the compressed blocks, in bytes
+ *  - D * 8 bytes: the dimensions
+ *  - Padding up to the size of the header
+ *
+ * Uncompressed tensors are written with the version 1 of the header. The old
+ * format (dimensions and values written one by one) has no magic and is
+ * still read by the deserializer.
+ */
+
+#pragma once
+
+#include <cstring> //For memcpy
+#include <ios>     //For the stream state
+#include <limits>  //For the overflow checks
+
+#include "etl/util/tensor_codec.hpp"
+
+namespace etl {
+
+/*!
+ * \brief The type of the values of a serialized tensor
+ */
+enum class tensor_dtype : uint8_t {
+    UNKNOWN    = 0,  ///< Type not known by the format
+    FLOAT      = 1,  ///< float
+    DOUBLE     = 2,  ///< double
+    INT8       = 3,  ///< int8_t
+    INT16      = 4,  ///< int16_t
+    INT32      = 5,  ///< int32_t
+    INT64      = 6,  ///< int64_t
+    UINT8      = 7,  ///< uint8_t
+    UINT16     = 8,  ///< uint16_t
+    UINT32     = 9,  ///< uint32_t
+    UINT64     = 10, ///< uint64_t
+    COMPLEX64  = 11, ///< complex of float
+    COMPLEX128 = 12  ///< complex of double
+};
+
+namespace detail {
+
+constexpr size_t tensor_magic_size     = 8;  ///< The size of the magic of the tensor format
+constexpr uint32_t tensor_version      = 2;  ///< The current version of the tensor format
+constexpr uint32_t tensor_alignment    = 64; ///< The alignment of the data of a serialized tensor
+constexpr size_t tensor_fixed_size     = 32; ///< The size of the fixed part of the header
+constexpr size_t tensor_codec_size     = 8;  ///< The size of the codec part of the header (since version 2)
+constexpr size_t tensor_max_dimensions = 32; ///< The maximum number of dimensions of a serialized tensor
+
+/*!
+ * \brief Returns the magic of the tensor format
+ */
+inline const char* tensor_magic() {
+    return "\x93" "ETLTNSR";
+}
+
+/*!
+ * \brief Returns the tensor_dtype corresponding to the type T
+ */
+template <typename T>
+constexpr tensor_dtype tensor_dtype_of() {
+    return std::is_same<T, float>::value ? tensor_dtype::FLOAT
+         : std::is_same<T, double>::value ? tensor_dtype::DOUBLE
+         : std::is_same<T, int8_t>::value ? tensor_dtype::INT8
+         : std::is_same<T, int16_t>::value ? tensor_dtype::INT16
+         : std::is_same<T, int32_t>::value ? tensor_dtype::INT32
+         : std::is_same<T, int64_t>::value ? tensor_dtype::INT64
+         : std::is_same<T, uint8_t>::value ? tensor_dtype::UINT8
+         : std::is_same<T, uint16_t>::value ? tensor_dtype::UINT16
+         : std::is_same<T, uint32_t>::value ? tensor_dtype::UINT32
+         : std::is_same<T, uint64_t>::value ? tensor_dtype::UINT64
+         : (std::is_same<T, std::complex<float>>::value || std::is_same<T, etl::complex<float>>::value) ? tensor_dtype::COMPLEX64
+         : (std::is_same<T, std::complex<double>>::value || std::is_same<T, etl::complex<double>>::value) ? tensor_dtype::COMPLEX128
+         : tensor_dtype::UNKNOWN;
+}
+
+/*!
+ * \brief Compute the checksum of a block of memory.
+ *
+ * This is a FNV-1a hash on 64-bit words, with four independent lanes to
+ * avoid a single chain of multiplications.
+ *
+ * \param data The memory to hash
+ * \param n The number of bytes to hash
+ * \return the checksum of the memory
+ */
+inline uint64_t tensor_checksum(const void* data, size_t n) {
+    constexpr uint64_t basis = 14695981039346656037ULL;
+    constexpr uint64_t prime = 1099511628211ULL;
+
+    auto bytes = static_cast<const char*>(data);
+
+    uint64_t h0 = basis;
+    uint64_t h1 = basis ^ 1;
+    uint64_t h2 = basis ^ 2;
+    uint64_t h3 = basis ^ 3;
+
+    size_t i = 0;
+
+    for (; i + 31 < n; i += 32) {
+        uint64_t w[4];
+        std::memcpy(w, bytes + i, 32);
+
+        h0 = (h0 ^ w[0]) * prime;
+        h1 = (h1 ^ w[1]) * prime;
+        h2 = (h2 ^ w[2]) * prime;
+        h3 = (h3 ^ w[3]) * prime;
+    }
+
+    for (; i < n; ++i) {
+        h0 = (h0 ^ uint8_t(bytes[i])) * prime;
+    }
+
+    uint64_t h = basis;
+
+    h = (h ^ h0) * prime;
+    h = (h ^ h1) * prime;
+    h = (h ^ h2) * prime;
+    h = (h ^ h3) * prime;
+    h = (h ^ uint64_t(n)) * prime;
+
+    return h;
+}
+
+/*!
+ * \brief Compute the number of bytes of a tensor from its dimensions
+ * \param first The first dimension
+ * \param last The end of the dimensions
+ * \param value_size The size of one value, in bytes
+ * \param bytes Receives the number of bytes
+ * \return false if the number of bytes does not fit in a size_t, true otherwise
+ */
+template <typename Iterator>
+bool checked_data_size(Iterator first, Iterator last, size_t value_size, size_t& bytes) {
+    bytes = value_size;
+
+    for (; first != last; ++first) {
+        const size_t d = *first;
+
+        if (d && bytes > std::numeric_limits<size_t>::max() / d) {
+            return false;
+        }
+
+        bytes *= d;
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Returns the number of bytes remaining in the given stream, from
+ * its current position.
+ *
+ * The position and the state of the stream are preserved. If the stream
+ * cannot be seeked, the maximum size_t is returned.
+ *
+ * \param stream The input stream
+ */
+template <typename Stream>
+size_t stream_remaining(Stream& stream) {
+    const auto state   = stream.rdstate();
+    const auto current = stream.tellg();
+
+    size_t n = std::numeric_limits<size_t>::max();
+
+    if (current != decltype(current)(-1)) {
+        if (stream.seekg(0, std::ios_base::end)) {
+            const auto end = stream.tellg();
+
+            if (end != decltype(end)(-1) && end >= current) {
+                n = size_t(end - current);
+            }
+        }
+
+        stream.clear();
+        stream.seekg(current);
+    }
+
+    stream.clear(state);
+
+    return n;
+}
+
+/*!
+ * \brief The header of a serialized tensor
+ */
+struct tensor_header {
+    uint32_t version     = tensor_version;        ///< The version of the format
+    tensor_dtype dtype   = tensor_dtype::UNKNOWN; ///< The type of the values
+    uint8_t storage      = 0;                     ///< The storage order (0: row-major, 1: column-major)
+    uint8_t dimensions   = 0;                     ///< The number of dimensions
+    uint8_t value_size   = 0;                     ///< The size of one value, in bytes
+    uint32_t alignment   = tensor_alignment;      ///< The alignment of the data
+    uint32_t header_size = 0;                     ///< The size of the header, including the padding
+    uint64_t checksum    = 0;                     ///< The checksum of the data
+    tensor_codec codec   = tensor_codec::NONE;    ///< The codec of the data
+    uint32_t block_size  = 0;                     ///< The size of the compressed blocks
+    std::array<uint64_t, tensor_max_dimensions> dims; ///< The dimensions
+
+    /*!
+     * \brief Returns the size of the header, without the padding
+     */
+    size_t raw_size() const {
+        return tensor_fixed_size + (version >= 2 ? tensor_codec_size : 0) + 8 * dimensions;
+    }
+
+    /*!
+     * \brief Returns the number of values of the tensor
+     */
+    size_t size() const {
+        size_t s = 1;
+
+        for (size_t d = 0; d < dimensions; ++d) {
+            s *= dims[d];
+        }
+
+        return s;
+    }
+};
+
+/*!
+ * \brief Create the header of the given matrix
+ * \param matrix The matrix to serialize
+ * \param codec The codec of the data
+ * \param block_size The size of the compressed blocks, in bytes
+ * \return The header of the matrix, with the checksum of its memory
+ */
+template <typename E>
+tensor_header make_tensor_header(const E& matrix, tensor_codec codec = tensor_codec::NONE, size_t block_size = tensor_default_block_size) {
+    using T = value_t<E>;
+
+    static_assert(decay_traits<E>::dimensions() <= tensor_max_dimensions, "Too many dimensions for the tensor format");
+
+    tensor_header header;
+
+    header.dtype      = tensor_dtype_of<T>();
+    header.storage    = decay_traits<E>::storage_order == order::RowMajor ? 0 : 1;
+    header.dimensions = uint8_t(etl::dimensions(matrix));
+    header.value_size = uint8_t(sizeof(T));
+
+    for (size_t d = 0; d < etl::dimensions(matrix); ++d) {
+        header.dims[d] = etl::dim(matrix, d);
+    }
+
+    if (codec != tensor_codec::NONE) {
+        // The blocks hold complete values and their size must fit in 31 bits
+        block_size = std::min(std::max(block_size, sizeof(T)), tensor_max_block_size);
+
+        header.version    = tensor_version;
+        header.codec      = codec;
+        header.block_size = uint32_t(block_size - block_size % sizeof(T));
+    } else {
+        header.version = 1;
+    }
+
+    header.header_size = uint32_t(((header.raw_size() + tensor_alignment - 1) / tensor_alignment) * tensor_alignment);
+    header.checksum    = tensor_checksum(matrix.memory_start(), etl::size(matrix) * sizeof(T));
+
+    return header;
+}
+
+/*!
+ * \brief Write a value in its binary representation to the given buffer
+ * \param buffer The buffer to write to
+ * \param value The value to write
+ * \return a pointer to the buffer, after the value
+ */
+template <typename T>
+char* tensor_put(char* buffer, T value) {
+    std::memcpy(buffer, &value, sizeof(T));
+    return buffer + sizeof(T);
+}
+
+/*!
+ * \brief Read a value in its binary representation from the given buffer
+ * \param buffer The buffer to read from
+ * \param value The value to read
+ * \return a pointer to the buffer, after the value
+ */
+template <typename T>
+const char* tensor_get(const char* buffer, T& value) {
+    std::memcpy(&value, buffer, sizeof(T));
+    return buffer + sizeof(T);
+}
+
+/*!
+ * \brief Write the header of a tensor to the given serializer
+ * \param os The serializer
+ * \param header The header to write
+ */
+template <typename Serializer>
+void write_tensor_header(Serializer& os, const tensor_header& header) {
+    std::vector<char> buffer(header.header_size, 0);
+
+    char* it = buffer.data();
+
+    std::memcpy(it, tensor_magic(), tensor_magic_size);
+    it += tensor_magic_size;
+
+    it = tensor_put(it, header.version);
+    it = tensor_put(it, uint8_t(header.dtype));
+    it = tensor_put(it, header.storage);
+    it = tensor_put(it, header.dimensions);
+    it = tensor_put(it, header.value_size);
+    it = tensor_put(it, header.alignment);
+    it = tensor_put(it, header.header_size);
+    it = tensor_put(it, header.checksum);
+
+    if (header.version >= 2) {
+        it = tensor_put(it, uint8_t(header.codec));
+        it += 3;
+        it = tensor_put(it, header.block_size);
+    }
+
+    for (size_t d = 0; d < header.dimensions; ++d) {
+        it = tensor_put(it, header.dims[d]);
+    }
+
+    os.write(buffer.data(), buffer.size());
+}
+
+/*!
+ * \brief Read the header of a tensor from the given deserializer.
+ *
+ * If the stream does not start with the magic of the format, nothing is
+ * consumed from the stream and false is returned.
+ *
+ * \param is The deserializer
+ * \param header The header to fill
+ * \return true if a header has been read, false otherwise
+ */
+template <typename Deserializer>
+bool read_tensor_header(Deserializer& is, tensor_header& header) {
+    if (!is.peek_equals(tensor_magic(), tensor_magic_size)) {
+        return false;
+    }
+
+    char buffer[tensor_fixed_size + tensor_codec_size + 8 * tensor_max_dimensions];
+
+    is.read(buffer, tensor_fixed_size);
+
+    uint8_t dtype;
+
+    const char* it = buffer + tensor_magic_size;
+
+    it = tensor_get(it, header.version);
+    it = tensor_get(it, dtype);
+    it = tensor_get(it, header.storage);
+    it = tensor_get(it, header.dimensions);
+    it = tensor_get(it, header.value_size);
+    it = tensor_get(it, header.alignment);
+    it = tensor_get(it, header.header_size);
+    it = tensor_get(it, header.checksum);
+
+    header.dtype = tensor_dtype(dtype);
+
+    if (header.version == 0 || header.version > tensor_version || header.dimensions > tensor_max_dimensions || header.header_size < header.raw_size()) {
+        is.stream.setstate(std::ios_base::failbit);
+        return true;
+    }
+
+    it = buffer;
+
+    if (header.version >= 2) {
+        uint8_t codec;
+
+        is.read(buffer, tensor_codec_size);
+
+        it = tensor_get(it, codec);
+        it += 3;
+        it = tensor_get(it, header.block_size);
+
+        header.codec = tensor_codec(codec);
+
+        it = buffer;
+    }
+
+    is.read(buffer, 8 * header.dimensions);
+
+    for (size_t d = 0; d < header.dimensions; ++d) {
+        it = tensor_get(it, header.dims[d]);
+    }
+
+    is.skip(header.header_size - header.raw_size());
+
+    return true;
+}
+
+/*!
+ * \brief Validate a read header against the given matrix type
+ * \param header The header that has been read
+ * \return true if the tensor can be read into a matrix of type E, false otherwise
+ */
+template <typename E>
+bool check_tensor_header(const tensor_header& header) {
+    using T = value_t<E>;
+
+    return header.dtype == tensor_dtype_of<T>()
+        && header.value_size == sizeof(T)
+        && header.storage == (decay_traits<E>::storage_order == order::RowMajor ? 0 : 1)
+        && header.dimensions == decay_traits<E>::dimensions();
+}
+
+/*!
+ * \brief Validate the size of the data of a tensor against the number of
+ * bytes remaining in the stream, before any memory is allocated for it
+ * \param header The header that has been read
+ * \param available The number of bytes remaining in the stream
+ * \return true if the data of the tensor can be in the stream, false otherwise
+ */
+inline bool check_tensor_data_size(const tensor_header& header, size_t available) {
+    size_t bytes;
+
+    if (!checked_data_size(header.dims.begin(), header.dims.begin() + header.dimensions, header.value_size, bytes)) {
+        return false;
+    }
+
+    // Each compressed block is stored with at least its size
+    if (header.codec == tensor_codec::SHUFFLE_LZ) {
+        return header.block_size > 0 && block_count(bytes, header.block_size) <= available / 4;
+    }
+
+    return bytes <= available;
+}
+
+/*!
+ * \brief Serialize the memory of a matrix with a tensor header
+ * \param os The serializer
+ * \param matrix The matrix to serialize
+ */
+template <typename Serializer, typename E>
+void serialize_tensor(Serializer& os, const E& matrix) {
+    matrix.ensure_cpu_up_to_date();
+
+    auto header = make_tensor_header(matrix, os.codec, os.block_size);
+
+    write_tensor_header(os, header);
+
+    auto memory = reinterpret_cast<const char*>(matrix.memory_start());
+
+    if (header.codec == tensor_codec::SHUFFLE_LZ) {
+        write_compressed_blocks(os, memory, etl::size(matrix) * sizeof(value_t<E>), header.value_size, header.block_size);
+    } else {
+        os.write(memory, etl::size(matrix) * sizeof(value_t<E>));
+    }
+}
+
+/*!
+ * \brief Read the data of a tensor into the memory of a matrix and verify
+ * its checksum.
+ *
+ * The matrix must already have the dimensions of the header.
+ *
+ * \param is The deserializer
+ * \param header The header that has been read
+ * \param matrix The matrix to fill
+ */
+template <typename Deserializer, typename E>
+void deserialize_tensor_data(Deserializer& is, const tensor_header& header, E& matrix) {
+    const size_t bytes = etl::size(matrix) * sizeof(value_t<E>);
+
+    auto memory = reinterpret_cast<char*>(matrix.memory_start());
+
+    bool valid = true;
+
+    if (header.codec == tensor_codec::SHUFFLE_LZ) {
+        valid = header.block_size > 0 && header.block_size <= tensor_max_block_size
+             && read_compressed_blocks(is, memory, bytes, header.value_size, header.block_size);
+    } else if (header.codec == tensor_codec::NONE) {
+        is.read(memory, bytes);
+    } else {
+        valid = false;
+    }
+
+    matrix.invalidate_gpu();
+
+    if (!valid || tensor_checksum(matrix.memory_start(), bytes) != header.checksum) {
+        is.stream.setstate(std::ios_base::failbit);
+    }
+}
+
+} //end of namespace detail
+
+} //end of namespace etl
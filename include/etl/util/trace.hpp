@@ -0,0 +1,545 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Tracing of the tasks of the thread engine (ETL_TRACE)
+ *
+ * When ETL_TRACE is defined, every task scheduled on the thread engine is
+ * recorded (thread, dispatch site, range size, begin and end) as well as
+ * the time spent by the dispatching thread waiting for the tasks. The
+ * events are written without any lock in a buffer per thread and can be
+ * dumped in the Chrome trace event format (chrome://tracing or Perfetto).
+ *
+ * When ETL_TRACE is not defined, all the functions are empty and the tasks
+ * are not wrapped.
+ */
+
+#pragma once
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "etl/util/json.hpp"
+
+namespace etl {
+
+/*!
+ * \brief A traced event
+ */
+struct trace_record {
+    std::string name;    ///< The name of the event ("task" or "wait")
+    std::string site;    ///< The dispatch site
+    size_t tid      = 0; ///< The index of the thread
+    size_t begin_ns = 0; ///< The beginning of the event, in nanoseconds
+    size_t end_ns   = 0; ///< The end of the event, in nanoseconds
+    size_t range    = 0; ///< The size of the range of the task
+};
+
+} //end of namespace etl
+
+#ifndef ETL_TRACE
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Set the dispatch site of the current scope (disabled)
+ */
+struct trace_site {
+    /*!
+     * \brief Set the dispatch site (disabled)
+     */
+    explicit trace_site(const char* site) {
+        cpp_unused(site);
+    }
+};
+
+/*!
+ * \brief Trace the wait of the current scope (disabled)
+ */
+struct trace_wait {
+    /*!
+     * \brief Nothing to trace (user-provided to avoid unused variable warnings)
+     */
+    trace_wait() {}
+};
+
+/*!
+ * \brief Return the task to schedule (not traced)
+ */
+template <typename Functor, typename... Args>
+Functor&& trace_task(Functor&& fun, const Args&... /*args*/) {
+    return std::forward<Functor>(fun);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Returns all the traced events (none)
+ */
+inline std::vector<trace_record> trace_records() {
+    return {};
+}
+
+/*!
+ * \brief Discard all the traced events
+ */
+inline void reset_trace() {
+    //No trace
+}
+
+/*!
+ * \brief Dump the traced events in the Chrome trace event format
+ * \param os The stream to write to
+ */
+inline void dump_trace(std::ostream& os) {
+    cpp_unused(os);
+}
+
+} //end of namespace etl
+
+#else
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief An event in a trace buffer
+ */
+struct trace_event {
+    const char* name; ///< The name of the event
+    const char* site; ///< The dispatch site
+    size_t begin_ns;  ///< The beginning of the event, in nanoseconds
+    size_t end_ns;    ///< The end of the event, in nanoseconds
+    size_t range;     ///< The size of the range of the task
+};
+
+constexpr size_t trace_chunk_size = 4096; ///< The number of events of a chunk of a trace buffer
+
+/*!
+ * \brief A chunk of events of a trace buffer
+ */
+struct trace_chunk {
+    std::array<trace_event, trace_chunk_size> events; ///< The events
+    std::atomic<trace_chunk*> next{nullptr};          ///< The next chunk
+};
+
+/*!
+ * \brief The trace buffer of one thread.
+ *
+ * The buffer is only written by its thread. The events are published by
+ * the release of the number of events, the readers never take a lock. A
+ * reset changes the generation of the registry, the buffer is then rewound
+ * and its chunks are released by its thread, under the lock of the
+ * registry, before its next event.
+ */
+struct trace_buffer {
+    const size_t tid;                  ///< The index of the thread
+    trace_chunk head;                  ///< The first chunk
+    trace_chunk* tail = &head;         ///< The chunk being written (owner only)
+    std::atomic<size_t> count{0};      ///< The number of published events
+    std::atomic<size_t> generation{0}; ///< The generation of the events
+    bool finished = false;             ///< Indicates if the thread is terminated (under the lock of the registry)
+
+    /*!
+     * \brief Construct the buffer of the given thread
+     */
+    trace_buffer(size_t tid, size_t generation) : tid(tid), generation(generation) {}
+
+    trace_buffer(const trace_buffer& rhs) = delete;
+    trace_buffer& operator=(const trace_buffer& rhs) = delete;
+
+    ~trace_buffer() {
+        release_chunks();
+    }
+
+    /*!
+     * \brief Release all the chunks but the first one
+     */
+    void release_chunks() {
+        auto* chunk = head.next.load();
+
+        while (chunk) {
+            auto* next = chunk->next.load();
+            delete chunk;
+            chunk = next;
+        }
+
+        head.next.store(nullptr);
+        tail = &head;
+    }
+
+    /*!
+     * \brief Discard all the events and release the chunks, the lock of
+     * the registry must be held
+     * \param current The new generation of the buffer
+     */
+    void rewind(size_t current) {
+        count.store(0, std::memory_order_relaxed);
+        release_chunks();
+        generation.store(current, std::memory_order_release);
+    }
+
+    /*!
+     * \brief Append an event, must only be called by the owner thread
+     */
+    void push(const trace_event& event) {
+        const size_t n = count.load(std::memory_order_relaxed);
+
+        if (n && n % trace_chunk_size == 0) {
+            auto* chunk = new trace_chunk;
+            tail->next.store(chunk, std::memory_order_release);
+            tail = chunk;
+        }
+
+        tail->events[n % trace_chunk_size] = event;
+
+        count.store(n + 1, std::memory_order_release);
+    }
+
+    /*!
+     * \brief Call the given functor on each published event of the given generation
+     */
+    template <typename Functor>
+    void for_each(size_t current, Functor&& functor) const {
+        if (generation.load(std::memory_order_acquire) != current) {
+            return;
+        }
+
+        const size_t n = count.load(std::memory_order_acquire);
+
+        const trace_chunk* chunk = &head;
+
+        for (size_t i = 0; i < n; ++i) {
+            if (i && i % trace_chunk_size == 0) {
+                chunk = chunk->next.load(std::memory_order_acquire);
+            }
+
+            functor(chunk->events[i % trace_chunk_size]);
+        }
+    }
+};
+
+/*!
+ * \brief The registry of the trace buffers of all the threads.
+ *
+ * The buffers are kept after the end of their threads so that the
+ * events can still be dumped.
+ */
+struct trace_registry {
+    std::mutex lock;                                    ///< The lock protecting the registration
+    std::vector<std::unique_ptr<trace_buffer>> buffers; ///< The buffers of the threads
+    std::atomic<size_t> generation{0};                  ///< The generation, incremented by each reset
+    const timer_clock::time_point epoch = timer_clock::now(); ///< The origin of the timestamps
+};
+
+/*!
+ * \brief Returns the global trace registry
+ */
+inline trace_registry& get_trace_registry() {
+    static trace_registry registry;
+    return registry;
+}
+
+/*!
+ * \brief The trace buffer of a thread, registered on construction and
+ * marked as finished at the end of the thread
+ */
+struct trace_thread_buffer {
+    trace_buffer* buffer; ///< The buffer of the thread
+
+    trace_thread_buffer() {
+        auto& registry = get_trace_registry();
+
+        std::lock_guard<std::mutex> l(registry.lock);
+        registry.buffers.emplace_back(std::make_unique<trace_buffer>(registry.buffers.size(), registry.generation.load()));
+        buffer = registry.buffers.back().get();
+    }
+
+    ~trace_thread_buffer() {
+        auto& registry = get_trace_registry();
+
+        std::lock_guard<std::mutex> l(registry.lock);
+        buffer->finished = true;
+    }
+};
+
+/*!
+ * \brief Returns the trace buffer of the current thread, registered on
+ * first use and rewound after a reset
+ */
+inline trace_buffer& local_trace_buffer() {
+    static thread_local trace_thread_buffer local_buffer;
+
+    auto& registry = get_trace_registry();
+    auto& buffer   = *local_buffer.buffer;
+
+    const size_t current = registry.generation.load(std::memory_order_acquire);
+
+    if (cpp_unlikely(buffer.generation.load(std::memory_order_relaxed) != current)) {
+        std::lock_guard<std::mutex> l(registry.lock);
+        buffer.rewind(registry.generation.load(std::memory_order_relaxed));
+    }
+
+    return buffer;
+}
+
+/*!
+ * \brief Returns the current time, in nanoseconds since the start of the trace
+ */
+inline size_t trace_now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timer_clock::now() - get_trace_registry().epoch).count();
+}
+
+/*!
+ * \brief Returns a reference to the dispatch site of the current thread
+ */
+inline const char*& trace_current_site() {
+    static thread_local const char* site = "parallel";
+    return site;
+}
+
+/*!
+ * \brief Set the dispatch site of the current scope
+ */
+struct trace_site {
+    /*!
+     * \brief Set the dispatch site until the end of the scope
+     * \param site The name of the dispatch site
+     */
+    explicit trace_site(const char* site) : parent(trace_current_site()) {
+        trace_current_site() = site;
+    }
+
+    trace_site(const trace_site& rhs) = delete;
+    trace_site& operator=(const trace_site& rhs) = delete;
+
+    /*!
+     * \brief Restore the previous dispatch site
+     */
+    ~trace_site() {
+        trace_current_site() = parent;
+    }
+
+private:
+    const char* parent; ///< The enclosing dispatch site
+};
+
+/*!
+ * \brief Trace the wait of the current scope
+ */
+struct trace_wait {
+    const size_t begin_ns = trace_now(); ///< The beginning of the wait
+
+    /*!
+     * \brief Record the wait
+     */
+    ~trace_wait() {
+        local_trace_buffer().push({"wait", trace_current_site(), begin_ns, trace_now(), 0});
+    }
+};
+
+/*!
+ * \brief Returns the size of a range given as [first, last)
+ */
+inline size_t trace_range(size_t first, size_t last) {
+    return last - first;
+}
+
+/*!
+ * \brief Returns the size of a range given as an index and [first, last)
+ */
+inline size_t trace_range(size_t t, size_t first, size_t last) {
+    cpp_unused(t);
+    return last - first;
+}
+
+/*!
+ * \brief Returns the size of a 2D range given as [first1, last1) and [first2, last2)
+ */
+inline size_t trace_range(size_t first1, size_t last1, size_t first2, size_t last2) {
+    return (last1 - first1) * (last2 - first2);
+}
+
+/*!
+ * \brief Returns the size of a range given as an index and a sub expression
+ */
+template <typename E>
+size_t trace_range(size_t t, const E& sub) {
+    cpp_unused(t);
+    return size(sub);
+}
+
+/*!
+ * \brief Returns the size of the range of the task, for tasks with an
+ * integral _size member (the evaluator functors)
+ */
+template <typename Functor, cpp_enable_if(std::is_integral<std::decay_t<decltype(std::declval<Functor>()._size)>>::value)>
+size_t trace_task_range(const Functor& fun) {
+    return fun._size;
+}
+
+/*!
+ * \brief Returns the size of the range of the task
+ */
+template <typename Functor, typename... Args>
+size_t trace_task_range(const Functor& fun, const Args&... args) {
+    cpp_unused(fun);
+    return trace_range(args...);
+}
+
+/*!
+ * \brief A task wrapped to record its execution
+ */
+template <typename Functor>
+struct traced_task {
+    Functor fun;      ///< The task
+    const char* site; ///< The dispatch site
+    size_t range;     ///< The size of the range of the task
+
+    /*!
+     * \brief Execute the task and record it
+     */
+    template <typename... Args>
+    void operator()(Args&&... args) {
+        const size_t begin_ns = trace_now();
+
+        fun(std::forward<Args>(args)...);
+
+        local_trace_buffer().push({"task", site, begin_ns, trace_now(), range});
+    }
+};
+
+/*!
+ * \brief Wrap a task to be scheduled so that its execution is recorded
+ * \param fun The task
+ * \param args The arguments that will be passed to the task
+ */
+template <typename Functor, typename... Args>
+traced_task<std::decay_t<Functor>> trace_task(Functor&& fun, const Args&... args) {
+    const size_t range = trace_task_range(fun, args...);
+    return {std::forward<Functor>(fun), trace_current_site(), range};
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Returns all the traced events, by thread and then by order of completion
+ */
+inline std::vector<trace_record> trace_records() {
+    auto& registry = detail::get_trace_registry();
+
+    std::vector<trace_record> records;
+
+    std::lock_guard<std::mutex> l(registry.lock);
+
+    const size_t current = registry.generation.load(std::memory_order_relaxed);
+
+    for (auto& buffer : registry.buffers) {
+        buffer->for_each(current, [&](const detail::trace_event& event) {
+            records.emplace_back();
+
+            auto& record    = records.back();
+            record.name     = event.name;
+            record.site     = event.site;
+            record.tid      = buffer->tid;
+            record.begin_ns = event.begin_ns;
+            record.end_ns   = event.end_ns;
+            record.range    = event.range;
+        });
+    }
+
+    return records;
+}
+
+/*!
+ * \brief Discard all the traced events.
+ *
+ * The chunks of the terminated threads are released immediately, the
+ * running threads release theirs before their next event. The events that
+ * are being recorded concurrently may or may not be discarded.
+ */
+inline void reset_trace() {
+    auto& registry = detail::get_trace_registry();
+
+    std::lock_guard<std::mutex> l(registry.lock);
+
+    const size_t current = registry.generation.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+    for (auto& buffer : registry.buffers) {
+        if (buffer->finished) {
+            buffer->rewind(current);
+        }
+    }
+}
+
+/*!
+ * \brief Dump the traced events in the Chrome trace event format
+ *
+ * Each event is a complete event ("X") with its dispatch site and range
+ * size as arguments. The timestamps are in microseconds.
+ *
+ * \param os The stream to write to
+ */
+inline void dump_trace(std::ostream& os) {
+    auto records = trace_records();
+
+    size_t threads = 0;
+
+    for (auto& record : records) {
+        threads = std::max(threads, record.tid + 1);
+    }
+
+    auto old_flags     = os.flags();
+    auto old_precision = os.precision();
+
+    os.setf(std::ios::fixed, std::ios::floatfield);
+    os.precision(3);
+
+    os << "{\"traceEvents\": [";
+
+    bool first = true;
+
+    for (size_t t = 0; t < threads; ++t) {
+        os << (first ? "\n " : ",\n ") << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << t
+           << ", \"args\": {\"name\": \"thread " << t << "\"}}";
+        first = false;
+    }
+
+    for (auto& record : records) {
+        os << (first ? "\n " : ",\n ") << "{\"name\": ";
+        write_json_string(os, record.name == "task" ? record.site : record.name);
+        os << ", \"cat\": ";
+        write_json_string(os, record.name);
+        os << ", \"ph\": \"X\", \"pid\": 0, \"tid\": " << record.tid
+           << ", \"ts\": " << record.begin_ns / 1000.0
+           << ", \"dur\": " << (record.end_ns - record.begin_ns) / 1000.0
+           << ", \"args\": {\"site\": ";
+        write_json_string(os, record.site);
+        os << ", \"range\": " << record.range << "}}";
+        first = false;
+    }
+
+    os << "\n], \"displayTimeUnit\": \"ns\"}\n";
+
+    os.flags(old_flags);
+    os.precision(old_precision);
+}
+
+} //end of namespace etl
+
+#endif
@@ -16,6 +16,10 @@
 
 #include <immintrin.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
 #include "etl/inline.hpp"
 
 namespace etl {
@@ -205,4 +209,280 @@ using default_intrinsic_traits = no_intrinsic_traits<T>;
 template <typename T>
 using default_intrinsic_type = typename default_intrinsic_traits<T>::intrinsic_type;
 
+namespace detail {
+
+/*!
+ * \brief Indicates if the vectorized implementations of the kernels can be
+ * used for the given value type
+ */
+template <typename T>
+constexpr bool vec_impl_enabled() {
+    return vec_enabled && vectorize_impl && default_intrinsic_traits<T>::vectorizable;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Load a vector of values that are not contiguous in memory.
+ *
+ * The values are first gathered in an aligned buffer from which the vector
+ * is then loaded. This is much slower than a real load, but allows
+ * expressions containing such values to still be vectorized.
+ *
+ * \param value A functor returning the value of the given lane of the vector
+ * \tparam V The vector implementation
+ * \tparam T The value type
+ * \return a vector containing the gathered values
+ */
+template <typename V, typename T, typename F>
+ETL_STRONG_INLINE(typename V::template vec_type<T>) gather_load(F&& value) {
+    constexpr size_t lanes = V::template traits<T>::size;
+
+    alignas(V::template traits<T>::alignment) T tmp[lanes];
+
+    for (size_t l = 0; l < lanes; ++l) {
+        tmp[l] = value(l);
+    }
+
+    return V::load(tmp);
+}
+
+namespace detail {
+
+/*!
+ * \brief Load the elements memory[offset(l)] with the hardware gather of
+ * the vector implementation
+ */
+template <typename V, typename T, typename F>
+inline auto gather_lanes(const T* memory, F&& offset, int) -> decltype(V::gather(memory, static_cast<const int32_t*>(nullptr))) {
+    constexpr size_t lanes = V::template traits<T>::size;
+
+    alignas(64) int32_t offsets[lanes];
+
+    // The offsets of the hardware gather are 32-bit
+    size_t high = 0;
+
+    for (size_t l = 0; l < lanes; ++l) {
+        const size_t o = offset(l);
+
+        high |= o >> 31;
+        offsets[l] = int32_t(o);
+    }
+
+    if (high) {
+        return gather_load<V, T>([memory, &offset](size_t l) { return memory[offset(l)]; });
+    }
+
+    return V::gather(memory, offsets);
+}
+
+/*!
+ * \brief Load the elements memory[offset(l)] one by one, the vector
+ * implementation has no hardware gather for this type
+ */
+template <typename V, typename T, typename F>
+inline typename V::template vec_type<T> gather_lanes(const T* memory, F&& offset, long) {
+    return gather_load<V, T>([memory, &offset](size_t l) { return memory[offset(l)]; });
+}
+
+/*!
+ * \brief Load the elements memory[l * stride] with the hardware gather of
+ * the vector implementation
+ */
+template <typename V, typename T>
+inline auto strided_lanes(const T* memory, size_t stride, int) -> decltype(V::strided_gather(memory, int32_t(stride))) {
+    constexpr size_t lanes = V::template traits<T>::size;
+
+    // The offsets of the hardware gather are 32-bit
+    if (stride * (lanes - 1) > size_t(std::numeric_limits<int32_t>::max())) {
+        return gather_load<V, T>([memory, stride](size_t l) { return memory[l * stride]; });
+    }
+
+    return V::strided_gather(memory, int32_t(stride));
+}
+
+/*!
+ * \brief Load the elements memory[l * stride] one by one, the vector
+ * implementation has no hardware gather for this type
+ */
+template <typename V, typename T>
+inline typename V::template vec_type<T> strided_lanes(const T* memory, size_t stride, long) {
+    return gather_load<V, T>([memory, stride](size_t l) { return memory[l * stride]; });
+}
+
+/*!
+ * \brief Reverse the lanes of a vector with the shuffle of the vector
+ * implementation
+ */
+template <typename V, typename T, typename Vec>
+inline auto reverse_lanes(Vec x, int) -> decltype(V::reverse(x)) {
+    return V::reverse(x);
+}
+
+/*!
+ * \brief Reverse the lanes of a vector through memory, the vector
+ * implementation has no shuffle for this type
+ */
+template <typename V, typename T, typename Vec>
+inline Vec reverse_lanes(Vec x, long) {
+    constexpr size_t lanes = V::template traits<T>::size;
+
+    alignas(V::template traits<T>::alignment) T tmp[lanes];
+
+    V::store(tmp, x);
+    std::reverse(tmp, tmp + lanes);
+
+    return V::load(tmp);
+}
+
+/*!
+ * \brief Keep the even lanes of two vectors with the shuffle of the vector
+ * implementation
+ */
+template <typename V, typename T, typename Vec>
+inline auto deinterleave_lanes(Vec lo, Vec hi, int) -> decltype(V::deinterleave(lo, hi)) {
+    return V::deinterleave(lo, hi);
+}
+
+/*!
+ * \brief Keep the even lanes of two vectors through memory, the vector
+ * implementation has no shuffle for this type
+ */
+template <typename V, typename T, typename Vec>
+inline Vec deinterleave_lanes(Vec lo, Vec hi, long) {
+    constexpr size_t lanes = V::template traits<T>::size;
+
+    alignas(V::template traits<T>::alignment) T tmp[2 * lanes];
+
+    V::store(tmp, lo);
+    V::store(tmp + lanes, hi);
+
+    for (size_t l = 0; l < lanes; ++l) {
+        tmp[l] = tmp[2 * l];
+    }
+
+    return V::load(tmp);
+}
+
+/*!
+ * \brief Store the interleaving of two vectors with the shuffles of the
+ * vector implementation
+ */
+template <typename V, typename T, typename Vec>
+inline auto interleave_lanes(T* out, Vec a, Vec b, int) -> decltype(V::interleave_lo(a, b), void()) {
+    constexpr size_t lanes = V::template traits<T>::size;
+
+    V::storeu(out, V::interleave_lo(a, b));
+    V::storeu(out + lanes, V::interleave_hi(a, b));
+}
+
+/*!
+ * \brief Store the interleaving of two vectors through memory, the vector
+ * implementation has no shuffle for this type
+ */
+template <typename V, typename T, typename Vec>
+inline void interleave_lanes(T* out, Vec a, Vec b, long) {
+    constexpr size_t lanes = V::template traits<T>::size;
+
+    alignas(V::template traits<T>::alignment) T tmp[2 * lanes];
+
+    V::store(tmp, a);
+    V::store(tmp + lanes, b);
+
+    for (size_t l = 0; l < lanes; ++l) {
+        out[2 * l + 0] = tmp[l];
+        out[2 * l + 1] = tmp[lanes + l];
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Load a vector of the values memory[offset(l)].
+ *
+ * The values are loaded with a hardware gather if the vector implementation
+ * has one for this type (AVX2), otherwise one by one.
+ *
+ * \param memory The base memory
+ * \param offset A functor returning the offset from memory of the given lane
+ * \tparam V The vector implementation
+ * \return a vector containing the gathered values
+ */
+template <typename V, typename T, typename F>
+ETL_STRONG_INLINE(typename V::template vec_type<T>) gather_load(const T* memory, F&& offset) {
+    return detail::gather_lanes<V>(memory, offset, 0);
+}
+
+/*!
+ * \brief Load a vector of the values memory[l * stride].
+ *
+ * The values are loaded with a hardware gather if the vector implementation
+ * has one for this type (AVX2), otherwise one by one.
+ *
+ * \param memory The memory of the first value
+ * \param stride The distance between two values
+ * \tparam V The vector implementation
+ * \return a vector containing the gathered values
+ */
+template <typename V, typename T>
+ETL_STRONG_INLINE(typename V::template vec_type<T>) strided_load(const T* memory, size_t stride) {
+    return detail::strided_lanes<V>(memory, stride, 0);
+}
+
+/*!
+ * \brief Load a vector of the values sub[last - l], contiguous in reverse
+ * order in the given expression.
+ *
+ * The values are loaded at once and their order is reversed with a shuffle
+ * if the vector implementation has one for this type.
+ *
+ * \param sub The expression
+ * \param last The index of the value of the first lane
+ * \tparam V The vector implementation
+ * \tparam T The value type
+ * \return a vector containing the values in reverse order
+ */
+template <typename V, typename T, typename E>
+ETL_STRONG_INLINE(typename V::template vec_type<T>) reverse_loadu(const E& sub, size_t last) {
+    return detail::reverse_lanes<V, T>(sub.template loadu<V>(last + 1 - V::template traits<T>::size), 0);
+}
+
+/*!
+ * \brief Load a vector of the values sub[first + 2 * l], every other value
+ * of the given expression.
+ *
+ * Two contiguous vectors are loaded and their even lanes are kept with a
+ * shuffle if the vector implementation has one for this type. The values
+ * up to sub[first + 2 * lanes - 1] must be valid.
+ *
+ * \param sub The expression
+ * \param first The index of the value of the first lane
+ * \tparam V The vector implementation
+ * \tparam T The value type
+ * \return a vector containing every other value
+ */
+template <typename V, typename T, typename E>
+ETL_STRONG_INLINE(typename V::template vec_type<T>) deinterleave_loadu(const E& sub, size_t first) {
+    constexpr size_t lanes = V::template traits<T>::size;
+
+    return detail::deinterleave_lanes<V, T>(sub.template loadu<V>(first), sub.template loadu<V>(first + lanes), 0);
+}
+
+/*!
+ * \brief Store the values a[0], b[0], a[1], b[1], ... into the 2 * lanes
+ * values starting at out.
+ *
+ * The two vectors are interleaved with shuffles if the vector
+ * implementation has them for this type.
+ *
+ * \param out The output memory
+ * \param a The values of the even positions
+ * \param b The values of the odd positions
+ * \tparam V The vector implementation
+ */
+template <typename V, typename T, typename Vec>
+ETL_STRONG_INLINE(void) interleave_storeu(T* out, Vec a, Vec b) {
+    detail::interleave_lanes<V>(out, a, b, 0);
+}
+
 } //end of namespace etl
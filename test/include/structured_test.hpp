@@ -0,0 +1,111 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+// Helpers for the tests of the structured matrices: adapters, packed
+// matrices, structured products and batched inverses
+
+/*!
+ * \brief Fill the given matrix with small integers so that the structured
+ * and dense results can be compared exactly.
+ */
+template <typename M>
+void fill_small(M& m, size_t seed = 5) {
+    for (size_t i = 0; i < etl::size(m); ++i) {
+        m[i] = int((i * seed + 3) % 11) - 5;
+    }
+}
+
+/*!
+ * \brief Fill the given dense matrix with small integers inside the given
+ * band and zeros outside, so that the structured and the dense products
+ * can be compared exactly.
+ */
+template <typename M, typename Band>
+void fill_band(M& m, Band band, bool unit) {
+    const size_t n = etl::dim<0>(m);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            m(i, j) = band(i, j) ? int((i * 7 + j * 3) % 11) - 5 : 0;
+        }
+
+        if (unit) {
+            m(i, i) = 1;
+        }
+    }
+}
+
+/*!
+ * \brief Fill the given batch with well-conditioned matrices. The rows of
+ * the odd matrices are rotated so that the largest element of each column
+ * is not on the diagonal, which needs pivoting.
+ */
+template <typename T>
+void fill_batch(etl::dyn_matrix<T, 3>& a) {
+    const size_t B = etl::dim<0>(a);
+    const size_t n = etl::dim<1>(a);
+
+    for (size_t b = 0; b < B; ++b) {
+        for (size_t i = 0; i < n; ++i) {
+            const size_t r = b % 2 ? (i + 1) % n : i;
+
+            for (size_t j = 0; j < n; ++j) {
+                a(b, i, j) = int((b * 7 + r * 5 + j * 3) % 11) - 5 + (r == j ? int(6 * n) : 0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Unary operation returning its input and counting its
+ * applications, to check how many times an expression is evaluated
+ */
+template <typename T>
+struct counting_unary_op {
+    static constexpr bool linear      = true;  ///< Indicates if the operator is linear
+    static constexpr bool thread_safe = false; ///< Indicates if the operator is thread safe or not
+
+    /*!
+     * \brief The operator is never vectorized, so that each evaluation
+     * of an element is counted
+     */
+    template <etl::vector_mode_t V>
+    using vectorizable = std::false_type;
+
+    /*!
+     * \brief Returns a reference to the number of applications
+     */
+    static size_t& count() {
+        static size_t c = 0;
+        return c;
+    }
+
+    /*!
+     * \brief Apply the unary operator on x
+     */
+    static T apply(const T& x) noexcept {
+        ++count();
+        return x;
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operator
+     */
+    static std::string desc() noexcept {
+        return "counting";
+    }
+};
+
+/*!
+ * \brief Wrap the given expression into an expression counting the
+ * evaluations of its elements
+ */
+template <typename E>
+etl::detail::unary_helper<E, counting_unary_op> counting(E&& e) {
+    counting_unary_op<etl::value_t<E>>::count() = 0;
+    return etl::detail::unary_helper<E, counting_unary_op>{e};
+}
@@ -161,6 +161,52 @@ TEMPLATE_TEST_CASE_4("alignment/temporary/3", "[alignment]", ZZZ, double, float,
     REQUIRE_DIRECT(reinterpret_cast<size_t>(c.memory_start()) % etl::default_intrinsic_traits<ZZZ>::alignment == 0);
 }
 
+TEMPLATE_TEST_CASE_2("alignment/sub/1", "[alignment][sub]", Z, double, float) {
+    etl::fast_matrix<Z, 3, 16> a;
+    etl::fast_matrix<Z, 3, 3> b;
+
+    REQUIRE_DIRECT(etl::decay_traits<decltype(a(1))>::is_aligned);
+    REQUIRE_DIRECT(etl::decay_traits<decltype(etl::slice(a, 1, 2))>::is_aligned);
+    REQUIRE_DIRECT(!etl::decay_traits<decltype(b(1))>::is_aligned);
+    REQUIRE_DIRECT(!etl::decay_traits<decltype(etl::slice(b, 1, 2))>::is_aligned);
+
+    for (size_t i = 0; i < 3; ++i) {
+        REQUIRE_DIRECT(reinterpret_cast<size_t>(a(i).memory_start()) % etl::default_intrinsic_traits<Z>::alignment == 0);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("alignment/sub/2", "[alignment][sub]", Z, double, float) {
+    // Rows that are all aligned (16) and rows that are not (13)
+    for (size_t n : {16UL, 13UL}) {
+        etl::dyn_matrix<Z> a(5, n);
+        etl::dyn_matrix<Z> b(5, n);
+        etl::dyn_vector<Z> c(n);
+
+        b = etl::sequence_generator(1.0);
+
+        for (size_t i = 0; i < 5; ++i) {
+            a(i) = b(i) + Z(2) * b(i);
+        }
+
+        for (size_t i = 0; i < 5; ++i) {
+            c = etl::sub(a + b, i);
+
+            for (size_t j = 0; j < n; ++j) {
+                REQUIRE_EQUALS(a(i, j), Z(3) * b(i, j));
+                REQUIRE_EQUALS(c[j], Z(4) * b(i, j));
+            }
+        }
+
+        etl::slice(a, 1, 3) = etl::slice(b, 2, 4) + etl::slice(b + b, 0, 2);
+
+        for (size_t i = 1; i < 3; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                REQUIRE_EQUALS(a(i, j), b(i + 1, j) + Z(2) * b(i - 1, j));
+            }
+        }
+    }
+}
+
 //TODO Add the following test!
 //TEST_CASE("alignment/temporary/4", "[alignment]") {
     //etl::dyn_matrix<int> a(3, 3);
@@ -0,0 +1,166 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+#include "structured_test.hpp"
+
+namespace {
+
+/*!
+ * \brief Compare batch_inv and batch_det to the inverse and the determinant
+ * of each matrix of the batch
+ */
+template <typename T>
+void check_batch_inv(size_t B, size_t n) {
+    etl::dyn_matrix<T, 3> a(B, n, n);
+    fill_batch(a);
+
+    auto c = etl::batch_inv(a);
+    auto d = etl::batch_det(a);
+
+    REQUIRE_EQUALS(etl::dim<0>(c), B);
+    REQUIRE_EQUALS(etl::dim<1>(c), n);
+    REQUIRE_EQUALS(etl::dim<2>(c), n);
+    REQUIRE_EQUALS(etl::size(d), B);
+
+    etl::dyn_matrix<T> m(n, n);
+    etl::dyn_matrix<T> m0(n, n);
+    etl::dyn_matrix<T> ref(n, n);
+
+    for (size_t b = 0; b < B; ++b) {
+        m   = a(b);
+        ref = etl::inv(m);
+
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                T identity(0);
+
+                for (size_t k = 0; k < n; ++k) {
+                    identity += a(b, i, k) * c(b, k, j);
+                }
+
+                REQUIRE_DIRECT(std::abs(identity - (i == j ? T(1) : T(0))) < T(1e-4));
+                REQUIRE_DIRECT(std::abs(c(b, i, j) - ref(i, j)) < T(1e-4));
+            }
+        }
+
+        // The reference determinant is computed on the diagonally dominant
+        // matrix, before the rotation of its rows, of sign (-1)^(n-1)
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                m0(b % 2 ? (i + 1) % n : i, j) = m(i, j);
+            }
+        }
+
+        const T sign = b % 2 && n % 2 == 0 ? T(-1) : T(1);
+
+        REQUIRE_EQUALS_APPROX_E(d(b), sign * etl::determinant(m0), 1e-4);
+    }
+}
+
+} // end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("batch_inv/closed", "[inv][batch_inv]", Z, float, double) {
+    for (size_t n = 1; n <= 4; ++n) {
+        check_batch_inv<Z>(37, n);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_inv/unrolled", "[inv][batch_inv]", Z, float, double) {
+    for (size_t n = 5; n <= 8; ++n) {
+        check_batch_inv<Z>(13, n);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_inv/generic", "[inv][batch_inv]", Z, float, double) {
+    check_batch_inv<Z>(5, 11);
+}
+
+TEMPLATE_TEST_CASE_2("batch_inv/values", "[inv][batch_inv]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(2, 3, 3);
+    a(0) = etl::fast_matrix<Z, 3, 3>{2.0, 0.0, 0.0, 0.0, 4.0, 0.0, 0.0, 0.0, 8.0};
+    a(1) = etl::fast_matrix<Z, 3, 3>{0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0};
+
+    etl::dyn_matrix<Z, 3> c(2, 3, 3);
+    etl::dyn_vector<Z> d(2);
+
+    etl::batch_inv(a, c);
+    etl::batch_det(a, d);
+
+    REQUIRE_EQUALS(c(0, 0, 0), Z(0.5));
+    REQUIRE_EQUALS(c(0, 1, 1), Z(0.25));
+    REQUIRE_EQUALS(c(0, 2, 2), Z(0.125));
+    REQUIRE_EQUALS(c(0, 0, 1), Z(0.0));
+
+    REQUIRE_EQUALS(c(1, 0, 2), Z(1.0));
+    REQUIRE_EQUALS(c(1, 1, 0), Z(1.0));
+    REQUIRE_EQUALS(c(1, 2, 1), Z(1.0));
+    REQUIRE_EQUALS(c(1, 0, 0), Z(0.0));
+
+    REQUIRE_EQUALS(d(0), Z(64.0));
+    REQUIRE_EQUALS(d(1), Z(1.0));
+}
+
+TEMPLATE_TEST_CASE_2("batch_inv/singular", "[inv][batch_inv]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(2, 6, 6);
+    a = 1.0;
+
+    auto d = etl::batch_det(a);
+
+    REQUIRE_EQUALS(d(0), Z(0.0));
+    REQUIRE_EQUALS(d(1), Z(0.0));
+}
+
+TEMPLATE_TEST_CASE_2("batch_inv/singular/block", "[inv][batch_inv]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(19, 6, 6);
+    fill_batch(a);
+
+    for (size_t b = 0; b < 19; b += 3) {
+        a(b) = 1.0;
+    }
+
+    auto d = etl::batch_det(a);
+
+    etl::dyn_matrix<Z, 3> one(1, 6, 6);
+
+    for (size_t b = 0; b < 19; ++b) {
+        one(0) = a(b);
+
+        if (b % 3 == 0) {
+            REQUIRE_EQUALS(d(b), Z(0.0));
+        } else {
+            REQUIRE_EQUALS_APPROX_E(d(b), etl::batch_det(one)(0), 1e-4);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_inv/parallel", "[inv][batch_inv]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(2048, 4, 4);
+    fill_batch(a);
+
+    etl::dyn_matrix<Z, 3> ref(2048, 4, 4);
+    etl::dyn_vector<Z> ref_d(2048);
+
+    etl::batch_inv(a, ref);
+    etl::batch_det(a, ref_d);
+
+    etl::dyn_matrix<Z, 3> c(2048, 4, 4);
+    etl::dyn_vector<Z> d(2048);
+
+    PARALLEL_SECTION {
+        etl::batch_inv(a, c);
+        etl::batch_det(a, d);
+    }
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS(c[i], ref[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(d); ++i) {
+        REQUIRE_EQUALS(d[i], ref_d[i]);
+    }
+}
@@ -254,3 +254,36 @@ TEMPLATE_TEST_CASE_2("convmtx2/convmtx2_4", "convmtx conv", Z, double, float) {
         REQUIRE_EQUALS_APPROX_E(ref[i], b2[i], base_eps);
     }
 }
+
+TEMPLATE_TEST_CASE_2("convmtx2/convmtx2_5", "convmtx conv", Z, double, float) {
+    etl::dyn_matrix<Z> I(9, 6);
+    etl::dyn_matrix<Z> K(3, 4);
+
+    I = etl::sequence_generator<Z>(1.0) * 0.1;
+    K = etl::sequence_generator<Z>(2.0) * 0.2;
+
+    etl::dyn_matrix<Z> C(11 * 9, 12);
+    etl::dyn_matrix<Z> C_t(12, 11 * 9);
+
+    C = etl::convmtx2(I, 3, 4);
+    etl::convmtx2_direct_t(C_t, I, 3, 4);
+
+    etl::dyn_matrix<Z> a(11 * 9, 1);
+    a = etl::mul(C, etl::reshape(etl::transpose(K), 12, 1));
+
+    etl::dyn_matrix<Z> b(11, 9);
+    b = etl::transpose(etl::reshape(a, 9, 11));
+
+    etl::dyn_matrix<Z> ref(11, 9);
+    ref = etl::conv_2d_full(I, K);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(ref[i], b[i], base_eps * 10);
+    }
+
+    for (size_t i = 0; i < etl::dim<0>(C); ++i) {
+        for (size_t j = 0; j < etl::dim<1>(C); ++j) {
+            REQUIRE_EQUALS(C_t(j, i), C(i, j));
+        }
+    }
+}
@@ -0,0 +1,159 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test_light.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+namespace {
+
+void write_text_file(const std::string& path, const std::string& content) {
+    std::ofstream os(path, std::ios::binary);
+    os << content;
+}
+
+} //end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("csv/1", "[csv]", Z, float, double) {
+    write_text_file("csv1.tmp.csv", "a,b,c\r\n1.0,2.5,-3\r\n\r\n 4e2 , -0.125,6.\n1E-3,+8,9.75\n");
+
+    etl::csv_options options;
+    options.skip_rows = 1;
+
+    etl::dyn_matrix<Z> a;
+
+    REQUIRE_DIRECT(etl::load_csv("csv1.tmp.csv", a, options));
+
+    REQUIRE_EQUALS(etl::dim<0>(a), 3UL);
+    REQUIRE_EQUALS(etl::dim<1>(a), 3UL);
+
+    REQUIRE_EQUALS(a(0, 0), Z(1.0));
+    REQUIRE_EQUALS(a(0, 1), Z(2.5));
+    REQUIRE_EQUALS(a(0, 2), Z(-3.0));
+    REQUIRE_EQUALS(a(1, 0), Z(400.0));
+    REQUIRE_EQUALS(a(1, 1), Z(-0.125));
+    REQUIRE_EQUALS(a(1, 2), Z(6.0));
+    REQUIRE_EQUALS(a(2, 0), Z(1e-3));
+    REQUIRE_EQUALS(a(2, 1), Z(8.0));
+    REQUIRE_EQUALS(a(2, 2), Z(9.75));
+}
+
+TEMPLATE_TEST_CASE_2("csv/2", "[csv]", Z, float, double) {
+    write_text_file("csv2.tmp.csv", "1;2;3;4\n5;;7;8\n9;10\n");
+
+    etl::csv_options options;
+    options.delimiter = ';';
+    options.columns   = {3, 1};
+
+    etl::dyn_matrix<Z> a;
+
+    REQUIRE_DIRECT(etl::load_csv("csv2.tmp.csv", a, options));
+
+    REQUIRE_EQUALS(etl::dim<0>(a), 3UL);
+    REQUIRE_EQUALS(etl::dim<1>(a), 2UL);
+
+    REQUIRE_EQUALS(a(0, 0), Z(4.0));
+    REQUIRE_EQUALS(a(0, 1), Z(2.0));
+    REQUIRE_EQUALS(a(1, 0), Z(8.0));
+    REQUIRE_DIRECT(std::isnan(a(1, 1)));
+    REQUIRE_DIRECT(std::isnan(a(2, 0)));
+    REQUIRE_EQUALS(a(2, 1), Z(10.0));
+}
+
+TEMPLATE_TEST_CASE_2("csv/3", "[csv]", Z, float, double) {
+    const size_t rows    = 20011;
+    const size_t columns = 7;
+
+    std::vector<std::string> tokens(rows * columns);
+
+    {
+        std::ofstream os("csv3.tmp.csv", std::ios::binary);
+
+        char buffer[64];
+
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < columns; ++j) {
+                const double v = (double((i * 7919 + j * 104729) % 1000003) - 500000.0) * std::pow(10.0, double(int(j) - 3)) / 3.0;
+
+                std::snprintf(buffer, sizeof(buffer), j % 2 ? "%.17g" : "%.6f", v);
+
+                tokens[i * columns + j] = buffer;
+
+                os << buffer << (j == columns - 1 ? "\n" : ",");
+            }
+        }
+    }
+
+    etl::dyn_matrix<Z> a(5, 5);
+
+    REQUIRE_DIRECT(etl::load_csv("csv3.tmp.csv", a));
+
+    REQUIRE_EQUALS(etl::dim<0>(a), rows);
+    REQUIRE_EQUALS(etl::dim<1>(a), columns);
+
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < columns; ++j) {
+            REQUIRE_EQUALS(a(i, j), Z(std::strtod(tokens[i * columns + j].c_str(), nullptr)));
+        }
+    }
+}
+
+TEST_CASE("csv/4", "[csv]") {
+    write_text_file("csv4.tmp.csv", "1,2,3\n4,5,6\n");
+
+    etl::fast_matrix<float, 2, 3> a;
+    etl::fast_matrix<float, 3, 2> b;
+    etl::dyn_matrix_cm<double> c;
+
+    REQUIRE_DIRECT(etl::load_csv("csv4.tmp.csv", a));
+    REQUIRE_EQUALS(a(1, 2), 6.0f);
+
+    REQUIRE_DIRECT(!etl::load_csv("csv4.tmp.csv", b));
+
+    REQUIRE_DIRECT(etl::load_csv("csv4.tmp.csv", c));
+    REQUIRE_EQUALS(c(0, 1), 2.0);
+    REQUIRE_EQUALS(c(1, 0), 4.0);
+    REQUIRE_EQUALS(c(1, 2), 6.0);
+
+    write_text_file("csv4b.tmp.csv", "1,2,3\n4,x,6\n");
+
+    REQUIRE_DIRECT(!etl::load_csv("csv4b.tmp.csv", a));
+    REQUIRE_DIRECT(!etl::load_csv("csv4_missing.tmp.csv", a));
+
+    etl::csv_options options;
+    options.columns = {3};
+
+    REQUIRE_DIRECT(!etl::load_csv("csv4.tmp.csv", c, options));
+}
+
+TEST_CASE("csv/5", "[csv]") {
+    write_text_file("csv5.tmp.csv", "1,2,3\n4,5,6,7\n");
+
+    etl::dyn_matrix<float> a;
+
+    // A row with more fields than the first row
+    REQUIRE_DIRECT(!etl::load_csv("csv5.tmp.csv", a));
+
+    etl::csv_options options;
+    options.columns = {0};
+
+    REQUIRE_DIRECT(!etl::load_csv("csv5.tmp.csv", a, options));
+
+    // A column selected twice
+    write_text_file("csv5b.tmp.csv", "1,2,3\n4,5,6\n");
+
+    options.columns = {2, 0, 2};
+
+    REQUIRE_DIRECT(!etl::load_csv("csv5b.tmp.csv", a, options));
+
+    options.columns = {2, 0};
+
+    REQUIRE_DIRECT(etl::load_csv("csv5b.tmp.csv", a, options));
+    REQUIRE_EQUALS(a(1, 0), 6.0f);
+    REQUIRE_EQUALS(a(1, 1), 4.0f);
+}
@@ -55,3 +55,16 @@ TEMPLATE_TEST_CASE_2("globals/qr/1", "[globals][QR]", Z, float, double) {
 
     REQUIRE_DIRECT(approx_equals(QR, A, base_eps * 10.0));
 }
+
+TEMPLATE_TEST_CASE_2("globals/qr/2", "[globals][QR]", Z, float, double) {
+    etl::dyn_matrix<Z> A(5, 3, std::initializer_list<Z>({12, -51, 4, 6, 167, -68, -4, 24, -41, -1, 1, 0, 2, 0, 3}));
+    etl::dyn_matrix<Z> Q(5, 5);
+    etl::dyn_matrix<Z> R(5, 3);
+    etl::dyn_matrix<Z> QR(5, 3);
+
+    etl::qr(A, Q, R);
+
+    QR = Q * R;
+
+    REQUIRE_DIRECT(approx_equals(QR, A, base_eps * 10.0));
+}
@@ -178,3 +178,156 @@ TEMPLATE_TEST_CASE_2("dyn_upsample/deep/3d/1", "[pooling]", Z, float, double) {
     REQUIRE_EQUALS(c(1, 0, 3, 2), 8.0);
     REQUIRE_EQUALS(c(1, 0, 3, 3), 8.0);
 }
+
+TEMPLATE_TEST_CASE_2("dyn_upsample/deep/2d/2", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> a(8, 6, 31, 37);
+    etl::dyn_matrix<Z, 4> c(8, 6, 62, 37 * 3);
+
+    a = etl::sequence_generator(Z(1.0));
+
+    c = etl::upsample_2d(a, 2, 3);
+
+    for (size_t n = 0; n < 8; ++n) {
+        for (size_t k = 0; k < 6; ++k) {
+            for (size_t i = 0; i < 62; ++i) {
+                for (size_t j = 0; j < 37 * 3; ++j) {
+                    REQUIRE_EQUALS(c(n, k, i, j), a(n, k, i / 2, j / 3));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("dyn_upsample/deep/2d/3", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(3, 5, 7);
+    etl::dyn_matrix<Z, 3> c(3, 15, 7 * 9);
+
+    a = etl::sequence_generator(Z(1.0));
+
+    c = etl::upsample_2d(a, 3, 9);
+
+    for (size_t k = 0; k < 3; ++k) {
+        for (size_t i = 0; i < 15; ++i) {
+            for (size_t j = 0; j < 7 * 9; ++j) {
+                REQUIRE_EQUALS(c(k, i, j), a(k, i / 3, j / 9));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("dyn_upsample/deep/2d/4", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(2, 3, 37);
+
+    a = etl::sequence_generator(Z(1.0));
+
+    for (size_t f = 1; f < 10; ++f) {
+        etl::dyn_matrix<Z, 3> c(2, 3, 37 * f);
+
+        c = etl::upsample_2d(a, 1, f);
+
+        for (size_t k = 0; k < 2; ++k) {
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 37 * f; ++j) {
+                    REQUIRE_EQUALS(c(k, i, j), a(k, i, j / f));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("dyn_upsample/deep/2d/5", "[pooling]") {
+    etl::dyn_matrix<int, 3> a(2, 3, 37);
+
+    a = etl::sequence_generator(1);
+
+    for (size_t f = 1; f < 10; ++f) {
+        etl::dyn_matrix<int, 3> c(2, 3, 37 * f);
+
+        c = etl::upsample_2d(a, 1, f);
+
+        for (size_t k = 0; k < 2; ++k) {
+            for (size_t i = 0; i < 3; ++i) {
+                for (size_t j = 0; j < 37 * f; ++j) {
+                    REQUIRE_EQUALS(c(k, i, j), a(k, i, j / f));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("dyn_upsample/deep/3d/2", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> a(4, 6, 17, 19);
+    etl::dyn_matrix<Z, 4> c(4, 12, 34, 38);
+
+    a = etl::sequence_generator(Z(1.0));
+
+    c = etl::upsample_3d(a, 2, 2, 2);
+
+    for (size_t n = 0; n < 4; ++n) {
+        for (size_t k = 0; k < 12; ++k) {
+            for (size_t i = 0; i < 34; ++i) {
+                for (size_t j = 0; j < 38; ++j) {
+                    REQUIRE_EQUALS(c(n, k, i, j), a(n, k / 2, i / 2, j / 2));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("dyn_upsample/bilinear/1", "[upsample]", Z, float, double) {
+    etl::dyn_matrix<Z> a(2, 2, etl::values(1.0, 2.0, 3.0, 4.0));
+    etl::dyn_matrix<Z> c(4, 4);
+
+    c = etl::upsample_2d_bilinear(a, 2, 2);
+
+    REQUIRE_EQUALS_APPROX(c(0, 0), Z(1.0));
+    REQUIRE_EQUALS_APPROX(c(0, 1), Z(1.25));
+    REQUIRE_EQUALS_APPROX(c(0, 2), Z(1.75));
+    REQUIRE_EQUALS_APPROX(c(0, 3), Z(2.0));
+
+    REQUIRE_EQUALS_APPROX(c(1, 0), Z(1.5));
+    REQUIRE_EQUALS_APPROX(c(1, 1), Z(1.75));
+    REQUIRE_EQUALS_APPROX(c(1, 2), Z(2.25));
+    REQUIRE_EQUALS_APPROX(c(1, 3), Z(2.5));
+
+    REQUIRE_EQUALS_APPROX(c(2, 0), Z(2.5));
+    REQUIRE_EQUALS_APPROX(c(2, 1), Z(2.75));
+    REQUIRE_EQUALS_APPROX(c(2, 2), Z(3.25));
+    REQUIRE_EQUALS_APPROX(c(2, 3), Z(3.5));
+
+    REQUIRE_EQUALS_APPROX(c(3, 0), Z(3.0));
+    REQUIRE_EQUALS_APPROX(c(3, 1), Z(3.25));
+    REQUIRE_EQUALS_APPROX(c(3, 2), Z(3.75));
+    REQUIRE_EQUALS_APPROX(c(3, 3), Z(4.0));
+}
+
+TEMPLATE_TEST_CASE_2("dyn_upsample/bilinear/2", "[upsample]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> a(16, 8, 13, 21);
+    etl::dyn_matrix<Z, 4> c(16, 8, 26, 84);
+
+    // A linear function must be interpolated exactly (away from the clamped borders)
+    for (size_t n = 0; n < 16; ++n) {
+        for (size_t k = 0; k < 8; ++k) {
+            for (size_t i = 0; i < 13; ++i) {
+                for (size_t j = 0; j < 21; ++j) {
+                    a(n, k, i, j) = Z(n) + Z(2.0) * i + Z(0.5) * j;
+                }
+            }
+        }
+    }
+
+    c = etl::upsample_2d_bilinear(a, 2, 4);
+
+    for (size_t n = 0; n < 16; ++n) {
+        for (size_t k = 0; k < 8; ++k) {
+            for (size_t i = 1; i < 25; ++i) {
+                for (size_t j = 2; j < 82; ++j) {
+                    const Z y = (i + Z(0.5)) / Z(2.0) - Z(0.5);
+                    const Z x = (j + Z(0.5)) / Z(4.0) - Z(0.5);
+
+                    REQUIRE_EQUALS_APPROX(c(n, k, i, j), Z(n) + Z(2.0) * y + Z(0.5) * x);
+                }
+            }
+        }
+    }
+}
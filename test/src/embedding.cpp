@@ -0,0 +1,117 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("gather_rows/0", "[embedding]", Z, float, double) {
+    etl::fast_matrix<Z, 4, 3> a({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    etl::fast_vector<size_t, 3> i({2, 0, 2});
+    etl::fast_matrix<Z, 3, 3> c;
+
+    c = etl::gather_rows(a, i);
+
+    REQUIRE_EQUALS(c(0, 0), Z(7));
+    REQUIRE_EQUALS(c(0, 1), Z(8));
+    REQUIRE_EQUALS(c(0, 2), Z(9));
+
+    REQUIRE_EQUALS(c(1, 0), Z(1));
+    REQUIRE_EQUALS(c(1, 1), Z(2));
+    REQUIRE_EQUALS(c(1, 2), Z(3));
+
+    REQUIRE_EQUALS(c(2, 0), Z(7));
+    REQUIRE_EQUALS(c(2, 1), Z(8));
+    REQUIRE_EQUALS(c(2, 2), Z(9));
+}
+
+TEMPLATE_TEST_CASE_2("gather_rows/1", "[embedding]", Z, float, double) {
+    etl::dyn_matrix<Z> a(4, 3, etl::values(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12));
+    etl::dyn_vector<int> i(2, etl::values(3, 1));
+    etl::dyn_matrix<Z> c(2, 3, Z(1));
+
+    c += etl::gather_rows(a, i);
+
+    REQUIRE_EQUALS(c(0, 0), Z(11));
+    REQUIRE_EQUALS(c(0, 1), Z(12));
+    REQUIRE_EQUALS(c(0, 2), Z(13));
+
+    REQUIRE_EQUALS(c(1, 0), Z(5));
+    REQUIRE_EQUALS(c(1, 1), Z(6));
+    REQUIRE_EQUALS(c(1, 2), Z(7));
+}
+
+TEMPLATE_TEST_CASE_2("gather_rows/2", "[embedding]", Z, float, double) {
+    etl::dyn_matrix<Z> a(128, 71);
+    etl::dyn_vector<size_t> i(257);
+    etl::dyn_matrix<Z> c(257, 71);
+
+    a = etl::sequence_generator(1.0);
+
+    for (size_t k = 0; k < etl::size(i); ++k) {
+        i[k] = (k * 7) % 128;
+    }
+
+    PARALLEL_SECTION {
+        c = etl::gather_rows(a, i);
+    }
+
+    for (size_t k = 0; k < etl::size(i); ++k) {
+        for (size_t j = 0; j < 71; ++j) {
+            REQUIRE_EQUALS(c(k, j), a(i[k], j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("scatter_add_rows/0", "[embedding]", Z, float, double) {
+    etl::fast_matrix<Z, 4, 3> a(Z(1));
+    etl::fast_vector<size_t, 3> i({2, 0, 2});
+    etl::fast_matrix<Z, 3, 3> g({1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+    etl::scatter_add_rows(a, i, g);
+
+    REQUIRE_EQUALS(a(0, 0), Z(5));
+    REQUIRE_EQUALS(a(0, 1), Z(6));
+    REQUIRE_EQUALS(a(0, 2), Z(7));
+
+    REQUIRE_EQUALS(a(1, 0), Z(1));
+    REQUIRE_EQUALS(a(1, 1), Z(1));
+    REQUIRE_EQUALS(a(1, 2), Z(1));
+
+    REQUIRE_EQUALS(a(2, 0), Z(9));
+    REQUIRE_EQUALS(a(2, 1), Z(11));
+    REQUIRE_EQUALS(a(2, 2), Z(13));
+
+    REQUIRE_EQUALS(a(3, 0), Z(1));
+    REQUIRE_EQUALS(a(3, 1), Z(1));
+    REQUIRE_EQUALS(a(3, 2), Z(1));
+}
+
+TEMPLATE_TEST_CASE_2("scatter_add_rows/1", "[embedding]", Z, float, double) {
+    etl::dyn_matrix<Z> a(33, 45);
+    etl::dyn_matrix<Z> ref(33, 45);
+    etl::dyn_vector<size_t> i(301);
+    etl::dyn_matrix<Z> g(301, 45);
+
+    a   = etl::sequence_generator(1.0);
+    ref = a;
+    g   = 0.01 * etl::sequence_generator(1.0);
+
+    for (size_t k = 0; k < etl::size(i); ++k) {
+        i[k] = (k * 13) % 33;
+    }
+
+    for (size_t k = 0; k < etl::size(i); ++k) {
+        ref(i[k]) += g(k);
+    }
+
+    PARALLEL_SECTION {
+        etl::scatter_add_rows(a, i, g);
+    }
+
+    for (size_t k = 0; k < etl::size(a); ++k) {
+        REQUIRE_EQUALS_APPROX(a[k], ref[k]);
+    }
+}
@@ -175,6 +175,102 @@ TEMPLATE_TEST_CASE_2("fflip/dyn_matrix", "fflip", Z, float, double) {
 
 // fflip_inplace
 
+TEMPLATE_TEST_CASE_2("hflip/expr/1", "hflip", Z, float, double) {
+    etl::dyn_matrix<Z> a(9, 11);
+    etl::dyn_matrix<Z> b(9, 11);
+    etl::dyn_matrix<Z> c(9, 11);
+
+    a = etl::sequence_generator(1.0);
+    b = etl::sequence_generator(-3.0);
+
+    c = etl::hflip(a) + b;
+
+    for (size_t i = 0; i < 9; ++i) {
+        for (size_t j = 0; j < 11; ++j) {
+            REQUIRE_EQUALS(c(i, j), a(i, 10 - j) + b(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("hflip/expr/2", "hflip", Z, float, double) {
+    etl::dyn_vector<Z> a(19);
+    etl::dyn_vector<Z> c(19);
+
+    a = etl::sequence_generator(1.0);
+
+    c = etl::hflip(a) + a;
+
+    for (size_t i = 0; i < 19; ++i) {
+        REQUIRE_EQUALS(c[i], 20.0);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("hflip/expr/3", "hflip", Z, float, double) {
+    etl::dyn_matrix<Z> a(7, 5);
+    etl::dyn_matrix<Z> b(7, 5);
+    etl::dyn_matrix<Z> c(7, 5);
+
+    a = etl::sequence_generator(1.0);
+    b = etl::sequence_generator(-3.0);
+
+    c = etl::hflip(a + b) + a;
+
+    for (size_t i = 0; i < 7; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            REQUIRE_EQUALS(c(i, j), a(i, 4 - j) + b(i, 4 - j) + a(i, j));
+        }
+    }
+}
+
+TEST_CASE("hflip/expr/4", "hflip") {
+    etl::dyn_matrix<int> a(9, 11);
+    etl::dyn_matrix<int> c(9, 11);
+
+    a = etl::sequence_generator(1);
+
+    c = etl::hflip(a) + a;
+
+    for (size_t i = 0; i < 9; ++i) {
+        for (size_t j = 0; j < 11; ++j) {
+            REQUIRE_EQUALS(c(i, j), a(i, 10 - j) + a(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("vflip/expr/1", "vflip", Z, float, double) {
+    etl::dyn_matrix<Z> a(9, 11);
+    etl::dyn_matrix<Z> b(9, 11);
+    etl::dyn_matrix<Z> c(9, 11);
+
+    a = etl::sequence_generator(1.0);
+    b = etl::sequence_generator(-3.0);
+
+    c = etl::vflip(a) >> b;
+
+    for (size_t i = 0; i < 9; ++i) {
+        for (size_t j = 0; j < 11; ++j) {
+            REQUIRE_EQUALS(c(i, j), a(8 - i, j) * b(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("fflip/expr/1", "fflip", Z, float, double) {
+    etl::dyn_matrix<Z> a(9, 11);
+    etl::dyn_matrix<Z> b(9, 11);
+    etl::dyn_matrix<Z> c(9, 11);
+
+    a = etl::sequence_generator(1.0);
+    b = etl::sequence_generator(-3.0);
+
+    c = etl::fflip(a) - b;
+
+    for (size_t i = 0; i < 9; ++i) {
+        for (size_t j = 0; j < 11; ++j) {
+            REQUIRE_EQUALS(c(i, j), a(8 - i, 10 - j) - b(i, j));
+        }
+    }
+}
+
 TEMPLATE_TEST_CASE_2("fflip_inplace/1", "[fflip][fast][vector][inplace]", Z, float, double) {
     etl::fast_vector<Z, 3> a({1.0, -2.0, 3.0});
 
@@ -155,3 +155,163 @@ TEMPLATE_TEST_CASE_2("im2col/im2col_6", "im2col", Z, double, float) {
     REQUIRE_EQUALS(C(0, 2), 3);
     REQUIRE_EQUALS(C(1, 2), 6);
 }
+
+TEMPLATE_TEST_CASE_2("im2col/im2col_7", "im2col", Z, double, float) {
+    etl::dyn_matrix<Z> I(101, 97);
+    etl::dyn_matrix<Z> C(3 * 5, 99 * 93);
+    etl::dyn_matrix<Z> R(3 * 5, 99 * 93);
+
+    I = etl::sequence_generator(Z(1.0));
+
+    etl::im2col_direct(C, I, 3, 5);
+    etl::im2col_direct(R, I * Z(1.0), 3, 5);
+
+    for (size_t i = 0; i < etl::size(C); ++i) {
+        REQUIRE_EQUALS(C[i], R[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("im2col/im2col_tr_1", "im2col", Z, double, float) {
+    etl::dyn_matrix<Z> I(3, 3, etl::values(1, 2, 3, 4, 5, 6, 7, 8, 9));
+    etl::dyn_matrix<Z> C(4, 4);
+
+    etl::im2col_direct_tr(C, I, 2, 2);
+
+    REQUIRE_EQUALS(C(0, 0), 1);
+    REQUIRE_EQUALS(C(0, 1), 2);
+    REQUIRE_EQUALS(C(0, 2), 4);
+    REQUIRE_EQUALS(C(0, 3), 5);
+
+    REQUIRE_EQUALS(C(1, 0), 2);
+    REQUIRE_EQUALS(C(1, 1), 3);
+    REQUIRE_EQUALS(C(1, 2), 5);
+    REQUIRE_EQUALS(C(1, 3), 6);
+
+    REQUIRE_EQUALS(C(2, 0), 4);
+    REQUIRE_EQUALS(C(2, 1), 5);
+    REQUIRE_EQUALS(C(2, 2), 7);
+    REQUIRE_EQUALS(C(2, 3), 8);
+
+    REQUIRE_EQUALS(C(3, 0), 5);
+    REQUIRE_EQUALS(C(3, 1), 6);
+    REQUIRE_EQUALS(C(3, 2), 8);
+    REQUIRE_EQUALS(C(3, 3), 9);
+}
+
+TEMPLATE_TEST_CASE_2("im2col/im2col_tr_2", "im2col", Z, double, float) {
+    const size_t i1 = 129;
+    const size_t i2 = 121;
+    const size_t k1 = 5;
+    const size_t k2 = 3;
+
+    etl::dyn_matrix<Z> I(i1, i2);
+    etl::dyn_matrix<Z> C(k1 * k2, (i1 - k1 + 1) * (i2 - k2 + 1));
+
+    I = etl::sequence_generator(Z(1.0));
+
+    etl::im2col_direct_tr(C, I, k1, k2);
+
+    const size_t c1 = i1 - k1 + 1;
+    const size_t c2 = i2 - k2 + 1;
+
+    for (size_t b_i = 0; b_i < k1; ++b_i) {
+        for (size_t b_j = 0; b_j < k2; ++b_j) {
+            for (size_t i = 0; i < c1; ++i) {
+                for (size_t j = 0; j < c2; ++j) {
+                    REQUIRE_EQUALS(C(b_i * k2 + b_j, i * c2 + j), I(i + b_i, j + b_j));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("im2col/im2col_tr_3", "im2col", Z, double, float) {
+    const size_t i1 = 33;
+    const size_t i2 = 28;
+    const size_t k1 = 3;
+    const size_t k2 = 4;
+    const size_t s1 = 2;
+    const size_t s2 = 3;
+
+    const size_t c1 = (i1 - k1) / s1 + 1;
+    const size_t c2 = (i2 - k2) / s2 + 1;
+
+    etl::dyn_matrix<Z> I(i1, i2);
+    etl::dyn_matrix<Z> C(k1 * k2, c1 * c2);
+
+    I = etl::sequence_generator(Z(1.0));
+
+    etl::im2col_direct_tr(C, I, k1, k2, s1, s2);
+
+    for (size_t b_i = 0; b_i < k1; ++b_i) {
+        for (size_t b_j = 0; b_j < k2; ++b_j) {
+            for (size_t i = 0; i < c1; ++i) {
+                for (size_t j = 0; j < c2; ++j) {
+                    REQUIRE_EQUALS(C(b_i * k2 + b_j, i * c2 + j), I(i * s1 + b_i, j * s2 + b_j));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("im2col/im2col_tr_multi_1", "im2col", Z, double, float) {
+    const size_t N  = 32;
+    const size_t i1 = 25;
+    const size_t i2 = 23;
+    const size_t k1 = 3;
+    const size_t k2 = 3;
+
+    const size_t c1 = i1 - k1 + 1;
+    const size_t c2 = i2 - k2 + 1;
+
+    etl::dyn_matrix<Z, 3> I(N, i1, i2);
+    etl::dyn_matrix<Z> C(k1 * k2, N * c1 * c2);
+
+    I = etl::sequence_generator(Z(1.0));
+
+    etl::im2col_direct_tr_multi(C, I, k1, k2);
+
+    for (size_t n = 0; n < N; ++n) {
+        for (size_t b_i = 0; b_i < k1; ++b_i) {
+            for (size_t b_j = 0; b_j < k2; ++b_j) {
+                for (size_t i = 0; i < c1; ++i) {
+                    for (size_t j = 0; j < c2; ++j) {
+                        REQUIRE_EQUALS(C(b_i * k2 + b_j, n * c1 * c2 + i * c2 + j), I(n, i + b_i, j + b_j));
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("im2col/im2col_tr_multi_2", "im2col", Z, double, float) {
+    const size_t N  = 5;
+    const size_t i1 = 21;
+    const size_t i2 = 17;
+    const size_t k1 = 4;
+    const size_t k2 = 3;
+    const size_t s1 = 3;
+    const size_t s2 = 2;
+
+    const size_t c1 = (i1 - k1) / s1 + 1;
+    const size_t c2 = (i2 - k2) / s2 + 1;
+
+    etl::dyn_matrix<Z, 3> I(N, i1, i2);
+    etl::dyn_matrix<Z> C(k1 * k2, N * c1 * c2);
+
+    I = etl::sequence_generator(Z(1.0));
+
+    etl::im2col_direct_tr_multi(C, I, k1, k2, s1, s2);
+
+    for (size_t n = 0; n < N; ++n) {
+        for (size_t b_i = 0; b_i < k1; ++b_i) {
+            for (size_t b_j = 0; b_j < k2; ++b_j) {
+                for (size_t i = 0; i < c1; ++i) {
+                    for (size_t j = 0; j < c2; ++j) {
+                        REQUIRE_EQUALS(C(b_i * k2 + b_j, n * c1 * c2 + i * c2 + j), I(n, i * s1 + b_i, j * s2 + b_j));
+                    }
+                }
+            }
+        }
+    }
+}
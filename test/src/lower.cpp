@@ -6,6 +6,7 @@
 //=======================================================================
 
 #include "test_light.hpp"
+#include "structured_test.hpp"
 
 TEMPLATE_TEST_CASE_2("lower/1", "[lower]", Z, float, double) {
     etl::lower_matrix<etl::fast_matrix<Z, 2,2>> a;
@@ -193,3 +194,30 @@ TEMPLATE_TEST_CASE_2("lower/9", "[lower][fast]", Z, float, double) {
 
     REQUIRE_THROWS(c(0,2) = 1.0);
 }
+
+TEMPLATE_TEST_CASE_2("lower/10", "[lower]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> a = {1.0, 0.0, 0.0, 2.0, 3.0, 0.0, 4.0, 5.0, 6.0};
+
+    etl::lower_matrix<etl::dyn_matrix<Z>> c(3UL);
+
+    // The expression is evaluated only once to be validated and assigned
+    c = counting(a + a);
+
+    REQUIRE_EQUALS(counting_unary_op<Z>::count(), 9UL);
+    REQUIRE_EQUALS(c(2, 1), Z(10.0));
+
+    a(0, 2) = 1.0;
+
+    REQUIRE_THROWS(c = counting(a));
+    REQUIRE_EQUALS(counting_unary_op<Z>::count(), 9UL);
+    REQUIRE_EQUALS(c(0, 2), Z(0.0));
+
+    Z sum = 0;
+
+    for (auto& v : c) {
+        sum += v;
+    }
+
+    REQUIRE_EQUALS(sum, Z(42.0));
+    REQUIRE_EQUALS(*std::max_element(c.begin(), c.end()), Z(12.0));
+}
@@ -0,0 +1,241 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test_light.hpp"
+
+#include <fstream>
+
+namespace {
+
+// Write a npy file as written by NumPy (version 1.0, header padded to 64 bytes)
+void write_numpy_file(const std::string& path, const std::string& dict, const void* data, size_t n) {
+    std::string header = dict;
+
+    while ((10 + header.size() + 1) % 64) {
+        header += ' ';
+    }
+
+    header += '\n';
+
+    std::ofstream os(path, std::ios::binary);
+    os.write("\x93NUMPY\x01\x00", 8);
+    os.put(char(header.size() & 0xFF));
+    os.put(char(header.size() >> 8));
+    os.write(header.data(), header.size());
+    os.write(static_cast<const char*>(data), n);
+}
+
+} //end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("npy/1", "[npy]", Z, float, double) {
+    etl::dyn_matrix<Z> a(3, 2, etl::values<Z>(1.0, 3.0, -4.0, -1.0, 0.0, 2.5));
+
+    REQUIRE_DIRECT(etl::save_npy("npy1.tmp.npy", a));
+
+    etl::dyn_matrix<Z> b;
+
+    REQUIRE_DIRECT(etl::load_npy("npy1.tmp.npy", b));
+
+    REQUIRE_EQUALS(etl::dim(b, 0), 3UL);
+    REQUIRE_EQUALS(etl::dim(b, 1), 2UL);
+    REQUIRE_EQUALS(b, a);
+}
+
+TEMPLATE_TEST_CASE_2("npy/2", "[npy]", Z, int32_t, int64_t) {
+    etl::fast_matrix<Z, 2, 3, 4> a;
+    a = etl::sequence_generator<Z>(1);
+
+    REQUIRE_DIRECT(etl::save_npy("npy2.tmp.npy", a));
+
+    etl::fast_matrix<Z, 2, 3, 4> b;
+    etl::fast_matrix<Z, 2, 4, 3> c;
+    etl::fast_matrix<float, 2, 3, 4> d;
+
+    REQUIRE_DIRECT(etl::load_npy("npy2.tmp.npy", b));
+    REQUIRE_DIRECT(!etl::load_npy("npy2.tmp.npy", c));
+    REQUIRE_DIRECT(!etl::load_npy("npy2.tmp.npy", d));
+
+    REQUIRE_EQUALS(b, a);
+}
+
+// Fortran order to C order and back
+
+TEMPLATE_TEST_CASE_2("npy/3", "[npy]", Z, float, double) {
+    etl::dyn_matrix_cm<Z> a(2, 3);
+
+    a(0, 0) = 1.0;
+    a(0, 1) = 2.0;
+    a(0, 2) = 3.0;
+    a(1, 0) = 4.0;
+    a(1, 1) = 5.0;
+    a(1, 2) = 6.0;
+
+    REQUIRE_DIRECT(etl::save_npy("npy3.tmp.npy", a));
+
+    etl::dyn_matrix<Z> b;
+    etl::dyn_matrix_cm<Z> c;
+
+    REQUIRE_DIRECT(etl::load_npy("npy3.tmp.npy", b));
+    REQUIRE_DIRECT(etl::load_npy("npy3.tmp.npy", c));
+
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            REQUIRE_EQUALS(b(i, j), a(i, j));
+            REQUIRE_EQUALS(c(i, j), a(i, j));
+        }
+    }
+
+    REQUIRE_EQUALS(b[1], 2.0);
+    REQUIRE_EQUALS(c[1], 4.0);
+}
+
+// File written by NumPy
+
+TEST_CASE("npy/4", "[npy]") {
+    const double data[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+    write_numpy_file("npy4.tmp.npy", "{'descr': '<f8', 'fortran_order': False, 'shape': (6,), }", data, sizeof(data));
+
+    etl::dyn_vector<double> a;
+    float buffer[6];
+    etl::custom_dyn_vector<float> b(buffer, 6);
+    std::vector<double> memory(6);
+    etl::custom_dyn_vector<double> c(memory.data(), 6);
+
+    REQUIRE_DIRECT(etl::load_npy("npy4.tmp.npy", a));
+    REQUIRE_DIRECT(!etl::load_npy("npy4.tmp.npy", b));
+    REQUIRE_DIRECT(etl::load_npy("npy4.tmp.npy", c));
+
+    REQUIRE_EQUALS(etl::size(a), 6UL);
+    REQUIRE_EQUALS(a[0], 1.0);
+    REQUIRE_EQUALS(a[5], 6.0);
+    REQUIRE_EQUALS(memory[3], 4.0);
+}
+
+TEST_CASE("npy/5", "[npy]") {
+    const float data[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+    write_numpy_file("npy5.tmp.npy", "{'descr': '<f4', 'fortran_order': True, 'shape': (3, 2), }", data, sizeof(data));
+
+    etl::dyn_matrix<float> a;
+
+    REQUIRE_DIRECT(etl::load_npy("npy5.tmp.npy", a));
+
+    REQUIRE_EQUALS(a(0, 0), 1.0f);
+    REQUIRE_EQUALS(a(1, 0), 2.0f);
+    REQUIRE_EQUALS(a(2, 0), 3.0f);
+    REQUIRE_EQUALS(a(0, 1), 4.0f);
+    REQUIRE_EQUALS(a(2, 1), 6.0f);
+}
+
+TEST_CASE("npy/6", "[npy]") {
+    const float data[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+    // The shape does not match the size of the file, then its size overflows
+    write_numpy_file("npy6.tmp.npy", "{'descr': '<f4', 'fortran_order': False, 'shape': (3, 2000000), }", data, sizeof(data));
+    write_numpy_file("npy7.tmp.npy", "{'descr': '<f4', 'fortran_order': False, 'shape': (4294967296, 4294967296), }", data, sizeof(data));
+
+    etl::dyn_matrix<float> a(3, 2);
+
+    REQUIRE_DIRECT(!etl::load_npy("npy6.tmp.npy", a));
+    REQUIRE_DIRECT(!etl::load_npy("npy7.tmp.npy", a));
+    REQUIRE_EQUALS(etl::dim(a, 1), 2UL);
+
+    etl::mapped_npy<float, etl::order::RowMajor, 2> m6("npy6.tmp.npy");
+    etl::mapped_npy<float, etl::order::RowMajor, 2> m7("npy7.tmp.npy");
+
+    REQUIRE_DIRECT(!m6.valid());
+    REQUIRE_DIRECT(!m7.valid());
+}
+
+TEMPLATE_TEST_CASE_2("npy/mmap/1", "[npy]", Z, float, double) {
+    etl::dyn_matrix<Z> a(5, 7);
+    a = etl::sequence_generator<Z>(1.0);
+
+    REQUIRE_DIRECT(etl::save_npy("npy6.tmp.npy", a));
+
+    auto mapped = etl::map_npy<Z, 2>("npy6.tmp.npy");
+
+    REQUIRE_DIRECT(mapped.valid());
+    REQUIRE_DIRECT(mapped.is_mapped());
+
+    auto b = mapped.matrix();
+
+    REQUIRE_EQUALS(etl::dim(b, 0), 5UL);
+    REQUIRE_EQUALS(etl::dim(b, 1), 7UL);
+    REQUIRE_EQUALS(b, a);
+
+    // The mapping is private, the file is not modified
+    b(0, 0) = 42.0;
+
+    etl::dyn_matrix<Z> c;
+    REQUIRE_DIRECT(etl::load_npy("npy6.tmp.npy", c));
+    REQUIRE_EQUALS(c(0, 0), 1.0);
+}
+
+TEMPLATE_TEST_CASE_2("npy/mmap/2", "[npy]", Z, float, double) {
+    etl::dyn_matrix<Z> a(5, 7);
+    a = etl::sequence_generator<Z>(1.0);
+
+    REQUIRE_DIRECT(etl::save_npy("npy7.tmp.npy", a));
+
+    auto mapped = etl::map_npy<Z, 2, etl::order::ColumnMajor>("npy7.tmp.npy");
+
+    REQUIRE_DIRECT(mapped.valid());
+    REQUIRE_DIRECT(!mapped.is_mapped());
+
+    auto b = mapped.matrix();
+
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 7; ++j) {
+            REQUIRE_EQUALS(b(i, j), a(i, j));
+        }
+    }
+
+    auto invalid = etl::map_npy<Z, 3>("npy7.tmp.npy");
+    auto missing = etl::map_npy<Z, 2>("npy_missing.tmp.npy");
+
+    REQUIRE_DIRECT(!invalid.valid());
+    REQUIRE_DIRECT(!missing.valid());
+}
+
+TEMPLATE_TEST_CASE_2("npz/1", "[npy]", Z, float, double) {
+    etl::dyn_matrix<Z> a(3, 2, etl::values<Z>(1.0, 3.0, -4.0, -1.0, 0.0, 2.5));
+    etl::fast_vector<int32_t, 4> b({4, 3, 2, 1});
+
+    {
+        etl::npz_writer writer("npz1.tmp.npz");
+
+        REQUIRE_DIRECT(writer.add("weights", a));
+        REQUIRE_DIRECT(writer.add("indices", b));
+        REQUIRE_DIRECT(writer.close());
+    }
+
+    etl::npz_reader reader("npz1.tmp.npz");
+
+    REQUIRE_DIRECT(reader.valid());
+
+    auto names = reader.names();
+
+    REQUIRE_EQUALS(names.size(), 2UL);
+    REQUIRE_EQUALS(names[0], "weights");
+    REQUIRE_EQUALS(names[1], "indices");
+
+    etl::dyn_matrix<Z> c;
+    etl::dyn_vector<int32_t> d;
+
+    REQUIRE_DIRECT(reader.load("indices", d));
+    REQUIRE_DIRECT(reader.load("weights.npy", c));
+    REQUIRE_DIRECT(!reader.load("bias", c));
+
+    REQUIRE_EQUALS(c, a);
+    REQUIRE_EQUALS(d, b);
+
+    etl::dyn_matrix<Z> e;
+    REQUIRE_DIRECT(etl::load_npz("npz1.tmp.npz", "weights", e));
+    REQUIRE_EQUALS(e, a);
+}
@@ -0,0 +1,282 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+#include "structured_test.hpp"
+
+TEMPLATE_TEST_CASE_2("packed/sym/1", "[packed]", Z, float, double) {
+    etl::dyn_matrix<Z> a(3, 3, std::initializer_list<Z>({1.0, 2.0, 3.0, 2.0, 4.0, 5.0, 3.0, 5.0, 6.0}));
+
+    etl::packed_symmetric_matrix<Z> b(a);
+
+    REQUIRE_EQUALS(b.dimension(), 3UL);
+    REQUIRE_EQUALS(b.packed_size(), 6UL);
+    REQUIRE_EQUALS(etl::size(b), 9UL);
+    REQUIRE_EQUALS(etl::dim<0>(b), 3UL);
+    REQUIRE_EQUALS(etl::dim<1>(b), 3UL);
+
+    REQUIRE_EQUALS(b(0, 2), Z(3.0));
+    REQUIRE_EQUALS(b(2, 0), Z(3.0));
+    REQUIRE_EQUALS(b(1, 2), Z(5.0));
+
+    etl::dyn_matrix<Z> c;
+    c = b;
+
+    REQUIRE_DIRECT(c == a);
+
+    b.set(0, 1, Z(7.0));
+
+    REQUIRE_EQUALS(b(0, 1), Z(7.0));
+    REQUIRE_EQUALS(b(1, 0), Z(7.0));
+}
+
+TEMPLATE_TEST_CASE_2("packed/sym/2", "[packed]", Z, float, double) {
+    etl::dyn_matrix<Z> a(3, 3, std::initializer_list<Z>({1.0, 2.0, 3.0, 2.0, 4.0, 5.0, 3.0, 5.0, 6.0}));
+    etl::dyn_matrix<Z> n(3, 3, std::initializer_list<Z>({1.0, 2.0, 3.0, 2.0, 4.0, 5.0, 3.0, 1.0, 6.0}));
+
+    etl::packed_symmetric_matrix<Z> b(a);
+
+    REQUIRE_THROWS(b = n);
+
+    // The matrix is unchanged by the failed assignment
+    REQUIRE_EQUALS(b(2, 1), Z(5.0));
+    REQUIRE_EQUALS(b(1, 2), Z(5.0));
+
+    // The expression is evaluated only once
+    b = n + etl::transpose(n);
+
+    REQUIRE_EQUALS(b(0, 0), Z(2.0));
+    REQUIRE_EQUALS(b(1, 2), Z(6.0));
+    REQUIRE_EQUALS(b(2, 1), Z(6.0));
+    REQUIRE_EQUALS(b(2, 2), Z(12.0));
+}
+
+TEMPLATE_TEST_CASE_2("packed/tri/1", "[packed]", Z, float, double) {
+    etl::dyn_matrix<Z> a(3, 3, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0, 4.0, 5.0, 6.0}));
+
+    etl::packed_lower_matrix<Z> b(a);
+    etl::packed_upper_matrix<Z> c(etl::transpose(a));
+
+    REQUIRE_EQUALS(b.packed_size(), 6UL);
+    REQUIRE_EQUALS(c.packed_size(), 6UL);
+
+    REQUIRE_EQUALS(b(2, 1), Z(5.0));
+    REQUIRE_EQUALS(b(1, 2), Z(0.0));
+    REQUIRE_EQUALS(c(1, 2), Z(5.0));
+    REQUIRE_EQUALS(c(2, 1), Z(0.0));
+
+    etl::dyn_matrix<Z> d;
+    d = b;
+
+    REQUIRE_DIRECT(d == a);
+
+    d = c;
+
+    REQUIRE_DIRECT(d == etl::transpose(a));
+
+    REQUIRE_THROWS(b = etl::transpose(a));
+    REQUIRE_THROWS(c = a);
+    REQUIRE_THROWS(b.set(0, 1, Z(1.0)));
+
+    b.set(0, 1, Z(0.0));
+
+    REQUIRE_EQUALS(b(2, 1), Z(5.0));
+    REQUIRE_EQUALS(c(1, 2), Z(5.0));
+}
+
+TEMPLATE_TEST_CASE_2("packed/eval/1", "[packed]", Z, float, double) {
+    const size_t n = 9;
+
+    etl::dyn_matrix<Z> r(n, n);
+    fill_small(r, 7);
+
+    etl::dyn_matrix<Z> a;
+    a = r + etl::transpose(r);
+
+    etl::dyn_matrix<Z> l(n, n);
+    l = a;
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = i + 1; j < n; ++j) {
+            l(i, j) = Z(0);
+        }
+    }
+
+    // Each element of the expression is evaluated only once
+
+    etl::packed_symmetric_matrix<Z> b(n);
+    b = counting(a);
+
+    REQUIRE_EQUALS(counting_unary_op<Z>::count(), n * n);
+    REQUIRE_EQUALS(b(2, 7), a(2, 7));
+
+    etl::packed_lower_matrix<Z> c(n);
+    c = counting(l);
+
+    REQUIRE_EQUALS(counting_unary_op<Z>::count(), n * n);
+    REQUIRE_EQUALS(c(7, 2), l(7, 2));
+
+    // Including when the validation fails
+
+    a(1, 5) = Z(100);
+
+    REQUIRE_THROWS(b = counting(a));
+    REQUIRE_EQUALS(counting_unary_op<Z>::count(), n * n);
+    REQUIRE_EQUALS(b(1, 5), r(1, 5) + r(5, 1));
+
+    REQUIRE_THROWS(c = counting(a));
+    REQUIRE_EQUALS(counting_unary_op<Z>::count(), n * n);
+    REQUIRE_EQUALS(c(5, 1), l(5, 1));
+}
+
+TEMPLATE_TEST_CASE_2("packed/symv/1", "[packed][symv]", Z, float, double) {
+    const size_t n = 37;
+
+    etl::dyn_matrix<Z> r(n, n);
+    etl::dyn_vector<Z> x(n);
+
+    fill_small(r, 7);
+    fill_small(x, 5);
+
+    etl::dyn_matrix<Z> a;
+    a = r + etl::transpose(r);
+
+    etl::packed_symmetric_matrix<Z> p(a);
+
+    etl::dyn_vector<Z> y(n);
+    etl::symv(p, x, y);
+
+    etl::dyn_vector<Z> ref(n);
+    ref = a * x;
+
+    for (size_t i = 0; i < n; ++i) {
+        REQUIRE_EQUALS(y[i], ref[i]);
+    }
+
+    etl::dyn_vector<Z> z;
+    z = etl::symv(p, 2.0 * x);
+
+    for (size_t i = 0; i < n; ++i) {
+        REQUIRE_EQUALS(z[i], Z(2.0) * ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("packed/trmv/1", "[packed][trmv]", Z, float, double) {
+    const size_t n = 33;
+
+    etl::dyn_matrix<Z> r(n, n);
+    etl::dyn_vector<Z> x(n);
+
+    fill_small(r, 3);
+    fill_small(x, 7);
+
+    etl::dyn_matrix<Z> l(n, n, Z(0));
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j <= i; ++j) {
+            l(i, j) = r(i, j);
+        }
+    }
+
+    etl::packed_lower_matrix<Z> pl(l);
+    etl::packed_upper_matrix<Z> pu(etl::transpose(l));
+
+    etl::dyn_vector<Z> ref(n);
+
+    ref = l * x;
+
+    etl::dyn_vector<Z> y(n);
+    etl::trmv(pl, x, y);
+
+    for (size_t i = 0; i < n; ++i) {
+        REQUIRE_EQUALS(y[i], ref[i]);
+    }
+
+    ref = etl::transpose(l) * x;
+
+    etl::dyn_vector<Z> z;
+    z = etl::trmv(pu, x);
+
+    for (size_t i = 0; i < n; ++i) {
+        REQUIRE_EQUALS(z[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("packed/trmm/1", "[packed][trmm]", Z, float, double) {
+    const size_t n = 19;
+    const size_t k = 23;
+
+    etl::dyn_matrix<Z> r(n, n);
+    etl::dyn_matrix<Z> b(n, k);
+
+    fill_small(r, 5);
+    fill_small(b, 3);
+
+    etl::dyn_matrix<Z> u(n, n, Z(0));
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = i; j < n; ++j) {
+            u(i, j) = r(i, j);
+        }
+    }
+
+    etl::packed_upper_matrix<Z> pu(u);
+    etl::packed_lower_matrix<Z> pl(etl::transpose(u));
+
+    etl::dyn_matrix<Z> ref;
+
+    ref = u * b;
+
+    etl::dyn_matrix<Z> c(n, k);
+    etl::trmm(pu, b, c);
+
+    for (size_t i = 0; i < n * k; ++i) {
+        REQUIRE_EQUALS(c[i], ref[i]);
+    }
+
+    ref = etl::transpose(u) * b;
+
+    etl::dyn_matrix<Z> d;
+    d = etl::trmm(pl, b);
+
+    for (size_t i = 0; i < n * k; ++i) {
+        REQUIRE_EQUALS(d[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("packed/syrk/1", "[packed][syrk]", Z, float, double) {
+    const size_t n = 17;
+    const size_t k = 29;
+
+    etl::dyn_matrix<Z> a(n, k);
+
+    fill_small(a, 13);
+
+    etl::dyn_matrix<Z> ref;
+    ref = a * etl::transpose(a);
+
+    etl::packed_symmetric_matrix<Z> c;
+    etl::syrk(a, c);
+
+    REQUIRE_EQUALS(c.dimension(), n);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS(c(i, j), ref(i, j));
+        }
+    }
+
+    auto d = etl::syrk(a >> a);
+
+    ref = (a >> a) * etl::transpose(a >> a);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS(d(i, j), ref(i, j));
+        }
+    }
+}
@@ -97,3 +97,41 @@ TEMPLATE_TEST_CASE_2("parallel_section/3", "[fast][parallel]", Z, float, double)
 
     REQUIRE_DIRECT(!etl::local_context().parallel);
 }
+
+TEST_CASE("threads_section/1", "[parallel]") {
+    REQUIRE_EQUALS(etl::parallel_threads(), etl::threads);
+
+    THREADS_SECTION(1) {
+        REQUIRE_EQUALS(etl::parallel_threads(), 1UL);
+        REQUIRE_DIRECT(!etl::select_parallel(1024 * 1024));
+
+        THREADS_SECTION(etl::threads + 4) {
+            REQUIRE_EQUALS(etl::parallel_threads(), etl::threads);
+        }
+
+        REQUIRE_EQUALS(etl::parallel_threads(), 1UL);
+    }
+
+    REQUIRE_EQUALS(etl::parallel_threads(), etl::threads);
+}
+
+TEMPLATE_TEST_CASE_2("threads_section/2", "[dyn][parallel][sum]", Z, float, double) {
+    etl::dyn_vector<Z> a(1001);
+    etl::dyn_vector<Z> b(1001);
+    etl::dyn_vector<Z> c(1001);
+
+    a = etl::sequence_generator<Z>(1.0);
+    b = 2.0;
+
+    for (size_t t = 1; t <= etl::threads + 1; ++t) {
+        THREADS_SECTION(t) {
+            PARALLEL_SECTION {
+                c = a + b;
+
+                REQUIRE_EQUALS(c[0], Z(3.0));
+                REQUIRE_EQUALS(c[1000], Z(1003.0));
+                REQUIRE_EQUALS(etl::sum(a), Z(1001.0 * 1002.0 / 2.0));
+            }
+        }
+    }
+}
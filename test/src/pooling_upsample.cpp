@@ -85,6 +85,28 @@ TEMPLATE_TEST_CASE_2("pool_upsample/dyn/max2/deep/1", "[pooling]", Z, float, dou
     REQUIRE_DIRECT(approx_equals(c1, c2, base_eps));
 }
 
+TEMPLATE_TEST_CASE_2("pool_upsample/dyn/max2/deep/2", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> input(2, 3, 8, 8);
+    input = etl::uniform_generator<Z>(-1000.0, 1000.0);
+
+    etl::dyn_matrix<Z, 4> errors(2, 3, 4, 4);
+    errors = etl::uniform_generator<Z>(-1000.0, 1000.0);
+
+    etl::dyn_matrix<Z, 4> output(2, 3, 4, 4);
+    output = etl::max_pool_2d(input, 2, 2);
+
+    etl::dyn_matrix<Z, 4> c1(2, 3, 8, 8);
+    etl::dyn_matrix<Z, 4> c2(2, 3, 8, 8);
+
+    for (size_t i = 0; i < 2; ++i) {
+        c1(i) = etl::max_pool_upsample_2d(input(i), output(i), errors(i), 2, 2);
+    }
+
+    c2 = etl::max_pool_upsample_2d(input, output, errors, 2, 2);
+
+    REQUIRE_DIRECT(approx_equals(c1, c2, base_eps));
+}
+
 TEMPLATE_TEST_CASE_2("pool_upsample/dyn/max3/1", "[pooling]", Z, float, double) {
     etl::dyn_matrix<Z, 3> input(2, 4, 4);
     input = etl::uniform_generator<Z>(-1000.0, 1000.0);
@@ -237,6 +259,28 @@ TEMPLATE_TEST_CASE_2("pool_upsample/max2/deep/1", "[pooling]", Z, float, double)
     REQUIRE_DIRECT(approx_equals(c1, c2, base_eps));
 }
 
+TEMPLATE_TEST_CASE_2("pool_upsample/max2/deep/2", "[pooling]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 3, 8, 4> input;
+    input = etl::uniform_generator<Z>(-1000.0, 1000.0);
+
+    etl::fast_matrix<Z, 2, 3, 4, 4> errors;
+    errors = etl::uniform_generator<Z>(-1000.0, 1000.0);
+
+    etl::fast_matrix<Z, 2, 3, 4, 4> output;
+    output = etl::max_pool_2d<2, 1>(input);
+
+    etl::fast_matrix<Z, 2, 3, 8, 4> c1;
+    etl::fast_matrix<Z, 2, 3, 8, 4> c2;
+
+    for (size_t i = 0; i < 2; ++i) {
+        c1(i) = etl::max_pool_upsample_2d<2, 1>(input(i), output(i), errors(i));
+    }
+
+    c2 = etl::max_pool_upsample_2d<2, 1>(input, output, errors);
+
+    REQUIRE_DIRECT(approx_equals(c1, c2, base_eps));
+}
+
 TEMPLATE_TEST_CASE_2("pool_upsample/max3/1", "[pooling]", Z, float, double) {
     etl::fast_matrix<Z, 2, 4, 4> input;
     input = etl::uniform_generator<Z>(-1000.0, 1000.0);
@@ -0,0 +1,122 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+#include <sstream>
+
+namespace {
+
+const etl::profile_record* find_record(const std::vector<etl::profile_record>& records, const std::string& operation) {
+    for (auto& record : records) {
+        if (record.operation == operation) {
+            return &record;
+        }
+    }
+
+    return nullptr;
+}
+
+} //end of anonymous namespace
+
+TEST_CASE("profile/1", "[profile]") {
+    etl::reset_profile();
+
+    etl::dyn_matrix<float> a(32, 16);
+    etl::dyn_matrix<float> b(16, 8);
+    etl::dyn_matrix<float> c(32, 8);
+    etl::dyn_matrix<float> d(32, 8);
+
+    a = 1.0f;
+    b = 2.0f;
+
+    c = a * b;
+    c = a * b;
+    d = c + c;
+
+    REQUIRE_EQUALS(etl::sum(d), 32.0f * 8.0f * 64.0f);
+
+    auto records = etl::profile_records();
+
+#ifdef ETL_PROFILE
+    auto* gemm = find_record(records, "gemm");
+
+    REQUIRE_DIRECT(gemm);
+    REQUIRE_EQUALS(gemm->count, 2UL);
+    REQUIRE_EQUALS(gemm->flops, 2UL * 2 * 32 * 16 * 8);
+    REQUIRE_EQUALS(gemm->bytes, 2UL * (32 * 16 + 16 * 8 + 32 * 8) * sizeof(float));
+    REQUIRE_DIRECT(gemm->max_ns <= gemm->total_ns);
+    REQUIRE_DIRECT(!gemm->impl.empty());
+
+    REQUIRE_DIRECT(find_record(records, "assign"));
+    REQUIRE_DIRECT(find_record(records, "sum"));
+
+    std::ostringstream json;
+    etl::dump_profile_json(json);
+
+    REQUIRE_DIRECT(json.str().find("\"operation\": \"gemm\"") != std::string::npos);
+
+    std::ostringstream csv;
+    etl::dump_profile_csv(csv);
+
+    REQUIRE_DIRECT(csv.str().find("operation,impl,count,total_ns,max_ns,bytes,flops\n") == 0);
+    REQUIRE_DIRECT(csv.str().find("gemm," + gemm->impl + ",2,") != std::string::npos);
+
+    etl::reset_profile();
+
+    REQUIRE_DIRECT(etl::profile_records().empty());
+#else
+    REQUIRE_DIRECT(records.empty());
+    REQUIRE_DIRECT(!find_record(records, "gemm"));
+#endif
+}
+
+TEST_CASE("profile/pooling", "[profile]") {
+    etl::reset_profile();
+
+    etl::dyn_matrix<float, 3> a(4, 8, 8);
+    etl::dyn_matrix<float, 3> b(4, 4, 4);
+
+    a = 1.0f;
+
+    b = etl::max_pool_2d<2, 2>(a);
+    b = etl::avg_pool_2d(a, 2, 2);
+    b = etl::avg_pool_2d(a, 2, 2);
+
+    REQUIRE_EQUALS(b(0, 0, 0), 1.0f);
+
+    auto records = etl::profile_records();
+
+#ifdef ETL_PROFILE
+    auto* max_pool = find_record(records, "max_pool_2d");
+    auto* avg_pool = find_record(records, "avg_pool_2d");
+
+    REQUIRE_DIRECT(max_pool);
+    REQUIRE_DIRECT(avg_pool);
+    REQUIRE_EQUALS(max_pool->count, 1UL);
+    REQUIRE_EQUALS(avg_pool->count, 2UL);
+    REQUIRE_DIRECT((max_pool->impl == "STD" || max_pool->impl == "PAR_STD"));
+
+    etl::reset_profile();
+
+    b = etl::max_pool_2d<2, 2>(a);
+
+    records = etl::profile_records();
+
+    REQUIRE_DIRECT(find_record(records, "max_pool_2d"));
+    REQUIRE_DIRECT(!find_record(records, "avg_pool_2d"));
+#else
+    REQUIRE_DIRECT(records.empty());
+#endif
+}
+
+TEST_CASE("profile/json", "[profile]") {
+    std::ostringstream os;
+    etl::write_json_string(os, std::string("a\"b\\c\n\x01"));
+
+    REQUIRE_EQUALS(os.str(), std::string("\"a\\\"b\\\\c\\u000a\\u0001\""));
+}
@@ -0,0 +1,202 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("cumsum/1", "[scan]", Z, float, double) {
+    etl::fast_vector<Z, 5> a({1.0, 2.0, 3.0, 4.0, 5.0});
+    etl::fast_vector<Z, 5> b;
+
+    b = etl::cumsum(a);
+
+    REQUIRE_EQUALS(b[0], Z(1.0));
+    REQUIRE_EQUALS(b[1], Z(3.0));
+    REQUIRE_EQUALS(b[2], Z(6.0));
+    REQUIRE_EQUALS(b[3], Z(10.0));
+    REQUIRE_EQUALS(b[4], Z(15.0));
+}
+
+TEMPLATE_TEST_CASE_2("cumsum/2", "[scan]", Z, float, double) {
+    etl::dyn_vector<Z> a(200003);
+    etl::dyn_vector<Z> b(200003);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 7) - Z(3.0);
+    }
+
+    b = etl::cumsum(a);
+
+    Z acc = 0;
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        acc += a[i];
+        REQUIRE_EQUALS(b[i], acc);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("cumsum/3", "[scan]", Z, float, double) {
+    etl::dyn_vector<Z> a(37);
+    etl::dyn_vector<Z> b(37);
+
+    a = etl::sequence_generator(Z(1.0));
+    b = 1.0;
+
+    b += etl::cumsum(a >> a);
+
+    Z acc = 0;
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        acc += a[i] * a[i];
+        REQUIRE_EQUALS(b[i], acc + Z(1.0));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("cumprod/1", "[scan]", Z, float, double) {
+    etl::fast_vector<Z, 11> a({1.0, 2.0, 3.0, 0.5, 2.0, -1.0, 1.0, 2.0, 1.0, 0.5, 4.0});
+    etl::fast_vector<Z, 11> b;
+
+    b = etl::cumprod(a);
+
+    Z acc = 1;
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        acc *= a[i];
+        REQUIRE_EQUALS_APPROX(b[i], acc);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("cumsum_r/1", "[scan]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 3> a({1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    etl::fast_matrix<Z, 2, 3> b;
+
+    b = etl::cumsum_r(a);
+
+    REQUIRE_EQUALS(b(0, 0), Z(1.0));
+    REQUIRE_EQUALS(b(0, 1), Z(3.0));
+    REQUIRE_EQUALS(b(0, 2), Z(6.0));
+    REQUIRE_EQUALS(b(1, 0), Z(4.0));
+    REQUIRE_EQUALS(b(1, 1), Z(9.0));
+    REQUIRE_EQUALS(b(1, 2), Z(15.0));
+}
+
+TEMPLATE_TEST_CASE_2("cumsum_l/1", "[scan]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 2> a({1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    etl::fast_matrix<Z, 3, 2> b;
+
+    b = etl::cumsum_l(a);
+
+    REQUIRE_EQUALS(b(0, 0), Z(1.0));
+    REQUIRE_EQUALS(b(0, 1), Z(2.0));
+    REQUIRE_EQUALS(b(1, 0), Z(4.0));
+    REQUIRE_EQUALS(b(1, 1), Z(6.0));
+    REQUIRE_EQUALS(b(2, 0), Z(9.0));
+    REQUIRE_EQUALS(b(2, 1), Z(12.0));
+}
+
+TEMPLATE_TEST_CASE_2("cumsum_rl/2", "[scan]", Z, float, double) {
+    etl::dyn_matrix<Z> a(67, 45);
+    etl::dyn_matrix<Z> r(67, 45);
+    etl::dyn_matrix<Z> l(67, 45);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 13) % 11) - Z(5.0);
+    }
+
+    r = etl::cumsum_r(a);
+    l = etl::cumsum_l(a);
+
+    for (size_t i = 0; i < 67; ++i) {
+        Z acc = 0;
+        for (size_t j = 0; j < 45; ++j) {
+            acc += a(i, j);
+            REQUIRE_EQUALS(r(i, j), acc);
+        }
+    }
+
+    for (size_t j = 0; j < 45; ++j) {
+        Z acc = 0;
+        for (size_t i = 0; i < 67; ++i) {
+            acc += a(i, j);
+            REQUIRE_EQUALS(l(i, j), acc);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("cumprod_rl/1", "[scan]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 3> a({1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    etl::fast_matrix<Z, 2, 3> r;
+    etl::fast_matrix<Z, 2, 3> l;
+
+    r = etl::cumprod_r(a);
+    l = etl::cumprod_l(a);
+
+    REQUIRE_EQUALS(r(0, 0), Z(1.0));
+    REQUIRE_EQUALS(r(0, 1), Z(2.0));
+    REQUIRE_EQUALS(r(0, 2), Z(6.0));
+    REQUIRE_EQUALS(r(1, 0), Z(4.0));
+    REQUIRE_EQUALS(r(1, 1), Z(20.0));
+    REQUIRE_EQUALS(r(1, 2), Z(120.0));
+
+    REQUIRE_EQUALS(l(0, 0), Z(1.0));
+    REQUIRE_EQUALS(l(0, 1), Z(2.0));
+    REQUIRE_EQUALS(l(0, 2), Z(3.0));
+    REQUIRE_EQUALS(l(1, 0), Z(4.0));
+    REQUIRE_EQUALS(l(1, 1), Z(10.0));
+    REQUIRE_EQUALS(l(1, 2), Z(18.0));
+}
+
+TEMPLATE_TEST_CASE_2("integral_image/1", "[scan]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> a({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
+    etl::fast_matrix<Z, 3, 3> b;
+
+    b = etl::integral_image(a);
+
+    REQUIRE_EQUALS(b(0, 0), Z(1.0));
+    REQUIRE_EQUALS(b(0, 1), Z(3.0));
+    REQUIRE_EQUALS(b(0, 2), Z(6.0));
+    REQUIRE_EQUALS(b(1, 0), Z(5.0));
+    REQUIRE_EQUALS(b(1, 1), Z(12.0));
+    REQUIRE_EQUALS(b(1, 2), Z(21.0));
+    REQUIRE_EQUALS(b(2, 0), Z(12.0));
+    REQUIRE_EQUALS(b(2, 1), Z(27.0));
+    REQUIRE_EQUALS(b(2, 2), Z(45.0));
+}
+
+TEMPLATE_TEST_CASE_2("integral_image/2", "[scan]", Z, float, double) {
+    etl::dyn_matrix<Z> a(33, 71);
+    etl::dyn_matrix<Z> b(33, 71);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 5);
+    }
+
+    b = etl::integral_image(a);
+
+    for (size_t i = 0; i < 33; ++i) {
+        for (size_t j = 0; j < 71; ++j) {
+            Z acc = 0;
+            for (size_t k = 0; k <= i; ++k) {
+                for (size_t l = 0; l <= j; ++l) {
+                    acc += a(k, l);
+                }
+            }
+
+            REQUIRE_EQUALS(b(i, j), acc);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("integral_image/3", "[scan]", Z, float, double) {
+    etl::fast_matrix_cm<Z, 2, 3> a({1.0, 4.0, 2.0, 5.0, 3.0, 6.0});
+    etl::fast_matrix_cm<Z, 2, 3> b;
+
+    b = etl::integral_image(a);
+
+    REQUIRE_EQUALS(b(0, 0), Z(1.0));
+    REQUIRE_EQUALS(b(0, 1), Z(3.0));
+    REQUIRE_EQUALS(b(0, 2), Z(6.0));
+    REQUIRE_EQUALS(b(1, 0), Z(5.0));
+    REQUIRE_EQUALS(b(1, 1), Z(12.0));
+    REQUIRE_EQUALS(b(1, 2), Z(21.0));
+}
@@ -0,0 +1,109 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+#include <sstream>
+#include <thread>
+
+TEST_CASE("selection_log/1", "[selection]") {
+    etl::reset_selection_log();
+
+    etl::dyn_matrix<float> a(8, 4);
+    etl::dyn_matrix<float> b(4, 6);
+    etl::dyn_matrix<float> c(8, 6);
+
+    a = 1.0f;
+    b = 2.0f;
+
+    c = a * b;
+    c = a * b;
+
+    SELECTED_SECTION(etl::gemm_impl::STD) {
+        c = a * b;
+    }
+
+    REQUIRE_EQUALS(etl::sum(c), 8.0f * 6.0f * 8.0f);
+
+    auto records = etl::selection_records();
+
+#ifdef ETL_SELECTION_LOG
+    size_t heuristic = 0;
+    size_t forced    = 0;
+    size_t sums      = 0;
+
+    for (auto& record : records) {
+        if (record.operation == "gemm") {
+            REQUIRE_EQUALS(record.shape, "8x4x6");
+            REQUIRE_DIRECT(record.candidates.find("STD") == 0);
+
+            if (record.reason == etl::selection_reason::FORCED) {
+                REQUIRE_EQUALS(record.impl, "STD");
+                forced += record.count;
+            } else {
+                REQUIRE_DIRECT(record.reason == etl::selection_reason::HEURISTIC);
+                heuristic += record.count;
+            }
+        } else if (record.operation == "sum") {
+            REQUIRE_EQUALS(record.shape, "48");
+            sums += record.count;
+        }
+    }
+
+    REQUIRE_EQUALS(heuristic, 2UL);
+    REQUIRE_EQUALS(forced, 1UL);
+    REQUIRE_EQUALS(sums, 1UL);
+
+    std::ostringstream os;
+    etl::dump_selection_report(os);
+
+    REQUIRE_DIRECT(os.str().find("gemm (3 selections)") != std::string::npos);
+    REQUIRE_DIRECT(os.str().find("forced") != std::string::npos);
+
+    etl::reset_selection_log();
+
+    REQUIRE_DIRECT(etl::selection_records().empty());
+#else
+    REQUIRE_DIRECT(records.empty());
+#endif
+}
+
+TEST_CASE("selection_log/2", "[selection]") {
+    etl::reset_selection_log();
+
+    etl::dyn_vector<double> a(100);
+    a = 1.0;
+
+    REQUIRE_EQUALS(etl::sum(a), 100.0);
+
+    etl::reset_selection_log();
+
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&a] {
+            for (size_t i = 0; i < 100; ++i) {
+                etl::sum(a);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto records = etl::selection_records();
+
+#ifdef ETL_SELECTION_LOG
+    REQUIRE_EQUALS(records.size(), 1UL);
+    REQUIRE_EQUALS(records[0].operation, "sum");
+    REQUIRE_EQUALS(records[0].shape, "100");
+    REQUIRE_EQUALS(records[0].count, 400UL);
+#else
+    REQUIRE_DIRECT(records.empty());
+#endif
+}
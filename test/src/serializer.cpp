@@ -8,6 +8,7 @@
 #include "test_light.hpp"
 
 #include <fstream>
+#include <sstream>
 
 TEMPLATE_TEST_CASE_2("serializer/1", "[serializer]", Z, float, double) {
     {
@@ -106,3 +107,435 @@ TEMPLATE_TEST_CASE_2("serializer/4", "[serializer]", Z, float, double) {
     REQUIRE_EQUALS(a[4], 0.0);
     REQUIRE_EQUALS(a[5], 2.5);
 }
+
+TEMPLATE_TEST_CASE_2("serializer/5", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(7, 5, 13);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i) * Z(0.5) - Z(100.0);
+    }
+
+    {
+        etl::serializer<std::ofstream> serializer("test5.tmp.etl", std::ios::binary);
+        serializer << a;
+    }
+
+    etl::dyn_matrix<Z, 3> b;
+
+    {
+        etl::deserializer<std::ifstream> deserializer("test5.tmp.etl", std::ios::binary);
+        deserializer >> b;
+
+        REQUIRE_DIRECT(deserializer.stream.good());
+    }
+
+    REQUIRE_EQUALS(etl::dim(b, 0), 7UL);
+    REQUIRE_EQUALS(etl::dim(b, 1), 5UL);
+    REQUIRE_EQUALS(etl::dim(b, 2), 13UL);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(b[i], a[i]);
+    }
+}
+
+// Old format: the dimensions and then the values, one by one
+
+TEMPLATE_TEST_CASE_2("serializer/6", "[serializer]", Z, float, double) {
+    {
+        etl::serializer<std::ofstream> serializer("test6.tmp.etl", std::ios::binary);
+
+        serializer << size_t(2) << size_t(3);
+        serializer << Z(1.0) << Z(2.0) << Z(3.0) << Z(4.0) << Z(5.0) << Z(-6.0);
+        serializer << Z(7.0);
+    }
+
+    etl::dyn_matrix<Z> a;
+    etl::fast_vector<Z, 1> b;
+
+    {
+        etl::deserializer<std::ifstream> deserializer("test6.tmp.etl", std::ios::binary);
+        deserializer >> a >> b;
+
+        REQUIRE_DIRECT(deserializer.stream.good());
+    }
+
+    REQUIRE_EQUALS(etl::dim(a, 0), 2UL);
+    REQUIRE_EQUALS(etl::dim(a, 1), 3UL);
+
+    REQUIRE_EQUALS(a(0, 0), 1.0);
+    REQUIRE_EQUALS(a(0, 2), 3.0);
+    REQUIRE_EQUALS(a(1, 2), -6.0);
+    REQUIRE_EQUALS(b[0], 7.0);
+}
+
+TEMPLATE_TEST_CASE_2("serializer/7", "[serializer]", Z, float, double) {
+    {
+        etl::serializer<std::ofstream> serializer("test7.tmp.etl", std::ios::binary);
+
+        etl::dyn_matrix<Z> a(3, 2, etl::values<Z>(1.0, 3.0, -4.0, -1.0, 0.0, 2.5));
+        serializer << a;
+    }
+
+    // Corrupt the last value
+    {
+        std::fstream stream("test7.tmp.etl", std::ios::binary | std::ios::in | std::ios::out);
+        stream.seekp(-1, std::ios::end);
+        stream.put(char(0x42));
+    }
+
+    etl::dyn_matrix<Z> a;
+
+    etl::deserializer<std::ifstream> deserializer("test7.tmp.etl", std::ios::binary);
+    deserializer >> a;
+
+    REQUIRE_DIRECT(deserializer.stream.fail());
+}
+
+TEST_CASE("serializer/8", "[serializer]") {
+    {
+        etl::serializer<std::ofstream> serializer("test8.tmp.etl", std::ios::binary);
+
+        etl::dyn_matrix<float> a(3, 2, etl::values<float>(1.0, 3.0, -4.0, -1.0, 0.0, 2.5));
+        serializer << a;
+    }
+
+    etl::dyn_matrix<double> a;
+    etl::fast_matrix<float, 2, 3> b;
+
+    {
+        etl::deserializer<std::ifstream> deserializer("test8.tmp.etl", std::ios::binary);
+        deserializer >> a;
+
+        REQUIRE_DIRECT(deserializer.stream.fail());
+    }
+
+    {
+        etl::deserializer<std::ifstream> deserializer("test8.tmp.etl", std::ios::binary);
+        deserializer >> b;
+
+        REQUIRE_DIRECT(deserializer.stream.fail());
+    }
+}
+
+TEST_CASE("serializer/9", "[serializer]") {
+    {
+        etl::serializer<std::ofstream> serializer("test9.tmp.etl", std::ios::binary);
+
+        etl::dyn_matrix<float> a(3, 2, etl::values<float>(1.0, 3.0, -4.0, -1.0, 0.0, 2.5));
+        serializer << a;
+    }
+
+    // Dimensions larger than the file, then dimensions whose product overflows
+    const uint64_t dims[][2] = {{3, 1000000}, {uint64_t(1) << 40, uint64_t(1) << 40}};
+
+    for (auto& d : dims) {
+        {
+            std::fstream stream("test9.tmp.etl", std::ios::binary | std::ios::in | std::ios::out);
+            stream.seekp(32);
+            stream.write(reinterpret_cast<const char*>(d), sizeof(d));
+        }
+
+        etl::dyn_matrix<float> a(2, 2);
+
+        etl::deserializer<std::ifstream> deserializer("test9.tmp.etl", std::ios::binary);
+        deserializer >> a;
+
+        REQUIRE_DIRECT(deserializer.stream.fail());
+        REQUIRE_EQUALS(etl::dim(a, 0), 2UL);
+    }
+}
+
+TEST_CASE("serializer/10", "[serializer]") {
+    // Old format, with dimensions larger than the file
+    {
+        etl::serializer<std::ofstream> serializer("test10.tmp.etl", std::ios::binary);
+
+        serializer << size_t(1) << (size_t(1) << 62);
+        serializer << 1.0f << 2.0f;
+    }
+
+    etl::dyn_matrix<float> a;
+
+    etl::deserializer<std::ifstream> deserializer("test10.tmp.etl", std::ios::binary);
+    deserializer >> a;
+
+    REQUIRE_DIRECT(deserializer.stream.fail());
+    REQUIRE_EQUALS(etl::size(a), 0UL);
+}
+
+TEMPLATE_TEST_CASE_2("serializer/compressed/1", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(7, 33, 129);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(i % 17) * Z(0.5) - Z(2.0);
+    }
+
+    {
+        etl::serializer<std::ofstream> serializer("test_c1.tmp.etl", std::ios::binary);
+        serializer.compress(etl::tensor_codec::SHUFFLE_LZ, 4096);
+        serializer << a;
+    }
+
+    etl::dyn_matrix<Z, 3> b;
+
+    etl::deserializer<std::ifstream> deserializer("test_c1.tmp.etl", std::ios::binary);
+    deserializer >> b;
+
+    REQUIRE_DIRECT(!deserializer.stream.fail());
+    REQUIRE_EQUALS(etl::dim<0>(b), 7UL);
+    REQUIRE_EQUALS(etl::dim<1>(b), 33UL);
+    REQUIRE_EQUALS(etl::dim<2>(b), 129UL);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(b[i], a[i]);
+    }
+}
+
+TEST_CASE("serializer/compressed/2", "[serializer]") {
+    // Incompressible data is stored, the small blocks are compressed
+    etl::dyn_vector<double> a(100001);
+    etl::fast_matrix<float, 3, 4> b;
+
+    a = etl::uniform_generator(-1000.0, 1000.0);
+    b = etl::sequence_generator(1.0f);
+
+    std::string content;
+
+    {
+        etl::serializer<std::stringstream> serializer;
+        serializer.compress();
+        serializer << a << b;
+        content = serializer.stream.str();
+    }
+
+    etl::dyn_vector<double> c;
+    etl::fast_matrix<float, 3, 4> d;
+
+    etl::deserializer<std::stringstream> deserializer(content);
+    deserializer >> c >> d;
+
+    REQUIRE_DIRECT(!deserializer.stream.fail());
+    REQUIRE_EQUALS(etl::size(c), etl::size(a));
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(c[i], a[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(b); ++i) {
+        REQUIRE_EQUALS(d[i], b[i]);
+    }
+}
+
+TEST_CASE("serializer/compressed/3", "[serializer]") {
+    etl::dyn_matrix<float> a(500, 500);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = float(i % 100 == 0 ? i : 0);
+    }
+
+    std::string content;
+
+    {
+        etl::serializer<std::stringstream> serializer;
+        serializer.compress(etl::tensor_codec::SHUFFLE_LZ, 10000);
+        serializer << a;
+        content = serializer.stream.str();
+    }
+
+    REQUIRE_DIRECT(content.size() < etl::size(a) * sizeof(float) / 4);
+
+    etl::tensor_reader<std::stringstream> reader(content);
+
+    REQUIRE_DIRECT(reader.valid());
+    REQUIRE_EQUALS(reader.dimensions(), 2UL);
+    REQUIRE_EQUALS(reader.dim(0), 500UL);
+    REQUIRE_EQUALS(reader.size(), 250000UL);
+    REQUIRE_EQUALS(reader.blocks(), 100UL);
+
+    // Ranges inside one block and over several blocks
+    std::vector<float> values(30000);
+
+    REQUIRE_DIRECT(reader.read(12345, 10, values.data()));
+
+    for (size_t i = 0; i < 10; ++i) {
+        REQUIRE_EQUALS(values[i], a[12345 + i]);
+    }
+
+    REQUIRE_DIRECT(reader.read(2499 * 100 - 29999, 29999, values.data()));
+
+    for (size_t i = 0; i < 29999; ++i) {
+        REQUIRE_EQUALS(values[i], a[2499 * 100 - 29999 + i]);
+    }
+
+    REQUIRE_DIRECT(!reader.read(249990, 11, values.data()));
+
+    std::vector<double> wrong(10);
+    REQUIRE_DIRECT(!reader.read(0, 10, wrong.data()));
+}
+
+TEST_CASE("serializer/compressed/5", "[serializer]") {
+    etl::dyn_matrix<float> a(500, 500);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = float(i % 100 == 0 ? i : 0);
+    }
+
+    std::string content;
+
+    {
+        etl::serializer<std::stringstream> serializer;
+        serializer.compress(etl::tensor_codec::SHUFFLE_LZ, 10000);
+        serializer << a;
+        content = serializer.stream.str();
+    }
+
+    // The last block is truncated
+    etl::tensor_reader<std::stringstream> truncated(content.substr(0, content.size() - 1));
+
+    REQUIRE_DIRECT(!truncated.valid());
+
+    // The dimensions need more blocks than the stream can hold
+    std::string large = content;
+    const uint64_t dim = uint64_t(1) << 40;
+    std::memcpy(&large[40], &dim, sizeof(dim));
+
+    etl::tensor_reader<std::stringstream> reader(large);
+
+    REQUIRE_DIRECT(!reader.valid());
+    REQUIRE_EQUALS(reader.blocks(), 0UL);
+}
+
+TEST_CASE("serializer/compressed/4", "[serializer]") {
+    etl::dyn_matrix<float> a(100, 100);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = float(i % 10);
+    }
+
+    std::string content;
+
+    {
+        etl::serializer<std::stringstream> serializer;
+        serializer.compress(etl::tensor_codec::SHUFFLE_LZ, 4000);
+        serializer << a;
+        content = serializer.stream.str();
+    }
+
+    // Corrupt the content of the first block
+    content[64 + 4 + 3] ^= 0x5A;
+
+    etl::dyn_matrix<float> b;
+
+    etl::deserializer<std::stringstream> deserializer(content);
+    deserializer >> b;
+
+    REQUIRE_DIRECT(deserializer.stream.fail());
+}
+
+TEST_CASE("serializer/reuse/1", "[serializer]") {
+    etl::dyn_matrix<float> a(10, 20);
+    etl::dyn_matrix<float> b(10, 20);
+
+    a = etl::sequence_generator(1.0f);
+
+    {
+        etl::serializer<std::ofstream> serializer("test_r1.tmp.etl", std::ios::binary);
+        serializer << a;
+    }
+
+    auto* memory = b.memory_start();
+
+    etl::deserializer<std::ifstream> deserializer("test_r1.tmp.etl", std::ios::binary);
+    deserializer >> b;
+
+    REQUIRE_DIRECT(!deserializer.stream.fail());
+    REQUIRE_DIRECT(b.memory_start() == memory);
+    REQUIRE_EQUALS(b(9, 19), 200.0f);
+}
+
+TEMPLATE_TEST_CASE_2("dataset_reader/1", "[serializer]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(103, 4, 5);
+
+    a = etl::sequence_generator(Z(0.0));
+
+    {
+        etl::serializer<std::ofstream> serializer("test_d1.tmp.etl", std::ios::binary);
+        serializer << a;
+    }
+
+    etl::dataset_reader<Z> reader("test_d1.tmp.etl", std::ios::binary);
+
+    REQUIRE_DIRECT(reader.valid());
+    REQUIRE_EQUALS(reader.rows(), 103UL);
+    REQUIRE_EQUALS(reader.row_size(), 20UL);
+
+    etl::dyn_matrix<Z, 3> batch(10, 4, 5);
+
+    auto* memory = batch.memory_start();
+
+    size_t rows = 0;
+    size_t n;
+
+    while ((n = reader.next(batch))) {
+        for (size_t i = 0; i < n * 20; ++i) {
+            REQUIRE_EQUALS(batch[i], a[rows * 20 + i]);
+        }
+
+        rows += n;
+    }
+
+    REQUIRE_EQUALS(rows, 103UL);
+    REQUIRE_EQUALS(reader.remaining(), 0UL);
+    REQUIRE_DIRECT(batch.memory_start() == memory);
+
+    reader.seek(50);
+
+    REQUIRE_EQUALS(reader.next(batch), 10UL);
+    REQUIRE_EQUALS(batch(0, 0, 0), a(50, 0, 0));
+    REQUIRE_EQUALS(batch(9, 3, 4), a(59, 3, 4));
+}
+
+TEST_CASE("dataset_reader/2", "[serializer]") {
+    etl::dyn_matrix<float> a(1000, 33);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = float(i % 7);
+    }
+
+    {
+        etl::serializer<std::ofstream> serializer("test_d2.tmp.etl", std::ios::binary);
+        serializer.compress(etl::tensor_codec::SHUFFLE_LZ, 1024);
+        serializer << a;
+    }
+
+    etl::dataset_reader<float> reader("test_d2.tmp.etl", std::ios::binary);
+
+    REQUIRE_DIRECT(reader.valid());
+
+    // Read into the sub views of a larger batch
+    etl::dyn_matrix<float, 3> batches(2, 64, 33);
+
+    for (size_t b = 0; b < 10; ++b) {
+        auto batch = etl::sub(batches, b % 2);
+
+        REQUIRE_EQUALS(reader.next(batch), 64UL);
+
+        for (size_t i = 0; i < 64; ++i) {
+            for (size_t j = 0; j < 33; ++j) {
+                REQUIRE_EQUALS(batches(b % 2, i, j), a(b * 64 + i, j));
+            }
+        }
+    }
+
+    reader.prefetch(false);
+
+    etl::dyn_matrix<float> batch(100, 33);
+
+    REQUIRE_EQUALS(reader.read(950, batch), 50UL);
+    REQUIRE_EQUALS(batch(49, 32), a(999, 32));
+    REQUIRE_EQUALS(reader.position(), 640UL);
+
+    etl::dataset_reader<double> wrong("test_d2.tmp.etl", std::ios::binary);
+
+    REQUIRE_DIRECT(!wrong.valid());
+}
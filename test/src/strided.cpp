@@ -0,0 +1,236 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("strided/0", "[strided]", Z, double, float) {
+    etl::dyn_vector<Z> a(11);
+    a = etl::sequence_generator<Z>(0);
+
+    auto a_0 = etl::strided(a, 1, 11, 3);
+
+    REQUIRE_EQUALS(etl::size(a_0), 4UL);
+    REQUIRE_EQUALS(etl::dimensions(a_0), 1UL);
+    REQUIRE_EQUALS(etl::dim<0>(a_0), 4UL);
+    REQUIRE_DIRECT(!etl::is_dma<decltype(a_0)>::value);
+
+    REQUIRE_EQUALS(a_0[0], Z(1));
+    REQUIRE_EQUALS(a_0[1], Z(4));
+    REQUIRE_EQUALS(a_0[2], Z(7));
+    REQUIRE_EQUALS(a_0[3], Z(10));
+
+    REQUIRE_EQUALS(a_0(0), Z(1));
+    REQUIRE_EQUALS(a_0(3), Z(10));
+
+    auto a_1 = etl::strided(a_0, 1, 4, 2);
+
+    REQUIRE_DIRECT((std::is_same<decltype(a_0), decltype(a_1)>::value));
+    REQUIRE_EQUALS(etl::size(a_1), 2UL);
+    REQUIRE_EQUALS(a_1[0], Z(4));
+    REQUIRE_EQUALS(a_1[1], Z(10));
+
+    a_0 = Z(-1);
+
+    REQUIRE_EQUALS(a[0], Z(0));
+    REQUIRE_EQUALS(a[1], Z(-1));
+    REQUIRE_EQUALS(a[2], Z(2));
+    REQUIRE_EQUALS(a[4], Z(-1));
+    REQUIRE_EQUALS(a[10], Z(-1));
+}
+
+TEMPLATE_TEST_CASE_2("strided/1", "[strided]", Z, double, float) {
+    etl::dyn_matrix<Z> a(7, 19);
+    a = etl::sequence_generator<Z>(0);
+
+    auto rows = etl::strided(a, 0, 7, 2);
+
+    REQUIRE_EQUALS(etl::dim<0>(rows), 4UL);
+    REQUIRE_EQUALS(etl::dim<1>(rows), 19UL);
+
+    etl::dyn_matrix<Z> b;
+    b = rows;
+
+    REQUIRE_EQUALS(etl::dim<0>(b), 4UL);
+    REQUIRE_EQUALS(etl::dim<1>(b), 19UL);
+
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 19; ++j) {
+            REQUIRE_EQUALS(b(i, j), a(2 * i, j));
+            REQUIRE_EQUALS(rows(i, j), a(2 * i, j));
+        }
+    }
+
+    etl::dyn_matrix<Z> c(4, 19);
+    c = Z(2) * rows + rows;
+
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 19; ++j) {
+            REQUIRE_EQUALS(c(i, j), Z(3) * a(2 * i, j));
+        }
+    }
+
+    REQUIRE_EQUALS(rows(1)[3], a(2, 3));
+}
+
+TEMPLATE_TEST_CASE_2("strided/2", "[strided]", Z, double, float) {
+    etl::dyn_matrix<Z> a(9, 17);
+    a = etl::sequence_generator<Z>(0);
+
+    auto cols = etl::strided<1>(a, 1, 17, 3);
+
+    REQUIRE_EQUALS(etl::dim<0>(cols), 9UL);
+    REQUIRE_EQUALS(etl::dim<1>(cols), 6UL);
+
+    etl::dyn_matrix<Z> b(9, 6);
+    b = cols + cols;
+
+    for (size_t i = 0; i < 9; ++i) {
+        for (size_t j = 0; j < 6; ++j) {
+            REQUIRE_EQUALS(b(i, j), Z(2) * a(i, 1 + 3 * j));
+            REQUIRE_EQUALS(cols(i, j), a(i, 1 + 3 * j));
+        }
+    }
+
+    REQUIRE_EQUALS(etl::sum(cols), etl::sum(b) / Z(2));
+}
+
+TEMPLATE_TEST_CASE_2("strided/3", "[strided]", Z, double, float) {
+    etl::dyn_matrix<Z> a(16, 16);
+    a = etl::sequence_generator<Z>(0);
+
+    // Downsampling by two in each dimension
+    auto down = etl::strided<1>(etl::strided(a, 0, 16, 2), 0, 16, 2);
+
+    REQUIRE_EQUALS(etl::dim<0>(down), 8UL);
+    REQUIRE_EQUALS(etl::dim<1>(down), 8UL);
+
+    etl::fast_matrix<Z, 8, 8> b;
+    b = down;
+
+    for (size_t i = 0; i < 8; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            REQUIRE_EQUALS(b(i, j), a(2 * i, 2 * j));
+        }
+    }
+
+    down = Z(0);
+
+    REQUIRE_EQUALS(a(0, 0), Z(0));
+    REQUIRE_EQUALS(a(0, 1), Z(1));
+    REQUIRE_EQUALS(a(2, 2), Z(0));
+    REQUIRE_EQUALS(a(2, 3), Z(35));
+    REQUIRE_EQUALS(etl::sum(down), Z(0));
+}
+
+TEMPLATE_TEST_CASE_2("strided/4", "[strided]", Z, double, float) {
+    etl::dyn_matrix<Z, 3> a(5, 3, 10);
+    a = etl::sequence_generator<Z>(0);
+
+    auto s = etl::strided<1>(a, 0, 3, 2);
+
+    REQUIRE_EQUALS(etl::dim<0>(s), 5UL);
+    REQUIRE_EQUALS(etl::dim<1>(s), 2UL);
+    REQUIRE_EQUALS(etl::dim<2>(s), 10UL);
+
+    etl::dyn_matrix<Z, 3> b(5, 2, 10);
+    b = s * Z(2);
+
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 2; ++j) {
+            for (size_t k = 0; k < 10; ++k) {
+                REQUIRE_EQUALS(b(i, j, k), Z(2) * a(i, 2 * j, k));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("strided/cm", "[strided]", Z, double, float) {
+    etl::dyn_matrix_cm<Z> a(6, 5);
+    a = etl::sequence_generator<Z>(0);
+
+    auto s = etl::strided<1>(a, 0, 5, 2);
+
+    etl::dyn_matrix_cm<Z> b(6, 3);
+    b = s + s;
+
+    for (size_t i = 0; i < 6; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            REQUIRE_EQUALS(b(i, j), Z(2) * a(i, 2 * j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("strided/5", "[strided]", Z, double, float) {
+    etl::dyn_matrix<Z> a(7, 37);
+    a = etl::sequence_generator<Z>(1);
+
+    // Every other column, the vectors of the last row end with the matrix
+    auto even = etl::strided<1>(a, 1, 37, 2);
+    auto odd  = etl::strided<1>(a, 0, 37, 3);
+
+    etl::dyn_matrix<Z> b(7, 18);
+    etl::dyn_matrix<Z> c(7, 13);
+
+    b = even + even;
+    c = odd * Z(3);
+
+    for (size_t i = 0; i < 7; ++i) {
+        for (size_t j = 0; j < 18; ++j) {
+            REQUIRE_EQUALS(b(i, j), Z(2) * a(i, 1 + 2 * j));
+        }
+
+        for (size_t j = 0; j < 13; ++j) {
+            REQUIRE_EQUALS(c(i, j), Z(3) * a(i, 3 * j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("strided/6", "[strided]", Z, double, float) {
+    etl::dyn_matrix<Z> a(5, 41);
+    etl::dyn_matrix<Z> b(5, 41);
+
+    a = etl::sequence_generator<Z>(1);
+    b = etl::sequence_generator<Z>(3);
+
+    // The sub expression has no direct memory access
+    etl::dyn_matrix<Z> c(5, 21);
+    etl::dyn_matrix<Z> d(5, 10);
+
+    c = etl::strided<1>(a + b, 0, 41, 2);
+    d = etl::strided<1>(a - b * Z(2), 2, 41, 4);
+
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 21; ++j) {
+            REQUIRE_EQUALS(c(i, j), a(i, 2 * j) + b(i, 2 * j));
+        }
+
+        for (size_t j = 0; j < 10; ++j) {
+            REQUIRE_EQUALS(d(i, j), a(i, 2 + 4 * j) - Z(2) * b(i, 2 + 4 * j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("strided/7", "[strided]", Z, int, long) {
+    etl::dyn_matrix<Z> a(6, 50);
+    a = etl::sequence_generator<Z>(0);
+
+    etl::dyn_matrix<Z> b(6, 25);
+    etl::dyn_matrix<Z> c(6, 10);
+
+    b = etl::strided<1>(a, 0, 50, 2) + Z(1);
+    c = etl::strided<1>(a, 3, 50, 5) + Z(1);
+
+    for (size_t i = 0; i < 6; ++i) {
+        for (size_t j = 0; j < 25; ++j) {
+            REQUIRE_EQUALS(b(i, j), a(i, 2 * j) + Z(1));
+        }
+
+        for (size_t j = 0; j < 10; ++j) {
+            REQUIRE_EQUALS(c(i, j), a(i, 3 + 5 * j) + Z(1));
+        }
+    }
+}
@@ -0,0 +1,164 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+#include "structured_test.hpp"
+
+namespace {
+
+/*!
+ * \brief Compare the products with the structured matrix a to the products
+ * with its dense copy ad, on both sides.
+ */
+template <typename A, typename M>
+void check_structured_gemm(A& a, const M& ad) {
+    using Z = etl::value_t<A>;
+
+    const size_t n = etl::dim<0>(ad);
+    const size_t k = 70;
+
+    etl::dyn_matrix<Z> b(n, k);
+    etl::dyn_matrix<Z> bt(k, n);
+
+    fill_small(b);
+    fill_small(bt);
+
+    etl::dyn_matrix<Z> ref;
+    etl::dyn_matrix<Z> c;
+
+    ref = ad * b;
+    c   = a * b;
+
+    REQUIRE_EQUALS(etl::dim<0>(c), n);
+    REQUIRE_EQUALS(etl::dim<1>(c), k);
+
+    for (size_t i = 0; i < n * k; ++i) {
+        REQUIRE_EQUALS(c[i], ref[i]);
+    }
+
+    etl::dyn_matrix<Z> ref_t;
+    etl::dyn_matrix<Z> c_t;
+
+    ref_t = bt * ad;
+    c_t   = etl::mul(bt, a);
+
+    REQUIRE_EQUALS(etl::dim<0>(c_t), k);
+    REQUIRE_EQUALS(etl::dim<1>(c_t), n);
+
+    for (size_t i = 0; i < n * k; ++i) {
+        REQUIRE_EQUALS(c_t[i], ref_t[i]);
+    }
+
+    c   = 0;
+    c_t = 0;
+
+    PARALLEL_SECTION {
+        c   = a * b;
+        c_t = etl::mul(bt, a);
+    }
+
+    for (size_t i = 0; i < n * k; ++i) {
+        REQUIRE_EQUALS(c[i], ref[i]);
+        REQUIRE_EQUALS(c_t[i], ref_t[i]);
+    }
+}
+
+} // end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("structured_gemm/diagonal", "[gemm][diagonal]", Z, float, double) {
+    etl::dyn_matrix<Z> ad(37, 37);
+    fill_band(ad, [](size_t i, size_t j) { return i == j; }, false);
+
+    etl::diagonal_matrix<etl::dyn_matrix<Z>> a(37UL);
+    a = ad;
+
+    check_structured_gemm(a, ad);
+}
+
+TEMPLATE_TEST_CASE_2("structured_gemm/lower", "[gemm][lower]", Z, float, double) {
+    etl::dyn_matrix<Z> ad(37, 37);
+    fill_band(ad, [](size_t i, size_t j) { return j <= i; }, false);
+
+    etl::lower_matrix<etl::dyn_matrix<Z>> a(37UL);
+    a = ad;
+
+    check_structured_gemm(a, ad);
+}
+
+TEMPLATE_TEST_CASE_2("structured_gemm/strictly_lower", "[gemm][lower]", Z, float, double) {
+    etl::dyn_matrix<Z> ad(37, 37);
+    fill_band(ad, [](size_t i, size_t j) { return j < i; }, false);
+
+    etl::strictly_lower_matrix<etl::dyn_matrix<Z>> a(37UL);
+    a = ad;
+
+    check_structured_gemm(a, ad);
+}
+
+TEMPLATE_TEST_CASE_2("structured_gemm/uni_lower", "[gemm][lower]", Z, float, double) {
+    etl::dyn_matrix<Z> ad(37, 37);
+    fill_band(ad, [](size_t i, size_t j) { return j <= i; }, true);
+
+    etl::uni_lower_matrix<etl::dyn_matrix<Z>> a(37UL);
+    a = ad;
+
+    check_structured_gemm(a, ad);
+}
+
+TEMPLATE_TEST_CASE_2("structured_gemm/upper", "[gemm][upper]", Z, float, double) {
+    etl::dyn_matrix<Z> ad(37, 37);
+    fill_band(ad, [](size_t i, size_t j) { return j >= i; }, false);
+
+    etl::upper_matrix<etl::dyn_matrix<Z>> a(37UL);
+    a = ad;
+
+    check_structured_gemm(a, ad);
+}
+
+TEMPLATE_TEST_CASE_2("structured_gemm/strictly_upper", "[gemm][upper]", Z, float, double) {
+    etl::dyn_matrix<Z> ad(37, 37);
+    fill_band(ad, [](size_t i, size_t j) { return j > i; }, false);
+
+    etl::strictly_upper_matrix<etl::dyn_matrix<Z>> a(37UL);
+    a = ad;
+
+    check_structured_gemm(a, ad);
+}
+
+TEMPLATE_TEST_CASE_2("structured_gemm/uni_upper", "[gemm][upper]", Z, float, double) {
+    etl::dyn_matrix<Z> ad(37, 37);
+    fill_band(ad, [](size_t i, size_t j) { return j >= i; }, true);
+
+    etl::uni_upper_matrix<etl::dyn_matrix<Z>> a(37UL);
+    a = ad;
+
+    check_structured_gemm(a, ad);
+}
+
+TEMPLATE_TEST_CASE_2("structured_gemm/fast", "[gemm][lower][fast]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> ad = {1.0, 0.0, 0.0, 2.0, 3.0, 0.0, 4.0, 5.0, 6.0};
+    etl::fast_matrix<Z, 3, 2> b  = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+    etl::lower_matrix<etl::fast_matrix<Z, 3, 3>> a;
+    a = ad;
+
+    etl::fast_matrix<Z, 3, 2> c;
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0, 0), Z(1.0));
+    REQUIRE_EQUALS(c(0, 1), Z(2.0));
+    REQUIRE_EQUALS(c(1, 0), Z(11.0));
+    REQUIRE_EQUALS(c(1, 1), Z(16.0));
+    REQUIRE_EQUALS(c(2, 0), Z(49.0));
+    REQUIRE_EQUALS(c(2, 1), Z(64.0));
+
+    // The structured matrix can also be part of a larger expression
+    c = Z(2.0) * (a * b) + b;
+
+    REQUIRE_EQUALS(c(0, 0), Z(3.0));
+    REQUIRE_EQUALS(c(2, 1), Z(134.0));
+}
@@ -141,6 +141,40 @@ TEMPLATE_TEST_CASE_2("sub_matrix_2d/4", "[sub]", Z, double, float) {
     REQUIRE_EQUALS(a(3, 3), 16);
 }
 
+TEMPLATE_TEST_CASE_2("sub_matrix_2d/5", "[sub]", Z, double, float) {
+    etl::dyn_matrix<Z> a(9, 11);
+    etl::dyn_matrix<Z> b(5, 7);
+    etl::dyn_matrix<Z> c(5, 7);
+
+    a = etl::sequence_generator(1.0);
+    b = etl::sequence_generator(-3.0);
+
+    c = Z(2) * sub(a, 2, 3, 5, 7) + b;
+
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 7; ++j) {
+            REQUIRE_EQUALS(c(i, j), Z(2) * a(2 + i, 3 + j) + b(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sub_matrix_2d/6", "[sub]", Z, double, float) {
+    etl::dyn_matrix<Z> a(9, 13);
+    etl::dyn_matrix<Z> b(5, 9);
+    etl::dyn_matrix<Z> c(5, 9);
+
+    a = etl::sequence_generator(1.0);
+    b = etl::sequence_generator(-3.0);
+
+    c = Z(2) * sub(a, 2, 3, 5, 9) + b;
+
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 9; ++j) {
+            REQUIRE_EQUALS(c(i, j), Z(2) * a(2 + i, 3 + j) + b(i, j));
+        }
+    }
+}
+
 TEMPLATE_TEST_CASE_2("sub_matrix_2d/cm/0", "[sub]", Z, double, float) {
     etl::fast_matrix_cm<Z, 3, 3> a = {1, 4, 7, 2, 5, 8, 3, 6, 9};
 
@@ -6,6 +6,7 @@
 //=======================================================================
 
 #include "test_light.hpp"
+#include "structured_test.hpp"
 
 TEMPLATE_TEST_CASE_2("sym/fast_matrix/1", "[sym][fast]", Z, float, double) {
     etl::symmetric_matrix<etl::fast_matrix<Z, 2,2>> a;
@@ -196,3 +197,34 @@ TEMPLATE_TEST_CASE_2("sym/fast_matrix/8", "[sym][fast]", Z, float, double) {
     REQUIRE_EQUALS(c(2, 1), 3.0);
     REQUIRE_EQUALS(c(2, 2), 2.0);
 }
+
+TEMPLATE_TEST_CASE_2("sym/dyn_matrix/eval", "[sym]", Z, float, double) {
+    etl::dyn_matrix<Z> a(5, 5);
+
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            a(i, j) = Z(i + j);
+        }
+    }
+
+    etl::symmetric_matrix<etl::dyn_matrix<Z>> s(5UL);
+
+    // The expression is evaluated only once to be validated and assigned
+    s = counting(a);
+
+    REQUIRE_EQUALS(counting_unary_op<Z>::count(), 25UL);
+    REQUIRE_EQUALS(s(1, 3), Z(4));
+    REQUIRE_EQUALS(s(3, 1), Z(4));
+
+    a(0, 4) = Z(42);
+
+    REQUIRE_THROWS(s = counting(a));
+    REQUIRE_EQUALS(counting_unary_op<Z>::count(), 25UL);
+    REQUIRE_EQUALS(s(0, 4), Z(4));
+
+    // The elements can only be iterated in read-only
+    static_assert(std::is_same<decltype(s.begin()), const Z*>::value, "Invalid iterator for symmetric_matrix");
+
+    REQUIRE_EQUALS(std::accumulate(s.begin(), s.end(), Z(0)), Z(100));
+    REQUIRE_EQUALS(size_t(s.end() - s.begin()), 25UL);
+}
@@ -0,0 +1,140 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+#include <vector>
+#include <random>
+
+namespace {
+
+/*!
+ * \brief Reference top-k of a row, with partial_sort on (value, index) pairs
+ */
+template <typename T>
+std::vector<std::pair<T, size_t>> reference_topk(const std::vector<T>& row, size_t k) {
+    std::vector<std::pair<T, size_t>> pairs(row.size());
+
+    for (size_t j = 0; j < row.size(); ++j) {
+        pairs[j] = std::make_pair(row[j], j);
+    }
+
+    std::partial_sort(pairs.begin(), pairs.begin() + k, pairs.end(), [](const std::pair<T, size_t>& lhs, const std::pair<T, size_t>& rhs) {
+        return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+    });
+
+    pairs.resize(k);
+
+    return pairs;
+}
+
+} //end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("topk/1", "[topk]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 6> a({1.0, 5.0, 3.0, 7.0, 2.0, 6.0,
+                                 9.0, -1.0, 4.0, 4.0, 8.0, 0.0});
+
+    etl::fast_matrix<Z, 2, 3> values;
+    etl::fast_matrix<size_t, 2, 3> indices;
+
+    etl::topk(a, 3, values, indices);
+
+    REQUIRE_EQUALS(values(0, 0), Z(7.0));
+    REQUIRE_EQUALS(values(0, 1), Z(6.0));
+    REQUIRE_EQUALS(values(0, 2), Z(5.0));
+
+    REQUIRE_EQUALS(indices(0, 0), 3UL);
+    REQUIRE_EQUALS(indices(0, 1), 5UL);
+    REQUIRE_EQUALS(indices(0, 2), 1UL);
+
+    // Ties are broken by index
+    REQUIRE_EQUALS(values(1, 0), Z(9.0));
+    REQUIRE_EQUALS(values(1, 1), Z(8.0));
+    REQUIRE_EQUALS(values(1, 2), Z(4.0));
+
+    REQUIRE_EQUALS(indices(1, 0), 0UL);
+    REQUIRE_EQUALS(indices(1, 1), 4UL);
+    REQUIRE_EQUALS(indices(1, 2), 2UL);
+}
+
+TEMPLATE_TEST_CASE_2("topk/2", "[topk]", Z, float, double) {
+    etl::dyn_matrix<Z> a(3, 4, etl::values(1.0, 2.0, 3.0, 4.0, 4.0, 3.0, 2.0, 1.0, 2.0, 2.0, 2.0, 2.0));
+    etl::dyn_matrix<Z> b(3, 4, 1.0);
+
+    auto result = etl::topk(a + b, 2);
+
+    REQUIRE_EQUALS(etl::dim<0>(result.first), 3UL);
+    REQUIRE_EQUALS(etl::dim<1>(result.first), 2UL);
+
+    REQUIRE_EQUALS(result.first(0, 0), Z(5.0));
+    REQUIRE_EQUALS(result.first(0, 1), Z(4.0));
+    REQUIRE_EQUALS(result.first(1, 0), Z(5.0));
+    REQUIRE_EQUALS(result.first(1, 1), Z(4.0));
+    REQUIRE_EQUALS(result.first(2, 0), Z(3.0));
+    REQUIRE_EQUALS(result.first(2, 1), Z(3.0));
+
+    REQUIRE_EQUALS(result.second(0, 0), 3UL);
+    REQUIRE_EQUALS(result.second(0, 1), 2UL);
+    REQUIRE_EQUALS(result.second(1, 0), 0UL);
+    REQUIRE_EQUALS(result.second(1, 1), 1UL);
+    REQUIRE_EQUALS(result.second(2, 0), 0UL);
+    REQUIRE_EQUALS(result.second(2, 1), 1UL);
+}
+
+TEMPLATE_TEST_CASE_2("topk/3", "[topk]", Z, float, double) {
+    etl::dyn_matrix_cm<Z> a(2, 5);
+
+    a(0, 0) = 3.0; a(0, 1) = 1.0; a(0, 2) = 4.0; a(0, 3) = 1.0; a(0, 4) = 5.0;
+    a(1, 0) = 9.0; a(1, 1) = 2.0; a(1, 2) = 6.0; a(1, 3) = 5.0; a(1, 4) = 3.0;
+
+    etl::dyn_matrix<Z> values(2, 2);
+    etl::dyn_matrix<size_t> indices(2, 2);
+
+    etl::topk(a, 2, values, indices);
+
+    REQUIRE_EQUALS(values(0, 0), Z(5.0));
+    REQUIRE_EQUALS(values(0, 1), Z(4.0));
+    REQUIRE_EQUALS(values(1, 0), Z(9.0));
+    REQUIRE_EQUALS(values(1, 1), Z(6.0));
+
+    REQUIRE_EQUALS(indices(0, 0), 4UL);
+    REQUIRE_EQUALS(indices(0, 1), 2UL);
+    REQUIRE_EQUALS(indices(1, 0), 0UL);
+    REQUIRE_EQUALS(indices(1, 1), 2UL);
+}
+
+TEMPLATE_TEST_CASE_2("topk/4", "[topk]", Z, float, double) {
+    const size_t N = 64;
+    const size_t M = 5003;
+    const size_t K = 37;
+
+    etl::dyn_matrix<Z> a(N, M);
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(-1000, 1000);
+
+    // Integer values to have many ties
+    for (auto& value : a) {
+        value = distribution(generator);
+    }
+
+    etl::dyn_matrix<Z> values(N, K);
+    etl::dyn_matrix<size_t> indices(N, K);
+
+    etl::topk(a, K, values, indices);
+
+    for (size_t i = 0; i < N; ++i) {
+        std::vector<Z> row(a(i).begin(), a(i).end());
+
+        auto ref = reference_topk(row, K);
+
+        for (size_t j = 0; j < K; ++j) {
+            REQUIRE_EQUALS(values(i, j), ref[j].first);
+            REQUIRE_EQUALS(indices(i, j), ref[j].second);
+        }
+    }
+}
@@ -0,0 +1,108 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+#include <sstream>
+#include <thread>
+
+TEST_CASE("trace/1", "[trace]") {
+    etl::reset_trace();
+
+    std::vector<size_t> values(1000, 0);
+
+    {
+        etl::detail::trace_site site("trace_test");
+
+        PARALLEL_SECTION {
+            etl::engine_dispatch_1d([&values](size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    values[i] = i;
+                }
+            }, 0, values.size(), true);
+        }
+    }
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        REQUIRE_EQUALS(values[i], i);
+    }
+
+    auto records = etl::trace_records();
+
+#ifdef ETL_TRACE
+    if (etl::parallel_support && etl::threads > 1) {
+        size_t tasks = 0;
+        size_t range = 0;
+        size_t waits = 0;
+
+        for (auto& record : records) {
+            REQUIRE_EQUALS(record.site, "trace_test");
+            REQUIRE_DIRECT(record.begin_ns <= record.end_ns);
+
+            if (record.name == "task") {
+                ++tasks;
+                range += record.range;
+            } else if (record.name == "wait") {
+                ++waits;
+            }
+        }
+
+        REQUIRE_EQUALS(tasks, std::min(values.size(), etl::threads));
+        REQUIRE_EQUALS(range, values.size());
+        REQUIRE_EQUALS(waits, 1UL);
+
+        std::ostringstream os;
+        etl::dump_trace(os);
+
+        REQUIRE_DIRECT(os.str().find("{\"traceEvents\": [") == 0);
+        REQUIRE_DIRECT(os.str().find("\"name\": \"trace_test\", \"cat\": \"task\", \"ph\": \"X\"") != std::string::npos);
+        REQUIRE_DIRECT(os.str().find("\"ph\": \"M\"") != std::string::npos);
+    }
+
+    etl::reset_trace();
+
+    REQUIRE_DIRECT(etl::trace_records().empty());
+#else
+    REQUIRE_DIRECT(records.empty());
+#endif
+}
+
+#ifdef ETL_TRACE
+
+TEST_CASE("trace/reset", "[trace]") {
+    etl::reset_trace();
+
+    auto& buffer = etl::detail::local_trace_buffer();
+
+    for (size_t i = 0; i < 3 * etl::detail::trace_chunk_size; ++i) {
+        buffer.push({"wait", "trace_reset", i, i + 1, 0});
+    }
+
+    REQUIRE_EQUALS(etl::trace_records().size(), 3 * etl::detail::trace_chunk_size);
+    REQUIRE_DIRECT(buffer.head.next.load());
+
+    etl::reset_trace();
+
+    REQUIRE_DIRECT(etl::trace_records().empty());
+
+    // The chunks are released before the next event of the thread
+    etl::detail::local_trace_buffer().push({"wait", "trace_reset", 0, 1, 0});
+
+    REQUIRE_DIRECT(!buffer.head.next.load());
+    REQUIRE_EQUALS(etl::trace_records().size(), 1UL);
+
+    // The buffer of a terminated thread is released by the reset
+    std::thread([] { etl::detail::local_trace_buffer().push({"wait", "trace_thread", 0, 1, 0}); }).join();
+
+    REQUIRE_EQUALS(etl::trace_records().size(), 2UL);
+
+    etl::reset_trace();
+
+    REQUIRE_DIRECT(etl::trace_records().empty());
+}
+
+#endif
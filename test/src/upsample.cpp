@@ -178,3 +178,47 @@ TEMPLATE_TEST_CASE_2("upsample/deep/3d/1", "[pooling]", Z, float, double) {
     REQUIRE_EQUALS(c(1, 0, 3, 2), 8.0);
     REQUIRE_EQUALS(c(1, 0, 3, 3), 8.0);
 }
+
+TEMPLATE_TEST_CASE_2("upsample/bilinear/1", "[upsample]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 3> a({1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    etl::fast_matrix<Z, 4, 6> c;
+
+    c = etl::upsample_2d_bilinear<2, 2>(a);
+
+    REQUIRE_EQUALS_APPROX(c(0, 0), Z(1.0));
+    REQUIRE_EQUALS_APPROX(c(0, 1), Z(1.25));
+    REQUIRE_EQUALS_APPROX(c(0, 2), Z(1.75));
+    REQUIRE_EQUALS_APPROX(c(0, 3), Z(2.25));
+    REQUIRE_EQUALS_APPROX(c(0, 4), Z(2.75));
+    REQUIRE_EQUALS_APPROX(c(0, 5), Z(3.0));
+
+    REQUIRE_EQUALS_APPROX(c(1, 0), Z(1.75));
+    REQUIRE_EQUALS_APPROX(c(1, 5), Z(3.75));
+
+    REQUIRE_EQUALS_APPROX(c(2, 0), Z(3.25));
+    REQUIRE_EQUALS_APPROX(c(2, 5), Z(5.25));
+
+    REQUIRE_EQUALS_APPROX(c(3, 0), Z(4.0));
+    REQUIRE_EQUALS_APPROX(c(3, 1), Z(4.25));
+    REQUIRE_EQUALS_APPROX(c(3, 4), Z(5.75));
+    REQUIRE_EQUALS_APPROX(c(3, 5), Z(6.0));
+}
+
+TEMPLATE_TEST_CASE_2("upsample/deep/2d/2", "[pooling]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 4, 9, 11> a;
+    etl::fast_matrix<Z, 3, 4, 18, 22> c;
+
+    a = etl::sequence_generator(Z(1.0));
+
+    c = etl::upsample_2d<2, 2>(a);
+
+    for (size_t n = 0; n < 3; ++n) {
+        for (size_t k = 0; k < 4; ++k) {
+            for (size_t i = 0; i < 18; ++i) {
+                for (size_t j = 0; j < 22; ++j) {
+                    REQUIRE_EQUALS(c(n, k, i, j), a(n, k, i / 2, j / 2));
+                }
+            }
+        }
+    }
+}
@@ -155,6 +155,25 @@ TEMPLATE_TEST_CASE_2("dim/mix", "dim", Z, float, double) {
     REQUIRE_EQUALS_APPROX(c[2], -0.03);
 }
 
+TEMPLATE_TEST_CASE_2("dim/expr", "dim", Z, float, double) {
+    etl::dyn_matrix<Z> a(9, 11);
+    etl::dyn_vector<Z> b(11);
+    etl::dyn_vector<Z> c(9);
+
+    a = etl::sequence_generator(1.0);
+
+    b = row(a, 4) + row(a, 2);
+    c = col(a, 4) + col(a, 2);
+
+    for (size_t j = 0; j < 11; ++j) {
+        REQUIRE_EQUALS(b[j], a(4, j) + a(2, j));
+    }
+
+    for (size_t i = 0; i < 9; ++i) {
+        REQUIRE_EQUALS(c[i], a(i, 4) + a(i, 2));
+    }
+}
+
 // reshape
 
 TEMPLATE_TEST_CASE_2("reshape/fast_vector_1", "reshape<2,2>", Z, float, double) {
@@ -149,3 +149,19 @@ TEMPLATE_TEST_CASE_2("fast_magic/dyn_matrix_4", "fast_magic(4)", Z, float, doubl
     REQUIRE_EQUALS(m(2, 2), 16);
     REQUIRE_EQUALS(m(2, 3), 2);
 }
+
+TEMPLATE_TEST_CASE_2("magic/expr", "magic", Z, float, double) {
+    etl::dyn_matrix<Z> a(7, 7);
+    etl::dyn_matrix<Z> b(7, 7);
+
+    a = etl::magic<Z>(7);
+    b = etl::magic<Z>(7) + a;
+
+    for (size_t i = 0; i < 7; ++i) {
+        for (size_t j = 0; j < 7; ++j) {
+            REQUIRE_EQUALS(b(i, j), Z(2) * a(i, j));
+        }
+    }
+
+    REQUIRE_EQUALS(etl::sum(etl::magic<Z>(7)), Z(7 * (7 * 7 + 1) / 2 * 7));
+}